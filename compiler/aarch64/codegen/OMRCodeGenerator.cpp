@@ -820,7 +820,7 @@ TR::Instruction *OMR::ARM64::CodeGenerator::generateDebugCounterBump(TR::Instruc
         return cursor;
     }
 
-    intptr_t addr = counter->getBumpCountAddress();
+    intptr_t addr = counter->getBumpCountAddress(comp());
 
     TR_ASSERT_FATAL(addr, "Expecting a non-null debug counter address");
 
@@ -849,7 +849,7 @@ TR::Instruction *OMR::ARM64::CodeGenerator::generateDebugCounterBump(TR::Instruc
     TR::DebugCounterBase *counter, TR::Register *deltaReg, TR::RegisterDependencyConditions *cond)
 {
     TR::Node *node = cursor->getNode();
-    intptr_t addr = counter->getBumpCountAddress();
+    intptr_t addr = counter->getBumpCountAddress(comp());
 
     TR_ASSERT_FATAL(addr, "Expecting a non-null debug counter address");
 
@@ -886,7 +886,7 @@ TR::Instruction *OMR::ARM64::CodeGenerator::generateDebugCounterBump(TR::Instruc
         return cursor;
     }
 
-    intptr_t addr = counter->getBumpCountAddress();
+    intptr_t addr = counter->getBumpCountAddress(comp());
 
     TR_ASSERT_FATAL(addr, "Expecting a non-null debug counter address");
 
@@ -911,7 +911,7 @@ TR::Instruction *OMR::ARM64::CodeGenerator::generateDebugCounterBump(TR::Instruc
     TR::DebugCounterBase *counter, TR::Register *deltaReg, TR_ScratchRegisterManager &srm)
 {
     TR::Node *node = cursor->getNode();
-    intptr_t addr = counter->getBumpCountAddress();
+    intptr_t addr = counter->getBumpCountAddress(comp());
 
     TR_ASSERT_FATAL(addr, "Expecting a non-null debug counter address");
 
@@ -295,7 +295,7 @@ void OMR::CodeGenPhase::performBinaryEncodingPhase(TR::CodeGenerator *cg, TR::Co
     cg->postBinaryEncodingHook();
 
     // Instructions have been emitted, and now we know what the entry point is, so update the compilation method symbol
-    comp->getMethodSymbol()->setMethodAddress(cg->getCodeStart());
+    comp->getMethodSymbol()->setMethodAddress(cg->toExecutableAddress(cg->getCodeStart()));
 
     if (debug("verifyFinalNodeReferenceCounts")) {
         if (cg->getDebug())
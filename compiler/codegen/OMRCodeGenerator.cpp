@@ -1106,6 +1106,11 @@ uint8_t *OMR::CodeGenerator::getCodeStart()
     return _binaryBufferStart + self()->getPrePrologueSize() + _jitMethodEntryPaddingSize;
 }
 
+uint8_t *OMR::CodeGenerator::toExecutableAddress(uint8_t *address)
+{
+    return TR::CodeCacheManager::instance()->executableAddress(address);
+}
+
 uint32_t OMR::CodeGenerator::getCodeLength() // cast explicitly
 {
     return (uint32_t)(self()->getCodeEnd() - self()->getCodeStart());
@@ -1645,8 +1650,15 @@ uint8_t *OMR::CodeGenerator::allocateCodeMemoryInner(uint32_t warmCodeSizeInByte
 
     TR_ASSERT(codeCache->isReserved(), "Code cache should have been reserved.");
 
-    uint8_t *warmCode = TR::CodeCacheManager::instance()->allocateCodeMemory(warmCodeSizeInBytes, coldCodeSizeInBytes,
-        &codeCache, coldCode, false, isMethodHeaderNeeded);
+    TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+    uint8_t *warmCode = manager->allocateCodeMemory(warmCodeSizeInBytes, coldCodeSizeInBytes, &codeCache, coldCode,
+        false, isMethodHeaderNeeded);
+
+    // Code is generated through the writable view of a dual-mapped code cache
+    if (warmCode) {
+        warmCode = manager->writableAddress(warmCode);
+        *coldCode = manager->writableAddress(*coldCode);
+    }
 
     if (codeCache != self()->getCodeCache()) {
         // Either we didn't get a code cache, or the one we got should be reserved
@@ -1701,6 +1713,7 @@ void OMR::CodeGenerator::trimCodeMemoryToActualSize()
 {
     uint8_t *bufferStart = self()->getBinaryBufferStart();
     size_t actualCodeLengthInBytes = self()->getCodeEnd() - bufferStart;
+    bufferStart = self()->toExecutableAddress(bufferStart);
 
     self()->getCodeCache()->trimCodeMemoryAllocation(bufferStart, actualCodeLengthInBytes);
 }
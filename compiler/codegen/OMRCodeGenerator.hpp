@@ -785,6 +785,10 @@ public:
 
     void setGRACompleted() { _flags4.set(GRACompleted); }
 
+    bool getLinearScanGRACompleted() { return _flags4.testAny(LinearScanGRACompleted); }
+
+    void setLinearScanGRACompleted() { _flags4.set(LinearScanGRACompleted); }
+
     bool getSupportsProfiledInlining() { return _flags4.testAny(SupportsProfiledInlining); }
 
     void setSupportsProfiledInlining() { _flags4.set(SupportsProfiledInlining); }
@@ -954,6 +958,15 @@ public:
 
     uint8_t *getCodeEnd() { return _binaryBufferCursor; }
 
+    /**
+     * @brief Translates an address in the code being generated to the address it executes at
+     *
+     * Code memory is written through the writable view of a dual-mapped code cache, so
+     * addresses that are embedded in the code or reported outside the compilation are
+     * translated first. Other addresses are returned unchanged.
+     */
+    uint8_t *toExecutableAddress(uint8_t *address);
+
     uint32_t getCodeLength();
 
     uint8_t *getWarmCodeEnd() { return _coldCodeStart ? _warmCodeEnd : _binaryBufferCursor; }
@@ -2464,7 +2477,7 @@ protected:
         Supports64BitExpand = 0x00000008,
         // AVAILABLE                                        = 0x00000010,
         IsInOOLSection = 0x00000020,
-        // AVAILABLE                                        = 0x00000040,
+        LinearScanGRACompleted = 0x00000040,
         GRACompleted = 0x00000080,
         SupportsTestUnderMask = 0x00000100,
         SupportsRuntimeInstrumentation = 0x00000200,
@@ -92,7 +92,7 @@ void TR::LabelAbsoluteRelocation::apply(TR::CodeGenerator *cg)
 {
     intptr_t *cursor = (intptr_t *)getUpdateLocation();
     assertLabelDefined();
-    *cursor = (intptr_t)getLabel()->getCodeLocation();
+    *cursor = (intptr_t)cg->toExecutableAddress(getLabel()->getCodeLocation());
 }
 
 TR::InstructionLabelRelative16BitRelocation::InstructionLabelRelative16BitRelocation(TR::Instruction *cursor,
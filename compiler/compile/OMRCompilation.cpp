@@ -107,6 +107,8 @@
 #include "ras/Logger.hpp"
 #include "control/Recompilation.hpp"
 #include "runtime/CodeCacheExceptions.hpp"
+#include "runtime/CodeCacheLayout.hpp"
+#include "runtime/CodeCacheManager.hpp"
 #include "ilgen/IlGen.hpp"
 #include "env/RegionProfiler.hpp"
 #include "omrformatconsts.h"
@@ -254,6 +256,7 @@ OMR::Compilation::Compilation(int32_t id, OMR_VMThread *omrVMThread, TR_FrontEnd
     , _nodesThatShouldPrefetchOffset(getTypedAllocator<TR_Pair<TR::Node, uint32_t> *>(self()->allocator()))
     , _extraPrefetchInfo(getTypedAllocator<TR_PrefetchInfo *>(self()->allocator()))
     , _debugCounterMap(std::less<const void *>(), getTypedAllocator<DebugCounterEntry>(self()->allocator()))
+    , _debugCounterFrameTemp(NULL)
     , _currentBlock(NULL)
     , _verboseOptTransformationCount(0)
     , _relocatableMethodCodeStart(NULL)
@@ -275,6 +278,9 @@ OMR::Compilation::Compilation(int32_t id, OMR_VMThread *omrVMThread, TR_FrontEnd
     , _typeLayoutMap((LayoutComparator()), LayoutAllocator(self()->region()))
     , _currentILGenCallTarget(NULL)
     , _retainedMethods(NULL)
+    , _hasCompiledBodyKey(false)
+    , _reusedCompiledBody(false)
+    , _reusedCompiledBodyEnd(NULL)
     , _tlsManager(*self())
 {
     if (target != NULL) {
@@ -447,7 +453,19 @@ void OMR::Compilation::freeKnownObjectTable() { _knownObjectTable = NULL; }
 
 int32_t OMR::Compilation::maxInternalPointers() { return 0; }
 
-TR::CodeCacheKind OMR::Compilation::codeCacheKind() { return _options->getCodeCacheKind(); }
+TR::CodeCacheKind OMR::Compilation::codeCacheKind()
+{
+    TR::CodeCacheKind kind = _options->getCodeCacheKind();
+    if (kind != TR::CodeCacheKind::DEFAULT_CC)
+        return kind;
+
+    TR::CodeCacheManager *codeCacheManager = TR::CodeCacheManager::instance();
+    TR::CodeCacheLayout *codeCacheLayout = codeCacheManager ? codeCacheManager->codeCacheLayout() : NULL;
+    if (codeCacheLayout && codeCacheLayout->isHot(self()->getCurrentMethod()->getPersistentIdentifier()))
+        return TR::CodeCacheKind::HOT_CODE_CC;
+
+    return kind;
+}
 
 bool OMR::Compilation::isOutermostMethod()
 {
@@ -969,6 +987,20 @@ int32_t OMR::Compilation::compile()
             }
 #endif
 
+            // Identical IL compiles to an identical body, so reuse one if it exists
+            if (self()->getOption(TR_EnableCompiledBodyCache)) {
+                TR_CompiledBodyCache *cache = self()->getPersistentInfo()->getCompiledBodyCache();
+                _hasCompiledBodyKey = TR_CompiledBodyCache::computeKey(self(), _compiledBodyKey);
+                void *body = _hasCompiledBodyKey ? cache->acquire(_compiledBodyKey, _reusedCompiledBodyEnd) : NULL;
+                if (body) {
+                    logprintf(self()->getOption(TR_TraceAll), self()->log(),
+                        "Reusing compiled body %p of an earlier compilation with identical IL\n", body);
+                    _methodSymbol->setMethodAddress(body);
+                    _reusedCompiledBody = true;
+                    return COMPILATION_SUCCEEDED;
+                }
+            }
+
             if (_recompilationInfo) {
                 _recompilationInfo->beforeOptimization();
             } else if (self()->getOptLevel() == -1) {
@@ -1154,6 +1186,10 @@ int32_t OMR::Compilation::compile()
     }
 #endif /* defined(LINUX) || defined(J9ZOS390) || defined(OMR_OS_WINDOWS) */
 
+    if (_hasCompiledBodyKey)
+        self()->getPersistentInfo()->getCompiledBodyCache()->insert(_compiledBodyKey, _methodSymbol->getMethodAddress(),
+            self()->cg()->toExecutableAddress(self()->cg()->getCodeEnd()));
+
     return COMPILATION_SUCCEEDED;
 }
 
@@ -1850,6 +1886,13 @@ TR::DebugCounterBase *OMR::Compilation::getCounterFromStaticAddress(TR::SymbolRe
     }
 }
 
+TR::SymbolReference *OMR::Compilation::getDebugCounterFrameTemp()
+{
+    if (!_debugCounterFrameTemp)
+        _debugCounterFrameTemp = self()->getSymRefTab()->createTemporary(self()->getMethodSymbol(), TR::Int32);
+    return _debugCounterFrameTemp;
+}
+
 void OMR::Compilation::validateIL(TR::ILValidationContext ilValidationContext)
 {
     TR_ASSERT_FATAL(_ilValidator != NULL, "Attempting to validate the IL without the ILValidator being initialized");
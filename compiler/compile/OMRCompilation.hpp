@@ -49,6 +49,7 @@ typedef OMR::Compilation CompilationConnector;
 #include "compile/OSRData.hpp"
 #include "compile/Method.hpp"
 #include "compile/TLSCompilationManager.hpp"
+#include "control/CompiledBodyCache.hpp"
 #include "control/OptimizationPlan.hpp"
 #include "control/Options.hpp" // For Options
 #include "control/Options_inlines.hpp"
@@ -936,6 +937,13 @@ public:
      */
     TR::DebugCounterBase *getCounterFromStaticAddress(TR::SymbolReference *symRef);
 
+    /**
+     * @brief getDebugCounterFrameTemp
+     * @return a temporary of the method being compiled whose address sharded debug
+     *         counter bumps use to tell which thread is running; created on first use
+     */
+    TR::SymbolReference *getDebugCounterFrameTemp();
+
 #ifdef DEBUG
     void dumpMethodGraph(int index, TR::ResolvedMethodSymbol * = 0);
 #endif
@@ -996,6 +1004,18 @@ public:
 
     int32_t compile();
 
+    /**
+     * @brief Whether the method address is a body taken from the compiled body
+     *        cache, in which case this compilation did not generate any code
+     */
+    bool reusedCompiledBody() { return _reusedCompiledBody; }
+
+    /**
+     * @brief The end of the code of the body taken from the compiled body
+     *        cache; only meaningful when reusedCompiledBody() is true
+     */
+    uint8_t *getReusedCompiledBodyEnd() { return _reusedCompiledBodyEnd; }
+
     static void shutdown(TR_FrontEnd *);
 
     TR::Optimizer *createOptimizer(TR::ResolvedMethodSymbol *methodSymbol, bool isIlGen);
@@ -1529,6 +1549,7 @@ private:
      * the debug counter and the debug counter
      */
     DebugCounterMap _debugCounterMap;
+    TR::SymbolReference *_debugCounterFrameTemp;
 
     int32_t _verboseOptTransformationCount;
 
@@ -1582,6 +1603,11 @@ private:
 
     OMR::RetainedMethodSet *_retainedMethods;
 
+    TR_CompiledBodyCache::Key _compiledBodyKey;
+    bool _hasCompiledBodyKey;
+    bool _reusedCompiledBody;
+    uint8_t *_reusedCompiledBodyEnd;
+
     /*
      * This must be last
      * NOTE: TLS for Compilation needs to be set before any object that may use it is initialized.
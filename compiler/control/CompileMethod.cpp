@@ -31,6 +31,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "codegen/CodeGenerator.hpp"
+#include "codegen/Instruction.hpp"
 #include "env/FrontEnd.hpp"
 #include "codegen/LinkageConventionsEnum.hpp"
 #include "compile/Compilation.hpp"
@@ -49,17 +50,21 @@
 #include "env/VerboseLog.hpp"
 #include "env/defines.h"
 #include "env/jittypes.h"
+#include "il/Node.hpp"
 #include "il/ResolvedMethodSymbol.hpp"
 #include "ilgen/IlGenRequest.hpp"
 #include "ilgen/IlGeneratorMethodDetails.hpp"
 #include "infra/Assert.hpp"
 #include "infra/String.hpp"
+#include "infra/vector.hpp"
 #include "ras/Debug.hpp"
 #include "ras/Logger.hpp"
 #include "env/SystemSegmentProvider.hpp"
 #include "env/DebugSegmentProvider.hpp"
 #include "omrformatconsts.h"
+#include "runtime/CodeCacheLayout.hpp"
 #include "runtime/CodeCacheManager.hpp"
+#include "runtime/PerfJitDump.hpp"
 #include "control/CompilationController.hpp"
 
 static void writePerfToolEntry(void *start, uint32_t size, const char *name)
@@ -127,6 +132,39 @@ static void generatePerfToolEntry(uint8_t *startPC, uint8_t *endPC, const char *
     writePerfToolEntry(startPC, static_cast<uint32_t>(endPC - startPC), buffer);
 }
 
+// Reports the method to the perf jitdump file, optionally with the bytecode index of the
+// outermost method as the line number of each instruction
+static void generatePerfJitDumpEntry(TR::PerfJitDump *jitDump, TR::Compilation &comp, uint8_t *startPC,
+    uint8_t *endPC)
+{
+    TR::vector<TR::PerfJitDump::LineEntry, TR::Region &> lines(comp.trMemory()->currentStackRegion());
+
+    if (comp.getOption(TR_PerfJitDumpLineInfo)) {
+        uint8_t *lastAddress = NULL;
+        int32_t lastIndex = TR_ByteCodeInfo::invalidByteCodeIndex;
+        for (TR::Instruction *instr = comp.cg()->getFirstInstruction(); instr; instr = instr->getNext()) {
+            uint8_t *address = comp.cg()->toExecutableAddress(instr->getBinaryEncoding());
+            TR::Node *node = instr->getNode();
+            if (node == NULL || address < startPC || address >= endPC || (lastAddress && address <= lastAddress))
+                continue;
+
+            TR_ByteCodeInfo bcInfo = node->getByteCodeInfo();
+            while (!bcInfo.isInvalidCallerIndex())
+                bcInfo = comp.getInlinedCallSite(bcInfo.getCallerIndex())._byteCodeInfo;
+            if (bcInfo.isInvalidByteCodeIndex() || bcInfo.getByteCodeIndex() == lastIndex)
+                continue;
+
+            TR::PerfJitDump::LineEntry entry = { address, static_cast<uint32_t>(bcInfo.getByteCodeIndex()) };
+            lines.push_back(entry);
+            lastAddress = address;
+            lastIndex = bcInfo.getByteCodeIndex();
+        }
+    }
+
+    jitDump->codeLoad(comp.signature(), startPC, static_cast<uint32_t>(endPC - startPC), comp.signature(),
+        lines.empty() ? NULL : &lines[0], static_cast<uint32_t>(lines.size()));
+}
+
 #if defined(TR_TARGET_POWER)
 #include "p/codegen/PPCTableOfConstants.hpp"
 #endif
@@ -349,14 +387,17 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
             // OMR::MethodMetaDataPOD *metaData = fe->createMethodMetaData(&compiler);
 
             startPC = (uint8_t *)compiler.getMethodSymbol()->getMethodAddress();
+            // A reused body was not generated by this compilation's code generator
+            uint8_t *endPC = compiler.reusedCompiledBody()
+                ? compiler.getReusedCompiledBodyEnd()
+                : compiler.cg()->toExecutableAddress(compiler.cg()->getCodeEnd());
             uint64_t translationTime = TR::Compiler->vm.getUSecClock() - translationStartTime;
 
             if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompileEnd, TR_VerbosePerformance)) {
                 const char *signature = compilee.signature(&trMemory);
                 TR_VerboseLog::CriticalSection vlogLock;
                 TR_VerboseLog::write(TR_Vlog_COMP, "(%s) %s @ " POINTER_PRINTF_FORMAT "-" POINTER_PRINTF_FORMAT,
-                    compiler.getHotnessName(compiler.getMethodHotness()), signature, startPC,
-                    compiler.cg()->getCodeEnd());
+                    compiler.getHotnessName(compiler.getMethodHotness()), signature, startPC, endPC);
 
                 if (TR::Options::getVerboseOption(TR_VerbosePerformance)) {
                     TR_VerboseLog::write(" time=%llu mem=%lluKB", translationTime,
@@ -367,8 +408,25 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
                 trfflush(jitConfig->options.vLogFile);
             }
 
-            if (compiler.getOption(TR_PerfTool) || compiler.getOption(TR_EmitExecutableELFFile)
-                || compiler.getOption(TR_EmitRelocatableELFFile)) {
+            // A reused body was registered by the compilation that generated it
+            if (!compiler.reusedCompiledBody() && fe->codeCacheManager().perfJitDump()) {
+                generatePerfJitDumpEntry(fe->codeCacheManager().perfJitDump(), compiler, startPC, endPC);
+            }
+
+            TR::CodeCacheLayout *codeCacheLayout = fe->codeCacheManager().codeCacheLayout();
+            if (!compiler.reusedCompiledBody() && codeCacheLayout) {
+                TR_OpaqueMethodBlock *method = compilee.getPersistentIdentifier();
+                codeCacheLayout->recordCode(method, startPC, compiler.cg()->getCodeLength());
+
+                // Calls already made to this method reach it through its previous body unless patched
+                TR::CodeCache *codeCache = fe->codeCacheManager().findCodeCacheFromPC(startPC);
+                if (codeCache && codeCache->_kind == TR::CodeCacheKind::HOT_CODE_CC)
+                    fe->codeCacheManager().patchCallsToHotMethod(method, startPC);
+            }
+
+            if (!compiler.reusedCompiledBody()
+                && (compiler.getOption(TR_PerfTool) || compiler.getOption(TR_EmitExecutableELFFile)
+                    || compiler.getOption(TR_EmitRelocatableELFFile))) {
                 TR::CodeCacheManager &codeCacheManager(fe->codeCacheManager());
                 TR::CodeGenerator &codeGenerator(*compiler.cg());
                 codeCacheManager.registerCompiledMethod(compiler.externalName(), startPC,
@@ -380,7 +438,7 @@ uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMeth
                     }
                 }
                 if (compiler.getOption(TR_PerfTool)) {
-                    generatePerfToolEntry(startPC, codeGenerator.getCodeEnd(), compiler.signature(),
+                    generatePerfToolEntry(startPC, endPC, compiler.signature(),
                         compiler.getHotnessName(compiler.getMethodHotness()));
                 }
             }
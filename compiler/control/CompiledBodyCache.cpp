@@ -0,0 +1,296 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "control/CompiledBodyCache.hpp"
+
+#include <map>
+#include <stdint.h>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "env/TRMemory.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/MethodSymbol.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ParameterSymbol.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/StaticSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/List.hpp"
+#include "infra/Monitor.hpp"
+
+namespace {
+
+// Accumulates the two halves of a TR_CompiledBodyCache::Key: FNV-1a over the
+// bytes of every value, and an independent multiply/xor-shift mix.
+//
+class ILHasher {
+public:
+    ILHasher(TR::Compilation *comp)
+        : _hash(14695981039346656037ULL)
+        , _check(0x9e3779b97f4a7c15ULL)
+        , _cacheable(true)
+        , _numNodes(0)
+        , _nodeOrdinals(std::less<TR::Node *>(), comp->trMemory()->currentStackRegion())
+    {}
+
+    void add(uint64_t value)
+    {
+        for (int32_t i = 0; i < 8; i++)
+            _hash = (_hash ^ ((value >> (i * 8)) & 0xff)) * 1099511628211ULL;
+
+        _check = (_check ^ value) * 0xbf58476d1ce4e5b9ULL;
+        _check ^= _check >> 31;
+    }
+
+    void addNode(TR::Node *node);
+
+    bool isCacheable() { return _cacheable; }
+
+    void getKey(TR_CompiledBodyCache::Key &key)
+    {
+        key._hash = _hash;
+        key._check = _check;
+    }
+
+private:
+    // Marks a reference to a node that was already hashed, so that commoning
+    // is part of the key
+    static const uint64_t CommonedNode = 0xc0330de;
+
+    void addConstant(TR::Node *node);
+    void addSymbolReference(TR::SymbolReference *symRef);
+
+    typedef TR::typed_allocator<std::pair<TR::Node *const, uint32_t>, TR::Region &> NodeOrdinalAllocator;
+    typedef std::map<TR::Node *, uint32_t, std::less<TR::Node *>, NodeOrdinalAllocator> NodeOrdinals;
+
+    uint64_t _hash;
+    uint64_t _check;
+    bool _cacheable;
+    uint32_t _numNodes;
+    NodeOrdinals _nodeOrdinals;
+};
+
+void ILHasher::addNode(TR::Node *node)
+{
+    NodeOrdinals::iterator seen = _nodeOrdinals.find(node);
+    if (seen != _nodeOrdinals.end()) {
+        add(CommonedNode);
+        add(seen->second);
+        return;
+    }
+    _nodeOrdinals.insert(std::make_pair(node, _numNodes++));
+
+    TR::ILOpCode &op = node->getOpCode();
+    add(node->getOpCodeValue());
+    add(node->getDataType().getDataType());
+    add(node->getNumChildren());
+    add(node->getFlags().getValue());
+
+    if (op.isLoadConst())
+        addConstant(node);
+
+    if (node->getOpCodeValue() == TR::BBStart)
+        add(node->getBlock()->getNumber());
+
+    if (op.isCase())
+        add((uint64_t)node->getCaseConstant());
+
+    if ((op.isBranch() || op.isCase()) && node->getBranchDestination())
+        add(node->getBranchDestination()->getNode()->getBlock()->getNumber());
+
+    if (op.hasSymbolReference() && node->getSymbolReference())
+        addSymbolReference(node->getSymbolReference());
+
+    for (int32_t i = 0; i < node->getNumChildren(); i++)
+        addNode(node->getChild(i));
+}
+
+void ILHasher::addConstant(TR::Node *node)
+{
+    switch (node->getDataType().getDataType()) {
+        case TR::Int8:
+        case TR::Int16:
+        case TR::Int32:
+        case TR::Int64:
+            add(node->get64bitIntegralValueAsUnsigned());
+            break;
+        case TR::Address:
+            add((uintptr_t)node->getAddress());
+            break;
+        case TR::Float:
+            add(node->getFloatBits());
+            break;
+        case TR::Double:
+            add(node->getDoubleBits());
+            break;
+        default:
+            _cacheable = false;
+            break;
+    }
+}
+
+void ILHasher::addSymbolReference(TR::SymbolReference *symRef)
+{
+    TR::Symbol *symbol = symRef->getSymbol();
+    add(symRef->getReferenceNumber());
+    add(symRef->getOffset());
+    add(symRef->isUnresolved());
+    add(symbol->getFlags());
+    add(symbol->getDataType().getDataType());
+    add(symbol->getSize());
+
+    // Symbol reference numbers are assigned in the same order for the same
+    // sequence of IL generation calls, but what the symbol stands for must be
+    // part of the key as well
+    if (symbol->isParm()) {
+        add(symbol->getParmSymbol()->getSlot());
+    } else if (symbol->isStatic()) {
+        add((uintptr_t)symbol->getStaticSymbol()->getStaticAddress());
+    } else if (symbol->isMethod()) {
+        void *methodAddress = symbol->getMethodSymbol()->getMethodAddress();
+        if (!methodAddress)
+            _cacheable = false;
+        add((uintptr_t)methodAddress);
+    }
+}
+
+} // namespace
+
+TR_CompiledBodyCache::TR_CompiledBodyCache()
+    : _monitor(TR::Monitor::create("JIT-CompiledBodyCacheMonitor"))
+    , _entriesByBody(std::less<uint8_t *>(), EntryMapAllocator(TR::Compiler->persistentAllocator()))
+{
+    memset(_buckets, 0, sizeof(_buckets));
+}
+
+bool TR_CompiledBodyCache::computeKey(TR::Compilation *comp, Key &key)
+{
+    TR::StackMemoryRegion stackMemoryRegion(*comp->trMemory());
+    ILHasher hasher(comp);
+
+    // The name of the method does not affect its code, but its interface and
+    // the options it is compiled with do
+    TR::ResolvedMethodSymbol *methodSymbol = comp->getMethodSymbol();
+    hasher.add(comp->getMethodHotness());
+    hasher.add(comp->getOptions()->getCodeGenerationOptionsHash());
+    hasher.add(methodSymbol->getLinkageConvention());
+    hasher.add(methodSymbol->getResolvedMethod()->returnType().getDataType());
+    ListIterator<TR::ParameterSymbol> parms(&methodSymbol->getParameterList());
+    for (TR::ParameterSymbol *parm = parms.getFirst(); parm; parm = parms.getNext()) {
+        hasher.add(parm->getDataType().getDataType());
+        hasher.add(parm->getSlot());
+    }
+
+    for (TR::TreeTop *tt = comp->getStartTree(); tt; tt = tt->getNextTreeTop())
+        hasher.addNode(tt->getNode());
+
+    hasher.getKey(key);
+    return hasher.isCacheable();
+}
+
+TR_CompiledBodyCache::Entry *TR_CompiledBodyCache::findLocked(const Key &key)
+{
+    for (Entry *entry = _buckets[key._hash % NUM_BUCKETS]; entry; entry = entry->_next) {
+        if (entry->_key._hash == key._hash && entry->_key._check == key._check)
+            return entry;
+    }
+    return NULL;
+}
+
+void *TR_CompiledBodyCache::acquire(const Key &key, uint8_t *&bodyEnd)
+{
+    OMR::CriticalSection acquireBody(_monitor);
+    Entry *entry = findLocked(key);
+    if (!entry)
+        return NULL;
+
+    entry->_refCount++;
+    bodyEnd = entry->_bodyEnd;
+    return entry->_body;
+}
+
+void TR_CompiledBodyCache::insert(const Key &key, void *body, uint8_t *bodyEnd)
+{
+    OMR::CriticalSection insertBody(_monitor);
+    if (findLocked(key))
+        return;
+
+    Entry *entry = new (PERSISTENT_NEW) Entry;
+    if (!entry)
+        return;
+
+    Entry **bucket = &_buckets[key._hash % NUM_BUCKETS];
+    entry->_key = key;
+    entry->_body = body;
+    entry->_bodyEnd = bodyEnd;
+    entry->_refCount = 1;
+    entry->_next = *bucket;
+    *bucket = entry;
+    _entriesByBody.insert(std::make_pair(static_cast<uint8_t *>(body), entry));
+}
+
+void TR_CompiledBodyCache::removeLocked(EntryMap::iterator entryByBody)
+{
+    Entry *entry = entryByBody->second;
+    _entriesByBody.erase(entryByBody);
+
+    Entry **link = &_buckets[entry->_key._hash % NUM_BUCKETS];
+    while (*link != entry)
+        link = &(*link)->_next;
+    *link = entry->_next;
+    TR_Memory::jitPersistentFree(entry);
+}
+
+bool TR_CompiledBodyCache::release(uint8_t *start, uint8_t *end)
+{
+    OMR::CriticalSection releaseBody(_monitor);
+    EntryMap::iterator entryByBody = _entriesByBody.lower_bound(start);
+    if (entryByBody == _entriesByBody.end() || entryByBody->first >= end) {
+        // Bodies that were never cached have a single owner
+        return true;
+    }
+
+    if (--entryByBody->second->_refCount > 0)
+        return false;
+
+    removeLocked(entryByBody);
+    return true;
+}
+
+void TR_CompiledBodyCache::discard(uint8_t *start, uint8_t *end)
+{
+    OMR::CriticalSection discardBodies(_monitor);
+    EntryMap::iterator entryByBody = _entriesByBody.lower_bound(start);
+    while (entryByBody != _entriesByBody.end() && entryByBody->first < end)
+        removeLocked(entryByBody++);
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef COMPILEDBODYCACHE_INCL
+#define COMPILEDBODYCACHE_INCL
+
+#include <map>
+#include <stdint.h>
+#include "env/PersistentAllocator.hpp"
+#include "env/TRMemory.hpp"
+#include "env/TypedAllocator.hpp"
+
+namespace TR {
+class Compilation;
+class Monitor;
+} // namespace TR
+
+/**
+ * Process-wide cache of compiled bodies keyed by a hash of the IL they were
+ * compiled from. Owned by TR::PersistentInfo.
+ *
+ * Method builders that generate identical IL (for example specializations
+ * that end up with the same constants) can share one body instead of each
+ * going through optimization and code generation. The key is taken right
+ * after IL generation, so it does not depend on what the optimizer does.
+ *
+ * Every compilation that obtains a body holds a reference to it. The code
+ * cache calls release() whenever it frees a range of code, once for each
+ * compilation that returned the body; only when the last reference goes is
+ * the entry removed and the range actually freed. Destroying a whole code
+ * cache discards the entries of all the bodies in it.
+ *
+ * Options that change the generated code are part of the key, so bodies are
+ * only shared between compilations that would have produced the same code.
+ */
+class TR_CompiledBodyCache {
+public:
+    TR_ALLOC(TR_Memory::CompilationInfo)
+
+    /**
+     * Two independent 64-bit hashes of the IL. Both must match for a body to
+     * be reused, which makes an accidental collision vanishingly unlikely.
+     */
+    struct Key {
+        uint64_t _hash;
+        uint64_t _check;
+    };
+
+    TR_CompiledBodyCache();
+
+    /**
+     * Compute the key for the freshly generated IL of comp and the options it
+     * is compiled with.
+     * @returns false if the IL refers to something whose identity cannot be
+     *          captured in the key, in which case the body must not be cached
+     */
+    static bool computeKey(TR::Compilation *comp, Key &key);
+
+    /**
+     * Find the body compiled from IL with the given key and take a reference
+     * to it.
+     * @param[out] bodyEnd the end of the body's code, if there is one
+     * @returns the body's entry point, or NULL if there is none
+     */
+    void *acquire(const Key &key, uint8_t *&bodyEnd);
+
+    /**
+     * Record a newly compiled body, holding one reference to it. Nothing is
+     * recorded if another compilation of the same IL got there first.
+     */
+    void insert(const Key &key, void *body, uint8_t *bodyEnd);
+
+    /**
+     * Drop a reference to the cached body whose entry point lies in the code
+     * between start and end, if there is one.
+     * @returns false if the body is still referenced by another compilation
+     *          and the code must be kept; true if the code may be freed
+     */
+    bool release(uint8_t *start, uint8_t *end);
+
+    /**
+     * Forget every body in the code between start and end, however many
+     * compilations still refer to it. Used when a whole code cache goes away.
+     */
+    void discard(uint8_t *start, uint8_t *end);
+
+private:
+    static const int32_t NUM_BUCKETS = 251;
+
+    struct Entry {
+        TR_ALLOC(TR_Memory::CompilationInfo)
+
+        Key _key;
+        void *_body;
+        uint8_t *_bodyEnd;
+        int32_t _refCount;
+        Entry *_next;
+    };
+
+    typedef TR::typed_allocator<std::pair<uint8_t *const, Entry *>, TR::PersistentAllocator &> EntryMapAllocator;
+    typedef std::map<uint8_t *, Entry *, std::less<uint8_t *>, EntryMapAllocator> EntryMap;
+
+    Entry *findLocked(const Key &key);
+    void removeLocked(EntryMap::iterator entryByBody);
+
+    TR::Monitor *_monitor;
+    Entry *_buckets[NUM_BUCKETS];
+
+    // The same entries ordered by entry point, so that freeing code only
+    // visits the bodies in the freed range
+    EntryMap _entriesByBody;
+};
+
+#endif
@@ -179,6 +179,9 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "bigCalleeThresholdForColdCallsAtWarm=",
      "O<nnn>\tInliner threshold for cold calls for opt level less or equal to warm", TR::Options::set32BitNumeric,
      offsetof(OMR::Options, _bigCalleeThresholdForColdCallsAtWarm), 100, "F%d" },
+    { "blockFrequencyProfileThreshold=",
+     "O<nnn>\tnumber of recorded method entries required before block frequency profiles are used",
+     TR::Options::set32BitNumeric, offsetof(OMR::Options, _blockFrequencyProfileThreshold), 0, "F%d" },
     { "blockShufflingSequence=",
      "D<string>\tDescription of the particular block shuffling operations to perform; see source code for more "
         "details", TR::Options::setString, offsetof(OMR::Options, _blockShufflingSequence), 0, "P%s" },
@@ -223,6 +226,11 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "classRedefinitionUPICRatSize=", "M<nnn>\tsize of runtime assumption table for classRedefinitionUPIC",
      TR::Options::setStaticNumeric, (intptr_t)&OMR::Options::_classRedefinitionUPICRatSize, 0, "F%d",
      NOT_IN_SUBSET },
+    { "codeCacheDualMapping",
+     "M\tmap the code cache repository twice, read-execute for running code and read-write for writing it",
+     SET_OPTION_BIT(TR_CodeCacheDualMapping), "F", NOT_IN_SUBSET },
+    { "codeCacheHugePages", "M\tback the code cache repository with 2MB pages",
+     SET_OPTION_BIT(TR_CodeCacheHugePages), "F", NOT_IN_SUBSET },
     { "coldRunBCount=", "O<nnn>\tnumber of invocations before compiling methods with loops in AOT cold runs",
      TR::Options::setCount, offsetof(OMR::Options, _initialColdRunBCount), 0, "F%d", NOT_IN_SUBSET },
     { "coldRunCount=", "O<nnn>\tnumber of invocations before compiling methods with loops in AOT cold runs",
@@ -280,6 +288,9 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "debugCounters=",
      "D{regex}\tEnable dynamic debug counters with names matching regex (unless they fail to meet some other "
         "criterion)", TR::Options::setRegex, offsetof(OMR::Options, _enabledDynamicCounterNames), 0, "F" },
+    { "debugCounterShards=",
+     "D<nnn>\tBump each debug counter in one of nnn cache-line isolated slots chosen by the running thread, "
+        "rounded down to a power of two (production counter mode)", TR::Options::set32BitSignedNumeric, offsetof(OMR::Options, _debugCounterShards), 0, "F%d" },
     { "debugCounterWarmupSeconds=",
      "D<nnn>\tDebug counters will be reset to zero after nnn seconds, so only increments after this point will end "
         "up in the final report", TR::Options::set64BitSignedNumeric, offsetof(OMR::Options, _debugCounterWarmupSeconds), 0, "F%d" },
@@ -303,6 +314,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "disableAESInHardware", "O\tdo not use native AES instructions", SET_OPTION_BIT(TR_DisableAESInHardware), "F" },
     { "disableAggressiveRecompilations", "R\trecompilation to higher opt levels is not anymore twice as probable",
      SET_OPTION_BIT(TR_DisableAggressiveRecompilations), "F" },
+    { "disableAllocationEscapeAnalysis", "O\tdisable escape analysis of front-end allocation helpers",
+     TR::Options::disableOptimization, allocationEscapeAnalysis, 0, "P" },
     { DisableAllocationInliningString, "O\tdisable ANewArray    inline fast helper",
      SET_OPTION_BIT(TR_DisableAllocationInlining), "F" },
     { "disableAllocationOfScratchBTL", "M\tRefuse to allocate scratch memory below the line (zOS 31-bit)",
@@ -374,6 +387,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_DisableBDLLVersioning), "F" },
     { "disableBitOpcode", "O\tdisable converting calling bit operation java method to bitOpcode",
      SET_OPTION_BIT(TR_DisableBitOpcode), "F" },
+    { "disableBlockFrequencyProfiler", "O\tdisable block frequency profiler", TR::Options::disableOptimization,
+     blockFrequencyProfiler, 0, "P" },
     { "disableBlockShuffling", "O\tdisable random rearrangement of blocks", TR::Options::disableOptimization,
      blockShuffling, 0, "P" },
     { "disableBlockSplitter", "O\tdisable block splitter", TR::Options::disableOptimization, blockSplitter, 0, "P" },
@@ -666,6 +681,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_DisableLastITableCache), "F" },
     { "disableLeafRoutineDetection", "O\tdisable lleaf routine detection on zlinux",
      SET_OPTION_BIT(TR_DisableLeafRoutineDetection), "F" },
+    { "disableLinearScanGRA", "O\tdisable linear scan global register allocator", TR::Options::disableOptimization,
+     linearScanGlobalRegisterAllocator, 0, "P" },
     { "disableLinkageRegisterAllocation", "O\tdon't turn parm loads into RegLoads in first basic block",
      SET_OPTION_BIT(TR_DisableLinkageRegisterAllocation), "F" },
     { "disableLiveMonitorMetadata", "O\tdisable the creation of live monitor metadata",
@@ -892,6 +909,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_DisableSIMDUTF16BEEncoder), "F" },
     { "disableSIMDUTF16LEEncoder", "M\tdisable inlining of SIMD UTF16 Little Endian encoder",
      SET_OPTION_BIT(TR_DisableSIMDUTF16LEEncoder), "F" },
+    { "disableSLPVectorization", "O\tdisable packing of straight-line stores into vector operations",
+     TR::Options::disableOptimization, slpVectorization, 0, "P" },
     { "disableSmartPlacementOfCodeCaches",
      "O\tdisable placement of code caches in memory so they are near each other and the DLLs", SET_OPTION_BIT(TR_DisableSmartPlacementOfCodeCaches), "F", NOT_IN_SUBSET },
     { "disableSSE3", "C\tdisable sse 3 and newer on x86", TR::Options::disableCPUFeatures, TR_DisableSSE3, 0, "F" },
@@ -1139,6 +1158,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "enableBasicBlockHoisting", "O\tenable basic block hoisting", TR::Options::enableOptimization, basicBlockHoisting,
      0, "P" },
     { "enableBenefitInliner", "O\tenable benefit inliner", SET_OPTION_BIT(TR_EnableBenefitInliner), "F" },
+    { "enableBlockFrequencyProfiling",
+     "O\tinstrument warm bodies with block and branch counters and use the counts as block frequencies on "
+     "recompilation",
+     SET_OPTION_BIT(TR_EnableBlockFrequencyProfiling), "F" },
     { "enableBlockShuffling", "O\tenable random rearrangement of blocks", TR::Options::enableOptimization,
      blockShuffling, 0, "P" },
     { "enableBranchPreload", "O\tenable return branch preload for each method (for func testing)",
@@ -1165,6 +1188,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_EnableCompThreadThrottlingDuringStartup), "F", NOT_IN_SUBSET },
     { "enableCompilationYieldStats", "M\tenable statistics on time between 2 consecutive yield points",
      SET_OPTION_BIT(TR_EnableCompYieldStats), "F", NOT_IN_SUBSET },
+    { "enableCompiledBodyCache", "O\treuse the body of an earlier compilation whose IL was identical",
+     SET_OPTION_BIT(TR_EnableCompiledBodyCache), "F" },
 #ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
     { "enableConstRefs", "I\tenable constant references", SET_OPTION_BIT(TR_EnableConstRefs), "F" },
 #endif
@@ -1233,6 +1258,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_VerboseInlineProfiling), "F" },
     { "enableInliningDuringVPAtWarm", "O\tenable inlining during VP for warm bodies",
      RESET_OPTION_BIT(TR_DisableInliningDuringVPAtWarm), "F" },
+    { "enableInliningMethodSummaryCache", "O\treuse BenefitInliner method summaries across compilations",
+     SET_OPTION_BIT(TR_EnableInliningMethodSummaryCache), "F" },
     { "enableInliningOfUnsafeForArraylets", "O\tenable inlining of Unsafe calls when arraylets are enabled",
      SET_OPTION_BIT(TR_EnableInliningOfUnsafeForArraylets), "F" },
     { "enableInterfaceCallCachingSingleDynamicSlot",
@@ -1257,6 +1284,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_EnableKnownObjectTableCachingVerification), "F" },
     { "enableLastRetrialLogging",
      "O\tenable fullTrace logging for last compilation attempt. Needs to have a log defined on the command line", SET_OPTION_BIT(TR_EnableLastCompilationRetrialLogging), "F" },
+    { "enableLinearScanGRA", "O\tuse the linear scan global register allocator instead of tactical GRA at all opt levels",
+     SET_OPTION_BIT(TR_EnableLinearScanGRA), "F" },
     { "enableLocalVPSkipLowFreqBlock", "O\tSkip processing of low frequency blocks in localVP",
      SET_OPTION_BIT(TR_EnableLocalVPSkipLowFreqBlock), "F" },
     { "enableLoopEntryAlignment", "O\tenable loop Entry alignment", SET_OPTION_BIT(TR_EnableLoopEntryAlignment), "F" },
@@ -1451,6 +1480,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      NOT_IN_SUBSET },
     { "highOpt", "O\tdeprecated; equivalent to optLevel=hot", TR::Options::set32BitValue,
      offsetof(OMR::Options, _optLevel), hot },
+    { "hotCodeLayout", "M\tplace the methods the runtime reports as hot contiguously in a hot code cache",
+     SET_OPTION_BIT(TR_HotCodeLayout), "F", NOT_IN_SUBSET },
     { "hotFieldReductionAlgorithm=", "O\tcompilation's hot field combined block frequency reduction algorithm",
      TR::Options::setHotFieldReductionAlgorithm, 0, 0, "F", NOT_IN_SUBSET },
     { "hotFieldThreshold=",
@@ -1581,6 +1612,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      "O<nnn>\tindex of the last opt transformation to perform within the last optimization (see lastOptIndex)", TR::Options::set32BitSignedNumeric, offsetof(OMR::Options, _lastOptSubIndex), 0, "F%d" },
     { "lastOptTransformationIndex=", "O<nnn>\tindex of the last optimization transformation to perform",
      TR::Options::set32BitSignedNumeric, offsetof(OMR::Options, _lastOptTransformationIndex), 0, "F%d" },
+    { "linearScanGRANodeThreshold=",
+     "O<nnn>\tnumber of nodes in the trees above which cold and warm compiles use the linear scan global register "
+     "allocator, -1 (the default) to never select it by size",
+     TR::Options::set32BitSignedNumeric, offsetof(OMR::Options, _linearScanGRANodeThreshold), 0, "F%d" },
     { "lockReserveClass=", "O{regex}\tenable reserving locks for specified classes", TR::Options::setRegex,
      offsetof(OMR::Options, _lockReserveClass), 0, "P" },
     { "lockVecRegs=", "M<nn>\tThe number of vector register to lock (from end) Range: 0-32",
@@ -1704,6 +1739,13 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
 
     { "optFile=",
      "O<filename>\tRead in 'Performing' statements from <filename> and perform those opts instead of the usual ones", TR::Options::setString, offsetof(OMR::Options, _optFileName), 0, "P%s" },
+    { "optimizerMemoryBudget=",
+     "O<nnn>\tscratch memory in KB the optimizer may use before skipping expensive optional optimizations, "
+     "0 for no limit",
+     TR::Options::set32BitSignedNumeric, offsetof(OMR::Options, _optimizerMemoryBudget), 0, "F%d" },
+    { "optimizerTimeBudget=",
+     "O<nnn>\ttime in ms the optimizer may spend before skipping expensive optional optimizations, 0 for no limit",
+     TR::Options::set32BitSignedNumeric, offsetof(OMR::Options, _optimizerTimeBudget), 0, "F%d" },
     { "optLevel=cold", "O\tcompile all methods at cold level", TR::Options::set32BitValue,
      offsetof(OMR::Options, _optLevel), cold, "P" },
     { "optLevel=hot", "O\tcompile all methods at hot level", TR::Options::set32BitValue,
@@ -1730,6 +1772,10 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_PaintDataCacheOnFree), "F" },
     { "paranoidOptCheck", "O\tcheck the trees and cfgs after every optimization phase",
      SET_OPTION_BIT(TR_EnableParanoidOptCheck), "F" },
+    { "perfJitDump", "M\twrite a perf jitdump file describing compiled code",
+     SET_OPTION_BIT(TR_PerfJitDump), "F", NOT_IN_SUBSET },
+    { "perfJitDumpLineInfo", "M\tadd bytecode index line info to the perf jitdump file",
+     SET_OPTION_BIT(TR_PerfJitDumpLineInfo), "F", NOT_IN_SUBSET },
     { "performLookaheadAtWarmCold", "O\tallow lookahead to be performed at cold and warm",
      SET_OPTION_BIT(TR_PerformLookaheadAtWarmCold), "F" },
     { "perfTool", "M\tenable PerfTool", SET_OPTION_BIT(TR_PerfTool), "F", NOT_IN_SUBSET },
@@ -1879,6 +1925,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_TraceAbstractInterpretation), "P" },
     { "traceAddAndRemoveEdge", "L\ttrace edge addition and removal", SET_OPTION_BIT(TR_TraceAddAndRemoveEdge), "P" },
     { "traceAliases", "L\ttrace alias set generation", SET_OPTION_BIT(TR_TraceAliases), "P" },
+    { "traceAllocationEscapeAnalysis", "L\ttrace escape analysis of front-end allocation helpers",
+     TR::Options::traceOptimization, allocationEscapeAnalysis, 0, "P" },
     { "traceAllocationSinking", "L\ttrace allocation sinking", TR::Options::traceOptimization, allocationSinking, 0,
      "P" },
     { "traceAndSimplification", "L\ttrace and simplification", TR::Options::traceOptimization, andSimplification, 0,
@@ -1904,6 +1952,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      "P" },
     { "traceBlockFrequencyGeneration", "L\ttrace block frequency generation", SET_OPTION_BIT(TR_TraceBFGeneration),
      "P" },
+    { "traceBlockFrequencyProfiler", "L\ttrace block frequency profiler", TR::Options::traceOptimization,
+     blockFrequencyProfiler, 0, "P" },
     { "traceBlockIteration", "L\ttrace block iteration", SET_OPTION_BIT(TR_TraceBlockIteration), "P" },
     { "traceBlockShuffling", "L\ttrace random rearrangement of blocks", TR::Options::traceOptimization, blockShuffling,
      0, "P" },
@@ -1990,6 +2040,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
      SET_OPTION_BIT(TR_TraceKnownObjectGraph), "P" },
     { "traceLastOpt", "L\textra tracing for the opt corresponding to lastOptIndex; usually used with traceFull",
      SET_OPTION_BIT(TR_TraceLastOpt), "F" },
+    { "traceLinearScanGRA", "L\ttrace linear scan global register allocator", TR::Options::traceOptimization,
+     linearScanGlobalRegisterAllocator, 0, "P" },
     { "traceLiveMonitorMetadata", "L\ttrace live monitor metadata", SET_OPTION_BIT(TR_TraceLiveMonitorMetadata), "F" },
     { "traceLiveness", "L\ttrace liveness analysis", SET_OPTION_BIT(TR_TraceLiveness), "P" },
     { "traceLiveRangeSplitter", "L\ttrace live-range splitter for global register allocator",
@@ -2085,6 +2137,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
     { "traceSequentialStoreSimplification", "L\ttrace sequential load or store simplification",
      TR::Options::traceOptimization, sequentialStoreSimplification, 0, "P" },
 #endif
+    { "traceSLPVectorization", "L\ttrace packing of straight-line stores into vector operations",
+     TR::Options::traceOptimization, slpVectorization, 0, "P" },
     { "traceStaticFinalFieldFolding", "L\ttrace generic static final field folding", TR::Options::traceOptimization,
      staticFinalFieldFolding, 0, "P" },
     { "traceStringBuilderTransformer", "L\ttrace StringBuilder transformer optimization",
@@ -2888,7 +2942,12 @@ void OMR::Options::initialize()
     _counterBucketGranularity = 0;
     _minCounterFidelity = 0;
     _debugCounterWarmupSeconds = 0;
+    _debugCounterShards = 0;
     _insertDebuggingCounters = 0;
+    _blockFrequencyProfileThreshold = 100;
+    _linearScanGRANodeThreshold = -1;
+    _optimizerTimeBudget = 0;
+    _optimizerMemoryBudget = 0;
     _inlineCntrCalleeTooBigBucketSize = 0;
     _inlineCntrColdAndNotTinyBucketSize = 0;
     _inlineCntrWarmCalleeTooBigBucketSize = 0;
@@ -5051,6 +5110,19 @@ int32_t OMR::Options::getOptLevel() const
     return _optLevel;
 }
 
+uint64_t OMR::Options::getCodeGenerationOptionsHash()
+{
+    // FNV-1a
+    const uint64_t prime = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL;
+    for (int32_t i = 0; i <= TR_OWM; i++)
+        hash = (hash ^ _options[i]) * prime;
+    for (int32_t o = 0; o < OMR::numOpts; o++)
+        hash = (hash ^ (_disabledOptimizations[o] ? 1 : 0)) * prime;
+    hash = (hash ^ static_cast<uint32_t>(_optLevel)) * prime;
+    return hash;
+}
+
 // Same as setFixedOptLevel
 void OMR::Options::setOptLevel(int32_t o)
 {
@@ -644,10 +644,10 @@ enum TR_CompilationOptions {
     // Available                                             = 0x80000000 + 17,
 
     // Option word 18
-    // Available                                             = 0x00000020 + 18,
-    // Available                                             = 0x00000040 + 18,
-    // Available                                             = 0x00000080 + 18,
-    // Available                                             = 0x00000100 + 18,
+    TR_EnableBlockFrequencyProfiling                         = 0x00000020 + 18,
+    TR_EnableLinearScanGRA                                   = 0x00000040 + 18,
+    TR_EnableCompiledBodyCache                               = 0x00000080 + 18,
+    TR_EnableInliningMethodSummaryCache                      = 0x00000100 + 18,
     TR_UseStrictStartupHints                                 = 0x00000200 + 18,
     // Available                                             = 0x00000400 + 18,
 #ifdef TR_ALLOW_NON_CONST_KNOWN_OBJECTS
@@ -843,12 +843,12 @@ enum TR_CompilationOptions {
     TR_DisableRecognizedMethods                              = 0x00000040 + 25,
     TR_DisableBitOpcode                                      = 0x00000080 + 25,
     TR_DisableRecognizeCurrentThread                         = 0x00000100 + 25,
-    // Available                                             = 0x00000200 + 25,
-    // Available                                             = 0x00000400 + 25,
-    // Available                                             = 0x00000800 + 25,
-    // Available                                             = 0x00001000 + 25,
+    TR_PerfJitDump                                           = 0x00000200 + 25,
+    TR_PerfJitDumpLineInfo                                   = 0x00000400 + 25,
+    TR_HotCodeLayout                                         = 0x00000800 + 25,
+    TR_CodeCacheHugePages                                    = 0x00001000 + 25,
     TR_TracePREForOptimalSubNodeReplacement                  = 0x00002000 + 25,
-    // Available                                             = 0x00008000 + 25,
+    TR_CodeCacheDualMapping                                  = 0x00008000 + 25,
     TR_PerfTool                                              = 0x00010000 + 25,
     // Available                                             = 0x00020000 + 25,
     TR_DisableBranchOnCount                                  = 0x00040000 + 25,
@@ -1613,6 +1613,12 @@ public:
 
     bool getOption(uint32_t mask);
 
+    /**
+     * Hash of the option words, the disabled optimizations and the opt level,
+     * i.e. the settings that can change the code generated for a method
+     */
+    uint64_t getCodeGenerationOptionsHash();
+
     static bool getSamplingJProfilingOption(TR_SamplingJProfilingFlags op)
     {
         return _samplingJProfilingOptionFlags.isSet(op);
@@ -1773,6 +1779,14 @@ public:
 
     int32_t insertDebuggingCounters() { return _insertDebuggingCounters; }
 
+    int32_t getBlockFrequencyProfileThreshold() { return _blockFrequencyProfileThreshold; }
+
+    int32_t getLinearScanGRANodeThreshold() { return _linearScanGRANodeThreshold; }
+
+    int32_t getOptimizerTimeBudget() { return _optimizerTimeBudget; }
+
+    int32_t getOptimizerMemoryBudget() { return _optimizerMemoryBudget; }
+
     int32_t getLastSearchCount() { return _lastSearchCount; }
 
     int32_t getAotrtDebugLevel() { return _newAotrtDebugLevel; }
@@ -1791,6 +1805,10 @@ public:
 
     int64_t getDebugCounterWarmupSeconds() { return _debugCounterWarmupSeconds; }
 
+    int32_t getDebugCounterShards() { return _debugCounterShards; }
+
+    void setDebugCounterShards(int32_t shards) { _debugCounterShards = shards; }
+
     const char *debugCounterInsertedFormat(TR_Memory *mem, const char *name, const char *format)
     {
         auto nameLen = strlen(name);
@@ -2824,7 +2842,12 @@ protected:
     int32_t _counterBucketGranularity;
     int32_t _minCounterFidelity;
     int64_t _debugCounterWarmupSeconds;
+    int32_t _debugCounterShards;
     int32_t _insertDebuggingCounters;
+    int32_t _blockFrequencyProfileThreshold;
+    int32_t _linearScanGRANodeThreshold;
+    int32_t _optimizerTimeBudget;
+    int32_t _optimizerMemoryBudget;
 
     int32_t _inlineCntrCalleeTooBigBucketSize;
     int32_t _inlineCntrColdAndNotTinyBucketSize;
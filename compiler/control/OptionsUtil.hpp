@@ -213,6 +213,8 @@ enum CodeCacheKind {
                        // transient, this allows us to place the code for these classes in a distinct code
                        // cache which prevents fragmentation.
     FILE_BACKED_CC,
+    HOT_CODE_CC, // Methods chosen by the TR::CodeCacheLayout are placed in a distinct code cache in layout order
+                 // so that methods calling each other frequently are contiguous.
 };
 
 } // namespace TR
@@ -33,6 +33,7 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
+#include "ras/DebugCounter.hpp"
 #include "runtime/CodeCache.hpp"
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/Runtime.hpp"
@@ -97,13 +98,17 @@ static void initializeCodeCache(TR::CodeCacheManager &codeCacheManager)
     codeCacheConfig._codeCachePadKB = 0;
     codeCacheConfig._codeCacheAlignment = 32;
     codeCacheConfig._codeCacheFreeBlockRecylingEnabled = true;
-    codeCacheConfig._largeCodePageSize = 0;
+    codeCacheConfig._largeCodePageSize
+        = TR::Options::getCmdLineOptions()->getOption(TR_CodeCacheHugePages) ? 2 * 1024 * 1024 : 0;
     codeCacheConfig._largeCodePageFlags = 0;
     codeCacheConfig._maxNumberOfCodeCaches = 96;
     codeCacheConfig._canChangeNumCodeCaches = true;
     codeCacheConfig._emitExecutableELF = TR::Options::getCmdLineOptions()->getOption(TR_PerfTool)
         || TR::Options::getCmdLineOptions()->getOption(TR_EmitExecutableELFFile);
     codeCacheConfig._emitRelocatableELF = TR::Options::getCmdLineOptions()->getOption(TR_EmitRelocatableELFFile);
+    codeCacheConfig._emitPerfJitDump = TR::Options::getCmdLineOptions()->getOption(TR_PerfJitDump);
+    codeCacheConfig._hotCodeLayout = TR::Options::getCmdLineOptions()->getOption(TR_HotCodeLayout);
+    codeCacheConfig._codeCacheDualMapping = TR::Options::getCmdLineOptions()->getOption(TR_CodeCacheDualMapping);
 
     TR::CodeCache *firstCodeCache = codeCacheManager.initialize(true, 1);
 }
@@ -207,4 +212,19 @@ void shutdownSimpleJit()
         TR::Compiler->rawAllocator.deallocate(TR::Compiler);
 }
 
+uint32_t snapshotJitDebugCounters(const char **names, int64_t *counts, uint32_t maxCounters)
+{
+    return TR::FrontEnd::instance()->getPersistentInfo()->getDynamicCounters()->snapshot(names, counts, maxCounters);
+}
+
+void resetJitDebugCounters()
+{
+    TR::FrontEnd::instance()->getPersistentInfo()->getDynamicCounters()->resetAll();
+}
+
+size_t formatJitDebugCounters(char *buffer, size_t bufferSize)
+{
+    return TR::FrontEnd::instance()->getPersistentInfo()->getDynamicCounters()->formatCSV(buffer, bufferSize);
+}
+
 } // extern "C"
@@ -23,6 +23,7 @@
 #ifndef SIMPLEJIT_INCL
 #define SIMPLEJIT_INCL
 
+#include "stddef.h"
 #include "stdint.h"
 #include "compile/CompilationTypes.hpp"
 
@@ -45,6 +46,18 @@ bool initializeSimpleJit();
 uint8_t *compileMethod(TR::IlGeneratorMethodDetails & details, TR_Hotness hotness, int32_t &rc);
 void shutdownSimpleJit();
 
+// Runtime access to the dynamic debug counters bumped by compiled code (see the
+// debugCounters= and debugCounterShards= options):
+//     snapshotJitDebugCounters() stores up to maxCounters names and counts, sorted
+//         by name, and returns the total number of counters
+//     resetJitDebugCounters() zeroes every counter
+//     formatJitDebugCounters() writes the counters as "name,count" CSV and, like
+//         snprintf, returns the length of the full text
+//
+uint32_t snapshotJitDebugCounters(const char **names, int64_t *counts, uint32_t maxCounters);
+void resetJitDebugCounters();
+size_t formatJitDebugCounters(char *buffer, size_t bufferSize);
+
 } // extern "C"
 
 #endif // defined(SIMPLEJIT_INCL)
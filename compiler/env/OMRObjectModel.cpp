@@ -28,13 +28,19 @@
 #include "compile/Compilation.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/jittypes.h"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
 #include "infra/Assert.hpp"
 
 namespace TR {
 class Node;
 }
 
-OMR::ObjectModel::ObjectModel() {}
+OMR::ObjectModel::ObjectModel()
+    : _numAllocationHelpers(0)
+{}
 
 int32_t OMR::ObjectModel::sizeofReferenceField() { return static_cast<int32_t>(sizeofReferenceAddress()); }
 
@@ -101,3 +107,73 @@ uintptr_t OMR::ObjectModel::decompressReference(TR::Compilation *comp, uintptr_t
 int32_t OMR::ObjectModel::compressedReferenceShiftOffset() { return 0; }
 
 int32_t OMR::ObjectModel::compressedReferenceShift() { return 0; }
+
+bool OMR::ObjectModel::registerAllocationHelper(void *helper, int32_t sizeArgument, int32_t fixedSizeInBytes,
+    bool allowsStackAllocation)
+{
+    if (helper == NULL || (sizeArgument < 0 && fixedSizeInBytes <= 0))
+        return false;
+
+    // Registering a helper again replaces its description
+    int32_t index = 0;
+    while (index < _numAllocationHelpers && _allocationHelpers[index]._helper != helper)
+        index++;
+    if (index == MAX_ALLOCATION_HELPERS)
+        return false;
+    if (index == _numAllocationHelpers)
+        _numAllocationHelpers++;
+
+    AllocationHelper &entry = _allocationHelpers[index];
+    entry._helper = helper;
+    entry._sizeArgument = sizeArgument;
+    entry._fixedSizeInBytes = fixedSizeInBytes;
+    entry._allowsStackAllocation = allowsStackAllocation;
+    return true;
+}
+
+OMR::ObjectModel::AllocationHelper *OMR::ObjectModel::findAllocationHelper(TR::Node *callNode)
+{
+    if (_numAllocationHelpers == 0 || !callNode->getOpCode().isCallDirect() || callNode->getDataType() != TR::Address)
+        return NULL;
+
+    TR::SymbolReference *symRef = callNode->getSymbolReference();
+    if (symRef->isUnresolved() || !symRef->getSymbol()->isMethod())
+        return NULL;
+
+    void *address = symRef->getSymbol()->castToMethodSymbol()->getMethodAddress();
+    for (int32_t i = 0; i < _numAllocationHelpers; i++) {
+        if (_allocationHelpers[i]._helper == address)
+            return &_allocationHelpers[i];
+    }
+    return NULL;
+}
+
+bool OMR::ObjectModel::isAllocationCall(TR::Compilation *comp, TR::Node *callNode, int32_t &sizeInBytes)
+{
+    AllocationHelper *entry = findAllocationHelper(callNode);
+    if (!entry)
+        return false;
+
+    sizeInBytes = -1;
+    if (entry->_sizeArgument < 0) {
+        sizeInBytes = entry->_fixedSizeInBytes;
+    } else {
+        int32_t childIndex = callNode->getFirstArgumentIndex() + entry->_sizeArgument;
+        if (childIndex >= callNode->getNumChildren())
+            return false;
+
+        TR::Node *sizeNode = callNode->getChild(childIndex);
+        if (sizeNode->getOpCode().isLoadConst() && sizeNode->getType().isIntegral()) {
+            int64_t size = sizeNode->get64bitIntegralValue();
+            if (size > 0 && size <= INT_MAX)
+                sizeInBytes = static_cast<int32_t>(size);
+        }
+    }
+    return true;
+}
+
+bool OMR::ObjectModel::allowsStackAllocation(TR::Node *callNode)
+{
+    AllocationHelper *entry = findAllocationHelper(callNode);
+    return entry && entry->_allowsStackAllocation;
+}
@@ -153,6 +153,66 @@ public:
     bool isOffHeapAllocationEnabled() { return false; }
 
     uintptr_t offsetOfContiguousDataAddrField() { return 0; }
+
+    // --------------------------------------------------------------------------
+    // Allocation helpers
+    //
+    // Front ends that allocate objects by calling out to a helper can describe
+    // those helpers here so that the optimizer can reason about the objects
+    // they return.  A registered helper must return a new, zero-initialized,
+    // non-null object of the requested size that is not reachable from
+    // anywhere else, and must have no other side effects visible to compiled
+    // code.  Helpers are registered during start-up, before any compilation.
+    //
+
+    /**
+     * @brief Register a function that allocates objects
+     * @param helper the address of the helper, as seen in the method symbol
+     *        of direct calls to it
+     * @param sizeArgument the index of the call argument giving the object size
+     *        in bytes, or -1 if every object it returns has the same size
+     * @param fixedSizeInBytes the object size when sizeArgument is -1
+     * @param allowsStackAllocation true if objects from this helper may be
+     *        allocated on the stack instead; only front ends whose collector
+     *        never scans or moves these objects should allow it
+     * @returns true if the helper was registered; registering a helper again
+     *          replaces its earlier description
+     */
+    bool registerAllocationHelper(void *helper, int32_t sizeArgument, int32_t fixedSizeInBytes = 0,
+        bool allowsStackAllocation = false);
+
+    /**
+     * @brief Determine whether a call allocates a new object
+     * @param callNode a call node
+     * @param sizeInBytes set to the size of the object, or to -1 if the size
+     *        is not a compile-time constant
+     * @returns true if callNode is a direct call to an allocation helper
+     */
+    bool isAllocationCall(TR::Compilation *comp, TR::Node *callNode, int32_t &sizeInBytes);
+
+    /**
+     * @brief Determine whether the object allocated by a call may live on the stack
+     * @param callNode a call for which isAllocationCall is true
+     * @returns true if the helper called was registered as allowing stack allocation
+     */
+    bool allowsStackAllocation(TR::Node *callNode);
+
+    bool hasAllocationHelpers() { return _numAllocationHelpers > 0; }
+
+private:
+    struct AllocationHelper {
+        void *_helper;
+        int32_t _sizeArgument;
+        int32_t _fixedSizeInBytes;
+        bool _allowsStackAllocation;
+    };
+
+    AllocationHelper *findAllocationHelper(TR::Node *callNode);
+
+    static const int32_t MAX_ALLOCATION_HELPERS = 8;
+
+    AllocationHelper _allocationHelpers[MAX_ALLOCATION_HELPERS];
+    int32_t _numAllocationHelpers;
 };
 } // namespace OMR
 
@@ -21,4 +21,29 @@
 
 #include "env/PersistentInfo.hpp"
 
+#include "control/CompiledBodyCache.hpp"
+#include "optimizer/BlockFrequencyProfiler.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
+
 TR::PersistentInfo *OMR::PersistentInfo::self() { return static_cast<TR::PersistentInfo *>(this); }
+
+TR_BlockFrequencyProfileTable *OMR::PersistentInfo::getBlockFrequencyProfiles()
+{
+    if (!_blockFrequencyProfiles)
+        _blockFrequencyProfiles = new (PERSISTENT_NEW) TR_BlockFrequencyProfileTable();
+    return _blockFrequencyProfiles;
+}
+
+TR_CompiledBodyCache *OMR::PersistentInfo::getCompiledBodyCache()
+{
+    if (!_compiledBodyCache)
+        _compiledBodyCache = new (PERSISTENT_NEW) TR_CompiledBodyCache();
+    return _compiledBodyCache;
+}
+
+TR::InliningMethodSummaryCache *OMR::PersistentInfo::getInliningMethodSummaryCache()
+{
+    if (!_inliningMethodSummaryCache)
+        _inliningMethodSummaryCache = new (PERSISTENT_NEW) TR::InliningMethodSummaryCache();
+    return _inliningMethodSummaryCache;
+}
@@ -36,6 +36,8 @@ typedef PersistentInfo PersistentInfoConnector;
 #include "codegen/TableOfConstants.hpp"
 
 class TR_AddressSet;
+class TR_BlockFrequencyProfileTable;
+class TR_CompiledBodyCache;
 class TR_FrontEnd;
 class TR_PersistentMemory;
 class TR_PseudoRandomNumbersListElement;
@@ -47,6 +49,7 @@ class Options;
 namespace TR {
 class PersistentInfo;
 class DebugCounterGroup;
+class InliningMethodSummaryCache;
 class Monitor;
 } // namespace TR
 
@@ -79,6 +82,9 @@ public:
         , _dynamicCounters(NULL)
         , _lastDebugCounterResetSeconds(0)
         , _persistentTOC(NULL)
+        , _blockFrequencyProfiles(NULL)
+        , _compiledBodyCache(NULL)
+        , _inliningMethodSummaryCache(NULL)
     {}
 
     TR::DebugCounterGroup *getStaticCounters()
@@ -125,6 +131,29 @@ public:
 
     void setPersistentTOC(TableOfConstants *toc) { _persistentTOC = toc; }
 
+    /**
+     * Table of block frequency profiles collected by instrumented bodies,
+     * created on first use.
+     */
+    TR_BlockFrequencyProfileTable *getBlockFrequencyProfiles();
+
+    /**
+     * Cache of compiled bodies keyed by the IL they were compiled from,
+     * created on first use.
+     */
+    TR_CompiledBodyCache *getCompiledBodyCache();
+
+    /**
+     * The compiled body cache, or NULL if no compilation has used it yet.
+     */
+    TR_CompiledBodyCache *getCompiledBodyCacheIfCreated() { return _compiledBodyCache; }
+
+    /**
+     * Cache of the method summaries built by the BenefitInliner, created on
+     * first use.
+     */
+    TR::InliningMethodSummaryCache *getInliningMethodSummaryCache();
+
     bool isObsoleteClass(void *v, TR_FrontEnd *fe) { return false; } // Has class been unloaded, replaced (HCR), etc.
 
     bool isRuntimeInstrumentationEnabled() { return false; }
@@ -141,6 +170,9 @@ private:
     TR::DebugCounterGroup *_dynamicCounters;
     int64_t _lastDebugCounterResetSeconds;
     TableOfConstants *_persistentTOC;
+    TR_BlockFrequencyProfileTable *_blockFrequencyProfiles;
+    TR_CompiledBodyCache *_compiledBodyCache;
+    TR::InliningMethodSummaryCache *_inliningMethodSummaryCache;
 };
 
 } // namespace OMR
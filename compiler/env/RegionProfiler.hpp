@@ -76,6 +76,20 @@ public:
         }
     }
 
+    /**
+     * @returns the bytes allocated from the region since the profiler was created
+     */
+    size_t regionBytesAllocated() const { return _region.bytesAllocated() - _initialRegionSize; }
+
+    /**
+     * @returns the growth of the segment provider's footprint since the profiler
+     *          was created, i.e. the scratch memory taken from the system
+     */
+    size_t segmentBytesAllocated() const
+    {
+        return _region._segmentProvider.bytesAllocated() - _initialSegmentProviderSize;
+    }
+
 private:
     TR::Region &_region;
     size_t const _initialRegionSize;
@@ -35,13 +35,29 @@ TR::NodePool::NodePool(TR::Compilation *comp)
     , _disableGC(true)
     , _globalIndex(0)
     , _nodeRegion(comp->trMemory()->heapMemoryRegion())
+    , _currentChunk(NULL)
 {}
 
-void TR::NodePool::cleanUp() { TR::Region::reset(_nodeRegion, _comp->trMemory()->heapMemoryRegion()); }
+void TR::NodePool::cleanUp()
+{
+    TR::Region::reset(_nodeRegion, _comp->trMemory()->heapMemoryRegion());
+    _currentChunk = NULL;
+}
+
+void TR::NodePool::allocateChunk()
+{
+    Chunk *chunk = static_cast<Chunk *>(_nodeRegion.allocate(sizeof(Chunk)));
+    chunk->_numNodes = 0;
+    chunk->_nodes = static_cast<uint8_t *>(_nodeRegion.allocate(NodesPerChunk * sizeof(TR::Node)));
+    _currentChunk = chunk;
+}
 
 TR::Node *TR::NodePool::allocate()
 {
-    TR::Node *newNode = static_cast<TR::Node *>(_nodeRegion.allocate(sizeof(TR::Node)));
+    if (!_currentChunk || _currentChunk->_numNodes == NodesPerChunk)
+        allocateChunk();
+
+    TR::Node *newNode = _currentChunk->getNode(_currentChunk->_numNodes++);
     memset(newNode, 0, sizeof(TR::Node));
     newNode->_globalIndex = ++_globalIndex;
     TR_ASSERT(_globalIndex < MAX_NODE_COUNT, "Reached TR::Node allocation limit");
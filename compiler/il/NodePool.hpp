@@ -34,11 +34,22 @@ template<class T> class TR_Array;
 
 namespace TR {
 
+/**
+ * Allocates the nodes of a compilation.
+ *
+ * Nodes are carved out of chunks that each hold NodesPerChunk nodes packed
+ * back to back, so nodes created together (which ILGen and most
+ * transformations do in tree-top order) share cache lines and pages.
+ */
 class NodePool {
 public:
     TR_ALLOC(TR_Memory::Compilation)
     NodePool(TR::Compilation *comp);
 
+    enum {
+        NodesPerChunk = 128
+    };
+
     TR::Node *allocate();
     bool deallocate(TR::Node *node);
     bool removeDeadNodes();
@@ -56,11 +67,21 @@ public:
     void cleanUp();
 
 private:
+    struct Chunk {
+        uint32_t _numNodes;
+        uint8_t *_nodes;
+
+        TR::Node *getNode(uint32_t i) { return reinterpret_cast<TR::Node *>(_nodes + i * sizeof(TR::Node)); }
+    };
+
+    void allocateChunk();
+
     TR::Compilation *_comp;
     bool _disableGC;
     ncount_t _globalIndex;
 
     TR::Region _nodeRegion;
+    Chunk *_currentChunk;
 };
 
 } // namespace TR
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_FIELD_INCL
+#define OMR_FIELD_INCL
+
+#include <stddef.h>
+#include "env/TRMemory.hpp"
+
+namespace TR {
+class IlType;
+class SymbolReference;
+} // namespace TR
+
+extern "C" {
+typedef void *(*ClientAllocator)(void *impl);
+typedef void *(*ImplGetter)(void *client);
+}
+
+namespace OMR {
+
+class FieldInfo;
+
+/**
+ * @brief pre-resolved handle for a field of a struct or union in a TypeDictionary
+ *
+ * Handles are obtained from TypeDictionary::LookupField() and can be passed to the
+ * IlBuilder LoadIndirect and StoreIndirect services in place of the type and field
+ * names, which avoids searching the TypeDictionary on every access.
+ */
+class Field {
+public:
+    TR_ALLOC(TR_Memory::IlGenerator)
+
+    Field(TR::IlType *owningType, const char *name, TR::IlType *type, size_t offset, OMR::FieldInfo *info)
+        : _client(0)
+        , _owningType(owningType)
+        , _name(name)
+        , _type(type)
+        , _offset(offset)
+        , _info(info)
+    {}
+
+    /**
+     * @brief returns the struct or union type that contains this field
+     */
+    TR::IlType *owningType() { return _owningType; }
+
+    /**
+     * @brief returns the name of this field
+     */
+    const char *getName() { return _name; }
+
+    /**
+     * @brief returns the type of this field
+     */
+    TR::IlType *getType() { return _type; }
+
+    /**
+     * @brief returns the offset of this field from the start of its owning type
+     */
+    size_t getOffset() { return _offset; }
+
+    /**
+     * @brief returns the TR::SymbolReference for this field in the current compilation
+     */
+    TR::SymbolReference *symRef();
+
+    /**
+     * @brief associates this object with a particular client object
+     */
+    void setClient(void *client) { _client = client; }
+
+    /**
+     * @brief returns the client object associated with this object
+     */
+    void *client();
+
+    /**
+     * @brief Set the Client Allocator function
+     *
+     * @param allocator a function pointer to the client object allocator
+     */
+    static void setClientAllocator(ClientAllocator allocator) { _clientAllocator = allocator; }
+
+    /**
+     * @brief Set the Get Impl function
+     *
+     * @param getter function pointer to the impl getter
+     */
+    static void setGetImpl(ImplGetter getter) { _getImpl = getter; }
+
+protected:
+    /**
+     * @brief pointer to a client object that corresponds to this object
+     */
+    void *_client;
+
+    /**
+     * @brief pointer to the function used to allocate an instance of a
+     * client object
+     */
+    static ClientAllocator _clientAllocator;
+
+    /**
+     * @brief pointer to impl getter function
+     */
+    static ImplGetter _getImpl;
+
+    TR::IlType *_owningType;
+    const char *_name;
+    TR::IlType *_type;
+    size_t _offset;
+
+    /**
+     * @brief TypeDictionary bookkeeping for this field, which caches its symbol reference
+     */
+    OMR::FieldInfo *_info;
+};
+
+} // namespace OMR
+
+#endif // !defined(OMR_FIELD_INCL)
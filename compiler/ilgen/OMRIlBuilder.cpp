@@ -43,9 +43,13 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/IlInjector.hpp"
+#include "ilgen/Field.hpp"
 #include "ilgen/IlReference.hpp"
+#include "ilgen/JitBuilderRecorder.hpp"
+#include "ilgen/LocalVariable.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
+#include "ilgen/StatementNames.hpp"
 #include "infra/Cfg.hpp"
 #include "infra/List.hpp"
 #include "ras/Logger.hpp"
@@ -90,6 +94,240 @@
 // control flow graph will not be connected together until all IlBuilder
 // objects have had injectIL() called.
 
+// Services are recorded through a RecordedService declared on entry. Only the outermost service active on a
+// MethodBuilder is recorded: services like ForLoop are implemented with other services, and replaying the
+// outer call generates the inner ones again. A service's result, any new builders it hands back, and any
+// types it refers to are given IDs before its statement is begun, because allocating an ID may write an
+// ID size change statement into the stream. Services that cannot be replayed call unsupported(), which
+// leaves the recording incomplete.
+class OMR::IlBuilder::RecordedService {
+public:
+    RecordedService(OMR::IlBuilder *builder)
+        : _builder(static_cast<TR::IlBuilder *>(builder))
+        , _methodBuilder(builder->_methodBuilder)
+        , _recorder(NULL)
+        , _left(NULL)
+        , _right(NULL)
+    {
+        _recorder = _methodBuilder->recorder();
+        _methodBuilder->enterRecordedService();
+    }
+
+    // binary operations often replace their operands with converted values, so the originals are kept here
+    RecordedService(OMR::IlBuilder *builder, TR::IlValue *left, TR::IlValue *right)
+        : _builder(static_cast<TR::IlBuilder *>(builder))
+        , _methodBuilder(builder->_methodBuilder)
+        , _recorder(NULL)
+        , _left(left)
+        , _right(right)
+    {
+        _recorder = _methodBuilder->recorder();
+        _methodBuilder->enterRecordedService();
+    }
+
+    ~RecordedService() { _methodBuilder->exitRecordedService(); }
+
+    TR::JitBuilderRecorder *recorder() { return _recorder; }
+
+    void unsupported()
+    {
+        if (_recorder != NULL)
+            _recorder->markIncomplete();
+    }
+
+    TR::IlValue *value(const char *statement, TR::IlValue *result)
+    {
+        if (_recorder != NULL) {
+            _recorder->EnsureAvailableID(result);
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->Value(result);
+            _recorder->EndStatement();
+        }
+        return result;
+    }
+
+    template<typename T> TR::IlValue *constant(const char *statement, T constValue, TR::IlValue *result)
+    {
+        if (_recorder != NULL) {
+            _recorder->EnsureAvailableID(result);
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->Number(constValue);
+            _recorder->Value(result);
+            _recorder->EndStatement();
+        }
+        return result;
+    }
+
+    TR::IlValue *named(const char *statement, const char *name, TR::IlValue *result)
+    {
+        if (_recorder != NULL) {
+            _recorder->EnsureAvailableID(result);
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->String(name);
+            _recorder->Value(result);
+            _recorder->EndStatement();
+        }
+        return result;
+    }
+
+    void store(const char *statement, const char *name, TR::IlValue *value)
+    {
+        if (_recorder != NULL) {
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->String(name);
+            _recorder->Value(value);
+            _recorder->EndStatement();
+        }
+    }
+
+    void store(const char *statement, TR::IlValue *dest, TR::IlValue *value)
+    {
+        if (_recorder != NULL) {
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->Value(dest);
+            _recorder->Value(value);
+            _recorder->EndStatement();
+        }
+    }
+
+    TR::IlValue *unary(const char *statement, TR::IlValue *v, TR::IlValue *result)
+    {
+        if (_recorder != NULL) {
+            _recorder->EnsureAvailableID(result);
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->Value(v);
+            _recorder->Value(result);
+            _recorder->EndStatement();
+        }
+        return result;
+    }
+
+    TR::IlValue *binary(const char *statement, TR::IlValue *result)
+    {
+        if (_recorder != NULL) {
+            _recorder->EnsureAvailableID(result);
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->Value(_left);
+            _recorder->Value(_right);
+            _recorder->Value(result);
+            _recorder->EndStatement();
+        }
+        return result;
+    }
+
+    TR::IlValue *typed(const char *statement, TR::IlType *type, TR::IlValue *v, TR::IlValue *result)
+    {
+        if (_recorder != NULL) {
+            _recorder->EnsureType(type);
+            _recorder->EnsureAvailableID(result);
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->Type(type);
+            _recorder->Value(v);
+            _recorder->Value(result);
+            _recorder->EndStatement();
+        }
+        return result;
+    }
+
+    // starts a statement issued by this service's builder; the caller writes the operands and ends it
+    void begin(const char *statement) { _recorder->BeginStatement(_builder, statement); }
+
+    void statement(const char *statement, TR::IlValue *operand = NULL)
+    {
+        if (_recorder != NULL) {
+            _recorder->BeginStatement(_builder, statement);
+            if (operand != NULL)
+                _recorder->Value(operand);
+            _recorder->EndStatement();
+        }
+    }
+
+    TR::IlBuilder *newBuilder(const char *statement, TR::IlBuilder *builder)
+    {
+        if (_recorder != NULL) {
+            _recorder->StoreID(builder);
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->Builder(builder);
+            _recorder->EndStatement();
+        }
+        return builder;
+    }
+
+    // comparison operands are only written when given, so the statement name determines how many there are
+    void branch(const char *statement, TR::IlBuilder *target, TR::IlValue *left = NULL, TR::IlValue *right = NULL)
+    {
+        if (_recorder != NULL) {
+            _recorder->EnsureAvailableID(target);
+            _recorder->BeginStatement(_builder, statement);
+            _recorder->Builder(target);
+            if (left != NULL)
+                _recorder->Value(left);
+            if (right != NULL)
+                _recorder->Value(right);
+            _recorder->EndStatement();
+        }
+    }
+
+    TR::IlValue *call(const char *functionName, TR::ResolvedMethod *method, int32_t numArgs, TR::IlValue **argValues,
+        TR::IlValue *result)
+    {
+        if (_recorder == NULL)
+            return result;
+
+        // calls back to the method being built do not need a definition: it is found by name
+        if (method != _builder->_methodSymbol->getResolvedMethod() && !_recorder->EnsureAvailableID(method))
+            defineFunction(method);
+
+        _recorder->EnsureAvailableID(result);
+        _recorder->BeginStatement(_builder, OMR::StatementName::STATEMENT_CALL);
+        _recorder->String(functionName);
+        _recorder->Number(numArgs);
+        for (int32_t a = 0; a < numArgs; a++)
+            _recorder->Value(argValues[a]);
+        _recorder->Value(result);
+        _recorder->EndStatement();
+        return result;
+    }
+
+    // a builder handed back through a TR::IlBuilder ** parameter, written as 0 if no parameter was passed
+    void ensureBuilder(TR::IlBuilder **builder)
+    {
+        if (builder != NULL)
+            _recorder->EnsureAvailableID(*builder);
+    }
+
+    void builder(TR::IlBuilder **builder) { _recorder->Builder(builder != NULL ? *builder : NULL); }
+
+private:
+    void defineFunction(TR::ResolvedMethod *method)
+    {
+        TR::TypeDictionary *types = _builder->typeDictionary();
+        int32_t numParms = method->getNumArgs();
+        TR::IlType *returnType = types->PrimitiveType(method->returnType());
+        _recorder->EnsureType(returnType);
+        for (int32_t p = 0; p < numParms; p++)
+            _recorder->EnsureType(types->PrimitiveType(method->parmType(p)));
+
+        _recorder->BeginStatement(_methodBuilder, OMR::StatementName::STATEMENT_DEFINEFUNCTION);
+        _recorder->String(method->nameChars());
+        _recorder->String(method->classNameChars());
+        _recorder->String(method->getLineNumber());
+        _recorder->Location(method->getEntryPoint());
+        _recorder->Type(returnType);
+        _recorder->Number(numParms);
+        for (int32_t p = 0; p < numParms; p++)
+            _recorder->Type(types->PrimitiveType(method->parmType(p)));
+        _recorder->Function(method);
+        _recorder->EndStatement();
+    }
+
+    TR::IlBuilder *_builder;
+    TR::MethodBuilder *_methodBuilder;
+    TR::JitBuilderRecorder *_recorder;
+    TR::IlValue *_left;
+    TR::IlValue *_right;
+};
+
 OMR::IlBuilder::IlBuilder(TR::IlBuilder *source)
     : TR::IlInjector(source)
     , _client(0)
@@ -249,6 +487,7 @@ TR::IlValue *OMR::IlBuilder::NewValue(TR::IlType *dt)
 
 TR::IlValue *OMR::IlBuilder::Copy(TR::IlValue *value)
 {
+    RecordedService service(this);
     TR::DataType dt = value->getDataType();
     TR::SymbolReference *newSymRef = symRefTab()->createTemporary(_methodSymbol, dt);
     const size_t nameSize = (2 + 10 + 1) * sizeof(char); // 2 ("_T") + max 10 digits + trailing zero
@@ -265,7 +504,7 @@ TR::IlValue *OMR::IlBuilder::Copy(TR::IlValue *value)
     TraceIL("IlBuilder[ %p ]::%d is Copy value (%d) dataType (%d) at cpIndex (%d)\n", this, newVal->getID(),
         value->getID(), dt.getDataType(), newVal->getID(), newSymRef->getCPIndex());
 
-    return newVal;
+    return service.unary(OMR::StatementName::STATEMENT_COPY, value, newVal);
 }
 
 TR::TreeTop *OMR::IlBuilder::getFirstTree()
@@ -449,15 +688,19 @@ TR::IlValue *OMR::IlBuilder::zeroForValue(TR::IlValue *v)
 
 TR::IlBuilder *OMR::IlBuilder::OrphanBuilder()
 {
+    RecordedService service(this);
     TR::IlBuilder *orphan = new (comp()->trHeapMemory()) TR::IlBuilder(_methodBuilder, _types);
     orphan->initialize(_details, _methodSymbol, _fe, _symRefTab);
     orphan->setupForBuildIL();
     TraceIL("IlBuilder[ %p ]::OrphanBuilder created %p\n", this, orphan);
-    return orphan;
+    return service.newBuilder(OMR::StatementName::STATEMENT_NEWILBUILDER, orphan);
 }
 
 TR::BytecodeBuilder *OMR::IlBuilder::OrphanBytecodeBuilder(int32_t bcIndex, const char *name)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR::BytecodeBuilder *orphan = new (comp()->trHeapMemory()) TR::BytecodeBuilder(_methodBuilder, bcIndex, name);
     orphan->initialize(_details, _methodSymbol, _fe, _symRefTab);
     orphan->setupForBuildIL();
@@ -511,6 +754,9 @@ void OMR::IlBuilder::AppendBuilder(TR::IlBuilder *builder)
     TR_ASSERT_FATAL(builder->_partOfSequence == false, "builder cannot be in two places");
     TraceIL("IlBuilder[ %p ]::AppendBuilder %p\n", this, builder);
 
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_APPENDBUILDER, builder);
+
     builder->_partOfSequence = true;
     _sequenceAppender->add(builderEntry(builder));
     if (_currentBlock != NULL) {
@@ -573,6 +819,9 @@ TR::IlValue *OMR::IlBuilder::indirectLoadNode(TR::IlType *dt, TR::Node *addr, bo
  */
 void OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
 {
+    RecordedService service(this);
+    service.store(OMR::StatementName::STATEMENT_STORE, varName, value);
+
     if (!_methodBuilder->symbolDefined(varName))
         _methodBuilder->defineValue(varName, _types->PrimitiveType(value->getDataType()));
     TR::SymbolReference *symRef = lookupSymbol(varName);
@@ -589,6 +838,9 @@ void OMR::IlBuilder::Store(const char *varName, TR::IlValue *value)
  */
 void OMR::IlBuilder::StoreOver(TR::IlValue *dest, TR::IlValue *value)
 {
+    RecordedService service(this);
+    service.store(OMR::StatementName::STATEMENT_STOREOVER, dest, value);
+
     TraceIL("IlBuilder[ %p ]::%d is StoreOver %d\n", this, dest->getID(), value->getID());
     dest->storeOver(value, _currentBlock);
 }
@@ -603,6 +855,9 @@ void OMR::IlBuilder::StoreOver(TR::IlValue *dest, TR::IlValue *value)
  */
 void OMR::IlBuilder::VectorStore(const char *varName, TR::IlValue *value)
 {
+    RecordedService service(this);
+    service.store(OMR::StatementName::STATEMENT_VECTORSTORE, varName, value);
+
     TR::Node *valueNode = loadValue(value);
     TR::DataType dt = valueNode->getDataType();
     if (!dt.isVector()) {
@@ -627,6 +882,9 @@ void OMR::IlBuilder::StoreAt(TR::IlValue *address, TR::IlValue *value)
 {
     TR_ASSERT_FATAL(address->getDataType() == TR::Address, "StoreAt needs an address operand");
 
+    RecordedService service(this);
+    service.store(OMR::StatementName::STATEMENT_STOREAT, address, value);
+
     TraceIL("IlBuilder[ %p ]::StoreAt address %d gets %d\n", this, address->getID(), value->getID());
     indirectStoreNode(loadValue(address), loadValue(value));
 }
@@ -641,6 +899,9 @@ void OMR::IlBuilder::VectorStoreAt(TR::IlValue *address, TR::IlValue *value)
 {
     TR_ASSERT_FATAL(address->getDataType() == TR::Address, "VectorStoreAt needs an address operand");
 
+    RecordedService service(this);
+    service.store(OMR::StatementName::STATEMENT_VECTORSTOREAT, address, value);
+
     TraceIL("IlBuilder[ %p ]::VectorStoreAt address %d gets %d\n", this, address->getID(), value->getID());
 
     TR::Node *valueNode = loadValue(value);
@@ -656,6 +917,7 @@ void OMR::IlBuilder::VectorStoreAt(TR::IlValue *address, TR::IlValue *value)
 
 TR::IlValue *OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *elementType)
 {
+    RecordedService service(this);
     uint32_t size = static_cast<uint32_t>(numElements * elementType->getSize());
     TR::SymbolReference *localArraySymRef
         = symRefTab()->createLocalPrimArray(size, methodSymbol(), 8 /*FIXME: JVM-specific - byte*/);
@@ -671,11 +933,23 @@ TR::IlValue *OMR::IlBuilder::CreateLocalArray(int32_t numElements, TR::IlType *e
 
     TraceIL("IlBuilder[ %p ]::%d is CreateLocalArray array allocated %d bytes\n", this, arrayAddressValue->getID(),
         size);
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        rec->EnsureType(elementType);
+        rec->StoreID(arrayAddressValue);
+        service.begin(OMR::StatementName::STATEMENT_CREATELOCALARRAY);
+        rec->Number(numElements);
+        rec->Type(elementType);
+        rec->Value(arrayAddressValue);
+        rec->EndStatement();
+    }
     return arrayAddressValue;
 }
 
 TR::IlValue *OMR::IlBuilder::CreateLocalStruct(TR::IlType *structType)
 {
+    RecordedService service(this);
+
     // similar to CreateLocalArray except writing a method in StructType to get the struct size
     uint32_t size = static_cast<uint32_t>(structType->getSize());
     TR::SymbolReference *localStructSymRef
@@ -692,11 +966,31 @@ TR::IlValue *OMR::IlBuilder::CreateLocalStruct(TR::IlType *structType)
 
     TraceIL("IlBuilder[ %p ]::%d is CreateLocalStruct struct allocated %d bytes\n", this, structAddressValue->getID(),
         size);
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        rec->EnsureType(structType);
+        rec->StoreID(structAddressValue);
+        service.begin(OMR::StatementName::STATEMENT_CREATELOCALSTRUCT);
+        rec->Type(structType);
+        rec->Value(structAddressValue);
+        rec->EndStatement();
+    }
     return structAddressValue;
 }
 
 void OMR::IlBuilder::StoreIndirect(const char *type, const char *field, TR::IlValue *object, TR::IlValue *value)
 {
+    RecordedService service(this);
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        service.begin(OMR::StatementName::STATEMENT_STOREINDIRECT);
+        rec->String(type);
+        rec->String(field);
+        rec->Value(object);
+        rec->Value(value);
+        rec->EndStatement();
+    }
+
     TR::IlReference *fieldRef = _types->FieldReference(type, field);
     TR::SymbolReference *symRef = fieldRef->symRef();
     TR::DataType fieldType = symRef->getSymbol()->getDataType();
@@ -709,16 +1003,18 @@ void OMR::IlBuilder::StoreIndirect(const char *type, const char *field, TR::IlVa
 
 TR::IlValue *OMR::IlBuilder::Load(const char *name)
 {
+    RecordedService service(this);
     TR::SymbolReference *symRef = lookupSymbol(name);
     TR::Node *valueNode = TR::Node::createLoad(symRef);
     TR::IlValue *returnValue = newValue(symRef->getSymbol()->getDataType(), valueNode);
     TraceIL("IlBuilder[ %p ]::%d is Load %s from symref %d\n", this, returnValue->getID(), name,
         symRef->getReferenceNumber());
-    return returnValue;
+    return service.named(OMR::StatementName::STATEMENT_LOAD, name, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::VectorLoad(const char *name)
 {
+    RecordedService service(this);
     TR::SymbolReference *nameSymRef = lookupSymbol(name);
     TR::DataType returnType = nameSymRef->getSymbol()->getDataType();
     TR_ASSERT_FATAL(returnType.isVector(), "VectorLoad must load symbol with a vector type");
@@ -727,11 +1023,12 @@ TR::IlValue *OMR::IlBuilder::VectorLoad(const char *name)
     TR::IlValue *returnValue = newValue(returnType, loadNode);
     TraceIL("IlBuilder[ %p ]::%d is VectorLoad %s (%d)\n", this, returnValue->getID(), name, nameSymRef->getCPIndex());
 
-    return returnValue;
+    return service.named(OMR::StatementName::STATEMENT_VECTORLOAD, name, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::LoadIndirect(const char *type, const char *field, TR::IlValue *object)
 {
+    RecordedService service(this);
     TR::IlReference *fieldRef = _types->FieldReference(type, field);
     TR::SymbolReference *symRef = fieldRef->symRef();
     TR::DataType fieldType = symRef->getSymbol()->getDataType();
@@ -740,29 +1037,121 @@ TR::IlValue *OMR::IlBuilder::LoadIndirect(const char *type, const char *field, T
     TraceIL("IlBuilder[ %p ]::%d is LoadIndirect %s.%s from (%d)\n", this, returnValue->getID(), type, field,
         object->getID());
     jitPersistentFree(fieldRef);
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        rec->StoreID(returnValue);
+        service.begin(OMR::StatementName::STATEMENT_LOADINDIRECT);
+        rec->String(type);
+        rec->String(field);
+        rec->Value(object);
+        rec->Value(returnValue);
+        rec->EndStatement();
+    }
+    return returnValue;
+}
+
+/**
+ * @brief Load the value of a local variable through a handle from MethodBuilder::LookupLocal
+ * @param var handle for the local variable, which must belong to this builder's MethodBuilder
+ */
+TR::IlValue *OMR::IlBuilder::Load(TR::LocalVariable *var)
+{
+    RecordedService service(this);
+    TR_ASSERT_FATAL(var->methodBuilder() == _methodBuilder, "Local variable '%s' belongs to a different MethodBuilder",
+        var->getName());
+    TR::SymbolReference *symRef = var->symRef();
+    TR::Node *valueNode = TR::Node::createLoad(symRef);
+    TR::IlValue *returnValue = newValue(symRef->getSymbol()->getDataType(), valueNode);
+    TraceIL("IlBuilder[ %p ]::%d is Load %s from symref %d\n", this, returnValue->getID(), var->getName(),
+        symRef->getReferenceNumber());
+    return service.named(OMR::StatementName::STATEMENT_LOAD, var->getName(), returnValue);
+}
+
+/**
+ * @brief Store an IlValue into a local variable through a handle from MethodBuilder::LookupLocal
+ * @param var handle for the local variable, which must belong to this builder's MethodBuilder
+ * @param value IlValue that should be written to the local variable
+ */
+void OMR::IlBuilder::Store(TR::LocalVariable *var, TR::IlValue *value)
+{
+    TR_ASSERT_FATAL(var->methodBuilder() == _methodBuilder, "Local variable '%s' belongs to a different MethodBuilder",
+        var->getName());
+    RecordedService service(this);
+    service.store(OMR::StatementName::STATEMENT_STORE, var->getName(), value);
+
+    TR::SymbolReference *symRef = var->symRef();
+
+    TraceIL("IlBuilder[ %p ]::Store %s %d (%d) gets %d\n", this, var->getName(), symRef->getCPIndex(),
+        symRef->getReferenceNumber(), value->getID());
+    storeNode(symRef, loadValue(value));
+}
+
+TR::IlValue *OMR::IlBuilder::LoadIndirect(TR::Field *field, TR::IlValue *object)
+{
+    RecordedService service(this);
+    TR::SymbolReference *symRef = field->symRef();
+    TR::DataType fieldType = symRef->getSymbol()->getDataType();
+    TR::IlValue *returnValue = newValue(fieldType,
+        TR::Node::createWithSymRef(comp()->il.opCodeForIndirectLoad(fieldType), 1, loadValue(object), 0, symRef));
+    TraceIL("IlBuilder[ %p ]::%d is LoadIndirect %s.%s from (%d)\n", this, returnValue->getID(),
+        field->owningType()->getName(), field->getName(), object->getID());
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        rec->StoreID(returnValue);
+        service.begin(OMR::StatementName::STATEMENT_LOADINDIRECT);
+        rec->String(field->owningType()->getName());
+        rec->String(field->getName());
+        rec->Value(object);
+        rec->Value(returnValue);
+        rec->EndStatement();
+    }
     return returnValue;
 }
 
+void OMR::IlBuilder::StoreIndirect(TR::Field *field, TR::IlValue *object, TR::IlValue *value)
+{
+    RecordedService service(this);
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        service.begin(OMR::StatementName::STATEMENT_STOREINDIRECT);
+        rec->String(field->owningType()->getName());
+        rec->String(field->getName());
+        rec->Value(object);
+        rec->Value(value);
+        rec->EndStatement();
+    }
+
+    TR::SymbolReference *symRef = field->symRef();
+    TR::DataType fieldType = symRef->getSymbol()->getDataType();
+    TraceIL("IlBuilder[ %p ]::StoreIndirect %s.%s = %d (base is %d)\n", this, field->owningType()->getName(),
+        field->getName(), value->getID(), object->getID());
+    TR::ILOpCodes storeOp = comp()->il.opCodeForIndirectStore(fieldType);
+    genTreeTop(TR::Node::createWithSymRef(storeOp, 2, loadValue(object), loadValue(value), 0, symRef));
+}
+
 TR::IlValue *OMR::IlBuilder::LoadAt(TR::IlType *dt, TR::IlValue *address)
 {
+    RecordedService service(this);
     TR_ASSERT_FATAL(address->getDataType() == TR::Address, "LoadAt needs an address operand");
     TR::IlValue *returnValue = indirectLoadNode(dt, loadValue(address));
     TraceIL("IlBuilder[ %p ]::%d is LoadAt type %d address %d\n", this, returnValue->getID(),
         dt->getPrimitiveType().getDataType(), address->getID());
-    return returnValue;
+    return service.typed(OMR::StatementName::STATEMENT_LOADAT, dt, address, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::VectorLoadAt(TR::IlType *dt, TR::IlValue *address)
 {
+    RecordedService service(this);
     TR_ASSERT_FATAL(address->getDataType() == TR::Address, "LoadAt needs an address operand");
     TR::IlValue *returnValue = indirectLoadNode(dt, loadValue(address), true);
     TraceIL("IlBuilder[ %p ]::%d is VectorLoadAt type %d address %d\n", this, returnValue->getID(),
         dt->getPrimitiveType().getDataType(), address->getID());
-    return returnValue;
+    return service.typed(OMR::StatementName::STATEMENT_VECTORLOADAT, dt, address, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlValue *index)
 {
+    RecordedService service(this);
     TR::IlType *elemType = dt->baseType();
     TR_ASSERT_FATAL(base->getDataType() == TR::Address, "IndexAt must be called with a pointer base");
     TR_ASSERT_FATAL(elemType != NULL, "IndexAt should be called with pointer type");
@@ -799,6 +1188,17 @@ TR::IlValue *OMR::IlBuilder::IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlVa
     TraceIL("IlBuilder[ %p ]::%d is IndexAt(%s) base %d index %d\n", this, address->getID(), dt->getName(),
         base->getID(), index->getID());
 
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        rec->EnsureType(dt);
+        rec->StoreID(address);
+        service.begin(OMR::StatementName::STATEMENT_INDEXAT);
+        rec->Type(dt);
+        rec->Value(base);
+        rec->Value(index);
+        rec->Value(address);
+        rec->EndStatement();
+    }
     return address;
 }
 
@@ -843,59 +1243,68 @@ TR::IlValue *OMR::IlBuilder::UnionFieldInstanceAddress(const char *unionName, co
 
 TR::IlValue *OMR::IlBuilder::NullAddress()
 {
+    RecordedService service(this);
     TR::IlValue *returnValue = newValue(Address, TR::Node::aconst(0));
     TraceIL("IlBuilder[ %p ]::%d is NullAddress\n", this, returnValue->getID());
-    return returnValue;
+    return service.value(OMR::StatementName::STATEMENT_NULLADDRESS, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::ConstInt8(int8_t value)
 {
+    RecordedService service(this);
     TR::IlValue *returnValue = newValue(Int8, TR::Node::bconst(value));
     TraceIL("IlBuilder[ %p ]::%d is ConstInt8 %d\n", this, returnValue->getID(), value);
-    return returnValue;
+    return service.constant(OMR::StatementName::STATEMENT_CONSTINT8, value, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::ConstInt16(int16_t value)
 {
+    RecordedService service(this);
     TR::IlValue *returnValue = newValue(Int16, TR::Node::sconst(value));
     TraceIL("IlBuilder[ %p ]::%d is ConstInt16 %d\n", this, returnValue->getID(), value);
-    return returnValue;
+    return service.constant(OMR::StatementName::STATEMENT_CONSTINT16, value, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::ConstInt32(int32_t value)
 {
+    RecordedService service(this);
     TR::IlValue *returnValue = newValue(Int32, TR::Node::iconst(value));
     TraceIL("IlBuilder[ %p ]::%d is ConstInt32 %d\n", this, returnValue->getID(), value);
-    return returnValue;
+    return service.constant(OMR::StatementName::STATEMENT_CONSTINT32, value, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::ConstInt64(int64_t value)
 {
+    RecordedService service(this);
     TR::IlValue *returnValue = newValue(Int64, TR::Node::lconst(value));
     TraceIL("IlBuilder[ %p ]::%d is ConstInt64 %lld\n", this, returnValue->getID(), value);
-    return returnValue;
+    return service.constant(OMR::StatementName::STATEMENT_CONSTINT64, value, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::ConstFloat(float value)
 {
+    RecordedService service(this);
     TR::Node *fconstNode = TR::Node::create(0, TR::fconst, 0);
     fconstNode->setFloat(value);
     TR::IlValue *returnValue = newValue(Float, fconstNode);
     TraceIL("IlBuilder[ %p ]::%d is ConstFloat %f\n", this, returnValue->getID(), value);
-    return returnValue;
+    return service.constant(OMR::StatementName::STATEMENT_CONSTFLOAT, value, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::ConstDouble(double value)
 {
+    RecordedService service(this);
     TR::Node *dconstNode = TR::Node::create(0, TR::dconst, 0);
     dconstNode->setDouble(value);
     TR::IlValue *returnValue = newValue(Double, dconstNode);
     TraceIL("IlBuilder[ %p ]::%d is ConstDouble %lf\n", this, returnValue->getID(), value);
-    return returnValue;
+    return service.constant(OMR::StatementName::STATEMENT_CONSTDOUBLE, value, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::ConstString(const char * const value)
 {
+    RecordedService service(this);
+    service.unsupported();
     TR::IlValue *returnValue = newValue(Address, TR::Node::aconst((uintptr_t)value));
     TraceIL("IlBuilder[ %p ]::%d is ConstString %p\n", this, returnValue->getID(), value);
     return returnValue;
@@ -903,8 +1312,17 @@ TR::IlValue *OMR::IlBuilder::ConstString(const char * const value)
 
 TR::IlValue *OMR::IlBuilder::ConstAddress(const void * const value)
 {
+    RecordedService service(this);
     TR::IlValue *returnValue = newValue(Address, TR::Node::aconst((uintptr_t)value));
     TraceIL("IlBuilder[ %p ]::%d is ConstAddress %p\n", this, returnValue->getID(), value);
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        rec->StoreID(returnValue);
+        service.begin(OMR::StatementName::STATEMENT_CONSTADDRESS);
+        rec->Location(value);
+        rec->Value(returnValue);
+        rec->EndStatement();
+    }
     return returnValue;
 }
 
@@ -925,35 +1343,38 @@ TR::IlValue *OMR::IlBuilder::ConstInteger(TR::IlType *intType, int64_t value)
 
 TR::IlValue *OMR::IlBuilder::ConvertTo(TR::IlType *t, TR::IlValue *v)
 {
+    RecordedService service(this);
     TR::DataType typeFrom = v->getDataType();
     TR::DataType typeTo = t->getPrimitiveType();
     if (typeFrom == typeTo) {
         TraceIL("IlBuilder[ %p ]::%d is ConvertTo (already has type %s) %d\n", this, v->getID(), t->getName(),
             v->getID());
-        return v;
+        return service.typed(OMR::StatementName::STATEMENT_CONVERTTO, t, v, v);
     }
     TR::IlValue *convertedValue = convertTo(typeTo, v, false);
     TraceIL("IlBuilder[ %p ]::%d is ConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
-    return convertedValue;
+    return service.typed(OMR::StatementName::STATEMENT_CONVERTTO, t, v, convertedValue);
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedConvertTo(TR::IlType *t, TR::IlValue *v)
 {
+    RecordedService service(this);
     TR::DataType typeFrom = v->getDataType();
     TR::DataType typeTo = t->getPrimitiveType();
     if (typeFrom == typeTo) {
         TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo (already has type %s) %d\n", this, v->getID(), t->getName(),
             v->getID());
-        return v;
+        return service.typed(OMR::StatementName::STATEMENT_UNSIGNEDCONVERTTO, t, v, v);
     }
     TR::IlValue *convertedValue = convertTo(typeTo, v, true);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedConvertTo(%s) %d\n", this, convertedValue->getID(), t->getName(),
         v->getID());
-    return convertedValue;
+    return service.typed(OMR::StatementName::STATEMENT_UNSIGNEDCONVERTTO, t, v, convertedValue);
 }
 
 TR::IlValue *OMR::IlBuilder::Negate(TR::IlValue *v)
 {
+    RecordedService service(this);
     TR::DataType dataType = v->getDataType();
 
     TR::ILOpCodes negateOp = ILOpCode::negateOpCode(dataType);
@@ -963,7 +1384,7 @@ TR::IlValue *OMR::IlBuilder::Negate(TR::IlValue *v)
     TR::Node *result = TR::Node::create(negateOp, 1, loadValue(v));
     TR::IlValue *negatedValue = newValue(dataType, result);
     TraceIL("IlBuilder[ %p ]::%d is Negate %d\n", this, negatedValue->getID(), v->getID());
-    return negatedValue;
+    return service.unary(OMR::StatementName::STATEMENT_NEGATE, v, negatedValue);
 }
 
 TR::IlValue *OMR::IlBuilder::convertTo(TR::DataType typeTo, TR::IlValue *v, bool needUnsigned)
@@ -981,13 +1402,14 @@ TR::IlValue *OMR::IlBuilder::convertTo(TR::DataType typeTo, TR::IlValue *v, bool
 
 TR::IlValue *OMR::IlBuilder::ConvertBitsTo(TR::IlType *t, TR::IlValue *v)
 {
+    RecordedService service(this);
     TR::DataType typeFrom = v->getDataType();
     TR::DataType typeTo = t->getPrimitiveType();
 
     if (typeTo == typeFrom) {
         TraceIL("IlBuilder[ %p ]::%d is ConvertBitsTo (already has type %s) %d\n", this, v->getID(), t->getName(),
             v->getID());
-        return v;
+        return service.typed(OMR::StatementName::STATEMENT_CONVERTBITSTO, t, v, v);
     }
 
     TR::ILOpCodes convertOpcode = TR::ILOpCode::getDataTypeBitConversion(typeFrom, typeTo);
@@ -1003,7 +1425,7 @@ TR::IlValue *OMR::IlBuilder::ConvertBitsTo(TR::IlType *t, TR::IlValue *v)
     TR::Node *result = TR::Node::create(convertOpcode, 1, loadValue(v));
     TR::IlValue *convertedValue = newValue(t, result);
     TraceIL("IlBuilder[ %p ]::%d is ConvertBitsTo(%s) %d\n", this, convertedValue->getID(), t->getName(), v->getID());
-    return convertedValue;
+    return service.typed(OMR::StatementName::STATEMENT_CONVERTBITSTO, t, v, convertedValue);
 }
 
 TR::IlValue *OMR::IlBuilder::unaryOp(TR::ILOpCodes op, TR::IlValue *v)
@@ -1101,14 +1523,17 @@ TR::IlValue *OMR::IlBuilder::compareOp(TR_ComparisonTypes ct, bool needUnsigned,
 
 TR::IlValue *OMR::IlBuilder::NotEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = compareOp(TR_cmpNE, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is NotEqualTo %d != %d?\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_NOTEQUALTO, returnValue);
 }
 
 void OMR::IlBuilder::Goto(TR::IlBuilder **dest)
 {
+    RecordedService service(this);
     *dest = createBuilderIfNeeded(*dest);
+    service.branch(OMR::StatementName::STATEMENT_GOTO, *dest);
     Goto(*dest);
     TraceIL("IlBuilder[ %p ]::Goto %p\n", this, *dest);
 }
@@ -1116,6 +1541,8 @@ void OMR::IlBuilder::Goto(TR::IlBuilder **dest)
 void OMR::IlBuilder::Goto(TR::IlBuilder *dest)
 {
     TR_ASSERT_FATAL(dest != NULL, "This goto implementation requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_GOTO, dest);
     TraceIL("IlBuilder[ %p ]::Goto %p\n", this, dest);
     appendGoto(dest->getEntry());
     setDoesNotComeBack();
@@ -1123,6 +1550,9 @@ void OMR::IlBuilder::Goto(TR::IlBuilder *dest)
 
 void OMR::IlBuilder::Return()
 {
+    RecordedService service(this);
+    service.statement(OMR::StatementName::STATEMENT_RETURN);
+
     TR::IlBuilder *returnBuilder = _methodBuilder->returnBuilder();
     if (returnBuilder != NULL) {
         TR_ASSERT_FATAL(_methodBuilder->returnSymbol() == NULL,
@@ -1142,6 +1572,9 @@ void OMR::IlBuilder::Return()
 
 void OMR::IlBuilder::Return(TR::IlValue *value)
 {
+    RecordedService service(this);
+    service.statement(OMR::StatementName::STATEMENT_RETURNVALUE, value);
+
     TR::DataType retType = value->getDataType();
     if (value->getDataType() == TR::Int8 || value->getDataType() == TR::Int16
         || (Word == Int64 && value->getDataType() == TR::Int32)) {
@@ -1182,6 +1615,7 @@ void OMR::IlBuilder::Return(TR::IlValue *value)
 
 TR::IlValue *OMR::IlBuilder::Sub(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = NULL;
     if (left->getDataType() == TR::Address) {
         TR::IlValue *zero;
@@ -1217,7 +1651,7 @@ TR::IlValue *OMR::IlBuilder::Sub(TR::IlValue *left, TR::IlValue *right)
         returnValue = binaryOpFromOpMap(TR::ILOpCode::subtractOpCode, left, right);
     }
     TraceIL("IlBuilder[ %p ]::%d is Sub %d - %d\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_SUB, returnValue);
 }
 
 static TR::ILOpCodes addOpCode(TR::DataType type)
@@ -1232,6 +1666,7 @@ static TR::ILOpCodes unsignedAddOpCode(TR::DataType type)
 
 TR::IlValue *OMR::IlBuilder::Add(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = NULL;
     if (left->getDataType() == TR::Address) {
         if (TR::Compiler->target.is64Bit() && right->getDataType() == TR::Int32) {
@@ -1245,7 +1680,7 @@ TR::IlValue *OMR::IlBuilder::Add(TR::IlValue *left, TR::IlValue *right)
         returnValue = binaryOpFromOpMap(addOpCode, left, right);
     }
     TraceIL("IlBuilder[ %p ]::%d is Add %d + %d\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_ADD, returnValue);
 }
 
 /*
@@ -1351,6 +1786,9 @@ TR::ILOpCodes OMR::IlBuilder::getOpCode(TR::IlValue *leftValue, TR::IlValue *rig
 
 TR::IlValue *OMR::IlBuilder::AddWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR::Node *leftNode = loadValue(left);
     TR::Node *rightNode = loadValue(right);
     TR::ILOpCodes opcode = getOpCode(left, right);
@@ -1361,6 +1799,9 @@ TR::IlValue *OMR::IlBuilder::AddWithOverflow(TR::IlBuilder **handler, TR::IlValu
 
 TR::IlValue *OMR::IlBuilder::AddWithUnsignedOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR::Node *leftNode = loadValue(left);
     TR::Node *rightNode = loadValue(right);
     TR::ILOpCodes opcode = getOpCode(left, right);
@@ -1372,6 +1813,9 @@ TR::IlValue *OMR::IlBuilder::AddWithUnsignedOverflow(TR::IlBuilder **handler, TR
 
 TR::IlValue *OMR::IlBuilder::SubWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR::Node *leftNode = loadValue(left);
     TR::Node *rightNode = loadValue(right);
     TR::IlValue *subValue = genOperationWithOverflowCHK(TR::ILOpCode::subtractOpCode(leftNode->getDataType()), leftNode,
@@ -1382,6 +1826,9 @@ TR::IlValue *OMR::IlBuilder::SubWithOverflow(TR::IlBuilder **handler, TR::IlValu
 
 TR::IlValue *OMR::IlBuilder::SubWithUnsignedOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR::Node *leftNode = loadValue(left);
     TR::Node *rightNode = loadValue(right);
     TR::IlValue *unsignedSubValue = genOperationWithOverflowCHK(TR::ILOpCode::subtractOpCode(leftNode->getDataType()),
@@ -1393,6 +1840,9 @@ TR::IlValue *OMR::IlBuilder::SubWithUnsignedOverflow(TR::IlBuilder **handler, TR
 
 TR::IlValue *OMR::IlBuilder::MulWithOverflow(TR::IlBuilder **handler, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR::Node *leftNode = loadValue(left);
     TR::Node *rightNode = loadValue(right);
     TR::IlValue *mulValue = genOperationWithOverflowCHK(TR::ILOpCode::multiplyOpCode(leftNode->getDataType()), leftNode,
@@ -1403,20 +1853,23 @@ TR::IlValue *OMR::IlBuilder::MulWithOverflow(TR::IlBuilder **handler, TR::IlValu
 
 TR::IlValue *OMR::IlBuilder::Mul(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::multiplyOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is Mul %d * %d\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_MUL, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::Div(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::divideOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is Div %d / %d\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_DIV, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedDiv(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::DataType returnType = left->getDataType();
 
     // There are no opcodes for performing unsigned division on 8-bit or 16-bit
@@ -1431,11 +1884,12 @@ TR::IlValue *OMR::IlBuilder::UnsignedDiv(TR::IlValue *left, TR::IlValue *right)
     if (returnValue->getDataType() != returnType)
         returnValue = UnsignedConvertTo(_types->PrimitiveType(returnType), returnValue);
 
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_UNSIGNEDDIV, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::Rem(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::DataType returnType = left->getDataType();
 
     // No code generators currently support the brem or srem opcodes. If we
@@ -1451,11 +1905,12 @@ TR::IlValue *OMR::IlBuilder::Rem(TR::IlValue *left, TR::IlValue *right)
     if (returnValue->getDataType() != returnType)
         returnValue = ConvertTo(_types->PrimitiveType(returnType), returnValue);
 
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_REM, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedRem(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::DataType returnType = left->getDataType();
     TR::IlValue *returnValue;
 
@@ -1485,28 +1940,31 @@ TR::IlValue *OMR::IlBuilder::UnsignedRem(TR::IlValue *left, TR::IlValue *right)
     if (returnValue->getDataType() != returnType)
         returnValue = UnsignedConvertTo(_types->PrimitiveType(returnType), returnValue);
 
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_UNSIGNEDREM, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::And(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::andOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is And %d & %d\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_AND, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::Or(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::orOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is Or %d | %d\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_OR, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::Xor(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = binaryOpFromOpMap(TR::ILOpCode::xorOpCode, left, right);
     TraceIL("IlBuilder[ %p ]::%d is Xor %d ^ %d\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_XOR, returnValue);
 }
 
 TR::Node *OMR::IlBuilder::shiftOpNodeFromNodes(TR::ILOpCodes op, TR::Node *leftNode, TR::Node *rightNode)
@@ -1543,26 +2001,358 @@ TR::IlValue *OMR::IlBuilder::shiftOpFromOpMap(OpCodeMapper mapOp, TR::IlValue *l
 
 TR::IlValue *OMR::IlBuilder::ShiftL(TR::IlValue *v, TR::IlValue *amount)
 {
+    RecordedService service(this, v, amount);
     TR::IlValue *returnValue = shiftOpFromOpMap(TR::ILOpCode::shiftLeftOpCode, v, amount);
     TraceIL("IlBuilder[ %p ]::%d is shl %d << %d\n", this, returnValue->getID(), v->getID(), amount->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_SHIFTL, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::ShiftR(TR::IlValue *v, TR::IlValue *amount)
 {
+    RecordedService service(this, v, amount);
     TR::IlValue *returnValue = shiftOpFromOpMap(TR::ILOpCode::shiftRightOpCode, v, amount);
     TraceIL("IlBuilder[ %p ]::%d is arithmetic shr %d >> %d\n", this, returnValue->getID(), v->getID(),
         amount->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_SHIFTR, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedShiftR(TR::IlValue *v, TR::IlValue *amount)
 {
+    RecordedService service(this, v, amount);
     TR::IlValue *returnValue = shiftOpFromOpMap(TR::ILOpCode::unsignedShiftRightOpCode, v, amount);
     TraceIL("IlBuilder[ %p ]::%d is unsigned shr %d >> %d\n", this, returnValue->getID(), v->getID(), amount->getID());
+    return service.binary(OMR::StatementName::STATEMENT_UNSIGNEDSHIFTR, returnValue);
+}
+
+static TR::ILOpCodes absOpCode(TR::DataType type) { return TR::ILOpCode::absOpCode(type); }
+
+static TR::ILOpCodes sqrtOpCode(TR::DataType type)
+{
+    switch (type) {
+        case TR::Float:
+            return TR::fsqrt;
+        case TR::Double:
+            return TR::dsqrt;
+        default:
+            return TR::BadILOp;
+    }
+}
+
+static TR::ILOpCodes minOpCode(TR::DataType type)
+{
+    switch (type) {
+        case TR::Int32:
+            return TR::imin;
+        case TR::Int64:
+            return TR::lmin;
+        case TR::Float:
+            return TR::fmin;
+        case TR::Double:
+            return TR::dmin;
+        default:
+            return TR::BadILOp;
+    }
+}
+
+static TR::ILOpCodes maxOpCode(TR::DataType type)
+{
+    switch (type) {
+        case TR::Int32:
+            return TR::imax;
+        case TR::Int64:
+            return TR::lmax;
+        case TR::Float:
+            return TR::fmax;
+        case TR::Double:
+            return TR::dmax;
+        default:
+            return TR::BadILOp;
+    }
+}
+
+TR::IlValue *OMR::IlBuilder::Abs(TR::IlValue *v)
+{
+    RecordedService service(this);
+    TR::IlValue *absValue = mathOp(absOpCode, TR::vabs, v);
+    TraceIL("IlBuilder[ %p ]::%d is Abs %d\n", this, absValue->getID(), v->getID());
+    return service.unary(OMR::StatementName::STATEMENT_ABS, v, absValue);
+}
+
+TR::IlValue *OMR::IlBuilder::Sqrt(TR::IlValue *v)
+{
+    RecordedService service(this);
+    TR::IlValue *sqrtValue = mathOp(sqrtOpCode, TR::vsqrt, v);
+    TraceIL("IlBuilder[ %p ]::%d is Sqrt %d\n", this, sqrtValue->getID(), v->getID());
+    return service.unary(OMR::StatementName::STATEMENT_SQRT, v, sqrtValue);
+}
+
+TR::IlValue *OMR::IlBuilder::Min(TR::IlValue *left, TR::IlValue *right)
+{
+    RecordedService service(this, left, right);
+    TR::IlValue *returnValue = mathOp(minOpCode, TR::vmin, left, right);
+    TraceIL("IlBuilder[ %p ]::%d is Min %d, %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    return service.binary(OMR::StatementName::STATEMENT_MIN, returnValue);
+}
+
+TR::IlValue *OMR::IlBuilder::Max(TR::IlValue *left, TR::IlValue *right)
+{
+    RecordedService service(this, left, right);
+    TR::IlValue *returnValue = mathOp(maxOpCode, TR::vmax, left, right);
+    TraceIL("IlBuilder[ %p ]::%d is Max %d, %d\n", this, returnValue->getID(), left->getID(), right->getID());
+    return service.binary(OMR::StatementName::STATEMENT_MAX, returnValue);
+}
+
+bool OMR::IlBuilder::supportsVectorOp(TR::ILOpCodes op)
+{
+    return comp()->cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(op));
+}
+
+// Applies mapOp's opcode to scalar operands. Int8 and Int16 operands are widened to Int32 and the result is
+// narrowed back, since abs, min and max only have opcodes for the wider types. Floating point min and max select on
+// compares instead because not every code generator evaluates fmin/fmax/dmin/dmax (x86 does not). Like IEEE minNum and
+// maxNum they return the other operand when one of them is NaN: the compare is false when left is NaN, and right is
+// checked against itself explicitly.
+TR::IlValue *OMR::IlBuilder::scalarOp(OpCodeMapper mapOp, TR::IlValue *left, TR::IlValue *right)
+{
+    TR::IlType *type = _types->PrimitiveType(left->getDataType());
+    left = widenIntegerTo32Bits(left);
+    TR::ILOpCodes op = mapOp(left->getDataType());
+    TR_ASSERT_FATAL(op != TR::BadILOp, "Builder [ %p ] has no operation for value %d of type %s", this, left->getID(),
+        left->getDataType().toString());
+
+    TR::IlValue *result = NULL;
+    if (op == TR::fmin || op == TR::dmin)
+        result = Select(EqualTo(right, right), Select(LessThan(left, right), left, right), left);
+    else if (op == TR::fmax || op == TR::dmax)
+        result = Select(EqualTo(right, right), Select(GreaterThan(left, right), left, right), left);
+    else if (right == NULL)
+        result = unaryOp(op, left);
+    else
+        result = binaryOpFromNodes(op, loadValue(left), loadValue(widenIntegerTo32Bits(right)));
+    return ConvertTo(type, result);
+}
+
+// Applies vectorOp to vector operands, splatting a scalar operand first. When the target cannot evaluate vectorOp for
+// this type, the operation is done one lane at a time with mapOp's scalar opcode instead. Floating point vmin and vmax
+// may return either operand of a lane holding a NaN (x86 MINPS returns the second), so to match scalarOp the lanes
+// where one operand is NaN are blended back to the other operand, found by comparing each operand with itself.
+TR::IlValue *OMR::IlBuilder::mathOp(OpCodeMapper mapOp, TR::VectorOperation vectorOp, TR::IlValue *left,
+    TR::IlValue *right)
+{
+    if (right != NULL) {
+        if (left->getDataType().isVector() && !right->getDataType().isVector())
+            right = VectorSplat(right);
+        else if (!left->getDataType().isVector() && right->getDataType().isVector())
+            left = VectorSplat(left);
+    }
+
+    TR::DataType type = left->getDataType();
+    if (!type.isVector())
+        return scalarOp(mapOp, left, right);
+
+    TR::ILOpCodes op = TR::ILOpCode::createVectorOpCode(vectorOp, type);
+    if (!supportsVectorOp(op))
+        return laneOp(mapOp, left, right);
+
+    if (right == NULL)
+        return unaryOp(op, left);
+
+    TR::DataType elementType = type.getVectorElementType();
+    if ((vectorOp == TR::vmin || vectorOp == TR::vmax) && elementType.isFloatingPoint()) {
+        TR::DataType maskType = TR::DataType::createMaskType(elementType, type.getVectorLength());
+        TR::ILOpCodes isNaNOp = TR::ILOpCode::createVectorOpCode(TR::vcmpne, type, maskType);
+        TR::ILOpCodes blendOp = TR::ILOpCode::createVectorOpCode(TR::vblend, type);
+        if (!supportsVectorOp(isNaNOp) || !supportsVectorOp(blendOp))
+            return laneOp(mapOp, left, right);
+
+        TR::Node *leftNode = loadValue(left);
+        TR::Node *rightNode = loadValue(right);
+        TR::Node *result = TR::Node::create(op, 2, leftNode, rightNode);
+        result = TR::Node::create(blendOp, 3, result, rightNode, TR::Node::create(isNaNOp, 2, leftNode, leftNode));
+        result = TR::Node::create(blendOp, 3, result, leftNode, TR::Node::create(isNaNOp, 2, rightNode, rightNode));
+        return newValue(type, result);
+    }
+
+    return binaryOpFromNodes(op, loadValue(left), loadValue(right));
+}
+
+// Stores a vector into a new stack array so that its lanes can be accessed individually; returns the array address
+TR::IlValue *OMR::IlBuilder::spillVector(TR::IlValue *vector)
+{
+    TR::DataType vectorType = vector->getDataType();
+    TR_ASSERT_FATAL(vectorType.isVector(), "Builder [ %p ] expected a vector value but %d has type %s", this,
+        vector->getID(), vectorType.toString());
+
+    TR::IlType *laneType = _types->PrimitiveType(vectorType.getVectorElementType());
+    TR::IlValue *lanes = CreateLocalArray(vectorType.getVectorNumLanes(), laneType);
+    VectorStoreAt(lanes, vector);
+    return lanes;
+}
+
+TR::IlValue *OMR::IlBuilder::laneOp(OpCodeMapper mapOp, TR::IlValue *left, TR::IlValue *right)
+{
+    TR::DataType vectorType = left->getDataType();
+    TR::IlType *laneType = _types->PrimitiveType(vectorType.getVectorElementType());
+    TR::IlType *pLane = _types->PointerTo(laneType);
+    int32_t numLanes = vectorType.getVectorNumLanes();
+
+    TR::IlValue *leftLanes = spillVector(left);
+    TR::IlValue *rightLanes = (right != NULL) ? spillVector(right) : NULL;
+    TR::IlValue *resultLanes = CreateLocalArray(numLanes, laneType);
+    for (int32_t lane = 0; lane < numLanes; lane++) {
+        TR::IlValue *index = ConstInt32(lane);
+        TR::IlValue *leftLane = LoadAt(pLane, IndexAt(pLane, leftLanes, index));
+        TR::IlValue *rightLane = (rightLanes != NULL) ? LoadAt(pLane, IndexAt(pLane, rightLanes, index)) : NULL;
+        StoreAt(IndexAt(pLane, resultLanes, index), scalarOp(mapOp, leftLane, rightLane));
+    }
+    return VectorLoadAt(pLane, resultLanes);
+}
+
+/**
+ * @brief Create a 128-bit vector with every lane set to a scalar value
+ * @param value the scalar IlValue to be replicated into each lane
+ */
+TR::IlValue *OMR::IlBuilder::VectorSplat(TR::IlValue *value)
+{
+    RecordedService service(this);
+    TR::DataType dt = value->getDataType();
+    TR_ASSERT_FATAL(!dt.isVector(), "Builder [ %p ] VectorSplat needs a scalar operand but %d has type %s", this,
+        value->getID(), dt.toString());
+
+    TR::DataType vectorType = dt.scalarToVector(TR::VectorLength128);
+    TR::Node *splat
+        = TR::Node::create(TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType), 1, loadValue(value));
+    TR::IlValue *returnValue = newValue(vectorType, splat);
+    TraceIL("IlBuilder[ %p ]::%d is VectorSplat %d\n", this, returnValue->getID(), value->getID());
+    return service.unary(OMR::StatementName::STATEMENT_VECTORSPLAT, value, returnValue);
+}
+
+/**
+ * @brief Read one lane of a vector
+ * @param vector the vector IlValue
+ * @param index Int32 IlValue with the lane number, counting from 0
+ */
+TR::IlValue *OMR::IlBuilder::VectorGetElement(TR::IlValue *vector, TR::IlValue *index)
+{
+    RecordedService service(this, vector, index);
+    TR::DataType vectorType = vector->getDataType();
+    TR::IlValue *returnValue = NULL;
+    TR::ILOpCodes op = TR::ILOpCode::createVectorOpCode(TR::vgetelem, vectorType);
+    if (supportsVectorOp(op)) {
+        TR::Node *indexNode = loadValue(ConvertTo(Int32, index));
+        returnValue = binaryOpFromNodes(op, loadValue(vector), indexNode);
+    } else {
+        TR::IlType *pLane = _types->PointerTo(vectorType.getVectorElementType());
+        returnValue = LoadAt(pLane, IndexAt(pLane, spillVector(vector), index));
+    }
+    TraceIL("IlBuilder[ %p ]::%d is VectorGetElement %d[%d]\n", this, returnValue->getID(), vector->getID(),
+        index->getID());
+    return service.binary(OMR::StatementName::STATEMENT_VECTORGETELEMENT, returnValue);
+}
+
+/**
+ * @brief Create a copy of a vector with one lane replaced
+ * @param vector the vector IlValue
+ * @param index Int32 IlValue with the lane number, counting from 0
+ * @param element the new value for the lane, which must have the vector's element type
+ */
+TR::IlValue *OMR::IlBuilder::VectorSetElement(TR::IlValue *vector, TR::IlValue *index, TR::IlValue *element)
+{
+    RecordedService service(this);
+    TR::DataType vectorType = vector->getDataType();
+    TR_ASSERT_FATAL(vectorType.isVector() && element->getDataType() == vectorType.getVectorElementType(),
+        "Builder [ %p ] VectorSetElement needs an element of the vector's element type", this);
+
+    TR::IlValue *returnValue = NULL;
+    TR::ILOpCodes op = TR::ILOpCode::createVectorOpCode(TR::vsetelem, vectorType);
+    if (supportsVectorOp(op)) {
+        TR::Node *setNode
+            = TR::Node::create(op, 3, loadValue(vector), loadValue(ConvertTo(Int32, index)), loadValue(element));
+        returnValue = newValue(vectorType, setNode);
+    } else {
+        // Build the result in an array written only by lane stores: the optimizer does not see a lane store as
+        // killing a vector previously stored to the same array, so reloading the spilled array would be unsafe
+        TR::IlType *laneType = _types->PrimitiveType(vectorType.getVectorElementType());
+        TR::IlType *pLane = _types->PointerTo(laneType);
+        TR::IlValue *lanes = spillVector(vector);
+        TR::IlValue *resultLanes = CreateLocalArray(vectorType.getVectorNumLanes(), laneType);
+        for (int32_t lane = 0; lane < vectorType.getVectorNumLanes(); lane++) {
+            TR::IlValue *laneIndex = ConstInt32(lane);
+            StoreAt(IndexAt(pLane, resultLanes, laneIndex), LoadAt(pLane, IndexAt(pLane, lanes, laneIndex)));
+        }
+        StoreAt(IndexAt(pLane, resultLanes, index), element);
+        returnValue = VectorLoadAt(pLane, resultLanes);
+    }
+    TraceIL("IlBuilder[ %p ]::%d is VectorSetElement %d[%d] = %d\n", this, returnValue->getID(), vector->getID(),
+        index->getID(), element->getID());
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        rec->StoreID(returnValue);
+        service.begin(OMR::StatementName::STATEMENT_VECTORSETELEMENT);
+        rec->Value(vector);
+        rec->Value(index);
+        rec->Value(element);
+        rec->Value(returnValue);
+        rec->EndStatement();
+    }
     return returnValue;
 }
 
+// Combines the lanes of a vector with the reduction opcode, or lane by lane with mapOp's scalar opcode when the
+// target cannot evaluate the reduction for this type
+TR::IlValue *OMR::IlBuilder::vectorReduction(TR::VectorOperation reduction, OpCodeMapper mapOp, TR::IlValue *vector)
+{
+    TR::DataType vectorType = vector->getDataType();
+    TR_ASSERT_FATAL(vectorType.isVector(), "Builder [ %p ] can only reduce a vector, but %d has type %s", this,
+        vector->getID(), vectorType.toString());
+
+    TR::ILOpCodes op = TR::ILOpCode::createVectorOpCode(reduction, vectorType);
+    if (supportsVectorOp(op)) {
+        TR::Node *reduceNode = TR::Node::create(op, 1, loadValue(vector));
+        return newValue(reduceNode->getDataType(), reduceNode);
+    }
+
+    TR::IlType *pLane = _types->PointerTo(vectorType.getVectorElementType());
+    TR::IlValue *lanes = spillVector(vector);
+    TR::IlValue *result = LoadAt(pLane, lanes);
+    for (int32_t lane = 1; lane < vectorType.getVectorNumLanes(); lane++)
+        result = scalarOp(mapOp, result, LoadAt(pLane, IndexAt(pLane, lanes, ConstInt32(lane))));
+    return result;
+}
+
+/**
+ * @brief Sum the lanes of a vector
+ */
+TR::IlValue *OMR::IlBuilder::VectorReduceAdd(TR::IlValue *vector)
+{
+    RecordedService service(this);
+    TR::IlValue *returnValue = vectorReduction(TR::vreductionAdd, addOpCode, vector);
+    TraceIL("IlBuilder[ %p ]::%d is VectorReduceAdd %d\n", this, returnValue->getID(), vector->getID());
+    return service.unary(OMR::StatementName::STATEMENT_VECTORREDUCEADD, vector, returnValue);
+}
+
+/**
+ * @brief Find the smallest lane of a vector
+ */
+TR::IlValue *OMR::IlBuilder::VectorReduceMin(TR::IlValue *vector)
+{
+    RecordedService service(this);
+    TR::IlValue *returnValue = vectorReduction(TR::vreductionMin, minOpCode, vector);
+    TraceIL("IlBuilder[ %p ]::%d is VectorReduceMin %d\n", this, returnValue->getID(), vector->getID());
+    return service.unary(OMR::StatementName::STATEMENT_VECTORREDUCEMIN, vector, returnValue);
+}
+
+/**
+ * @brief Find the largest lane of a vector
+ */
+TR::IlValue *OMR::IlBuilder::VectorReduceMax(TR::IlValue *vector)
+{
+    RecordedService service(this);
+    TR::IlValue *returnValue = vectorReduction(TR::vreductionMax, maxOpCode, vector);
+    TraceIL("IlBuilder[ %p ]::%d is VectorReduceMax %d\n", this, returnValue->getID(), vector->getID());
+    return service.unary(OMR::StatementName::STATEMENT_VECTORREDUCEMAX, vector, returnValue);
+}
+
 /*
  * @brief IfAnd service for constructing short circuit AND conditional nests (like the && operator)
  * @param allTrueBuilder builder containing operations to execute if all conditional tests evaluate
@@ -1588,6 +2378,9 @@ TR::IlValue *OMR::IlBuilder::UnsignedShiftR(TR::IlValue *v, TR::IlValue *amount)
 void OMR::IlBuilder::IfAnd(TR::IlBuilder **allTrueBuilder, TR::IlBuilder **anyFalseBuilder, int32_t numTerms,
     JBCondition **terms)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TraceIL("IlBuilder[ %p ]::IfAnd starting\n", this);
     TR::IlBuilder *mergePoint = OrphanBuilder();
     *allTrueBuilder = createBuilderIfNeeded(*allTrueBuilder);
@@ -1679,6 +2472,9 @@ void OMR::IlBuilder::IfAnd(TR::IlBuilder **allTrueBuilder, TR::IlBuilder **anyFa
 void OMR::IlBuilder::IfOr(TR::IlBuilder **anyTrueBuilder, TR::IlBuilder **allFalseBuilder, int32_t numTerms,
     JBCondition **terms)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TraceIL("IlBuilder[ %p ]::IfOr starting\n", this);
 
     TR::IlBuilder *mergePoint = OrphanBuilder();
@@ -1761,9 +2557,10 @@ TR::IlBuilder::JBCondition *OMR::IlBuilder::MakeCondition(TR::IlBuilder *conditi
 
 TR::IlValue *OMR::IlBuilder::EqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     TR::IlValue *returnValue = compareOp(TR_cmpEQ, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is EqualTo %d == %d?\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_EQUALTO, returnValue);
 }
 
 void OMR::IlBuilder::integerizeAddresses(TR::IlValue **leftPtr, TR::IlValue **rightPtr)
@@ -1779,72 +2576,80 @@ void OMR::IlBuilder::integerizeAddresses(TR::IlValue **leftPtr, TR::IlValue **ri
 
 TR::IlValue *OMR::IlBuilder::LessThan(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpLT, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is LessThan %d < %d?\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_LESSTHAN, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedLessThan(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpLT, true, left, right);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedLessThan %d < %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_UNSIGNEDLESSTHAN, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::LessOrEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpLE, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is LessOrEqualTo %d <= %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_LESSOREQUALTO, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedLessOrEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpLE, true, left, right);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedLessOrEqualTo %d <= %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_UNSIGNEDLESSOREQUALTO, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::GreaterThan(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpGT, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is GreaterThan %d > %d?\n", this, returnValue->getID(), left->getID(), right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_GREATERTHAN, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedGreaterThan(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpGT, true, left, right);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedGreaterThan %d > %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_UNSIGNEDGREATERTHAN, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::GreaterOrEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpGE, false, left, right);
     TraceIL("IlBuilder[ %p ]::%d is GreaterOrEqualTo %d >= %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_GREATEROREQUALTO, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::UnsignedGreaterOrEqualTo(TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this, left, right);
     integerizeAddresses(&left, &right);
     TR::IlValue *returnValue = compareOp(TR_cmpGE, true, left, right);
     TraceIL("IlBuilder[ %p ]::%d is UnsignedGreaterOrEqualTo %d >= %d?\n", this, returnValue->getID(), left->getID(),
         right->getID());
-    return returnValue;
+    return service.binary(OMR::StatementName::STATEMENT_UNSIGNEDGREATEROREQUALTO, returnValue);
 }
 
 TR::IlValue **OMR::IlBuilder::processCallArgs(TR::Compilation *comp, int numArgs, va_list args)
@@ -1864,6 +2669,9 @@ TR::IlValue **OMR::IlBuilder::processCallArgs(TR::Compilation *comp, int numArgs
  */
 TR::IlValue *OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, ...)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     va_list args;
     va_start(args, numArgs);
     TR::IlValue **argValues = processCallArgs(_comp, numArgs, args);
@@ -1887,6 +2695,9 @@ TR::IlValue *OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numA
  */
 TR::IlValue *OMR::IlBuilder::ComputedCall(const char *functionName, int32_t numArgs, TR::IlValue **argValues)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
     if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
         resolvedMethod = _methodBuilder->lookupFunction(functionName);
@@ -1932,6 +2743,9 @@ TR::IlValue *OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs,
  */
 TR::IlValue *OMR::IlBuilder::Call(TR::MethodBuilder *calleeMB, int32_t numArgs, TR::IlValue **argValues)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TraceIL("IlBuilder[ %p ]::Call %s", this, calleeMB->GetMethodName());
     for (int a = 0; a < numArgs; a++)
         TraceIL(" %d", argValues[a]->getID());
@@ -1991,19 +2805,13 @@ TR::IlValue *OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, ...
     va_start(args, numArgs);
     TR::IlValue **argValues = processCallArgs(_comp, numArgs, args);
     va_end(args);
-    TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
-    if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
-        resolvedMethod = _methodBuilder->lookupFunction(functionName);
-    TR_ASSERT_FATAL(resolvedMethod, "Could not identify function %s\n", functionName);
 
-    TR::SymbolReference *methodSymRef
-        = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
-    methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
-    return genCall("Call", methodSymRef, numArgs, argValues);
+    return Call(functionName, numArgs, argValues);
 }
 
 TR::IlValue *OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, TR::IlValue **argValues)
 {
+    RecordedService service(this);
     TR::ResolvedMethod *resolvedMethod = _methodBuilder->lookupFunction(functionName);
     if (resolvedMethod == NULL && _methodBuilder->RequestFunction(functionName))
         resolvedMethod = _methodBuilder->lookupFunction(functionName);
@@ -2012,7 +2820,8 @@ TR::IlValue *OMR::IlBuilder::Call(const char *functionName, int32_t numArgs, TR:
     TR::SymbolReference *methodSymRef
         = symRefTab()->findOrCreateStaticMethodSymbol(JITTED_METHOD_INDEX, -1, resolvedMethod);
     methodSymRef->getSymbol()->getMethodSymbol()->setLinkage(TR_System);
-    return genCall("Call", methodSymRef, numArgs, argValues);
+    TR::IlValue *returnValue = genCall("Call", methodSymRef, numArgs, argValues);
+    return service.call(functionName, resolvedMethod, numArgs, argValues, returnValue);
 }
 
 TR::IlValue *OMR::IlBuilder::genCall(const char *name, TR::SymbolReference *methodSymRef, int32_t numArgs,
@@ -2070,6 +2879,9 @@ TR::IlValue *OMR::IlBuilder::genCall(const char *name, TR::SymbolReference *meth
  */
 TR::IlValue *OMR::IlBuilder::AtomicAdd(TR::IlValue *baseAddress, TR::IlValue *value)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR_ASSERT_FATAL(baseAddress->getDataType() == TR::Address, "baseAddress must be TR::Address");
 
     // Determine the implementation type and returnType by detecting "value"'s type
@@ -2091,6 +2903,63 @@ TR::IlValue *OMR::IlBuilder::AtomicAdd(TR::IlValue *baseAddress, TR::IlValue *va
     return returnValue;
 }
 
+// arraycopy and arrayset take a byte count of the target's address width
+TR::IlValue *OMR::IlBuilder::memoryLength(TR::IlValue *numBytes)
+{
+    TR::DataType type = numBytes->getDataType();
+    TR_ASSERT_FATAL(type == TR::Int32 || type == TR::Int64, "Builder [ %p ] needs an Int32 or Int64 byte count", this);
+    return UnsignedConvertTo(TR::Compiler->target.is64Bit() ? Int64 : Int32, numBytes);
+}
+
+void OMR::IlBuilder::CopyMemory(TR::IlValue *dest, TR::IlValue *source, TR::IlValue *numBytes)
+{
+    TR_ASSERT_FATAL(dest->getDataType() == TR::Address && source->getDataType() == TR::Address,
+        "CopyMemory needs address operands");
+
+    RecordedService service(this);
+    TR::IlValue *length = memoryLength(numBytes);
+
+    // the 3-child arraycopy copies like memmove
+    TR::Node *copy = TR::Node::createArraycopy(loadValue(source), loadValue(dest), loadValue(length));
+    copy->setSymbolReference(symRefTab()->findOrCreateArrayCopySymbol());
+    copy->setArrayCopyElementType(TR::Int8);
+    genTreeTop(copy);
+
+    TraceIL("IlBuilder[ %p ]::CopyMemory %d bytes from %d to %d\n", this, numBytes->getID(), source->getID(),
+        dest->getID());
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        service.begin(OMR::StatementName::STATEMENT_COPYMEMORY);
+        rec->Value(dest);
+        rec->Value(source);
+        rec->Value(numBytes);
+        rec->EndStatement();
+    }
+}
+
+void OMR::IlBuilder::SetMemory(TR::IlValue *dest, TR::IlValue *value, TR::IlValue *numBytes)
+{
+    TR_ASSERT_FATAL(dest->getDataType() == TR::Address, "SetMemory needs an address operand");
+
+    RecordedService service(this);
+    TR::IlValue *length = memoryLength(numBytes);
+
+    TR::Node *set = TR::Node::create(TR::arrayset, 3, loadValue(dest), loadValue(value), loadValue(length));
+    set->setSymbolReference(symRefTab()->findOrCreateArraySetSymbol());
+    genTreeTop(set);
+
+    TraceIL("IlBuilder[ %p ]::SetMemory %d bytes at %d to %d\n", this, numBytes->getID(), dest->getID(),
+        value->getID());
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        service.begin(OMR::StatementName::STATEMENT_SETMEMORY);
+        rec->Value(dest);
+        rec->Value(value);
+        rec->Value(numBytes);
+        rec->EndStatement();
+    }
+}
+
 /**
  * \brief
  *  The service is for generating a treetop for transaction begin when the user needs to use transactional memory.
@@ -2164,6 +3033,9 @@ TR::IlValue *OMR::IlBuilder::AtomicAdd(TR::IlValue *baseAddress, TR::IlValue *va
 void OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuilder **transientFailureBuilder,
     TR::IlBuilder **transactionBuilder)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     // This assertion is to rule out platforms which don't have tstart evaluator yet.
     TR_ASSERT_FATAL(comp()->cg()->hasTMEvaluator(), "this platform doesn't support tstart or tfinish evaluator yet");
 
@@ -2236,6 +3108,9 @@ void OMR::IlBuilder::Transaction(TR::IlBuilder **persistentFailureBuilder, TR::I
  */
 void OMR::IlBuilder::TransactionAbort()
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR::Node *tAbortNode = TR::Node::create(TR::tabort, 0);
     tAbortNode->setSymbolReference(
         comp()->getSymRefTab()->findOrCreateTransactionAbortSymbolRef(comp()->getMethodSymbol()));
@@ -2245,13 +3120,18 @@ void OMR::IlBuilder::TransactionAbort()
 
 void OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder **target, TR::IlValue *condition)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPNOTEQUALZERO, *target, condition);
     IfCmpNotEqualZero(*target, condition);
 }
 
 void OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder *target, TR::IlValue *condition)
 {
     TR_ASSERT_FATAL(target != NULL, "This IfCmpNotEqualZero requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPNOTEQUALZERO, target, condition);
+
     TraceIL("IlBuilder[ %p ]::IfCmpNotEqualZero %d? -> [ %p ] B%d\n", this, condition->getID(), target,
         target->getEntry()->getNumber());
     ifCmpNotEqualZero(condition, target->getEntry());
@@ -2259,13 +3139,18 @@ void OMR::IlBuilder::IfCmpNotEqualZero(TR::IlBuilder *target, TR::IlValue *condi
 
 void OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPNOTEQUAL, *target, left, right);
     IfCmpNotEqual(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
     TR_ASSERT_FATAL(target != NULL, "This IfCmpNotEqual requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPNOTEQUAL, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpNotEqual %d == %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpNE, false, left, right, target->getEntry());
@@ -2273,13 +3158,18 @@ void OMR::IlBuilder::IfCmpNotEqual(TR::IlBuilder *target, TR::IlValue *left, TR:
 
 void OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder **target, TR::IlValue *condition)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPEQUALZERO, *target, condition);
     IfCmpEqualZero(*target, condition);
 }
 
 void OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder *target, TR::IlValue *condition)
 {
     TR_ASSERT_FATAL(target != NULL, "This IfCmpEqualZero requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPEQUALZERO, target, condition);
+
     TraceIL("IlBuilder[ %p ]::IfCmpEqualZero %d == 0? -> [ %p ] B%d\n", this, condition->getID(), target,
         target->getEntry()->getNumber());
     ifCmpEqualZero(condition, target->getEntry());
@@ -2287,13 +3177,18 @@ void OMR::IlBuilder::IfCmpEqualZero(TR::IlBuilder *target, TR::IlValue *conditio
 
 void OMR::IlBuilder::IfCmpEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPEQUAL, *target, left, right);
     IfCmpEqual(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
     TR_ASSERT_FATAL(target != NULL, "This IfCmpEqual requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPEQUAL, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpEqual %d == %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpEQ, false, left, right, target->getEntry());
@@ -2301,13 +3196,18 @@ void OMR::IlBuilder::IfCmpEqual(TR::IlBuilder *target, TR::IlValue *left, TR::Il
 
 void OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPLESSTHAN, *target, left, right);
     IfCmpLessThan(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
     TR_ASSERT_FATAL(target != NULL, "This IfCmpLessThan requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPLESSTHAN, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpLessThan %d < %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpLT, false, left, right, target->getEntry());
@@ -2315,13 +3215,18 @@ void OMR::IlBuilder::IfCmpLessThan(TR::IlBuilder *target, TR::IlValue *left, TR:
 
 void OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPUNSIGNEDLESSTHAN, *target, left, right);
     IfCmpUnsignedLessThan(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
     TR_ASSERT_FATAL(target != NULL, "This IfCmpUnsignedLessThan requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPUNSIGNEDLESSTHAN, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpUnsignedLessThan %d < %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(),
         target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpLT, true, left, right, target->getEntry());
@@ -2329,13 +3234,18 @@ void OMR::IlBuilder::IfCmpUnsignedLessThan(TR::IlBuilder *target, TR::IlValue *l
 
 void OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPLESSOREQUAL, *target, left, right);
     IfCmpLessOrEqual(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
     TR_ASSERT_FATAL(target != NULL, "This IfCmpLessOrEqual requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPLESSOREQUAL, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpLessOrEqual %d <= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpLE, false, left, right, target->getEntry());
@@ -2343,13 +3253,18 @@ void OMR::IlBuilder::IfCmpLessOrEqual(TR::IlBuilder *target, TR::IlValue *left,
 
 void OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPUNSIGNEDLESSOREQUAL, *target, left, right);
     IfCmpUnsignedLessOrEqual(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
     TR_ASSERT_FATAL(target != NULL, "This IfCmpUnsignedLessOrEqual requires a non-NULL builder object");
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPUNSIGNEDLESSOREQUAL, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpUnsignedLessOrEqual %d <= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(),
         target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpLE, true, left, right, target->getEntry());
@@ -2357,12 +3272,17 @@ void OMR::IlBuilder::IfCmpUnsignedLessOrEqual(TR::IlBuilder *target, TR::IlValue
 
 void OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPGREATERTHAN, *target, left, right);
     IfCmpGreaterThan(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPGREATERTHAN, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpGreaterThan %d > %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(), target,
         target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpGT, false, left, right, target->getEntry());
@@ -2370,12 +3290,17 @@ void OMR::IlBuilder::IfCmpGreaterThan(TR::IlBuilder *target, TR::IlValue *left,
 
 void OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPUNSIGNEDGREATERTHAN, *target, left, right);
     IfCmpUnsignedGreaterThan(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPUNSIGNEDGREATERTHAN, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpUnsignedGreaterThan %d > %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(),
         target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpGT, true, left, right, target->getEntry());
@@ -2383,12 +3308,17 @@ void OMR::IlBuilder::IfCmpUnsignedGreaterThan(TR::IlBuilder *target, TR::IlValue
 
 void OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPGREATEROREQUAL, *target, left, right);
     IfCmpGreaterOrEqual(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPGREATEROREQUAL, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpGreaterOrEqual %d >= %d? -> [ %p ] B%d\n", this, left->getID(), right->getID(),
         target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpGE, false, left, right, target->getEntry());
@@ -2396,12 +3326,17 @@ void OMR::IlBuilder::IfCmpGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *lef
 
 void OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
     *target = createBuilderIfNeeded(*target);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL, *target, left, right);
     IfCmpUnsignedGreaterOrEqual(*target, left, right);
 }
 
 void OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual(TR::IlBuilder *target, TR::IlValue *left, TR::IlValue *right)
 {
+    RecordedService service(this);
+    service.branch(OMR::StatementName::STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL, target, left, right);
+
     TraceIL("IlBuilder[ %p ]::IfCmpUnsignedGreaterOrEqual %d >= %d? -> [ %p ] B%d\n", this, left->getID(),
         right->getID(), target, target->getEntry()->getNumber());
     ifCmpCondition(TR_cmpGE, true, left, right, target->getEntry());
@@ -2472,6 +3407,17 @@ void OMR::IlBuilder::IfThenElse(TR::IlBuilder **thenPath, TR::IlBuilder **elsePa
         elseEntry = (*elsePath)->getEntry();
     }
 
+    RecordedService service(this);
+    if (service.recorder() != NULL) {
+        service.ensureBuilder(thenPath);
+        service.ensureBuilder(elsePath);
+        service.begin(OMR::StatementName::STATEMENT_IFTHENELSE);
+        service.builder(thenPath);
+        service.builder(elsePath);
+        service.recorder()->Value(condition);
+        service.recorder()->EndStatement();
+    }
+
     TR::Block *mergeBlock = emptyBlock();
 
     TraceIL("IlBuilder[ %p ]::IfThenElse %d", this, condition->getID());
@@ -2528,6 +3474,9 @@ void OMR::IlBuilder::traceSwitch(const char *name, TR::IlValue *selectorValue, T
 void OMR::IlBuilder::Switch(TR::IlValue *selectorValue, TR::IlBuilder **defaultBuilder, uint32_t numCases,
     JBCase **cases)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR_ASSERT_FATAL(selectorValue->getDataType() == TR::Int32, "Switch only supports selector having type Int32");
     *defaultBuilder = createBuilderIfNeeded(*defaultBuilder);
 
@@ -2551,6 +3500,9 @@ void OMR::IlBuilder::Switch(TR::IlValue *selectorValue, TR::IlBuilder **defaultB
 void OMR::IlBuilder::TableSwitch(TR::IlValue *selectorValue, TR::IlBuilder **defaultBuilder, bool generateBoundsCheck,
     uint32_t numCases, JBCase **cases)
 {
+    RecordedService service(this);
+    service.unsupported();
+
     TR_ASSERT_FATAL(selectorValue->getDataType() == TR::Int32, "TableSwitch only supports selector having type Int32");
     TR_ASSERT_FATAL(numCases > 0, "TableSwitch requires at least 1 case");
     int32_t low = cases[0]->_value;
@@ -2598,6 +3550,7 @@ TR::IlValue *OMR::IlBuilder::Select(TR::IlValue *condition, TR::IlValue *trueVal
     TR::DataType dt = trueValue->getDataType();
     TR_ASSERT_FATAL(dt == falseValue->getDataType(), "Select requires trueValue and falseValue to be of the same type");
     TR::ILOpCodes opCode = TR::ILOpCode::selectOpCode(dt);
+    RecordedService service(this);
     TR::IlValue *result = NULL;
     if (opCode == TR::BadILOp) {
         TR::IlBuilder *trueBuilder = OrphanBuilder();
@@ -2617,6 +3570,16 @@ TR::IlValue *OMR::IlBuilder::Select(TR::IlValue *condition, TR::IlValue *trueVal
 
     TraceIL("IlBuilder[ %p ]::%d is Select %d T (%d) F (%d)\n", this, result->getID(), condition->getID(),
         trueValue->getID(), falseValue->getID());
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        rec->StoreID(result);
+        service.begin(OMR::StatementName::STATEMENT_SELECT);
+        rec->Value(condition);
+        rec->Value(trueValue);
+        rec->Value(falseValue);
+        rec->Value(result);
+        rec->EndStatement();
+    }
     return result;
 }
 
@@ -2678,6 +3641,7 @@ void OMR::IlBuilder::generateSwitchCases(TR::Node *switchNode, TR::Node *default
 void OMR::IlBuilder::ForLoop(bool countsUp, const char *indVar, TR::IlBuilder **loopCode, TR::IlBuilder **breakBuilder,
     TR::IlBuilder **continueBuilder, TR::IlValue *initial, TR::IlValue *end, TR::IlValue *increment)
 {
+    RecordedService service(this);
     methodSymbol()->setMayHaveLoops(true);
     TR_ASSERT_FATAL(loopCode != NULL, "ForLoop needs to have loopCode builder");
     *loopCode = createBuilderIfNeeded(*loopCode);
@@ -2715,6 +3679,23 @@ void OMR::IlBuilder::ForLoop(bool countsUp, const char *indVar, TR::IlBuilder **
         loopContinue->IfCmpGreaterThan(&loopBody, loopContinue->Load(indVar), end);
     }
 
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        service.ensureBuilder(loopCode);
+        service.ensureBuilder(breakBuilder);
+        service.ensureBuilder(continueBuilder);
+        service.begin(OMR::StatementName::STATEMENT_FORLOOP);
+        rec->Number((int8_t)countsUp);
+        rec->String(indVar);
+        service.builder(loopCode);
+        service.builder(breakBuilder);
+        service.builder(continueBuilder);
+        rec->Value(initial);
+        rec->Value(end);
+        rec->Value(increment);
+        rec->EndStatement();
+    }
+
     // make sure any subsequent operations go into their own block *after* the loop
     appendBlock();
     TraceIL("IlBuilder[ %p ]::ForLoop complete\n", this);
@@ -2723,6 +3704,7 @@ void OMR::IlBuilder::ForLoop(bool countsUp, const char *indVar, TR::IlBuilder **
 void OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlBuilder **breakBuilder,
     TR::IlBuilder **continueBuilder)
 {
+    RecordedService service(this);
     methodSymbol()->setMayHaveLoops(true);
     TR_ASSERT_FATAL(body != NULL, "doWhileLoop needs to have a body");
 
@@ -2753,6 +3735,19 @@ void OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **bod
         AppendBuilder(*breakBuilder);
     }
 
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        service.ensureBuilder(body);
+        service.ensureBuilder(breakBuilder);
+        service.ensureBuilder(continueBuilder);
+        service.begin(OMR::StatementName::STATEMENT_DOWHILELOOP);
+        rec->String(whileCondition);
+        service.builder(body);
+        service.builder(breakBuilder);
+        service.builder(continueBuilder);
+        rec->EndStatement();
+    }
+
     // make sure any subsequent operations go into their own block *after* the loop
     appendBlock();
 
@@ -2762,6 +3757,7 @@ void OMR::IlBuilder::DoWhileLoop(const char *whileCondition, TR::IlBuilder **bod
 void OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **body, TR::IlBuilder **breakBuilder,
     TR::IlBuilder **continueBuilder)
 {
+    RecordedService service(this);
     methodSymbol()->setMayHaveLoops(true);
     TR_ASSERT_FATAL(body != NULL, "WhileDo needs to have a body");
     TraceIL("IlBuilder[ %p ]::WhileDoLoop while %s do body %p\n", this, whileCondition, *body);
@@ -2789,6 +3785,19 @@ void OMR::IlBuilder::WhileDoLoop(const char *whileCondition, TR::IlBuilder **bod
     Goto(&loopContinue);
     setComesBack(); // this goto is on one particular flow path, doesn't mean every path does a goto
 
+    if (service.recorder() != NULL) {
+        TR::JitBuilderRecorder *rec = service.recorder();
+        service.ensureBuilder(body);
+        service.ensureBuilder(breakBuilder);
+        service.ensureBuilder(continueBuilder);
+        service.begin(OMR::StatementName::STATEMENT_WHILEDOLOOP);
+        rec->String(whileCondition);
+        service.builder(body);
+        service.builder(breakBuilder);
+        service.builder(continueBuilder);
+        rec->EndStatement();
+    }
+
     AppendBuilder(done);
 
     TraceIL("IlBuilder[ %p ]::WhileLoop complete\n", this);
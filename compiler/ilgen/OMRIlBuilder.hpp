@@ -37,8 +37,10 @@ class MethodBuilder;
 namespace TR {
 class Block;
 class BytecodeBuilder;
+class Field;
 class IlGeneratorMethodDetails;
 class IlBuilder;
+class LocalVariable;
 class ResolvedMethodSymbol;
 class SymbolReference;
 class SymbolReferenceTable;
@@ -91,6 +93,9 @@ protected:
     SequenceEntry *blockEntry(TR::Block *block);
     SequenceEntry *builderEntry(TR::IlBuilder *builder);
 
+    // scope object that writes a service call to the MethodBuilder's recorder, if it has one
+    class RecordedService;
+
 public:
     TR_ALLOC(TR_Memory::IlGenerator)
 
@@ -331,6 +336,10 @@ public:
     TR::IlValue *ConvertTo(TR::IlType *t, TR::IlValue *v);
     TR::IlValue *UnsignedConvertTo(TR::IlType *t, TR::IlValue *v);
     TR::IlValue *Negate(TR::IlValue *v);
+    TR::IlValue *Abs(TR::IlValue *v);
+    TR::IlValue *Sqrt(TR::IlValue *v);
+    TR::IlValue *Min(TR::IlValue *left, TR::IlValue *right);
+    TR::IlValue *Max(TR::IlValue *left, TR::IlValue *right);
 
     /**
      * @brief Convert the bit representation of an IlValue to a given type
@@ -354,8 +363,32 @@ public:
     void StoreAt(TR::IlValue *address, TR::IlValue *value);
     TR::IlValue *LoadIndirect(const char *type, const char *field, TR::IlValue *object);
     void StoreIndirect(const char *type, const char *field, TR::IlValue *object, TR::IlValue *value);
+
+    // memory via handles from MethodBuilder::LookupLocal and TypeDictionary::LookupField, which skip name lookup
+    TR::IlValue *Load(TR::LocalVariable *var);
+    void Store(TR::LocalVariable *var, TR::IlValue *value);
+    TR::IlValue *LoadIndirect(TR::Field *field, TR::IlValue *object);
+    void StoreIndirect(TR::Field *field, TR::IlValue *object, TR::IlValue *value);
+
     TR::IlValue *IndexAt(TR::IlType *dt, TR::IlValue *base, TR::IlValue *index);
     TR::IlValue *AtomicAdd(TR::IlValue *baseAddress, TR::IlValue *value);
+
+    /**
+     * @brief Copy a block of memory, like memmove: the source and destination may overlap
+     * @param dest the address to copy to
+     * @param source the address to copy from
+     * @param numBytes the number of bytes to copy, as an Int32 or Int64 value
+     */
+    void CopyMemory(TR::IlValue *dest, TR::IlValue *source, TR::IlValue *numBytes);
+
+    /**
+     * @brief Fill a block of memory with copies of a value, like memset when the value is an Int8
+     * @param dest the address of the block
+     * @param value the value to store repeatedly; its type sets the width of each store
+     * @param numBytes the size of the block in bytes, which should be a multiple of the size of value
+     */
+    void SetMemory(TR::IlValue *dest, TR::IlValue *value, TR::IlValue *numBytes);
+
     void Transaction(TR::IlBuilder **persistentFailureBuilder, TR::IlBuilder **transientFailureBuilder,
         TR::IlBuilder **fallThroughBuilder);
     void TransactionAbort();
@@ -377,6 +410,14 @@ public:
     void VectorStore(const char *name, TR::IlValue *value);
     void VectorStoreAt(TR::IlValue *address, TR::IlValue *value);
 
+    // vector lanes; operations the target cannot evaluate directly are done one lane at a time through the stack
+    TR::IlValue *VectorSplat(TR::IlValue *value);
+    TR::IlValue *VectorGetElement(TR::IlValue *vector, TR::IlValue *index);
+    TR::IlValue *VectorSetElement(TR::IlValue *vector, TR::IlValue *index, TR::IlValue *element);
+    TR::IlValue *VectorReduceAdd(TR::IlValue *vector);
+    TR::IlValue *VectorReduceMin(TR::IlValue *vector);
+    TR::IlValue *VectorReduceMax(TR::IlValue *vector);
+
     // control
     void AppendBuilder(TR::IlBuilder *builder);
 
@@ -767,6 +808,15 @@ protected:
     TR::IlValue *compareOp(TR_ComparisonTypes ct, bool needUnsigned, TR::IlValue *left, TR::IlValue *right);
     TR::IlValue *convertTo(TR::DataType typeTo, TR::IlValue *v, bool needUnsigned);
 
+    bool supportsVectorOp(TR::ILOpCodes op);
+    TR::IlValue *scalarOp(OpCodeMapper mapOp, TR::IlValue *left, TR::IlValue *right);
+    TR::IlValue *mathOp(OpCodeMapper mapOp, TR::VectorOperation vectorOp, TR::IlValue *left,
+        TR::IlValue *right = NULL);
+    TR::IlValue *spillVector(TR::IlValue *vector);
+    TR::IlValue *laneOp(OpCodeMapper mapOp, TR::IlValue *left, TR::IlValue *right);
+    TR::IlValue *vectorReduction(TR::VectorOperation reduction, OpCodeMapper mapOp, TR::IlValue *vector);
+    TR::IlValue *memoryLength(TR::IlValue *numBytes);
+
     void ifCmpCondition(TR_ComparisonTypes ct, bool isUnsignedCmp, TR::IlValue *left, TR::IlValue *right,
         TR::Block *target);
     void ifCmpNotEqualZero(TR::IlValue *condition, TR::Block *target);
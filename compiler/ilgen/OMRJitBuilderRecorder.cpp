@@ -20,40 +20,48 @@
  *******************************************************************************/
 
 #include "infra/Assert.hpp"
+#include "ilgen/IlType.hpp"
 #include "ilgen/JitBuilderRecorder.hpp"
-
-namespace TR {
-class MethodBuilder;
-}
+#include "ilgen/MethodBuilder.hpp"
 
 OMR::JitBuilderRecorder::JitBuilderRecorder(const TR::MethodBuilder *mb, const char *fileName)
     : _mb(mb)
     , _nextID(0)
     , _idSize(8)
-    , _file(fileName, std::fstream::out | std::fstream::trunc)
+    , _started(false)
+    , _complete(true)
+    , _file()
 {
-    start(); // initializes IDs 0 and 1 (reserved)
+    if (fileName != NULL)
+        _file.open(fileName, std::fstream::out | std::fstream::trunc);
+
+    // special reserved values, must do them first ! 0 also stands for a NULL object
+    StoreID(0);
+    StoreID((const void *)1);
 }
 
 OMR::JitBuilderRecorder::~JitBuilderRecorder() {}
 
+// the header is written lazily because the output functions are virtual and so cannot be used by the constructor
 void OMR::JitBuilderRecorder::start()
 {
-    // special reserved value, must do it first !
-    StoreID(0);
-
-    // another special reserved value, so do it first
-    StoreID((const void *)1);
+    _started = true;
 
     String(StatementName::RECORDER_SIGNATURE);
     Number(StatementName::VERSION_MAJOR);
     Number(StatementName::VERSION_MINOR);
     Number(StatementName::VERSION_PATCH);
     EndStatement();
+
+    // the ID size change statements must be defined before they can be needed
+    ensureStatementDefined(StatementName::STATEMENT_ID16BIT);
+    ensureStatementDefined(StatementName::STATEMENT_ID32BIT);
 }
 
 void OMR::JitBuilderRecorder::Close()
 {
+    if (!_started)
+        start();
     end();
     EndStatement();
 }
@@ -62,15 +70,14 @@ OMR::JitBuilderRecorder::TypeID OMR::JitBuilderRecorder::getNewID()
 {
     // support for variable sized ID encoding
     //  to avoid any synchronization issues in how decoders/encoders count IDs, use a statement to signal change
-    // check if we're close to 8-bit / 16-bit boundary
-    // need to leave space for one ID because these statements will not have been defined yet
-    //  and defining the statement needs an ID!
+    //  the statement is written with the old ID size, in place of the builder ID that starts every statement,
+    //  so callers must allocate new IDs before they begin the statement that refers to them
     if (_nextID == (1 << 8) - 2) {
-        _idSize = 16;
         Statement(StatementName::STATEMENT_ID16BIT);
+        _idSize = 16;
     } else if (_nextID == (1 << 16) - 2) {
-        _idSize = 32;
         Statement(StatementName::STATEMENT_ID32BIT);
+        _idSize = 32;
     }
 
     return _nextID++;
@@ -114,8 +121,10 @@ void OMR::JitBuilderRecorder::end()
 
 void OMR::JitBuilderRecorder::BeginStatement(const char *s) { BeginStatement(_mb, s); }
 
-void OMR::JitBuilderRecorder::BeginStatement(const TR::MethodBuilder *b, const char *s)
+void OMR::JitBuilderRecorder::BeginStatement(const TR::IlBuilder *b, const char *s)
 {
+    if (!_started)
+        start();
     ensureStatementDefined(s);
     Builder(b);
     Statement(s);
@@ -138,3 +147,32 @@ bool OMR::JitBuilderRecorder::EnsureAvailableID(const void *ptr)
     StoreID(ptr);
     return false; // ID was not available, but is now
 }
+
+void OMR::JitBuilderRecorder::EnsureType(TR::IlType *type)
+{
+    if (knownID(type))
+        return;
+
+    // operands are listed before the new type's ID so a reader can create the type before naming it
+    if (type->isPointer()) {
+        TR::IlType *baseType = type->baseType();
+        EnsureType(baseType);
+        StoreID(type);
+        BeginStatement(StatementName::STATEMENT_POINTERTYPE);
+        Type(baseType);
+    } else if (type->isStruct()) {
+        StoreID(type);
+        BeginStatement(StatementName::STATEMENT_LOOKUPSTRUCT);
+        String(type->getName());
+    } else if (type->isUnion()) {
+        StoreID(type);
+        BeginStatement(StatementName::STATEMENT_LOOKUPUNION);
+        String(type->getName());
+    } else {
+        StoreID(type);
+        BeginStatement(StatementName::STATEMENT_PRIMITIVETYPE);
+        Number((int32_t)type->getPrimitiveType().getDataType());
+    }
+    Type(type);
+    EndStatement();
+}
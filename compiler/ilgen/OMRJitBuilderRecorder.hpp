@@ -46,6 +46,16 @@ public:
 
     void setMethodBuilderRecorder(TR::MethodBuilder *mb) { _mb = mb; }
 
+    /**
+     * @brief returns false once a service that cannot be replayed has been recorded
+     */
+    bool isComplete() { return _complete; }
+
+    /**
+     * @brief marks this recording as not replayable; nothing further is recorded except the end marker
+     */
+    void markIncomplete() { _complete = false; }
+
     /**
      * @brief Subclasses override these functions to record to different output formats
      */
@@ -73,13 +83,18 @@ public:
 
     virtual void Value(const TR::IlValue *v) {}
 
-    virtual void Builder(const TR::MethodBuilder *b) {}
+    virtual void Builder(const TR::IlBuilder *b) {}
 
     virtual void Builder() {}
 
     virtual void Location(const void *location) {}
 
-    virtual void BeginStatement(const TR::MethodBuilder *b, const char *s);
+    /**
+     * @brief writes the ID given to a function by its DefineFunction statement
+     */
+    void Function(const void *function) { ID(lookupID(function)); }
+
+    virtual void BeginStatement(const TR::IlBuilder *b, const char *s);
     virtual void BeginStatement(const char *s);
 
     virtual void EndStatement() {}
@@ -87,6 +102,12 @@ public:
     void StoreID(const void *ptr);
     bool EnsureAvailableID(const void *ptr);
 
+    /**
+     * @brief Records the statements needed to define a type (and any type it is built from) the first time
+     * the type is referenced. Must be called before the statement that references the type is begun.
+     */
+    void EnsureType(TR::IlType *type);
+
 protected:
     void start();
     bool knownID(const void *ptr);
@@ -101,6 +122,8 @@ protected:
     TypeID _nextID;
     TypeMapID _idMap;
     uint8_t _idSize;
+    bool _started;
+    bool _complete;
 
     std::fstream _file;
 };
@@ -0,0 +1,852 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "il/DataTypes.hpp"
+#include "ilgen/IlBuilder.hpp"
+#include "ilgen/IlType.hpp"
+#include "ilgen/JitBuilderReplay.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/StatementNames.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+// IDs are handed out in order and no statement introduces more than a few at once, so an ID far beyond the
+// ones already seen can only come from a damaged stream
+static const size_t MAX_NEW_IDS = 16;
+
+OMR::JitBuilderReplay::JitBuilderReplay()
+    : _idSize(8)
+    , _mb(NULL)
+    , _failed(false)
+    , _doneDefinitions(false)
+    , _entries()
+    , _strings()
+    , _buildILPosition(0)
+    , _buildILIDSize(8)
+    , _buildILNumEntries(0)
+{}
+
+bool OMR::JitBuilderReplay::replayDefinitions(TR::MethodBuilder *mb)
+{
+    _failed = false;
+    _doneDefinitions = false;
+    _idSize = 8;
+    _entries.clear();
+    setPosition(0);
+
+    // reserved IDs: 0 stands for a NULL object and 1 marks the end of the stream
+    bind(0, NULL);
+    bind(1, NULL);
+
+    if (!readHeader())
+        return false;
+
+    if (!replay(mb, true))
+        return false;
+
+    _buildILPosition = position();
+    _buildILIDSize = _idSize;
+    _buildILNumEntries = _entries.size();
+    return true;
+}
+
+bool OMR::JitBuilderReplay::replayBuildIL(TR::MethodBuilder *mb)
+{
+    if (!_doneDefinitions || _failed)
+        return false;
+
+    // everything created by an earlier replay belonged to that compilation and must be created again
+    setPosition(_buildILPosition);
+    _idSize = _buildILIDSize;
+    _entries.resize(_buildILNumEntries);
+
+    return replay(mb, false);
+}
+
+bool OMR::JitBuilderReplay::readHeader()
+{
+    std::string signature;
+    readString(signature);
+    int16_t major = readInt16();
+    readInt16(); // minor
+    readInt16(); // patch
+
+    if (signature != OMR::StatementName::RECORDER_SIGNATURE || major != OMR::StatementName::VERSION_MAJOR)
+        fail();
+
+    return !_failed;
+}
+
+bool OMR::JitBuilderReplay::replay(TR::MethodBuilder *mb, bool definitions)
+{
+    _mb = mb;
+
+    while (!_failed) {
+        TypeID builderID = readID();
+        if (_failed)
+            break;
+
+        if (builderID == 1) {
+            std::string complete;
+            readString(complete);
+
+            // the definitions always end with DoneConstructor, never with the end of the stream
+            if (definitions || complete != OMR::StatementName::JBIL_COMPLETE)
+                fail();
+            break;
+        }
+
+        if (builderID == 0) {
+            TypeID statementID = readID();
+            const Statement *statement = lookupStatement(readName());
+            if (statement == NULL || _failed) {
+                fail();
+                break;
+            }
+            bind(statementID, NULL);
+            if (!_failed)
+                _entries[statementID]._statement = statement;
+            continue;
+        }
+
+        if (isBound(builderID) && _entries[builderID]._statement != NULL) {
+            // ID size changes are written in place of a builder
+            const char *name = _entries[builderID]._statement->_name;
+            if (strcmp(name, OMR::StatementName::STATEMENT_ID16BIT) == 0)
+                _idSize = 16;
+            else if (strcmp(name, OMR::StatementName::STATEMENT_ID32BIT) == 0)
+                _idSize = 32;
+            else
+                fail();
+            continue;
+        }
+
+        TypeID statementID = readID();
+        if (_failed || !isBound(statementID) || _entries[statementID]._statement == NULL) {
+            fail();
+            break;
+        }
+        const Statement *statement = _entries[statementID]._statement;
+
+        if (!isBound(builderID)) {
+            // the only statement issued by a builder that does not exist yet is the one creating the MethodBuilder
+            if (!definitions || strcmp(statement->_name, OMR::StatementName::STATEMENT_NEWMETHODBUILDER) != 0) {
+                fail();
+                break;
+            }
+            bind(builderID, mb);
+            continue;
+        }
+
+        if (statement->_handler == NULL) {
+            fail();
+            break;
+        }
+
+        TR::IlBuilder *b = static_cast<TR::IlBuilder *>(lookup(builderID));
+        if (_failed)
+            break;
+
+        (this->*(statement->_handler))(b);
+
+        if (definitions && _doneDefinitions)
+            break;
+    }
+
+    return !_failed;
+}
+
+const OMR::JitBuilderReplay::Statement *OMR::JitBuilderReplay::lookupStatement(const char *name)
+{
+    for (const Statement *s = _statements; s->_name != NULL; s++) {
+        if (strcmp(s->_name, name) == 0)
+            return s;
+    }
+    return NULL;
+}
+
+OMR::JitBuilderReplay::TypeID OMR::JitBuilderReplay::readID()
+{
+    if (_idSize == 8)
+        return (uint8_t)readInt8();
+    else if (_idSize == 16)
+        return (uint16_t)readInt16();
+    return (uint32_t)readInt32();
+}
+
+const char *OMR::JitBuilderReplay::readName()
+{
+    std::string name;
+    readString(name);
+    return _strings.insert(name).first->c_str();
+}
+
+void OMR::JitBuilderReplay::bind(TypeID id, void *object)
+{
+    if (id >= _entries.size()) {
+        if (id > _entries.size() + MAX_NEW_IDS) {
+            fail();
+            return;
+        }
+        _entries.resize(id + 1);
+    }
+
+    Entry &entry = _entries[id];
+    entry._statement = NULL;
+    entry._object = object;
+    entry._bound = true;
+}
+
+bool OMR::JitBuilderReplay::isBound(TypeID id) { return id < _entries.size() && _entries[id]._bound; }
+
+void *OMR::JitBuilderReplay::lookup(TypeID id)
+{
+    if (!isBound(id) || _entries[id]._statement != NULL || _entries[id]._object == NULL) {
+        fail();
+        return NULL;
+    }
+    return _entries[id]._object;
+}
+
+// builders handed back through a TR::IlBuilder ** parameter: 0 means no parameter was passed, an ID that
+// has been seen before is passed in, and a new ID is bound to whatever builder the service creates
+OMR::JitBuilderReplay::TypeID OMR::JitBuilderReplay::readBuilderArgument(TR::IlBuilder **builder)
+{
+    TypeID id = readID();
+    *builder = NULL;
+    if (id != 0 && isBound(id))
+        *builder = static_cast<TR::IlBuilder *>(lookup(id));
+    return id;
+}
+
+void OMR::JitBuilderReplay::bindBuilderArgument(TypeID id, TR::IlBuilder *builder)
+{
+    if (id != 0 && !isBound(id))
+        bind(id, builder);
+}
+
+void OMR::JitBuilderReplay::bindResult(TypeID id, TR::IlValue *result)
+{
+    if (id != 0)
+        bind(id, result);
+}
+
+//
+// definitions
+//
+
+void OMR::JitBuilderReplay::doneConstructor(TR::IlBuilder *b) { _doneDefinitions = true; }
+
+void OMR::JitBuilderReplay::defineName(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    if (!_failed)
+        _mb->DefineName(name);
+}
+
+void OMR::JitBuilderReplay::defineFile(TR::IlBuilder *b)
+{
+    const char *file = readName();
+    if (!_failed)
+        _mb->DefineFile(file);
+}
+
+void OMR::JitBuilderReplay::defineLineString(TR::IlBuilder *b)
+{
+    const char *line = readName();
+    if (!_failed)
+        _mb->DefineLine(line);
+}
+
+void OMR::JitBuilderReplay::defineReturnType(TR::IlBuilder *b)
+{
+    TR::IlType *type = readType();
+    if (!_failed)
+        _mb->DefineReturnType(type);
+}
+
+// symbols defined while generating IL are still defined if the MethodBuilder is compiled again
+void OMR::JitBuilderReplay::defineParameter(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TR::IlType *type = readType();
+    if (!_failed && !_mb->symbolDefined(name))
+        _mb->DefineParameter(name, type);
+}
+
+void OMR::JitBuilderReplay::defineArrayParameter(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TR::IlType *type = readType();
+    if (!_failed && !_mb->symbolDefined(name))
+        _mb->DefineArrayParameter(name, type);
+}
+
+void OMR::JitBuilderReplay::defineLocal(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TR::IlType *type = readType();
+    if (!_failed && !_mb->symbolDefined(name))
+        _mb->DefineLocal(name, type);
+}
+
+void OMR::JitBuilderReplay::defineMemory(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TR::IlType *type = readType();
+    void *location = readLocation();
+    if (!_failed && !_mb->symbolDefined(name))
+        _mb->DefineMemory(name, type, location);
+}
+
+void OMR::JitBuilderReplay::defineGlobal(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TR::IlType *type = readType();
+    void *location = readLocation();
+    if (!_failed && !_mb->symbolDefined(name))
+        _mb->DefineGlobal(name, type, location);
+}
+
+void OMR::JitBuilderReplay::defineFunction(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    const char *fileName = readName();
+    const char *lineNumber = readName();
+    void *entryPoint = readLocation();
+    TR::IlType *returnType = readType();
+    int32_t numParms = readInt32();
+    if (numParms < 0)
+        fail();
+
+    std::vector<TR::IlType *> parmTypes;
+    for (int32_t p = 0; p < numParms && !_failed; p++)
+        parmTypes.push_back(readType());
+    TypeID id = readID();
+    if (_failed)
+        return;
+
+    if (_mb->lookupFunction(name) == NULL)
+        _mb->DefineFunction(name, fileName, lineNumber, entryPoint, returnType, numParms,
+            numParms > 0 ? &parmTypes[0] : NULL);
+    bind(id, _mb->lookupFunction(name));
+}
+
+void OMR::JitBuilderReplay::allLocalsHaveBeenDefined(TR::IlBuilder *b) { _mb->AllLocalsHaveBeenDefined(); }
+
+void OMR::JitBuilderReplay::primitiveType(TR::IlBuilder *b)
+{
+    int32_t dt = readInt32();
+    TypeID id = readID();
+    if (dt < 0 || dt >= TR::NumAllTypes)
+        fail();
+    if (!_failed)
+        bind(id, _mb->typeDictionary()->PrimitiveType(TR::DataType((TR::DataTypes)dt)));
+}
+
+void OMR::JitBuilderReplay::pointerType(TR::IlBuilder *b)
+{
+    TR::IlType *baseType = readType();
+    TypeID id = readID();
+    if (!_failed)
+        bind(id, _mb->typeDictionary()->PointerTo(baseType));
+}
+
+// structs and unions are not recorded: they must already be defined in the replaying TypeDictionary
+void OMR::JitBuilderReplay::lookupStruct(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TypeID id = readID();
+    if (!_failed)
+        bind(id, _mb->typeDictionary()->LookupStruct(name));
+}
+
+void OMR::JitBuilderReplay::lookupUnion(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TypeID id = readID();
+    if (!_failed)
+        bind(id, _mb->typeDictionary()->LookupUnion(name));
+}
+
+//
+// services
+//
+
+void OMR::JitBuilderReplay::newIlBuilder(TR::IlBuilder *b)
+{
+    TypeID id = readID();
+    if (!_failed)
+        bind(id, b->OrphanBuilder());
+}
+
+void OMR::JitBuilderReplay::appendBuilder(TR::IlBuilder *b)
+{
+    TR::IlBuilder *builder = readBuilder();
+    if (!_failed)
+        b->AppendBuilder(builder);
+}
+
+void OMR::JitBuilderReplay::nullAddress(TR::IlBuilder *b)
+{
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->NullAddress());
+}
+
+void OMR::JitBuilderReplay::constInt8(TR::IlBuilder *b)
+{
+    int8_t value = readInt8();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->ConstInt8(value));
+}
+
+void OMR::JitBuilderReplay::constInt16(TR::IlBuilder *b)
+{
+    int16_t value = readInt16();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->ConstInt16(value));
+}
+
+void OMR::JitBuilderReplay::constInt32(TR::IlBuilder *b)
+{
+    int32_t value = readInt32();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->ConstInt32(value));
+}
+
+void OMR::JitBuilderReplay::constInt64(TR::IlBuilder *b)
+{
+    int64_t value = readInt64();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->ConstInt64(value));
+}
+
+void OMR::JitBuilderReplay::constFloat(TR::IlBuilder *b)
+{
+    float value = readFloat();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->ConstFloat(value));
+}
+
+void OMR::JitBuilderReplay::constDouble(TR::IlBuilder *b)
+{
+    double value = readDouble();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->ConstDouble(value));
+}
+
+void OMR::JitBuilderReplay::constAddress(TR::IlBuilder *b)
+{
+    void *value = readLocation();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->ConstAddress(value));
+}
+
+void OMR::JitBuilderReplay::indexAt(TR::IlBuilder *b)
+{
+    TR::IlType *type = readType();
+    TR::IlValue *base = readValue();
+    TR::IlValue *index = readValue();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->IndexAt(type, base, index));
+}
+
+void OMR::JitBuilderReplay::loadIndirect(TR::IlBuilder *b)
+{
+    const char *type = readName();
+    const char *field = readName();
+    TR::IlValue *object = readValue();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->LoadIndirect(type, field, object));
+}
+
+void OMR::JitBuilderReplay::storeIndirect(TR::IlBuilder *b)
+{
+    const char *type = readName();
+    const char *field = readName();
+    TR::IlValue *object = readValue();
+    TR::IlValue *value = readValue();
+    if (!_failed)
+        b->StoreIndirect(type, field, object, value);
+}
+
+void OMR::JitBuilderReplay::createLocalArray(TR::IlBuilder *b)
+{
+    int32_t numElements = readInt32();
+    TR::IlType *elementType = readType();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->CreateLocalArray(numElements, elementType));
+}
+
+void OMR::JitBuilderReplay::createLocalStruct(TR::IlBuilder *b)
+{
+    TR::IlType *structType = readType();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->CreateLocalStruct(structType));
+}
+
+void OMR::JitBuilderReplay::copyMemory(TR::IlBuilder *b)
+{
+    TR::IlValue *dest = readValue();
+    TR::IlValue *source = readValue();
+    TR::IlValue *numBytes = readValue();
+    if (!_failed)
+        b->CopyMemory(dest, source, numBytes);
+}
+
+void OMR::JitBuilderReplay::setMemory(TR::IlBuilder *b)
+{
+    TR::IlValue *dest = readValue();
+    TR::IlValue *value = readValue();
+    TR::IlValue *numBytes = readValue();
+    if (!_failed)
+        b->SetMemory(dest, value, numBytes);
+}
+
+void OMR::JitBuilderReplay::vectorSetElement(TR::IlBuilder *b)
+{
+    TR::IlValue *vector = readValue();
+    TR::IlValue *index = readValue();
+    TR::IlValue *element = readValue();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->VectorSetElement(vector, index, element));
+}
+
+void OMR::JitBuilderReplay::select(TR::IlBuilder *b)
+{
+    TR::IlValue *condition = readValue();
+    TR::IlValue *trueValue = readValue();
+    TR::IlValue *falseValue = readValue();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->Select(condition, trueValue, falseValue));
+}
+
+void OMR::JitBuilderReplay::returnNoValue(TR::IlBuilder *b) { b->Return(); }
+
+void OMR::JitBuilderReplay::returnValue(TR::IlBuilder *b)
+{
+    TR::IlValue *value = readValue();
+    if (!_failed)
+        b->Return(value);
+}
+
+void OMR::JitBuilderReplay::gotoBuilder(TR::IlBuilder *b)
+{
+    TR::IlBuilder *dest;
+    TypeID destID = readBuilderArgument(&dest);
+    if (destID == 0)
+        fail();
+    if (_failed)
+        return;
+
+    b->Goto(&dest);
+    bindBuilderArgument(destID, dest);
+}
+
+void OMR::JitBuilderReplay::ifThenElse(TR::IlBuilder *b)
+{
+    TR::IlBuilder *thenPath, *elsePath;
+    TypeID thenID = readBuilderArgument(&thenPath);
+    TypeID elseID = readBuilderArgument(&elsePath);
+    TR::IlValue *condition = readValue();
+    if (_failed)
+        return;
+
+    b->IfThenElse(builderArgument(thenID, &thenPath), builderArgument(elseID, &elsePath), condition);
+    bindBuilderArgument(thenID, thenPath);
+    bindBuilderArgument(elseID, elsePath);
+}
+
+void OMR::JitBuilderReplay::forLoop(TR::IlBuilder *b)
+{
+    bool countsUp = readInt8() != 0;
+    const char *indVar = readName();
+    TR::IlBuilder *loopCode, *breakBuilder, *continueBuilder;
+    TypeID loopCodeID = readBuilderArgument(&loopCode);
+    TypeID breakID = readBuilderArgument(&breakBuilder);
+    TypeID continueID = readBuilderArgument(&continueBuilder);
+    TR::IlValue *initial = readValue();
+    TR::IlValue *end = readValue();
+    TR::IlValue *increment = readValue();
+    if (_failed)
+        return;
+
+    b->ForLoop(countsUp, indVar, builderArgument(loopCodeID, &loopCode), builderArgument(breakID, &breakBuilder),
+        builderArgument(continueID, &continueBuilder), initial, end, increment);
+    bindBuilderArgument(loopCodeID, loopCode);
+    bindBuilderArgument(breakID, breakBuilder);
+    bindBuilderArgument(continueID, continueBuilder);
+}
+
+void OMR::JitBuilderReplay::call(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    int32_t numArgs = readInt32();
+    if (numArgs < 0)
+        fail();
+
+    std::vector<TR::IlValue *> args;
+    for (int32_t a = 0; a < numArgs && !_failed; a++)
+        args.push_back(readValue());
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, b->Call(name, numArgs, numArgs > 0 ? &args[0] : NULL));
+}
+
+template<OMR::JitBuilderReplay::UnaryService S> void OMR::JitBuilderReplay::unary(TR::IlBuilder *b)
+{
+    TR::IlValue *v = readValue();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, (b->*S)(v));
+}
+
+template<OMR::JitBuilderReplay::BinaryService S> void OMR::JitBuilderReplay::binary(TR::IlBuilder *b)
+{
+    TR::IlValue *left = readValue();
+    TR::IlValue *right = readValue();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, (b->*S)(left, right));
+}
+
+template<OMR::JitBuilderReplay::TypedService S> void OMR::JitBuilderReplay::typed(TR::IlBuilder *b)
+{
+    TR::IlType *type = readType();
+    TR::IlValue *v = readValue();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, (b->*S)(type, v));
+}
+
+template<OMR::JitBuilderReplay::NamedService S> void OMR::JitBuilderReplay::named(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TypeID result = readID();
+    if (!_failed)
+        bindResult(result, (b->*S)(name));
+}
+
+template<OMR::JitBuilderReplay::StoreService S> void OMR::JitBuilderReplay::store(TR::IlBuilder *b)
+{
+    const char *name = readName();
+    TR::IlValue *value = readValue();
+    if (!_failed)
+        (b->*S)(name, value);
+}
+
+template<OMR::JitBuilderReplay::StoreAtService S> void OMR::JitBuilderReplay::storeAt(TR::IlBuilder *b)
+{
+    TR::IlValue *dest = readValue();
+    TR::IlValue *value = readValue();
+    if (!_failed)
+        (b->*S)(dest, value);
+}
+
+template<OMR::JitBuilderReplay::IfCmpService S> void OMR::JitBuilderReplay::ifCmp(TR::IlBuilder *b)
+{
+    TR::IlBuilder *target;
+    TypeID targetID = readBuilderArgument(&target);
+    TR::IlValue *left = readValue();
+    TR::IlValue *right = readValue();
+    if (targetID == 0)
+        fail();
+    if (_failed)
+        return;
+
+    (b->*S)(&target, left, right);
+    bindBuilderArgument(targetID, target);
+}
+
+template<OMR::JitBuilderReplay::IfCmpZeroService S> void OMR::JitBuilderReplay::ifCmpZero(TR::IlBuilder *b)
+{
+    TR::IlBuilder *target;
+    TypeID targetID = readBuilderArgument(&target);
+    TR::IlValue *condition = readValue();
+    if (targetID == 0)
+        fail();
+    if (_failed)
+        return;
+
+    (b->*S)(&target, condition);
+    bindBuilderArgument(targetID, target);
+}
+
+template<OMR::JitBuilderReplay::WhileLoopService S> void OMR::JitBuilderReplay::whileLoop(TR::IlBuilder *b)
+{
+    const char *whileCondition = readName();
+    TR::IlBuilder *body, *breakBuilder, *continueBuilder;
+    TypeID bodyID = readBuilderArgument(&body);
+    TypeID breakID = readBuilderArgument(&breakBuilder);
+    TypeID continueID = readBuilderArgument(&continueBuilder);
+    if (_failed)
+        return;
+
+    (b->*S)(whileCondition, builderArgument(bodyID, &body), builderArgument(breakID, &breakBuilder),
+        builderArgument(continueID, &continueBuilder));
+    bindBuilderArgument(bodyID, body);
+    bindBuilderArgument(breakID, breakBuilder);
+    bindBuilderArgument(continueID, continueBuilder);
+}
+
+// Statements not listed here (overflow checking arithmetic, switches, bytecode builders, ...) are never
+// written to a complete recording.
+const OMR::JitBuilderReplay::Statement OMR::JitBuilderReplay::_statements[] = {
+    { OMR::StatementName::STATEMENT_ID16BIT, NULL },
+    { OMR::StatementName::STATEMENT_ID32BIT, NULL },
+    { OMR::StatementName::STATEMENT_NEWMETHODBUILDER, NULL },
+    { OMR::StatementName::STATEMENT_DONECONSTRUCTOR, &OMR::JitBuilderReplay::doneConstructor },
+    { OMR::StatementName::STATEMENT_DEFINENAME, &OMR::JitBuilderReplay::defineName },
+    { OMR::StatementName::STATEMENT_DEFINEFILE, &OMR::JitBuilderReplay::defineFile },
+    { OMR::StatementName::STATEMENT_DEFINELINESTRING, &OMR::JitBuilderReplay::defineLineString },
+    { OMR::StatementName::STATEMENT_DEFINERETURNTYPE, &OMR::JitBuilderReplay::defineReturnType },
+    { OMR::StatementName::STATEMENT_DEFINEPARAMETER, &OMR::JitBuilderReplay::defineParameter },
+    { OMR::StatementName::STATEMENT_DEFINEARRAYPARAMETER, &OMR::JitBuilderReplay::defineArrayParameter },
+    { OMR::StatementName::STATEMENT_DEFINELOCAL, &OMR::JitBuilderReplay::defineLocal },
+    { OMR::StatementName::STATEMENT_DEFINEMEMORY, &OMR::JitBuilderReplay::defineMemory },
+    { OMR::StatementName::STATEMENT_DEFINEGLOBAL, &OMR::JitBuilderReplay::defineGlobal },
+    { OMR::StatementName::STATEMENT_DEFINEFUNCTION, &OMR::JitBuilderReplay::defineFunction },
+    { OMR::StatementName::STATEMENT_ALLLOCALSHAVEBEENDEFINED, &OMR::JitBuilderReplay::allLocalsHaveBeenDefined },
+    { OMR::StatementName::STATEMENT_PRIMITIVETYPE, &OMR::JitBuilderReplay::primitiveType },
+    { OMR::StatementName::STATEMENT_POINTERTYPE, &OMR::JitBuilderReplay::pointerType },
+    { OMR::StatementName::STATEMENT_LOOKUPSTRUCT, &OMR::JitBuilderReplay::lookupStruct },
+    { OMR::StatementName::STATEMENT_LOOKUPUNION, &OMR::JitBuilderReplay::lookupUnion },
+    { OMR::StatementName::STATEMENT_NEWILBUILDER, &OMR::JitBuilderReplay::newIlBuilder },
+    { OMR::StatementName::STATEMENT_APPENDBUILDER, &OMR::JitBuilderReplay::appendBuilder },
+    { OMR::StatementName::STATEMENT_NULLADDRESS, &OMR::JitBuilderReplay::nullAddress },
+    { OMR::StatementName::STATEMENT_CONSTINT8, &OMR::JitBuilderReplay::constInt8 },
+    { OMR::StatementName::STATEMENT_CONSTINT16, &OMR::JitBuilderReplay::constInt16 },
+    { OMR::StatementName::STATEMENT_CONSTINT32, &OMR::JitBuilderReplay::constInt32 },
+    { OMR::StatementName::STATEMENT_CONSTINT64, &OMR::JitBuilderReplay::constInt64 },
+    { OMR::StatementName::STATEMENT_CONSTFLOAT, &OMR::JitBuilderReplay::constFloat },
+    { OMR::StatementName::STATEMENT_CONSTDOUBLE, &OMR::JitBuilderReplay::constDouble },
+    { OMR::StatementName::STATEMENT_CONSTADDRESS, &OMR::JitBuilderReplay::constAddress },
+    { OMR::StatementName::STATEMENT_COPY, &OMR::JitBuilderReplay::unary<&OMR::IlBuilder::Copy> },
+    { OMR::StatementName::STATEMENT_NEGATE, &OMR::JitBuilderReplay::unary<&OMR::IlBuilder::Negate> },
+    { OMR::StatementName::STATEMENT_ABS, &OMR::JitBuilderReplay::unary<&OMR::IlBuilder::Abs> },
+    { OMR::StatementName::STATEMENT_SQRT, &OMR::JitBuilderReplay::unary<&OMR::IlBuilder::Sqrt> },
+    { OMR::StatementName::STATEMENT_LOAD, &OMR::JitBuilderReplay::named<&OMR::IlBuilder::Load> },
+    { OMR::StatementName::STATEMENT_VECTORLOAD, &OMR::JitBuilderReplay::named<&OMR::IlBuilder::VectorLoad> },
+    { OMR::StatementName::STATEMENT_STORE, &OMR::JitBuilderReplay::store<&OMR::IlBuilder::Store> },
+    { OMR::StatementName::STATEMENT_VECTORSTORE, &OMR::JitBuilderReplay::store<&OMR::IlBuilder::VectorStore> },
+    { OMR::StatementName::STATEMENT_STOREOVER, &OMR::JitBuilderReplay::storeAt<&OMR::IlBuilder::StoreOver> },
+    { OMR::StatementName::STATEMENT_STOREAT, &OMR::JitBuilderReplay::storeAt<&OMR::IlBuilder::StoreAt> },
+    { OMR::StatementName::STATEMENT_VECTORSTOREAT, &OMR::JitBuilderReplay::storeAt<&OMR::IlBuilder::VectorStoreAt> },
+    { OMR::StatementName::STATEMENT_LOADAT, &OMR::JitBuilderReplay::typed<&OMR::IlBuilder::LoadAt> },
+    { OMR::StatementName::STATEMENT_VECTORLOADAT, &OMR::JitBuilderReplay::typed<&OMR::IlBuilder::VectorLoadAt> },
+    { OMR::StatementName::STATEMENT_VECTORSPLAT, &OMR::JitBuilderReplay::unary<&OMR::IlBuilder::VectorSplat> },
+    { OMR::StatementName::STATEMENT_VECTORGETELEMENT,
+        &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::VectorGetElement> },
+    { OMR::StatementName::STATEMENT_VECTORSETELEMENT, &OMR::JitBuilderReplay::vectorSetElement },
+    { OMR::StatementName::STATEMENT_VECTORREDUCEADD,
+        &OMR::JitBuilderReplay::unary<&OMR::IlBuilder::VectorReduceAdd> },
+    { OMR::StatementName::STATEMENT_VECTORREDUCEMIN,
+        &OMR::JitBuilderReplay::unary<&OMR::IlBuilder::VectorReduceMin> },
+    { OMR::StatementName::STATEMENT_VECTORREDUCEMAX,
+        &OMR::JitBuilderReplay::unary<&OMR::IlBuilder::VectorReduceMax> },
+    { OMR::StatementName::STATEMENT_INDEXAT, &OMR::JitBuilderReplay::indexAt },
+    { OMR::StatementName::STATEMENT_LOADINDIRECT, &OMR::JitBuilderReplay::loadIndirect },
+    { OMR::StatementName::STATEMENT_STOREINDIRECT, &OMR::JitBuilderReplay::storeIndirect },
+    { OMR::StatementName::STATEMENT_CREATELOCALARRAY, &OMR::JitBuilderReplay::createLocalArray },
+    { OMR::StatementName::STATEMENT_CREATELOCALSTRUCT, &OMR::JitBuilderReplay::createLocalStruct },
+    { OMR::StatementName::STATEMENT_COPYMEMORY, &OMR::JitBuilderReplay::copyMemory },
+    { OMR::StatementName::STATEMENT_SETMEMORY, &OMR::JitBuilderReplay::setMemory },
+    { OMR::StatementName::STATEMENT_CONVERTTO, &OMR::JitBuilderReplay::typed<&OMR::IlBuilder::ConvertTo> },
+    { OMR::StatementName::STATEMENT_UNSIGNEDCONVERTTO,
+        &OMR::JitBuilderReplay::typed<&OMR::IlBuilder::UnsignedConvertTo> },
+    { OMR::StatementName::STATEMENT_CONVERTBITSTO, &OMR::JitBuilderReplay::typed<&OMR::IlBuilder::ConvertBitsTo> },
+    { OMR::StatementName::STATEMENT_ADD, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Add> },
+    { OMR::StatementName::STATEMENT_SUB, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Sub> },
+    { OMR::StatementName::STATEMENT_MUL, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Mul> },
+    { OMR::StatementName::STATEMENT_DIV, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Div> },
+    { OMR::StatementName::STATEMENT_UNSIGNEDDIV, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::UnsignedDiv> },
+    { OMR::StatementName::STATEMENT_REM, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Rem> },
+    { OMR::StatementName::STATEMENT_UNSIGNEDREM, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::UnsignedRem> },
+    { OMR::StatementName::STATEMENT_AND, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::And> },
+    { OMR::StatementName::STATEMENT_OR, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Or> },
+    { OMR::StatementName::STATEMENT_XOR, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Xor> },
+    { OMR::StatementName::STATEMENT_MIN, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Min> },
+    { OMR::StatementName::STATEMENT_MAX, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::Max> },
+    { OMR::StatementName::STATEMENT_SHIFTL, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::ShiftL> },
+    { OMR::StatementName::STATEMENT_SHIFTR, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::ShiftR> },
+    { OMR::StatementName::STATEMENT_UNSIGNEDSHIFTR, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::UnsignedShiftR> },
+    { OMR::StatementName::STATEMENT_EQUALTO, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::EqualTo> },
+    { OMR::StatementName::STATEMENT_NOTEQUALTO, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::NotEqualTo> },
+    { OMR::StatementName::STATEMENT_LESSTHAN, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::LessThan> },
+    { OMR::StatementName::STATEMENT_UNSIGNEDLESSTHAN,
+        &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::UnsignedLessThan> },
+    { OMR::StatementName::STATEMENT_LESSOREQUALTO, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::LessOrEqualTo> },
+    { OMR::StatementName::STATEMENT_UNSIGNEDLESSOREQUALTO,
+        &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::UnsignedLessOrEqualTo> },
+    { OMR::StatementName::STATEMENT_GREATERTHAN, &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::GreaterThan> },
+    { OMR::StatementName::STATEMENT_UNSIGNEDGREATERTHAN,
+        &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::UnsignedGreaterThan> },
+    { OMR::StatementName::STATEMENT_GREATEROREQUALTO,
+        &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::GreaterOrEqualTo> },
+    { OMR::StatementName::STATEMENT_UNSIGNEDGREATEROREQUALTO,
+        &OMR::JitBuilderReplay::binary<&OMR::IlBuilder::UnsignedGreaterOrEqualTo> },
+    { OMR::StatementName::STATEMENT_SELECT, &OMR::JitBuilderReplay::select },
+    { OMR::StatementName::STATEMENT_RETURN, &OMR::JitBuilderReplay::returnNoValue },
+    { OMR::StatementName::STATEMENT_RETURNVALUE, &OMR::JitBuilderReplay::returnValue },
+    { OMR::StatementName::STATEMENT_GOTO, &OMR::JitBuilderReplay::gotoBuilder },
+    { OMR::StatementName::STATEMENT_IFTHENELSE, &OMR::JitBuilderReplay::ifThenElse },
+    { OMR::StatementName::STATEMENT_IFCMPEQUALZERO, &OMR::JitBuilderReplay::ifCmpZero<&OMR::IlBuilder::IfCmpEqualZero> },
+    { OMR::StatementName::STATEMENT_IFCMPNOTEQUALZERO,
+        &OMR::JitBuilderReplay::ifCmpZero<&OMR::IlBuilder::IfCmpNotEqualZero> },
+    { OMR::StatementName::STATEMENT_IFCMPEQUAL, &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpEqual> },
+    { OMR::StatementName::STATEMENT_IFCMPNOTEQUAL, &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpNotEqual> },
+    { OMR::StatementName::STATEMENT_IFCMPLESSTHAN, &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpLessThan> },
+    { OMR::StatementName::STATEMENT_IFCMPUNSIGNEDLESSTHAN,
+        &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpUnsignedLessThan> },
+    { OMR::StatementName::STATEMENT_IFCMPLESSOREQUAL,
+        &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpLessOrEqual> },
+    { OMR::StatementName::STATEMENT_IFCMPUNSIGNEDLESSOREQUAL,
+        &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpUnsignedLessOrEqual> },
+    { OMR::StatementName::STATEMENT_IFCMPGREATERTHAN,
+        &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpGreaterThan> },
+    { OMR::StatementName::STATEMENT_IFCMPUNSIGNEDGREATERTHAN,
+        &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpUnsignedGreaterThan> },
+    { OMR::StatementName::STATEMENT_IFCMPGREATEROREQUAL,
+        &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpGreaterOrEqual> },
+    { OMR::StatementName::STATEMENT_IFCMPUNSIGNEDGREATEROREQUAL,
+        &OMR::JitBuilderReplay::ifCmp<&OMR::IlBuilder::IfCmpUnsignedGreaterOrEqual> },
+    { OMR::StatementName::STATEMENT_FORLOOP, &OMR::JitBuilderReplay::forLoop },
+    { OMR::StatementName::STATEMENT_DOWHILELOOP, &OMR::JitBuilderReplay::whileLoop<&OMR::IlBuilder::DoWhileLoop> },
+    { OMR::StatementName::STATEMENT_WHILEDOLOOP, &OMR::JitBuilderReplay::whileLoop<&OMR::IlBuilder::WhileDoLoop> },
+    { OMR::StatementName::STATEMENT_CALL, &OMR::JitBuilderReplay::call },
+    { NULL, NULL }
+};
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_JITBUILDERREPLAY_INCL
+#define OMR_JITBUILDERREPLAY_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace TR {
+class IlBuilder;
+class MethodBuilder;
+class IlType;
+class IlValue;
+} // namespace TR
+
+namespace OMR {
+
+class IlBuilder;
+
+/**
+ * @brief Rebuilds the IL of a MethodBuilder from a stream written by a JitBuilderRecorder.
+ *
+ * The stream is read in two parts: the definitions captured when the recorded MethodBuilder started
+ * generating IL (name, return type, parameters, locals, ...), which are applied once to the replaying
+ * MethodBuilder by replayDefinitions(), and the services called by buildIL(), which are called again
+ * on the replaying MethodBuilder's builders by replayBuildIL() every time it is compiled. A replay object
+ * keeps all strings it reads, so it must live as long as any MethodBuilder it has been applied to.
+ *
+ * Subclasses decode a particular recording format by implementing the read functions.
+ */
+class JitBuilderReplay {
+public:
+    typedef uint32_t TypeID;
+
+    JitBuilderReplay();
+    virtual ~JitBuilderReplay() {}
+
+    /**
+     * @brief Applies the recorded definitions to a MethodBuilder, normally from its constructor
+     * @returns false if the stream could not be replayed
+     */
+    bool replayDefinitions(TR::MethodBuilder *mb);
+
+    /**
+     * @brief Calls the recorded services on the builders of a MethodBuilder, normally from its buildIL()
+     * @returns false if the stream could not be replayed
+     */
+    bool replayBuildIL(TR::MethodBuilder *mb);
+
+    /**
+     * @brief returns true once the stream has been found to be malformed or to need something not available here
+     */
+    bool failed() { return _failed; }
+
+protected:
+    virtual int8_t readInt8() = 0;
+    virtual int16_t readInt16() = 0;
+    virtual int32_t readInt32() = 0;
+    virtual int64_t readInt64() = 0;
+    virtual float readFloat() = 0;
+    virtual double readDouble() = 0;
+    virtual void readString(std::string &string) = 0;
+    virtual void *readLocation() = 0;
+    virtual TypeID readID();
+
+    /**
+     * @brief Subclasses report the current read position so the stream can be read from the same place again
+     */
+    virtual size_t position() = 0;
+    virtual void setPosition(size_t position) = 0;
+
+    /**
+     * @brief Records that the stream cannot be replayed; every later read is ignored
+     */
+    void fail() { _failed = true; }
+
+    uint8_t _idSize;
+
+private:
+    typedef void (JitBuilderReplay::*Handler)(TR::IlBuilder *b);
+
+    struct Statement {
+        const char *_name;
+        Handler _handler;
+    };
+
+    struct Entry {
+        Entry()
+            : _statement(NULL)
+            , _object(NULL)
+            , _bound(false)
+        {}
+
+        const Statement *_statement;
+        void *_object;
+        bool _bound;
+    };
+
+    typedef TR::IlValue *(OMR::IlBuilder::*UnaryService)(TR::IlValue *v);
+    typedef TR::IlValue *(OMR::IlBuilder::*BinaryService)(TR::IlValue *left, TR::IlValue *right);
+    typedef TR::IlValue *(OMR::IlBuilder::*TypedService)(TR::IlType *t, TR::IlValue *v);
+    typedef TR::IlValue *(OMR::IlBuilder::*NamedService)(const char *name);
+    typedef void (OMR::IlBuilder::*StoreService)(const char *name, TR::IlValue *value);
+    typedef void (OMR::IlBuilder::*StoreAtService)(TR::IlValue *dest, TR::IlValue *value);
+    typedef void (OMR::IlBuilder::*IfCmpService)(TR::IlBuilder **target, TR::IlValue *left, TR::IlValue *right);
+    typedef void (OMR::IlBuilder::*IfCmpZeroService)(TR::IlBuilder **target, TR::IlValue *condition);
+    typedef void (OMR::IlBuilder::*WhileLoopService)(const char *whileCondition, TR::IlBuilder **body,
+        TR::IlBuilder **breakBuilder, TR::IlBuilder **continueBuilder);
+
+    static const Statement _statements[];
+
+    bool replay(TR::MethodBuilder *mb, bool definitions);
+    bool readHeader();
+    const Statement *lookupStatement(const char *name);
+
+    const char *readName();
+    void bind(TypeID id, void *object);
+    bool isBound(TypeID id);
+    void *lookup(TypeID id);
+    TR::IlValue *readValue() { return static_cast<TR::IlValue *>(lookup(readID())); }
+    TR::IlType *readType() { return static_cast<TR::IlType *>(lookup(readID())); }
+    TR::IlBuilder *readBuilder() { return static_cast<TR::IlBuilder *>(lookup(readID())); }
+    TypeID readBuilderArgument(TR::IlBuilder **builder);
+    TR::IlBuilder **builderArgument(TypeID id, TR::IlBuilder **builder) { return id != 0 ? builder : NULL; }
+    void bindBuilderArgument(TypeID id, TR::IlBuilder *builder);
+    void bindResult(TypeID id, TR::IlValue *result);
+
+    // definitions
+    void doneConstructor(TR::IlBuilder *b);
+    void defineName(TR::IlBuilder *b);
+    void defineFile(TR::IlBuilder *b);
+    void defineLineString(TR::IlBuilder *b);
+    void defineReturnType(TR::IlBuilder *b);
+    void defineParameter(TR::IlBuilder *b);
+    void defineArrayParameter(TR::IlBuilder *b);
+    void defineLocal(TR::IlBuilder *b);
+    void defineMemory(TR::IlBuilder *b);
+    void defineGlobal(TR::IlBuilder *b);
+    void defineFunction(TR::IlBuilder *b);
+    void allLocalsHaveBeenDefined(TR::IlBuilder *b);
+    void primitiveType(TR::IlBuilder *b);
+    void pointerType(TR::IlBuilder *b);
+    void lookupStruct(TR::IlBuilder *b);
+    void lookupUnion(TR::IlBuilder *b);
+
+    // services
+    void newIlBuilder(TR::IlBuilder *b);
+    void appendBuilder(TR::IlBuilder *b);
+    void nullAddress(TR::IlBuilder *b);
+    void constInt8(TR::IlBuilder *b);
+    void constInt16(TR::IlBuilder *b);
+    void constInt32(TR::IlBuilder *b);
+    void constInt64(TR::IlBuilder *b);
+    void constFloat(TR::IlBuilder *b);
+    void constDouble(TR::IlBuilder *b);
+    void constAddress(TR::IlBuilder *b);
+    void indexAt(TR::IlBuilder *b);
+    void loadIndirect(TR::IlBuilder *b);
+    void storeIndirect(TR::IlBuilder *b);
+    void createLocalArray(TR::IlBuilder *b);
+    void createLocalStruct(TR::IlBuilder *b);
+    void copyMemory(TR::IlBuilder *b);
+    void setMemory(TR::IlBuilder *b);
+    void vectorSetElement(TR::IlBuilder *b);
+    void select(TR::IlBuilder *b);
+    void returnNoValue(TR::IlBuilder *b);
+    void returnValue(TR::IlBuilder *b);
+    void gotoBuilder(TR::IlBuilder *b);
+    void ifThenElse(TR::IlBuilder *b);
+    void forLoop(TR::IlBuilder *b);
+    void call(TR::IlBuilder *b);
+
+    template<UnaryService S> void unary(TR::IlBuilder *b);
+    template<BinaryService S> void binary(TR::IlBuilder *b);
+    template<TypedService S> void typed(TR::IlBuilder *b);
+    template<NamedService S> void named(TR::IlBuilder *b);
+    template<StoreService S> void store(TR::IlBuilder *b);
+    template<StoreAtService S> void storeAt(TR::IlBuilder *b);
+    template<IfCmpService S> void ifCmp(TR::IlBuilder *b);
+    template<IfCmpZeroService S> void ifCmpZero(TR::IlBuilder *b);
+    template<WhileLoopService S> void whileLoop(TR::IlBuilder *b);
+
+    TR::MethodBuilder *_mb;
+    bool _failed;
+    bool _doneDefinitions;
+    std::vector<Entry> _entries;
+    std::set<std::string> _strings;
+
+    // where replayBuildIL() starts reading, saved by replayDefinitions()
+    size_t _buildILPosition;
+    uint8_t _buildILIDSize;
+    size_t _buildILNumEntries;
+};
+
+} // namespace OMR
+
+#endif // !defined(OMR_JITBUILDERREPLAY_INCL)
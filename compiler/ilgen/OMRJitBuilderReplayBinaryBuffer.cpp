@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdint.h>
+
+#include "ilgen/JitBuilderReplayBinaryBuffer.hpp"
+
+OMR::JitBuilderReplayBinaryBuffer::JitBuilderReplayBinaryBuffer(const uint8_t *buffer, size_t length)
+    : TR::JitBuilderReplay()
+    , _buf(buffer, buffer + length)
+    , _position(0)
+{}
+
+// numbers are written least significant byte first
+uint64_t OMR::JitBuilderReplayBinaryBuffer::readBytes(size_t numBytes)
+{
+    if (failed() || _position + numBytes > _buf.size()) {
+        fail();
+        return 0;
+    }
+
+    uint64_t num = 0;
+    for (size_t i = 0; i < numBytes; i++)
+        num |= ((uint64_t)_buf[_position + i]) << (8 * i);
+    _position += numBytes;
+    return num;
+}
+
+int8_t OMR::JitBuilderReplayBinaryBuffer::readInt8() { return (int8_t)(uint8_t)readBytes(1); }
+
+int16_t OMR::JitBuilderReplayBinaryBuffer::readInt16() { return (int16_t)(uint16_t)readBytes(2); }
+
+int32_t OMR::JitBuilderReplayBinaryBuffer::readInt32() { return (int32_t)(uint32_t)readBytes(4); }
+
+int64_t OMR::JitBuilderReplayBinaryBuffer::readInt64() { return (int64_t)readBytes(8); }
+
+float OMR::JitBuilderReplayBinaryBuffer::readFloat()
+{
+    int32_t num = readInt32();
+    float *floatNum = (float *)&num;
+    return *floatNum;
+}
+
+double OMR::JitBuilderReplayBinaryBuffer::readDouble()
+{
+    int64_t num = readInt64();
+    double *doubleNum = (double *)&num;
+    return *doubleNum;
+}
+
+void OMR::JitBuilderReplayBinaryBuffer::readString(std::string &string)
+{
+    // length(int16) characters
+    int16_t len = readInt16();
+    if (len < 0 || _position + len > _buf.size()) {
+        fail();
+        string.clear();
+        return;
+    }
+
+    string.assign((const char *)&_buf[_position], len);
+    _position += len;
+}
+
+void *OMR::JitBuilderReplayBinaryBuffer::readLocation() { return (void *)(intptr_t)readInt64(); }
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL
+#define OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL
+
+#include "ilgen/JitBuilderReplay.hpp"
+#include <vector>
+
+namespace OMR {
+
+/**
+ * @brief Replays a stream written by a JitBuilderRecorderBinaryBuffer or JitBuilderRecorderBinaryFile.
+ *
+ * The recording is copied, so the buffer passed in can be released once the replay has been constructed.
+ */
+class JitBuilderReplayBinaryBuffer : public TR::JitBuilderReplay {
+public:
+    JitBuilderReplayBinaryBuffer(const uint8_t *buffer, size_t length);
+
+    virtual ~JitBuilderReplayBinaryBuffer() {}
+
+protected:
+    virtual int8_t readInt8();
+    virtual int16_t readInt16();
+    virtual int32_t readInt32();
+    virtual int64_t readInt64();
+    virtual float readFloat();
+    virtual double readDouble();
+    virtual void readString(std::string &string);
+    virtual void *readLocation();
+
+    virtual size_t position() { return _position; }
+
+    virtual void setPosition(size_t position) { _position = position; }
+
+    uint64_t readBytes(size_t numBytes);
+
+    std::vector<uint8_t> _buf;
+    size_t _position;
+};
+
+} // namespace OMR
+
+#endif // !defined(OMR_JITBUILDERREPLAY_BINARYBUFFER_INCL)
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_LOCALVARIABLE_INCL
+#define OMR_LOCALVARIABLE_INCL
+
+#include "env/TRMemory.hpp"
+
+namespace TR {
+class IlType;
+class MethodBuilder;
+class SymbolReference;
+} // namespace TR
+
+extern "C" {
+typedef void *(*ClientAllocator)(void *impl);
+typedef void *(*ImplGetter)(void *client);
+}
+
+namespace OMR {
+
+/**
+ * @brief pre-resolved handle for a local variable or parameter of a MethodBuilder
+ *
+ * Handles are obtained from MethodBuilder::LookupLocal() and can be passed to the
+ * IlBuilder Load and Store services in place of the variable's name, which avoids
+ * looking the name up in the MethodBuilder's symbol maps on every access. The
+ * symbol reference is resolved on first use in a compilation and cached until the
+ * compilation completes.
+ */
+class LocalVariable {
+public:
+    TR_ALLOC(TR_Memory::IlGenerator)
+
+    LocalVariable(const char *name, TR::IlType *type, TR::MethodBuilder *methodBuilder)
+        : _client(0)
+        , _name(name)
+        , _type(type)
+        , _methodBuilder(methodBuilder)
+        , _symRef(0)
+    {}
+
+    /**
+     * @brief returns the name this variable was defined with
+     */
+    const char *getName() { return _name; }
+
+    /**
+     * @brief returns the type this variable was defined with
+     */
+    TR::IlType *getType() { return _type; }
+
+    /**
+     * @brief returns the MethodBuilder that defines this variable
+     */
+    TR::MethodBuilder *methodBuilder() { return _methodBuilder; }
+
+    /**
+     * @brief returns the TR::SymbolReference for this variable in the current compilation
+     */
+    TR::SymbolReference *symRef();
+
+    /**
+     * @brief forgets the cached TR::SymbolReference once the compilation that created it is done
+     */
+    void clearSymRef() { _symRef = NULL; }
+
+    /**
+     * @brief associates this object with a particular client object
+     */
+    void setClient(void *client) { _client = client; }
+
+    /**
+     * @brief returns the client object associated with this object
+     */
+    void *client();
+
+    /**
+     * @brief Set the Client Allocator function
+     *
+     * @param allocator a function pointer to the client object allocator
+     */
+    static void setClientAllocator(ClientAllocator allocator) { _clientAllocator = allocator; }
+
+    /**
+     * @brief Set the Get Impl function
+     *
+     * @param getter function pointer to the impl getter
+     */
+    static void setGetImpl(ImplGetter getter) { _getImpl = getter; }
+
+protected:
+    /**
+     * @brief pointer to a client object that corresponds to this object
+     */
+    void *_client;
+
+    /**
+     * @brief pointer to the function used to allocate an instance of a
+     * client object
+     */
+    static ClientAllocator _clientAllocator;
+
+    /**
+     * @brief pointer to impl getter function
+     */
+    static ImplGetter _getImpl;
+
+    const char *_name;
+    TR::IlType *_type;
+    TR::MethodBuilder *_methodBuilder;
+
+    /**
+     * @brief symbol reference for this variable, only valid during a compilation
+     */
+    TR::SymbolReference *_symRef;
+};
+
+} // namespace OMR
+
+#endif // !defined(OMR_LOCALVARIABLE_INCL)
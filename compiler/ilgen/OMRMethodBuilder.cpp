@@ -48,9 +48,12 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/IlInjector.hpp"
 #include "ilgen/IlBuilder.hpp"
+#include "ilgen/JitBuilderRecorder.hpp"
+#include "ilgen/LocalVariable.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
+#include "ilgen/StatementNames.hpp"
 #include "ilgen/VirtualMachineState.hpp"
 #include "ras/Logger.hpp"
 
@@ -116,6 +119,7 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
     , _memoryLocations(str_comparator, trMemory()->heapMemoryRegion())
     , _globals(str_comparator, trMemory()->heapMemoryRegion())
     , _functions(str_comparator, trMemory()->heapMemoryRegion())
+    , _localVariables(str_comparator, trMemory()->heapMemoryRegion())
     , _cachedParameterTypes(0)
     , _definingFile("")
     , _newSymbolsAreTemps(false)
@@ -131,6 +135,9 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
     , _nextInlineSiteIndex(0)
     , _returnBuilder(NULL)
     , _returnSymbolName(NULL)
+    , _recorder(NULL)
+    , _recording(false)
+    , _recordedServiceDepth(0)
 {
     _definingLine[0] = '\0';
 }
@@ -149,6 +156,7 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
     , _memoryLocations(str_comparator, trMemory()->heapMemoryRegion())
     , _globals(str_comparator, trMemory()->heapMemoryRegion())
     , _functions(str_comparator, trMemory()->heapMemoryRegion())
+    , _localVariables(str_comparator, trMemory()->heapMemoryRegion())
     , _cachedParameterTypes(0)
     , _definingFile("")
     , _newSymbolsAreTemps(false)
@@ -164,6 +172,9 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachin
     , _nextInlineSiteIndex(0)
     , _returnBuilder(NULL)
     , _returnSymbolName(NULL)
+    , _recorder(NULL)
+    , _recording(false)
+    , _recordedServiceDepth(0)
 {
     _definingLine[0] = '\0';
     initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -180,6 +191,7 @@ OMR::MethodBuilder::~MethodBuilder()
     _symbolIsArray.clear();
     _memoryLocations.clear();
     _functions.clear();
+    _localVariables.clear();
 }
 
 TR::MethodBuilder *OMR::MethodBuilder::asMethodBuilder() { return static_cast<TR::MethodBuilder *>(this); }
@@ -211,6 +223,34 @@ TR::MethodBuilder *OMR::MethodBuilder::callerMethodBuilder()
     return _returnBuilder->_methodBuilder;
 }
 
+bool OMR::MethodBuilder::injectIL()
+{
+    bool rc = TR::IlBuilder::injectIL();
+
+    if (_recording) {
+        _recorder->Close();
+        _recorder = NULL;
+        _recording = false;
+    }
+
+    return rc;
+}
+
+void OMR::MethodBuilder::setRecorder(TR::JitBuilderRecorder *recorder)
+{
+    TR_ASSERT_FATAL(!_recording, "Cannot change the recorder while IL is being recorded");
+    _recorder = recorder;
+    if (recorder != NULL)
+        recorder->setMethodBuilderRecorder(static_cast<TR::MethodBuilder *>(this));
+}
+
+TR::JitBuilderRecorder *OMR::MethodBuilder::recorder()
+{
+    if (_recording && _recordedServiceDepth == 0 && _recorder->isComplete())
+        return _recorder;
+    return NULL;
+}
+
 void OMR::MethodBuilder::setupForBuildIL()
 {
     initSequence();
@@ -229,6 +269,90 @@ void OMR::MethodBuilder::setupForBuildIL()
 
     // set up initial CFG
     cfg()->addEdge(_entryBlock, _currentBlock);
+
+    if (_recorder != NULL)
+        recordDefinitions();
+}
+
+// Captures everything defined before buildIL() in a fixed order, so a replayed MethodBuilder that is
+// itself recorded produces exactly the same stream
+void OMR::MethodBuilder::recordDefinitions()
+{
+    TR::JitBuilderRecorder *rec = _recorder;
+    _recording = true;
+
+    rec->StoreID(this);
+    rec->BeginStatement(this, OMR::StatementName::STATEMENT_NEWMETHODBUILDER);
+    rec->EndStatement();
+
+    rec->BeginStatement(this, OMR::StatementName::STATEMENT_DEFINENAME);
+    rec->String(_methodName);
+    rec->EndStatement();
+
+    rec->BeginStatement(this, OMR::StatementName::STATEMENT_DEFINEFILE);
+    rec->String(_definingFile);
+    rec->EndStatement();
+
+    rec->BeginStatement(this, OMR::StatementName::STATEMENT_DEFINELINESTRING);
+    rec->String(_definingLine);
+    rec->EndStatement();
+
+    rec->EnsureType(_returnType);
+    rec->BeginStatement(this, OMR::StatementName::STATEMENT_DEFINERETURNTYPE);
+    rec->Type(_returnType);
+    rec->EndStatement();
+
+    for (int32_t p = 0; p < _numParameters; p++) {
+        const char *name = _symbolNameFromSlot.find(p)->second;
+        const char *statement = isSymbolAnArray(name) ? OMR::StatementName::STATEMENT_DEFINEARRAYPARAMETER
+                                                      : OMR::StatementName::STATEMENT_DEFINEPARAMETER;
+        recordSymbolDefinition(statement, name, _symbolTypes.find(name)->second);
+        rec->EndStatement();
+    }
+
+    for (SymbolTypeMap::iterator it = _symbolTypes.begin(); it != _symbolTypes.end(); it++) {
+        const char *name = it->first;
+        if (_parameterSlot.find(name) != _parameterSlot.end() || _memoryLocations.find(name) != _memoryLocations.end()
+            || _globals.find(name) != _globals.end())
+            continue;
+        recordSymbolDefinition(OMR::StatementName::STATEMENT_DEFINELOCAL, name, it->second);
+        rec->EndStatement();
+    }
+
+    for (MemoryLocationMap::iterator it = _memoryLocations.begin(); it != _memoryLocations.end(); it++) {
+        recordSymbolDefinition(OMR::StatementName::STATEMENT_DEFINEMEMORY, it->first,
+            _symbolTypes.find(it->first)->second);
+        rec->Location(it->second);
+        rec->EndStatement();
+    }
+
+    for (GlobalMap::iterator it = _globals.begin(); it != _globals.end(); it++) {
+        recordSymbolDefinition(OMR::StatementName::STATEMENT_DEFINEGLOBAL, it->first,
+            _symbolTypes.find(it->first)->second);
+        rec->Location(it->second);
+        rec->EndStatement();
+    }
+
+    if (_newSymbolsAreTemps) {
+        rec->BeginStatement(this, OMR::StatementName::STATEMENT_ALLLOCALSHAVEBEENDEFINED);
+        rec->EndStatement();
+    }
+
+    rec->BeginStatement(this, OMR::StatementName::STATEMENT_DONECONSTRUCTOR);
+    rec->EndStatement();
+
+    // bytecode builders rely on client callbacks to find their successors
+    if (_useBytecodeBuilders)
+        rec->markIncomplete();
+}
+
+void OMR::MethodBuilder::recordSymbolDefinition(const char *statement, const char *name, TR::IlType *dt)
+{
+    TR::JitBuilderRecorder *rec = _recorder;
+    rec->EnsureType(dt);
+    rec->BeginStatement(this, statement);
+    rec->String(name);
+    rec->Type(dt);
 }
 
 uint32_t OMR::MethodBuilder::countBlocks()
@@ -471,10 +595,40 @@ void OMR::MethodBuilder::DefineLine(int line)
 
 void OMR::MethodBuilder::DefineName(const char *name) { _methodName = name; }
 
+void OMR::MethodBuilder::AllLocalsHaveBeenDefined()
+{
+    _newSymbolsAreTemps = true;
+
+    if (recorder() != NULL) {
+        _recorder->BeginStatement(this, OMR::StatementName::STATEMENT_ALLLOCALSHAVEBEENDEFINED);
+        _recorder->EndStatement();
+    }
+}
+
 void OMR::MethodBuilder::DefineLocal(const char *name, TR::IlType *dt)
 {
     TR_ASSERT_FATAL(_symbolTypes.find(name) == _symbolTypes.end(), "Symbol '%s' already defined", name);
     _symbolTypes.insert(std::make_pair(name, dt));
+
+    if (recorder() != NULL) {
+        recordSymbolDefinition(OMR::StatementName::STATEMENT_DEFINELOCAL, name, dt);
+        _recorder->EndStatement();
+    }
+}
+
+TR::LocalVariable *OMR::MethodBuilder::LookupLocal(const char *name)
+{
+    LocalVariableMap::iterator it = _localVariables.find(name);
+    if (it != _localVariables.end())
+        return it->second;
+
+    SymbolTypeMap::iterator symTypesIterator = _symbolTypes.find(name);
+    TR_ASSERT_FATAL(symTypesIterator != _symbolTypes.end(), "Symbol '%s' doesn't exist", name);
+
+    TR::LocalVariable *var = new (trMemory()->heapMemoryRegion())
+        TR::LocalVariable(symTypesIterator->first, symTypesIterator->second, static_cast<TR::MethodBuilder *>(this));
+    _localVariables.insert(std::make_pair(var->getName(), var));
+    return var;
 }
 
 void OMR::MethodBuilder::DefineMemory(const char *name, TR::IlType *dt, void *location)
@@ -483,6 +637,12 @@ void OMR::MethodBuilder::DefineMemory(const char *name, TR::IlType *dt, void *lo
 
     _symbolTypes.insert(std::make_pair(name, dt));
     _memoryLocations.insert(std::make_pair(name, location));
+
+    if (recorder() != NULL) {
+        recordSymbolDefinition(OMR::StatementName::STATEMENT_DEFINEMEMORY, name, dt);
+        _recorder->Location(location);
+        _recorder->EndStatement();
+    }
 }
 
 void OMR::MethodBuilder::DefineGlobal(const char *name, TR::IlType *dt, void *location)
@@ -491,24 +651,45 @@ void OMR::MethodBuilder::DefineGlobal(const char *name, TR::IlType *dt, void *lo
 
     _globals.insert(std::make_pair(name, location));
     _symbolTypes.insert(std::make_pair(name, dt));
+
+    if (recorder() != NULL) {
+        recordSymbolDefinition(OMR::StatementName::STATEMENT_DEFINEGLOBAL, name, dt);
+        _recorder->Location(location);
+        _recorder->EndStatement();
+    }
 }
 
 void OMR::MethodBuilder::DefineParameter(const char *name, TR::IlType *dt)
 {
-    TR_ASSERT_FATAL(_parameterSlot.find(name) == _parameterSlot.end(), "Parameter '%s' already defined", name);
-
-    _parameterSlot.insert(std::make_pair(name, _numParameters));
-    _symbolNameFromSlot.insert(std::make_pair(_numParameters, name));
-    _symbolTypes.insert(std::make_pair(name, dt));
+    defineParameter(name, dt);
 
-    _numParameters++;
+    if (recorder() != NULL) {
+        recordSymbolDefinition(OMR::StatementName::STATEMENT_DEFINEPARAMETER, name, dt);
+        _recorder->EndStatement();
+    }
 }
 
 void OMR::MethodBuilder::DefineArrayParameter(const char *name, TR::IlType *elementType)
 {
-    DefineParameter(name, elementType);
+    defineParameter(name, elementType);
 
     _symbolIsArray.insert(name);
+
+    if (recorder() != NULL) {
+        recordSymbolDefinition(OMR::StatementName::STATEMENT_DEFINEARRAYPARAMETER, name, elementType);
+        _recorder->EndStatement();
+    }
+}
+
+void OMR::MethodBuilder::defineParameter(const char *name, TR::IlType *dt)
+{
+    TR_ASSERT_FATAL(_parameterSlot.find(name) == _parameterSlot.end(), "Parameter '%s' already defined", name);
+
+    _parameterSlot.insert(std::make_pair(name, _numParameters));
+    _symbolNameFromSlot.insert(std::make_pair(_numParameters, name));
+    _symbolTypes.insert(std::make_pair(name, dt));
+
+    _numParameters++;
 }
 
 void OMR::MethodBuilder::DefineReturnType(TR::IlType *dt) { _returnType = dt; }
@@ -612,6 +793,8 @@ void OMR::MethodBuilder::addToAllBytecodeBuildersList(TR::BytecodeBuilder *bcBui
         // if we're allocating this list, then this method builder uses bytecode builders
         setUseBytecodeBuilders();
     }
+    if (recorder() != NULL)
+        _recorder->markIncomplete();
     _allBytecodeBuilders->add(bcBuilder);
 }
 
@@ -675,9 +858,19 @@ int32_t OMR::MethodBuilder::Compile(void **entry)
 
     // in case this MethodBuilder object is used in another Call()
     // clear out symrefs allocated in this compilation (no dangling pointers)
-    // and reset _connectedTrees so MethodBuilder can be inlined if needed
+    // and reset _connectedTrees so MethodBuilder can be inlined if needed.
+    // The blocks connectTrees allocated belong to this compilation too, so
+    // forget them and the block count before the builder is compiled again
     _symbols.clear();
+    for (LocalVariableMap::iterator it = _localVariables.begin(); it != _localVariables.end(); it++)
+        it->second->clearSymRef();
     _connectedTrees = false;
+    _count = -1;
+    _blocks = NULL;
+    _numBlocks = 0;
+    _blocksAllocatedUpFront = false;
+    _currentBlock = NULL;
+    _currentBlockNumber = -1;
 
     return rc;
 }
@@ -691,3 +884,20 @@ void *OMR::MethodBuilder::client()
 
 ClientAllocator OMR::MethodBuilder::_clientAllocator = NULL;
 ClientAllocator OMR::MethodBuilder::_getImpl = NULL;
+
+TR::SymbolReference *OMR::LocalVariable::symRef()
+{
+    if (NULL == _symRef)
+        _symRef = _methodBuilder->lookupSymbol(_name);
+    return _symRef;
+}
+
+void *OMR::LocalVariable::client()
+{
+    if (_client == NULL && _clientAllocator != NULL)
+        _client = _clientAllocator(static_cast<TR::LocalVariable *>(this));
+    return _client;
+}
+
+ClientAllocator OMR::LocalVariable::_clientAllocator = NULL;
+ClientAllocator OMR::LocalVariable::_getImpl = NULL;
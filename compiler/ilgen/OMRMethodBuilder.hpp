@@ -36,6 +36,8 @@ class TR_BitVector;
 
 namespace TR {
 class BytecodeBuilder;
+class LocalVariable;
+class JitBuilderRecorder;
 class ResolvedMethod;
 class SymbolReference;
 class VirtualMachineState;
@@ -60,8 +62,30 @@ public:
     MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachineState *vmState = NULL);
     virtual ~MethodBuilder();
 
+    virtual bool injectIL();
     virtual void setupForBuildIL();
 
+    /**
+     * @brief Records the next IL generation for this MethodBuilder so that it can later be replayed
+     * by a MethodBuilderReplay without this object. Everything defined before buildIL() is recorded
+     * when IL generation starts, and the recorder is closed once IL generation has finished.
+     * @param recorder the recorder to write to, or NULL to stop recording
+     */
+    void setRecorder(TR::JitBuilderRecorder *recorder);
+
+    /**
+     * @brief returns the recorder capturing the current IL generation, or NULL if nothing is being recorded,
+     * a service that cannot be replayed has already been called, or a recorded service is still active
+     */
+    TR::JitBuilderRecorder *recorder();
+
+    /**
+     * @brief called by IlBuilder services so that only the outermost service call is recorded
+     */
+    void enterRecordedService() { _recordedServiceDepth++; }
+
+    void exitRecordedService() { _recordedServiceDepth--; }
+
     /**
      * @brief returns the next index to be used for new values
      * @returns the next value index
@@ -95,7 +119,7 @@ public:
 
     const char *GetMethodName() { return _methodName; }
 
-    void AllLocalsHaveBeenDefined() { _newSymbolsAreTemps = true; }
+    void AllLocalsHaveBeenDefined();
 
     TR::IlType *getReturnType() { return _returnType; }
 
@@ -128,6 +152,15 @@ public:
     void DefineArrayParameter(const char *name, TR::IlType *dt);
     void DefineReturnType(TR::IlType *dt);
     void DefineLocal(const char *name, TR::IlType *dt);
+
+    /**
+     * @brief Returns a handle for a previously defined local variable or parameter
+     * @param name the name the local variable or parameter was defined with
+     * @return a handle that can be used in place of the name in Load and Store. The same handle is
+     * returned every time the same name is looked up.
+     */
+    TR::LocalVariable *LookupLocal(const char *name);
+
     void DefineMemory(const char *name, TR::IlType *dt, void *location);
 
     /**
@@ -273,6 +306,10 @@ protected:
     const char *adjustNameForInlinedSite(const char *name);
 
 private:
+    void defineParameter(const char *name, TR::IlType *dt);
+    void recordDefinitions();
+    void recordSymbolDefinition(const char *statement, const char *name, TR::IlType *dt);
+
     // We have MemoryManager as the first member of TypeDictionary, so that
     // it is the last one to get destroyed and all objects allocated using
     // MemoryManager->_memoryRegion may be safely destroyed in the destructor.
@@ -340,6 +377,13 @@ private:
     typedef std::map<const char *, TR::ResolvedMethod *, StrComparator, FunctionMapAllocator> FunctionMap;
     FunctionMap _functions;
 
+    typedef TR::typed_allocator<std::pair<const char * const, TR::LocalVariable *>, TR::Region &>
+        LocalVariableMapAllocator;
+    typedef std::map<const char *, TR::LocalVariable *, StrComparator, LocalVariableMapAllocator> LocalVariableMap;
+
+    // handles returned by LookupLocal, whose cached symbol references are cleared along with _symbols
+    LocalVariableMap _localVariables;
+
     TR::IlType **_cachedParameterTypes;
     const char *_definingFile;
     char _definingLine[MAX_LINE_NUM_LEN];
@@ -363,6 +407,10 @@ private:
     TR::IlBuilder *_returnBuilder;
     const char *_returnSymbolName;
 
+    TR::JitBuilderRecorder *_recorder;
+    bool _recording;
+    int32_t _recordedServiceDepth;
+
 private:
     static ClientAllocator _clientAllocator;
     static ImplGetter _getImpl;
@@ -26,6 +26,7 @@
 #include "compile/SymbolReferenceTable.hpp"
 #include "compile/Compilation.hpp"
 #include "env/FrontEnd.hpp"
+#include "ilgen/Field.hpp"
 #include "ilgen/IlReference.hpp"
 #include "ilgen/TypeDictionary.hpp"
 #include "env/Region.hpp"
@@ -72,6 +73,7 @@ public:
         , _offset(offset)
         , _type(type)
         , _symRef(0)
+        , _handle(0)
     {}
 
     void cacheSymRef(TR::SymbolReference *symRef) { _symRef = symRef; }
@@ -92,12 +94,26 @@ public:
 
     void setNext(FieldInfo *next) { _next = next; }
 
+    TR::Field *handle(TR::IlType *owningType)
+    {
+        if (NULL == _handle)
+            _handle = new (PERSISTENT_NEW) TR::Field(owningType, _name, _type, _offset, this);
+        return _handle;
+    }
+
+    void freeHandle()
+    {
+        if (NULL != _handle)
+            jitPersistentFree(_handle);
+    }
+
     // private:
     FieldInfo *_next;
     const char *_name;
     size_t _offset;
     TR::IlType *_type;
     TR::SymbolReference *_symRef;
+    TR::Field *_handle;
 };
 
 class StructType : public TR::IlType {
@@ -134,6 +150,8 @@ public:
     size_t getFieldOffset(const char *fieldName);
 
     TR::SymbolReference *getFieldSymRef(const char *name);
+    TR::SymbolReference *getFieldSymRef(FieldInfo *info);
+    TR::Field *getFieldHandle(const char *name);
 
     bool isStruct() { return true; }
 
@@ -146,6 +164,7 @@ public:
         FieldInfo *f = _firstField;
         while (f) {
             FieldInfo *n = f->_next;
+            f->freeHandle();
             jitPersistentFree(f);
             f = n;
         }
@@ -186,6 +205,8 @@ public:
     TR::IlType *getFieldType(const char *fieldName);
 
     TR::SymbolReference *getFieldSymRef(const char *name);
+    TR::SymbolReference *getFieldSymRef(FieldInfo *info);
+    TR::Field *getFieldHandle(const char *name);
 
     virtual bool isUnion() { return true; }
 
@@ -198,6 +219,7 @@ public:
         FieldInfo *f = _firstField;
         while (f) {
             FieldInfo *n = f->_next;
+            f->freeHandle();
             jitPersistentFree(f);
             f = n;
         }
@@ -316,7 +338,19 @@ TR::SymbolReference *OMR::StructType::getFieldSymRef(const char *fieldName)
     OMR::FieldInfo *info = findField(fieldName);
     if (NULL == info)
         return NULL;
+    return getFieldSymRef(info);
+}
+
+TR::Field *OMR::StructType::getFieldHandle(const char *fieldName)
+{
+    OMR::FieldInfo *info = findField(fieldName);
+    if (NULL == info)
+        return NULL;
+    return info->handle(this);
+}
 
+TR::SymbolReference *OMR::StructType::getFieldSymRef(OMR::FieldInfo *info)
+{
     TR::SymbolReference *symRef = info->getSymRef();
     if (NULL == symRef) {
         TR::Compilation *comp = TR::comp();
@@ -400,7 +434,19 @@ TR::SymbolReference *OMR::UnionType::getFieldSymRef(const char *fieldName)
 {
     OMR::FieldInfo *info = findField(fieldName);
     TR_ASSERT_FATAL(info, "Struct %s has no field with name %s\n", getName(), fieldName);
+    return getFieldSymRef(info);
+}
+
+TR::Field *OMR::UnionType::getFieldHandle(const char *fieldName)
+{
+    OMR::FieldInfo *info = findField(fieldName);
+    if (NULL == info)
+        return NULL;
+    return info->handle(this);
+}
 
+TR::SymbolReference *OMR::UnionType::getFieldSymRef(OMR::FieldInfo *info)
+{
     TR::SymbolReference *symRef = info->getSymRef();
     if (NULL == symRef) {
         // create a symref for the new field and set its bitvector
@@ -675,6 +721,23 @@ TR::IlReference *OMR::TypeDictionary::FieldReference(const char *typeName, const
     return NULL;
 }
 
+TR::Field *OMR::TypeDictionary::LookupField(const char *typeName, const char *fieldName)
+{
+    TR::Field *field = NULL;
+
+    StructMap::iterator structIterator = _structsByName.find(typeName);
+    if (structIterator != _structsByName.end()) {
+        field = structIterator->second->getFieldHandle(fieldName);
+    } else {
+        UnionMap::iterator unionIterator = _unionsByName.find(typeName);
+        TR_ASSERT_FATAL(unionIterator != _unionsByName.end(), "No type with name '%s'", typeName);
+        field = unionIterator->second->getFieldHandle(fieldName);
+    }
+
+    TR_ASSERT_FATAL(field, "Type %s has no field with name %s", typeName, fieldName);
+    return field;
+}
+
 void OMR::TypeDictionary::NotifyCompilationDone()
 {
     // clear all symbol references for fields
@@ -717,3 +780,20 @@ void *OMR::TypeDictionary::client()
 
 ClientAllocator OMR::TypeDictionary::_clientAllocator = NULL;
 ClientAllocator OMR::TypeDictionary::_getImpl = NULL;
+
+TR::SymbolReference *OMR::Field::symRef()
+{
+    if (_owningType->isUnion())
+        return static_cast<OMR::UnionType *>(_owningType)->getFieldSymRef(_info);
+    return static_cast<OMR::StructType *>(_owningType)->getFieldSymRef(_info);
+}
+
+void *OMR::Field::client()
+{
+    if (_client == NULL && _clientAllocator != NULL)
+        _client = _clientAllocator(static_cast<TR::Field *>(this));
+    return _client;
+}
+
+ClientAllocator OMR::Field::_clientAllocator = NULL;
+ClientAllocator OMR::Field::_getImpl = NULL;
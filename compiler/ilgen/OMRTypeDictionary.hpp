@@ -35,8 +35,9 @@ class UnionType;
 } // namespace OMR
 
 namespace TR {
+class Field;
 class IlReference;
-}
+} // namespace TR
 
 namespace TR {
 class SegmentProvider;
@@ -162,6 +163,15 @@ public:
 
     TR::IlReference *FieldReference(const char *typeName, const char *fieldName);
 
+    /**
+     * @brief Returns a handle for a field of a struct or union
+     * @param typeName the name of the struct or union containing the field
+     * @param fieldName the name of the field
+     * @return a handle that can be used in place of the type and field names when loading and storing the field.
+     * The same handle is returned every time the same field is looked up.
+     */
+    TR::Field *LookupField(const char *typeName, const char *fieldName);
+
     TR_Memory *trMemory() { return memoryManager._trMemory; }
 
     TR::IlType *getWord() { return Word; }
@@ -41,17 +41,21 @@ static const char * const STATEMENT_DEFINEARRAYPARAMETER = "DefineArrayParameter
 static const char * const STATEMENT_DEFINERETURNTYPE = "DefineReturnType";
 static const char * const STATEMENT_DEFINELOCAL = "DefineLocal";
 static const char * const STATEMENT_DEFINEMEMORY = "DefineMemory";
+static const char * const STATEMENT_DEFINEGLOBAL = "DefineGlobal";
 static const char * const STATEMENT_DEFINEFUNCTION = "DefineFunction";
 static const char * const STATEMENT_DEFINESTRUCT = "DefineStruct";
 static const char * const STATEMENT_DEFINEUNION = "DefineUnion";
 static const char * const STATEMENT_DEFINEFIELD = "DefineField";
 static const char * const STATEMENT_PRIMITIVETYPE = "PrimitiveType";
 static const char * const STATEMENT_POINTERTYPE = "PointerType";
+static const char * const STATEMENT_LOOKUPSTRUCT = "LookupStruct";
+static const char * const STATEMENT_LOOKUPUNION = "LookupUnion";
 static const char * const STATEMENT_NEWMETHODBUILDER = "NewMethodBuilder";
 static const char * const STATEMENT_NEWILBUILDER = "NewIlBuilder";
 static const char * const STATEMENT_NEWBYTECODEBUILDER = "NewBytecodeBuilder";
 static const char * const STATEMENT_ALLLOCALSHAVEBEENDEFINED = "AllLocalsHaveBeenDefined";
 static const char * const STATEMENT_NULLADDRESS = "NullAddress";
+static const char * const STATEMENT_COPY = "Copy";
 static const char * const STATEMENT_CONSTINT8 = "ConstInt8";
 static const char * const STATEMENT_CONSTINT16 = "ConstInt16";
 static const char * const STATEMENT_CONSTINT32 = "ConstInt32";
@@ -74,6 +78,14 @@ static const char * const STATEMENT_VECTORLOAD = "VectorLoad";
 static const char * const STATEMENT_VECTORLOADAT = "VectorLoadAt";
 static const char * const STATEMENT_VECTORSTORE = "VectorStore";
 static const char * const STATEMENT_VECTORSTOREAT = "VectorStoreAt";
+static const char * const STATEMENT_VECTORSPLAT = "VectorSplat";
+static const char * const STATEMENT_VECTORGETELEMENT = "VectorGetElement";
+static const char * const STATEMENT_VECTORSETELEMENT = "VectorSetElement";
+static const char * const STATEMENT_VECTORREDUCEADD = "VectorReduceAdd";
+static const char * const STATEMENT_VECTORREDUCEMIN = "VectorReduceMin";
+static const char * const STATEMENT_VECTORREDUCEMAX = "VectorReduceMax";
+static const char * const STATEMENT_COPYMEMORY = "CopyMemory";
+static const char * const STATEMENT_SETMEMORY = "SetMemory";
 static const char * const STATEMENT_STRUCTFIELDINSTANCEADDRESS = "StructFieldInstance";
 static const char * const STATEMENT_UNIONFIELDINSTANCEADDRESS = "UnionFieldInstance";
 static const char * const STATEMENT_CONVERTTO = "ConvertTo";
@@ -89,6 +101,8 @@ static const char * const STATEMENT_MUL = "Mul";
 static const char * const STATEMENT_MULWITHOVERFLOW = "MulWithOverflow";
 static const char * const STATEMENT_DIV = "Div";
 static const char * const STATEMENT_REM = "Rem";
+static const char * const STATEMENT_UNSIGNEDDIV = "UnsignedDiv";
+static const char * const STATEMENT_UNSIGNEDREM = "UnsignedRem";
 static const char * const STATEMENT_AND = "And";
 static const char * const STATEMENT_OR = "Or";
 static const char * const STATEMENT_XOR = "Xor";
@@ -96,6 +110,10 @@ static const char * const STATEMENT_LESSTHAN = "LessThan";
 static const char * const STATEMENT_UNSIGNEDLESSTHAN = "UnsignedLessThan";
 static const char * const STATEMENT_UNSIGNEDLESSOREQUALTO = "UnsignedLessOrEqualTo";
 static const char * const STATEMENT_NEGATE = "Negate";
+static const char * const STATEMENT_ABS = "Abs";
+static const char * const STATEMENT_SQRT = "Sqrt";
+static const char * const STATEMENT_MIN = "Min";
+static const char * const STATEMENT_MAX = "Max";
 static const char * const STATEMENT_CONVERTBITSTO = "ConvertBitsTo";
 static const char * const STATEMENT_GREATERTHAN = "GreaterThan";
 static const char * const STATEMENT_GREATEROREQUALTO = "GreaterOrEqualTo";
@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include "compile/Compilation.hpp"
+#include "infra/Bit.hpp"
 #include "ras/Debug.hpp"
 #include "ras/Logger.hpp"
 
@@ -175,7 +176,16 @@ inline bool TR_BitContainer::operator==(TR_BitVector &v2)
 {
     if (_type == bitvector)
         return _bitVector && ((*_bitVector) == v2);
-    else
+    else if (_type == hybridBitVector) {
+        if (!_hybridBitVector)
+            return v2.isEmpty();
+        if (_hybridBitVector->elementCount() != v2.elementCount())
+            return false;
+        for (TR_HybridBitVectorCursor cursor(*_hybridBitVector); cursor.Valid(); cursor.SetToNextOne())
+            if (!v2.get(cursor))
+                return false;
+        return true;
+    } else
         return (v2.get(_singleBit) && !v2.hasMoreThanOneElement());
 }
 
@@ -183,6 +193,8 @@ bool TR_BitContainer::hasMoreThanOneElement()
 {
     if (_type == bitvector && _bitVector && _bitVector->hasMoreThanOneElement())
         return true;
+    if (_type == hybridBitVector && _hybridBitVector && _hybridBitVector->hasMoreThanOneElement())
+        return true;
     return false;
 }
 
@@ -190,7 +202,9 @@ int32_t TR_BitContainer::get(int32_t n)
 {
     if (_type == bitvector && _bitVector)
         return _bitVector->get(n);
-    else if (_type == bitvector)
+    else if (_type == hybridBitVector && _hybridBitVector)
+        return _hybridBitVector->get(n);
+    else if (_type != singleton)
         return 0;
     else
         return (_singleBit == n ? _singleBit : 0);
@@ -200,7 +214,12 @@ bool TR_BitContainer::intersects(TR_BitVector &v2)
 {
     if (_type == bitvector && _bitVector)
         return _bitVector->intersects(v2);
-    else if (_type == bitvector)
+    else if (_type == hybridBitVector && _hybridBitVector) {
+        for (TR_HybridBitVectorCursor cursor(*_hybridBitVector); cursor.Valid(); cursor.SetToNextOne())
+            if (v2.get(cursor))
+                return true;
+        return false;
+    } else if (_type != singleton)
         return false;
     else
         return v2.get(_singleBit) != 0;
@@ -210,16 +229,741 @@ bool TR_BitContainer::intersects(TR_BitContainer &v2)
 {
     if (v2._type == bitvector && v2._bitVector)
         return intersects(*(v2._bitVector));
-    else if (v2._type == bitvector)
+    else if (v2._type == hybridBitVector && v2._hybridBitVector) {
+        if (_type == hybridBitVector && _hybridBitVector)
+            return _hybridBitVector->intersects(*(v2._hybridBitVector));
+        return v2.intersects(*this);
+    } else if (v2._type != singleton)
         return false;
     else {
         // v2 is singleton
-        if (_type == bitvector && _bitVector)
+        if (_type != singleton)
             return get(v2._singleBit) != 0;
-        else if (_type == bitvector)
-            return false;
         else
             // both are singletons
             return v2._singleBit == _singleBit;
     }
 }
+
+TR_HybridBitVector::TR_HybridBitVector(int64_t initBits, TR_Memory *m, TR_AllocationKind allocKind)
+{
+    switch (allocKind) {
+        case heapAlloc:
+            init(&(m->heapMemoryRegion()));
+            break;
+        case stackAlloc:
+            init(&(m->currentStackRegion()));
+            break;
+        case persistentAlloc:
+            init(NULL);
+            break;
+        default:
+            TR_ASSERT(false, "Unhandled allocation type!");
+            init(NULL);
+    }
+}
+
+void *TR_HybridBitVector::allocateMemory(size_t bytes)
+{
+    if (_region)
+        return _region->allocate(bytes);
+    return TR_Memory::jitPersistentAlloc(bytes, TR_Memory::BitVector);
+}
+
+void TR_HybridBitVector::freeMemory(void *p, size_t bytes)
+{
+    if (_region)
+        _region->deallocate(p, bytes);
+    else
+        TR_Memory::jitPersistentFree(p);
+}
+
+void *TR_HybridBitVector::allocateStorage(int32_t sizeClass)
+{
+    FreeStorage *storage = _freeStorage[sizeClass];
+    if (storage) {
+        _freeStorage[sizeClass] = storage->_next;
+        return storage;
+    }
+    _bytesAllocated += sizeClassBytes(sizeClass);
+    return allocateMemory(sizeClassBytes(sizeClass));
+}
+
+void TR_HybridBitVector::releaseStorage(Block &block)
+{
+    if (block._offsets) {
+        FreeStorage *storage = reinterpret_cast<FreeStorage *>(block._offsets);
+        storage->_next = _freeStorage[block._sizeClass];
+        _freeStorage[block._sizeClass] = storage;
+        block._offsets = NULL;
+    }
+}
+
+int32_t TR_HybridBitVector::findBlock(uint32_t key, int32_t &insertionPoint, int32_t low)
+{
+    int32_t high = _numBlocks;
+    while (low < high) {
+        int32_t mid = (low + high) >> 1;
+        if (_blocks[mid]._key < key)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    insertionPoint = low;
+    return (low < _numBlocks && _blocks[low]._key == key) ? low : -1;
+}
+
+void TR_HybridBitVector::ensureBlockCapacity(int32_t numBlocks)
+{
+    if (numBlocks <= _blockCapacity)
+        return;
+    int32_t newCapacity = _blockCapacity ? _blockCapacity * 2 : 4;
+    while (newCapacity < numBlocks)
+        newCapacity *= 2;
+    Block *newBlocks = (Block *)allocateMemory(newCapacity * sizeof(Block));
+    if (_blocks) {
+        memcpy(newBlocks, _blocks, _numBlocks * sizeof(Block));
+        freeMemory(_blocks, _blockCapacity * sizeof(Block));
+    }
+    _bytesAllocated += (newCapacity - _blockCapacity) * sizeof(Block);
+    _blocks = newBlocks;
+    _blockCapacity = newCapacity;
+}
+
+TR_HybridBitVector::Block &TR_HybridBitVector::insertBlock(int32_t position, uint32_t key)
+{
+    ensureBlockCapacity(_numBlocks + 1);
+    memmove(&_blocks[position + 1], &_blocks[position], (_numBlocks - position) * sizeof(Block));
+    _numBlocks++;
+    Block &block = _blocks[position];
+    block._key = key;
+    block._count = 0;
+    block._kind = SparseBlock;
+    block._sizeClass = 0;
+    block._offsets = NULL;
+    return block;
+}
+
+void TR_HybridBitVector::removeBlock(int32_t position)
+{
+    releaseStorage(_blocks[position]);
+    _numBlocks--;
+    memmove(&_blocks[position], &_blocks[position + 1], (_numBlocks - position) * sizeof(Block));
+}
+
+void TR_HybridBitVector::copyBlock(Block &to, Block &from)
+{
+    to._key = from._key;
+    to._count = from._count;
+    to._kind = from._kind;
+    to._sizeClass = from._sizeClass;
+    if (from._kind == FullBlock) {
+        to._offsets = NULL;
+    } else if (from._kind == DenseBlock) {
+        to._words = (uint32_t *)allocateStorage(DenseSizeClass);
+        memcpy(to._words, from._words, BlockWords * sizeof(uint32_t));
+    } else {
+        to._offsets = (uint16_t *)allocateStorage(from._sizeClass);
+        memcpy(to._offsets, from._offsets, from._count * sizeof(uint16_t));
+    }
+}
+
+void TR_HybridBitVector::makeFull(Block &block)
+{
+    releaseStorage(block);
+    block._kind = FullBlock;
+    block._sizeClass = 0;
+    block._count = BlockBits;
+}
+
+void TR_HybridBitVector::expandBlock(Block &block, uint32_t *words)
+{
+    if (block._kind == FullBlock) {
+        memset(words, 0xff, BlockWords * sizeof(uint32_t));
+    } else if (block._kind == DenseBlock) {
+        memcpy(words, block._words, BlockWords * sizeof(uint32_t));
+    } else {
+        memset(words, 0, BlockWords * sizeof(uint32_t));
+        for (int32_t i = 0; i < block._count; i++)
+            words[block._offsets[i] >> 5] |= 1u << (block._offsets[i] & 31);
+    }
+}
+
+bool TR_HybridBitVector::blockContains(Block &block, uint32_t offset)
+{
+    if (block._kind == FullBlock)
+        return true;
+    if (block._kind == DenseBlock)
+        return (block._words[offset >> 5] & (1u << (offset & 31))) != 0;
+
+    int32_t low = 0;
+    int32_t high = block._count;
+    while (low < high) {
+        int32_t mid = (low + high) >> 1;
+        if (block._offsets[mid] < offset)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low < block._count && block._offsets[low] == offset;
+}
+
+bool TR_HybridBitVector::normalizeBlock(Block &block, uint32_t *words)
+{
+    int32_t count = 0;
+    for (int32_t i = 0; i < BlockWords; i++)
+        count += populationCount(words[i]);
+
+    if (count == 0) {
+        releaseStorage(block);
+        block._count = 0;
+        return false;
+    }
+
+    if (count == BlockBits) {
+        makeFull(block);
+    } else if (count <= MaxSparseElements) {
+        int32_t sizeClass = sparseSizeClass(count);
+        if (block._kind != SparseBlock || !block._offsets || block._sizeClass < sizeClass) {
+            releaseStorage(block);
+            block._offsets = (uint16_t *)allocateStorage(sizeClass);
+            block._sizeClass = sizeClass;
+            block._kind = SparseBlock;
+        }
+        int32_t n = 0;
+        for (int32_t i = 0; i < BlockWords; i++) {
+            uint32_t word = words[i];
+            while (word) {
+                block._offsets[n++] = (uint16_t)((i << 5) + trailingZeroes(word));
+                word &= word - 1;
+            }
+        }
+    } else {
+        if (block._kind != DenseBlock) {
+            releaseStorage(block);
+            block._words = (uint32_t *)allocateStorage(DenseSizeClass);
+            block._sizeClass = DenseSizeClass;
+            block._kind = DenseBlock;
+        }
+        memcpy(block._words, words, BlockWords * sizeof(uint32_t));
+    }
+    block._count = count;
+    return true;
+}
+
+int32_t TR_HybridBitVector::get(int32_t n)
+{
+    int32_t insertionPoint;
+    int32_t position = findBlock((uint32_t)n >> BlockShift, insertionPoint);
+    return (position >= 0 && blockContains(_blocks[position], n & (BlockBits - 1))) ? 1 : 0;
+}
+
+void TR_HybridBitVector::set(int32_t n)
+{
+    TR_ASSERT(n >= 0, "Negative index %d for hybrid bit vector\n", n);
+    uint32_t key = (uint32_t)n >> BlockShift;
+    uint16_t offset = (uint16_t)(n & (BlockBits - 1));
+    int32_t insertionPoint;
+    int32_t position = findBlock(key, insertionPoint);
+    if (position < 0) {
+        Block &block = insertBlock(insertionPoint, key);
+        block._offsets = (uint16_t *)allocateStorage(0);
+        block._offsets[0] = offset;
+        block._count = 1;
+        return;
+    }
+
+    Block &block = _blocks[position];
+    if (block._kind == FullBlock)
+        return;
+
+    if (block._kind == DenseBlock) {
+        uint32_t mask = 1u << (offset & 31);
+        if (block._words[offset >> 5] & mask)
+            return;
+        block._words[offset >> 5] |= mask;
+        if (++block._count == BlockBits)
+            makeFull(block);
+        return;
+    }
+
+    int32_t low = 0;
+    int32_t high = block._count;
+    while (low < high) {
+        int32_t mid = (low + high) >> 1;
+        if (block._offsets[mid] < offset)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    if (low < block._count && block._offsets[low] == offset)
+        return;
+
+    if (block._count == MaxSparseElements) {
+        uint32_t words[BlockWords];
+        expandBlock(block, words);
+        words[offset >> 5] |= 1u << (offset & 31);
+        normalizeBlock(block, words);
+        return;
+    }
+
+    if (block._count == sparseCapacity(block._sizeClass)) {
+        uint16_t *offsets = (uint16_t *)allocateStorage(block._sizeClass + 1);
+        memcpy(offsets, block._offsets, block._count * sizeof(uint16_t));
+        releaseStorage(block);
+        block._offsets = offsets;
+        block._sizeClass++;
+    }
+    memmove(&block._offsets[low + 1], &block._offsets[low], (block._count - low) * sizeof(uint16_t));
+    block._offsets[low] = offset;
+    block._count++;
+}
+
+void TR_HybridBitVector::reset(int32_t n)
+{
+    uint32_t key = (uint32_t)n >> BlockShift;
+    uint16_t offset = (uint16_t)(n & (BlockBits - 1));
+    int32_t insertionPoint;
+    int32_t position = findBlock(key, insertionPoint);
+    if (position < 0)
+        return;
+
+    Block &block = _blocks[position];
+    if (block._kind == SparseBlock) {
+        int32_t i = 0;
+        while (i < block._count && block._offsets[i] < offset)
+            i++;
+        if (i == block._count || block._offsets[i] != offset)
+            return;
+        if (block._count == 1) {
+            removeBlock(position);
+            return;
+        }
+        memmove(&block._offsets[i], &block._offsets[i + 1], (block._count - i - 1) * sizeof(uint16_t));
+        block._count--;
+        return;
+    }
+
+    uint32_t mask = 1u << (offset & 31);
+    if (block._kind == DenseBlock) {
+        if (!(block._words[offset >> 5] & mask))
+            return;
+        block._words[offset >> 5] &= ~mask;
+        if (--block._count > MaxSparseElements)
+            return;
+    }
+
+    uint32_t words[BlockWords];
+    expandBlock(block, words);
+    words[offset >> 5] &= ~mask;
+    normalizeBlock(block, words);
+}
+
+int32_t TR_HybridBitVector::elementCount()
+{
+    int32_t count = 0;
+    for (int32_t i = 0; i < _numBlocks; i++)
+        count += _blocks[i]._count;
+    return count;
+}
+
+size_t TR_HybridBitVector::memoryUsed() { return sizeof(TR_HybridBitVector) + _bytesAllocated; }
+
+bool TR_HybridBitVector::intersects(TR_HybridBitVector &other)
+{
+    int32_t i = 0;
+    int32_t j = 0;
+    while (i < _numBlocks && j < other._numBlocks) {
+        Block &a = _blocks[i];
+        Block &b = other._blocks[j];
+        if (a._key < b._key) {
+            i++;
+        } else if (a._key > b._key) {
+            j++;
+        } else {
+            if (a._kind == FullBlock || b._kind == FullBlock)
+                return true;
+            if (a._kind == SparseBlock) {
+                for (int32_t k = 0; k < a._count; k++)
+                    if (blockContains(b, a._offsets[k]))
+                        return true;
+            } else if (b._kind == SparseBlock) {
+                for (int32_t k = 0; k < b._count; k++)
+                    if (blockContains(a, b._offsets[k]))
+                        return true;
+            } else {
+                for (int32_t k = 0; k < BlockWords; k++)
+                    if (a._words[k] & b._words[k])
+                        return true;
+            }
+            i++;
+            j++;
+        }
+    }
+    return false;
+}
+
+bool TR_HybridBitVector::operator==(TR_HybridBitVector &other)
+{
+    if (_numBlocks != other._numBlocks)
+        return false;
+    for (int32_t i = 0; i < _numBlocks; i++) {
+        Block &a = _blocks[i];
+        Block &b = other._blocks[i];
+        if (a._key != b._key || a._count != b._count || a._kind != b._kind)
+            return false;
+        if (a._kind == SparseBlock && memcmp(a._offsets, b._offsets, a._count * sizeof(uint16_t)))
+            return false;
+        if (a._kind == DenseBlock && memcmp(a._words, b._words, BlockWords * sizeof(uint32_t)))
+            return false;
+    }
+    return true;
+}
+
+void TR_HybridBitVector::operator|=(TR_HybridBitVector &other)
+{
+    if (&other == this)
+        return;
+
+    int32_t low = 0;
+    for (int32_t j = 0; j < other._numBlocks; j++) {
+        Block &b = other._blocks[j];
+        int32_t insertionPoint;
+        int32_t position = findBlock(b._key, insertionPoint, low);
+        if (position < 0) {
+            copyBlock(insertBlock(insertionPoint, b._key), b);
+            low = insertionPoint + 1;
+            continue;
+        }
+        low = position + 1;
+
+        Block &a = _blocks[position];
+        if (a._kind == FullBlock)
+            continue;
+        if (b._kind == FullBlock) {
+            makeFull(a);
+            continue;
+        }
+
+        uint32_t words[BlockWords];
+        expandBlock(a, words);
+        if (b._kind == DenseBlock) {
+            for (int32_t k = 0; k < BlockWords; k++)
+                words[k] |= b._words[k];
+        } else {
+            for (int32_t k = 0; k < b._count; k++)
+                words[b._offsets[k] >> 5] |= 1u << (b._offsets[k] & 31);
+        }
+        normalizeBlock(a, words);
+    }
+}
+
+void TR_HybridBitVector::operator&=(TR_HybridBitVector &other)
+{
+    if (&other == this)
+        return;
+
+    int32_t numKept = 0;
+    int32_t j = 0;
+    for (int32_t i = 0; i < _numBlocks; i++) {
+        Block &a = _blocks[i];
+        while (j < other._numBlocks && other._blocks[j]._key < a._key)
+            j++;
+        if (j == other._numBlocks || other._blocks[j]._key != a._key) {
+            releaseStorage(a);
+            continue;
+        }
+
+        Block &b = other._blocks[j];
+        bool keep = true;
+        if (b._kind == FullBlock) {
+            // a is unchanged
+        } else if (a._kind == FullBlock) {
+            copyBlock(a, b);
+        } else if (a._kind == SparseBlock) {
+            int32_t count = 0;
+            for (int32_t k = 0; k < a._count; k++)
+                if (blockContains(b, a._offsets[k]))
+                    a._offsets[count++] = a._offsets[k];
+            a._count = count;
+            if (count == 0) {
+                releaseStorage(a);
+                keep = false;
+            }
+        } else {
+            uint32_t words[BlockWords];
+            expandBlock(b, words);
+            for (int32_t k = 0; k < BlockWords; k++)
+                words[k] &= a._words[k];
+            keep = normalizeBlock(a, words);
+        }
+
+        if (keep)
+            _blocks[numKept++] = a;
+    }
+    _numBlocks = numKept;
+}
+
+void TR_HybridBitVector::operator-=(TR_HybridBitVector &other)
+{
+    if (&other == this) {
+        empty();
+        return;
+    }
+
+    int32_t numKept = 0;
+    int32_t j = 0;
+    for (int32_t i = 0; i < _numBlocks; i++) {
+        Block &a = _blocks[i];
+        while (j < other._numBlocks && other._blocks[j]._key < a._key)
+            j++;
+
+        bool keep = true;
+        if (j < other._numBlocks && other._blocks[j]._key == a._key) {
+            Block &b = other._blocks[j];
+            if (b._kind == FullBlock) {
+                releaseStorage(a);
+                keep = false;
+            } else if (a._kind == SparseBlock) {
+                int32_t count = 0;
+                for (int32_t k = 0; k < a._count; k++)
+                    if (!blockContains(b, a._offsets[k]))
+                        a._offsets[count++] = a._offsets[k];
+                a._count = count;
+                if (count == 0) {
+                    releaseStorage(a);
+                    keep = false;
+                }
+            } else {
+                uint32_t words[BlockWords];
+                expandBlock(a, words);
+                if (b._kind == DenseBlock) {
+                    for (int32_t k = 0; k < BlockWords; k++)
+                        words[k] &= ~b._words[k];
+                } else {
+                    for (int32_t k = 0; k < b._count; k++)
+                        words[b._offsets[k] >> 5] &= ~(1u << (b._offsets[k] & 31));
+                }
+                keep = normalizeBlock(a, words);
+            }
+        }
+
+        if (keep)
+            _blocks[numKept++] = a;
+    }
+    _numBlocks = numKept;
+}
+
+void TR_HybridBitVector::operator=(TR_HybridBitVector &other)
+{
+    if (&other == this)
+        return;
+
+    empty();
+    ensureBlockCapacity(other._numBlocks);
+    for (int32_t i = 0; i < other._numBlocks; i++)
+        copyBlock(_blocks[i], other._blocks[i]);
+    _numBlocks = other._numBlocks;
+}
+
+// Set or clear bits low to high of a block bitmap
+//
+static void setBlockBits(uint32_t *words, uint32_t low, uint32_t high, bool value)
+{
+    for (uint32_t bit = low; bit <= high;) {
+        if ((bit & 31) == 0 && bit + 31 <= high) {
+            words[bit >> 5] = value ? ~(uint32_t)0 : 0;
+            bit += 32;
+        } else {
+            if (value)
+                words[bit >> 5] |= 1u << (bit & 31);
+            else
+                words[bit >> 5] &= ~(1u << (bit & 31));
+            bit++;
+        }
+    }
+}
+
+void TR_HybridBitVector::setAll(int64_t m, int64_t n)
+{
+    if (m < 0)
+        m = 0;
+    if (m > n)
+        return;
+
+    uint32_t firstKey = (uint32_t)(m >> BlockShift);
+    uint32_t lastKey = (uint32_t)(n >> BlockShift);
+    int32_t low = 0;
+    for (uint32_t key = firstKey; key <= lastKey; key++) {
+        uint32_t first = (key == firstKey) ? (uint32_t)(m & (BlockBits - 1)) : 0;
+        uint32_t last = (key == lastKey) ? (uint32_t)(n & (BlockBits - 1)) : BlockBits - 1;
+
+        int32_t insertionPoint;
+        int32_t position = findBlock(key, insertionPoint, low);
+        if (position < 0) {
+            position = insertionPoint;
+            insertBlock(position, key);
+        }
+        low = position + 1;
+
+        Block &block = _blocks[position];
+        if (first == 0 && last == BlockBits - 1) {
+            makeFull(block);
+        } else if (block._kind != FullBlock) {
+            uint32_t words[BlockWords];
+            if (block._count)
+                expandBlock(block, words);
+            else
+                memset(words, 0, sizeof(words));
+            setBlockBits(words, first, last, true);
+            normalizeBlock(block, words);
+        }
+    }
+}
+
+void TR_HybridBitVector::resetAll(int64_t m, int64_t n)
+{
+    if (m < 0)
+        m = 0;
+    if (m > n)
+        return;
+
+    uint32_t firstKey = (uint32_t)(m >> BlockShift);
+    uint32_t lastKey = (uint32_t)(n >> BlockShift);
+    int32_t position;
+    findBlock(firstKey, position);
+    while (position < _numBlocks && _blocks[position]._key <= lastKey) {
+        Block &block = _blocks[position];
+        uint32_t first = (block._key == firstKey) ? (uint32_t)(m & (BlockBits - 1)) : 0;
+        uint32_t last = (block._key == lastKey) ? (uint32_t)(n & (BlockBits - 1)) : BlockBits - 1;
+
+        bool keep = false;
+        if (first != 0 || last != BlockBits - 1) {
+            uint32_t words[BlockWords];
+            expandBlock(block, words);
+            setBlockBits(words, first, last, false);
+            keep = normalizeBlock(block, words);
+        }
+
+        if (keep)
+            position++;
+        else
+            removeBlock(position);
+    }
+}
+
+void TR_HybridBitVector::empty()
+{
+    for (int32_t i = 0; i < _numBlocks; i++)
+        releaseStorage(_blocks[i]);
+    _numBlocks = 0;
+}
+
+void TR_HybridBitVector::print(OMR::Logger *log, TR::Compilation *comp) { comp->getDebug()->print(log, this); }
+
+bool TR_HybridBitVectorCursor::SetToNextOne()
+{
+    _valid = false;
+    if (!_bitVector)
+        return false;
+
+    while (_blockIndex < _bitVector->_numBlocks) {
+        TR_HybridBitVector::Block &block = _bitVector->_blocks[_blockIndex];
+        uint32_t base = block._key << TR_HybridBitVector::BlockShift;
+        int32_t next = _position + 1;
+        if (block._kind == TR_HybridBitVector::SparseBlock) {
+            if (next < block._count) {
+                _position = next;
+                _value = base + block._offsets[next];
+                _valid = true;
+                return true;
+            }
+        } else if (block._kind == TR_HybridBitVector::FullBlock) {
+            if (next < TR_HybridBitVector::BlockBits) {
+                _position = next;
+                _value = base + next;
+                _valid = true;
+                return true;
+            }
+        } else {
+            while (next < TR_HybridBitVector::BlockBits) {
+                uint32_t word = block._words[next >> 5] >> (next & 31);
+                if (word) {
+                    _position = next + trailingZeroes(word);
+                    _value = base + _position;
+                    _valid = true;
+                    return true;
+                }
+                next = (next | 31) + 1;
+            }
+        }
+        _blockIndex++;
+        _position = -1;
+    }
+    return false;
+}
+
+void TR_HybridBitVector::applyWords(uint32_t key, uint32_t *words, bool subtract)
+{
+    int32_t insertionPoint;
+    int32_t position = findBlock(key, insertionPoint);
+    uint32_t merged[BlockWords];
+    if (position < 0) {
+        if (subtract)
+            return;
+        position = insertionPoint;
+        insertBlock(position, key);
+        memset(merged, 0, sizeof(merged));
+    } else {
+        expandBlock(_blocks[position], merged);
+    }
+
+    for (int32_t k = 0; k < BlockWords; k++)
+        merged[k] = subtract ? (merged[k] & ~words[k]) : (merged[k] | words[k]);
+    if (!normalizeBlock(_blocks[position], merged))
+        removeBlock(position);
+}
+
+void TR_HybridBitVector::applyBitVector(TR_BitVector &other, bool subtract)
+{
+    if (subtract && isEmpty())
+        return;
+
+    // Gather the other vector's elements a block at a time so each affected
+    // block is rewritten once
+    //
+    uint32_t words[BlockWords];
+    uint32_t key = 0;
+    bool pending = false;
+    TR_BitVectorIterator bvi(other);
+    while (bvi.hasMoreElements()) {
+        int32_t n = bvi.getNextElement();
+        uint32_t nextKey = (uint32_t)n >> BlockShift;
+        if (!pending || nextKey != key) {
+            if (pending)
+                applyWords(key, words, subtract);
+            key = nextKey;
+            memset(words, 0, sizeof(words));
+            pending = true;
+        }
+        words[(n >> 5) & (BlockWords - 1)] |= 1u << (n & 31);
+    }
+    if (pending)
+        applyWords(key, words, subtract);
+}
+
+void TR_BitVector::operator|=(TR_HybridBitVector &v2)
+{
+    for (TR_HybridBitVectorCursor cursor(v2); cursor.Valid(); cursor.SetToNextOne())
+        set(cursor);
+}
+
+void TR_BitVector::operator&=(TR_HybridBitVector &v2)
+{
+    TR_BitVectorIterator bvi(*this);
+    while (bvi.hasMoreElements()) {
+        int32_t n = bvi.getNextElement();
+        if (!v2.get(n))
+            reset(n);
+    }
+}
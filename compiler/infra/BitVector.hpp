@@ -31,6 +31,8 @@
 
 class TR_BitVector;
 class TR_BitVectorCursor;
+class TR_HybridBitVector;
+class TR_HybridBitVectorCursor;
 
 namespace OMR {
 class Logger;
@@ -54,7 +56,8 @@ typedef uint32_t chunk_t;
 
 enum TR_BitContainerType {
     singleton,
-    bitvector
+    bitvector,
+    hybridBitVector
 };
 
 class TR_BitContainer {
@@ -76,6 +79,11 @@ public:
         , _type(bitvector)
     {}
 
+    TR_BitContainer(TR_HybridBitVector *bv)
+        : _hybridBitVector(bv)
+        , _type(hybridBitVector)
+    {}
+
     operator TR_BitVector *()
     {
         TR_ASSERT(_type == bitvector, "BitContainer cannot be converted to BitVector\n");
@@ -84,6 +92,8 @@ public:
 
     TR_BitVector *getBitVector() { return (_type == bitvector ? _bitVector : NULL); }
 
+    TR_HybridBitVector *getHybridBitVector() { return (_type == hybridBitVector ? _hybridBitVector : NULL); }
+
     // TR_BitVector methods (have extra run time check)
     int32_t get(int32_t n);
     bool intersects(TR_BitVector &v2);
@@ -94,7 +104,7 @@ public:
 
     bool isEmpty();
 
-    bool isSingleValue() { return (_type != bitvector); }
+    bool isSingleValue() { return (_type == singleton); }
 
     int32_t getSingleValue() { return _singleBit; }
 
@@ -102,6 +112,7 @@ private:
     union {
         int32_t _singleBit;
         TR_BitVector *_bitVector;
+        TR_HybridBitVector *_hybridBitVector;
     };
 
     TR_BitContainerType _type;
@@ -220,6 +231,254 @@ private:
     bool _value;
 };
 
+/**
+ * An adaptive bit set for data flow analyses over very large index spaces.
+ *
+ * A TR_BitVector allocates one bit per index up to the largest index it has
+ * ever held, so an analysis with tens of thousands of symbols or definitions
+ * pays for that many bits in every block's in, out, gen and kill sets even
+ * when each set holds only a handful of elements.
+ *
+ * This container splits the index space into fixed size blocks and only
+ * materializes blocks that hold at least one element. Each block is kept in
+ * whichever of three forms is cheapest for its population: a sorted array of
+ * offsets when it is sparse, a bitmap when it is dense, or no storage at all
+ * when every bit in the block is set (a run covering the whole block, which
+ * is what intersection analyses produce when they initialize to the
+ * universal set). Blocks are normalized after every operation, so equality
+ * can be decided block by block.
+ *
+ * Storage released by a block is kept on a per-vector free list and reused,
+ * since region memory is only reclaimed when the region is released.
+ *
+ * The class provides the subset of the TR_BitVector interface that the data
+ * flow engine relies on, so an analysis opts in by instantiating the engine
+ * on TR_HybridBitVector rather than TR_BitVector.
+ */
+class TR_HybridBitVector {
+public:
+    TR_ALLOC(TR_Memory::BitVector)
+
+    typedef TR_HybridBitVectorCursor Cursor;
+    typedef int32_t containerCharacteristic; // used by data flow
+    static const containerCharacteristic nullContainerCharacteristic = -1;
+
+    enum {
+        BlockShift = 10,
+        BlockBits = 1 << BlockShift,
+        BlockWords = BlockBits / 32,
+        MaxSparseElements = BlockBits / 16 // a full offset array is no larger than a bitmap
+    };
+
+    TR_HybridBitVector() { init(NULL); }
+
+    TR_HybridBitVector(TR::Region &region) { init(&region); }
+
+    // The initial size is only a hint for TR_BitVector; blocks are
+    // materialized on demand.
+    //
+    TR_HybridBitVector(int64_t initBits, TR_Memory *m, TR_AllocationKind allocKind = heapAlloc);
+
+    TR_HybridBitVector(int64_t initBits, TR::Region &region) { init(&region); }
+
+    int32_t get(int32_t n);
+
+    void set(int32_t n);
+
+    void reset(int32_t n);
+
+    bool isEmpty() { return _numBlocks == 0; }
+
+    bool hasMoreThanOneElement() { return _numBlocks > 1 || (_numBlocks == 1 && _blocks[0]._count > 1); }
+
+    int32_t elementCount();
+
+    bool intersects(TR_HybridBitVector &other);
+
+    bool operator==(TR_HybridBitVector &other);
+
+    bool operator!=(TR_HybridBitVector &other) { return !operator==(other); }
+
+    void operator|=(TR_HybridBitVector &other);
+
+    void operator&=(TR_HybridBitVector &other);
+
+    void operator-=(TR_HybridBitVector &other);
+
+    void operator=(TR_HybridBitVector &other);
+
+    // Mixed operations with the TR_BitVectors that analyses keep alongside
+    // their data flow sets (per-symbol def sets, for example)
+    //
+    void operator|=(TR_BitVector &other) { applyBitVector(other, false); }
+
+    void operator-=(TR_BitVector &other) { applyBitVector(other, true); }
+
+    // Set the first n elements of the set
+    //
+    void setAll(int64_t n)
+    {
+        if (n > 0)
+            setAll(0, n - 1);
+    }
+
+    // Set elements m to n of the set
+    //
+    void setAll(int64_t m, int64_t n);
+
+    // Reset the first n elements of the set
+    //
+    void resetAll(int64_t n)
+    {
+        if (n > 0)
+            resetAll(0, n - 1);
+    }
+
+    // Reset elements m to n of the set
+    //
+    void resetAll(int64_t m, int64_t n);
+
+    void empty();
+
+    // Chunk counts are reported in blocks
+    //
+    int32_t numUsedChunks() { return _numBlocks; }
+
+    int32_t numNonZeroChunks() { return _numBlocks; }
+
+    // Number of bytes of block storage currently owned by this vector,
+    // including storage held on the free lists
+    //
+    size_t memoryUsed();
+
+    void print(OMR::Logger *log, TR::Compilation *comp);
+
+private:
+    enum BlockKind {
+        SparseBlock,
+        DenseBlock,
+        FullBlock
+    };
+
+    // Storage size classes: offset arrays of 4, 8, 16, 32 and 64 elements.
+    // A bitmap is the same size as the largest offset array.
+    //
+    enum {
+        NumSizeClasses = 5,
+        DenseSizeClass = NumSizeClasses - 1
+    };
+
+    struct Block {
+        uint32_t _key;
+        uint16_t _count;
+        uint8_t _kind;
+        uint8_t _sizeClass;
+
+        union {
+            uint16_t *_offsets;
+            uint32_t *_words;
+        };
+    };
+
+    struct FreeStorage {
+        FreeStorage *_next;
+    };
+
+    TR_HybridBitVector(const TR_HybridBitVector &);
+
+    void init(TR::Region *region)
+    {
+        _blocks = NULL;
+        _numBlocks = 0;
+        _blockCapacity = 0;
+        _region = region;
+        _bytesAllocated = 0;
+        for (int32_t i = 0; i < NumSizeClasses; i++)
+            _freeStorage[i] = NULL;
+    }
+
+    static size_t sizeClassBytes(int32_t sizeClass) { return (size_t)8 << sizeClass; }
+
+    static int32_t sparseCapacity(int32_t sizeClass) { return 4 << sizeClass; }
+
+    static int32_t sparseSizeClass(int32_t count)
+    {
+        int32_t sizeClass = 0;
+        while (sparseCapacity(sizeClass) < count)
+            sizeClass++;
+        return sizeClass;
+    }
+
+    void *allocateMemory(size_t bytes);
+    void freeMemory(void *p, size_t bytes);
+    void *allocateStorage(int32_t sizeClass);
+    void releaseStorage(Block &block);
+
+    int32_t findBlock(uint32_t key, int32_t &insertionPoint, int32_t low = 0);
+    void ensureBlockCapacity(int32_t numBlocks);
+    Block &insertBlock(int32_t position, uint32_t key);
+    void removeBlock(int32_t position);
+    void copyBlock(Block &to, Block &from);
+    void makeFull(Block &block);
+
+    static void expandBlock(Block &block, uint32_t *words);
+    static bool blockContains(Block &block, uint32_t offset);
+
+    // Store the bitmap into the block in its canonical form. Returns false,
+    // leaving the block without storage, if the bitmap is empty.
+    //
+    bool normalizeBlock(Block &block, uint32_t *words);
+
+    void applyWords(uint32_t key, uint32_t *words, bool subtract);
+    void applyBitVector(TR_BitVector &other, bool subtract);
+
+    Block *_blocks;
+    int32_t _numBlocks;
+    int32_t _blockCapacity;
+    TR::Region *_region; // NULL means persistent memory
+    size_t _bytesAllocated;
+    FreeStorage *_freeStorage[NumSizeClasses];
+
+    friend class TR_HybridBitVectorCursor;
+};
+
+class TR_HybridBitVectorCursor {
+    // CS2-like iterator
+public:
+    TR_HybridBitVectorCursor()
+        : _bitVector(NULL)
+        , _valid(false)
+    {}
+
+    TR_HybridBitVectorCursor(TR_HybridBitVector &bv) { setBitVector(bv); }
+
+    void setBitVector(TR_HybridBitVector &bv)
+    {
+        _bitVector = &bv;
+        SetToFirstOne();
+    }
+
+    bool Valid() { return _valid; }
+
+    operator uint32_t() { return _value; }
+
+    bool SetToFirstOne()
+    {
+        _blockIndex = 0;
+        _position = -1;
+        return SetToNextOne();
+    }
+
+    bool SetToNextOne();
+
+private:
+    TR_HybridBitVector *_bitVector;
+    int32_t _blockIndex;
+    int32_t _position;
+    uint32_t _value;
+    bool _valid;
+};
+
 enum TR_BitVectorGrowable {
     notGrowable,
     growable
@@ -372,6 +631,9 @@ public:
         if (bc._type == singleton) {
             empty();
             set(bc._singleBit);
+        } else if (bc._type == hybridBitVector) {
+            empty();
+            *this |= bc;
         } else {
             TR_BitVector &v2 = *(bc._bitVector);
             _region = v2._region;
@@ -577,10 +839,14 @@ public:
 #endif
     }
 
+    void operator|=(TR_HybridBitVector &v2);
+
     void operator|=(TR_BitContainer &v2)
     {
         if (v2._type == singleton)
             set(v2._singleBit);
+        else if (v2._type == hybridBitVector)
+            *this |= *v2._hybridBitVector;
         else if (v2._bitVector)
             *this |= *v2._bitVector;
     }
@@ -629,6 +895,8 @@ public:
 #endif
     }
 
+    void operator&=(TR_HybridBitVector &v2);
+
     // Determine if any bit is set in both this vector and a second vector.
     //
     bool intersects(TR_BitVector &v2)
@@ -682,7 +950,10 @@ public:
     {
         if (v2._type == singleton)
             reset(v2._singleBit);
-        else if (v2._bitVector)
+        else if (v2._type == hybridBitVector) {
+            for (TR_HybridBitVectorCursor cursor(*v2._hybridBitVector); cursor.Valid(); cursor.SetToNextOne())
+                reset(cursor);
+        } else if (v2._bitVector)
             *this -= *v2._bitVector;
     }
 
@@ -1220,13 +1491,18 @@ public:
         else if (_type == singleton) {
             _singleBit = bc._singleBit;
             _curIndex = -1;
-        }
+        } else if (bc._hybridBitVector)
+            _hybridCursor.setBitVector(*bc._hybridBitVector);
+        else
+            _hybridCursor = TR_HybridBitVectorCursor();
     }
 
     int hasMoreElements()
     {
         if (_type == bitvector)
             return _bitVector ? TR_BitVectorIterator::hasMoreElements() : false;
+        else if (_type == hybridBitVector)
+            return _hybridCursor.Valid();
         else
             return (_curIndex == -1);
     }
@@ -1235,7 +1511,10 @@ public:
     {
         if (_type == bitvector)
             return _bitVector ? TR_BitVectorIterator::getFirstElement() : -1;
-        else
+        else if (_type == hybridBitVector) {
+            _hybridCursor.SetToFirstOne();
+            return getNextElement();
+        } else
             return (_curIndex = _singleBit);
     }
 
@@ -1243,13 +1522,20 @@ public:
     {
         if (_type == bitvector)
             return _bitVector ? TR_BitVectorIterator::getNextElement() : -1;
-        else
+        else if (_type == hybridBitVector) {
+            if (!_hybridCursor.Valid())
+                return -1;
+            int32_t element = _hybridCursor;
+            _hybridCursor.SetToNextOne();
+            return element;
+        } else
             return (_curIndex = _singleBit);
     }
 
 private:
     int32_t _singleBit;
     TR_BitContainerType _type;
+    TR_HybridBitVectorCursor _hybridCursor;
 };
 
 class TR_BitMatrix {
@@ -1391,6 +1677,8 @@ inline bool TR_BitContainer::isEmpty()
 {
     if (_type == bitvector)
         return (_bitVector != NULL) ? _bitVector->isEmpty() : true;
+    else if (_type == hybridBitVector)
+        return (_hybridBitVector != NULL) ? _hybridBitVector->isEmpty() : true;
     else if (_type == singleton)
         return false;
     else
@@ -1408,10 +1696,10 @@ template<class BitVector> inline void Assign(BitVector &cs2bv, TR_BitContainer &
         return;
 
     if (trbv == NULL) {
-        // so its a singleton, get first and only element
+        // so its a singleton or a hybrid bit vector, copy its elements
         TR_BitContainerIterator bci(trbc);
-        int32_t singleton = bci.getFirstElement();
-        cs2bv[singleton] = true;
+        while (bci.hasMoreElements())
+            cs2bv[bci.getNextElement()] = true;
     } else {
         // so its a bit vector, for now just copies the elements of the TR_BitVector into cs2bv
         // cs2bv = *trbv;
@@ -0,0 +1,418 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/AllocationEscapeAnalysis.hpp"
+
+#include <algorithm>
+#include <stdint.h>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/ObjectModel.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "env/TRMemory.hpp"
+#include "il/AutomaticSymbol.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "ras/DebugCounter.hpp"
+#include "ras/Logger.hpp"
+
+TR_AllocationEscapeAnalysis::TR_AllocationEscapeAnalysis(TR::OptimizationManager *manager)
+    : TR::Optimization(manager)
+{}
+
+bool TR_AllocationEscapeAnalysis::shouldPerform() { return TR::Compiler->om.hasAllocationHelpers(); }
+
+static bool isReplaceableType(TR::DataType dt)
+{
+    switch (dt) {
+        case TR::Int8:
+        case TR::Int16:
+        case TR::Int32:
+        case TR::Int64:
+        case TR::Float:
+        case TR::Double:
+        case TR::Address:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * A load or store of a field of the object whose base is child 0.
+ */
+static bool isFieldAccess(TR::Node *node)
+{
+    TR::ILOpCode &op = node->getOpCode();
+    if (!op.isLoadIndirect() && !(op.isStoreIndirect() && !op.isWrtBar()))
+        return false;
+
+    TR::SymbolReference *symRef = node->getSymbolReference();
+    return symRef->getSymbol()->isShadow() && !symRef->isUnresolved() && !symRef->getSymbol()->isVolatile()
+        && isReplaceableType(node->getDataType());
+}
+
+static bool accessPrecedes(TR::Node *a, TR::Node *b)
+{
+    return a->getSymbolReference()->getOffset() < b->getSymbolReference()->getOffset();
+}
+
+TR_AllocationEscapeAnalysis::Candidate *TR_AllocationEscapeAnalysis::candidateForCall(CandidateList &candidates,
+    TR::Node *node)
+{
+    if (!node->getOpCode().isCall())
+        return NULL;
+
+    for (auto c = candidates.begin(); c != candidates.end(); ++c) {
+        if ((*c)->_call == node)
+            return *c;
+    }
+    return NULL;
+}
+
+TR_AllocationEscapeAnalysis::Candidate *TR_AllocationEscapeAnalysis::candidateForLocal(CandidateList &candidates,
+    TR::SymbolReference *symRef)
+{
+    for (auto c = candidates.begin(); c != candidates.end(); ++c) {
+        if ((*c)->_local && (*c)->_local->getSymbol() == symRef->getSymbol())
+            return *c;
+    }
+    return NULL;
+}
+
+void TR_AllocationEscapeAnalysis::markEscaped(Candidate *candidate, TR::Node *node, const char *reason)
+{
+    if (candidate->_escapes)
+        return;
+
+    candidate->_escapes = true;
+    logprintf(trace(), comp()->log(), "Allocation [%p] escapes at [%p]: %s\n", candidate->_call, node, reason);
+}
+
+void TR_AllocationEscapeAnalysis::findAllocations(TR::Node *node, TR::TreeTop *tree, CandidateList &candidates,
+    TR::Region &region)
+{
+    if (node->getVisitCount() == comp()->getVisitCount())
+        return;
+    node->setVisitCount(comp()->getVisitCount());
+
+    for (int32_t i = 0; i < node->getNumChildren(); i++)
+        findAllocations(node->getChild(i), tree, candidates, region);
+
+    int32_t sizeInBytes;
+    if (node->getOpCode().isCall() && TR::Compiler->om.isAllocationCall(comp(), node, sizeInBytes)
+        && sizeInBytes > 0) {
+        candidates.push_back(new (region) Candidate(node, tree, sizeInBytes, region));
+        logprintf(trace(), comp()->log(), "Allocation [%p] of %d bytes is a candidate\n", node, sizeInBytes);
+    }
+}
+
+void TR_AllocationEscapeAnalysis::findCandidates(CandidateList &candidates, TR::Region &region)
+{
+    comp()->incVisitCount();
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop()) {
+        TR::Node *node = tt->getNode();
+        findAllocations(node, tt, candidates, region);
+
+        if (!node->getOpCode().isStoreDirect() || node->getDataType() != TR::Address)
+            continue;
+
+        Candidate *candidate = candidateForCall(candidates, node->getFirstChild());
+        if (!candidate)
+            continue;
+
+        TR::SymbolReference *symRef = node->getSymbolReference();
+        Candidate *other = candidateForLocal(candidates, symRef);
+        if (candidate->_storeTree || !symRef->getSymbol()->isAuto() || symRef->getSymbol()->isInternalPointer()) {
+            markEscaped(candidate, node, "not stored into a single local");
+        } else if (other) {
+            markEscaped(other, node, "local holds more than one allocation");
+            markEscaped(candidate, node, "local holds more than one allocation");
+        } else {
+            candidate->_storeTree = tt;
+            candidate->_local = symRef;
+        }
+    }
+}
+
+void TR_AllocationEscapeAnalysis::recordAccess(Candidate *candidate, TR::Node *node, int32_t childIndex,
+    bool underCheck)
+{
+    if (childIndex != 0 || underCheck || !isFieldAccess(node)) {
+        markEscaped(candidate, node, "object is used other than as a field base");
+        return;
+    }
+
+    int32_t offset = node->getSymbolReference()->getOffset();
+    if (offset < 0 || offset + node->getSize() > candidate->_sizeInBytes)
+        markEscaped(candidate, node, "field access is out of bounds");
+    else
+        candidate->_accesses.push_back(node);
+}
+
+void TR_AllocationEscapeAnalysis::checkUses(TR::Node *node, TR::TreeTop *tree, bool underCheck,
+    CandidateList &candidates)
+{
+    if (node->getVisitCount() == comp()->getVisitCount())
+        return;
+    node->setVisitCount(comp()->getVisitCount());
+
+    if (node->getOpCode().hasSymbolReference() && !node->getOpCode().isCall()) {
+        Candidate *owner = candidateForLocal(candidates, node->getSymbolReference());
+        if (owner && node->getOpCode().isStore() && tree != owner->_storeTree)
+            markEscaped(owner, node, "local is redefined");
+        else if (owner && node->getOpCodeValue() == TR::loadaddr)
+            markEscaped(owner, node, "address of local is taken");
+    }
+
+    // The reference child of a check may be commoned with an access seen
+    // earlier, so checks are looked at whether or not they see it first
+    if (underCheck && node == tree->getNode() && node->getNumChildren() > 0) {
+        TR::Node *reference = node->getFirstChild();
+        if (reference->getNumChildren() > 0 && reference->getFirstChild()->getOpCode().isLoadVarDirect()) {
+            Candidate *checked = candidateForLocal(candidates, reference->getFirstChild()->getSymbolReference());
+            if (checked)
+                markEscaped(checked, node, "object is the reference of a check");
+        }
+    }
+
+    bool isAnchor = node == tree->getNode() && node->getOpCodeValue() == TR::treetop;
+    for (int32_t i = 0; i < node->getNumChildren(); i++) {
+        TR::Node *child = node->getChild(i);
+        Candidate *candidate = candidateForCall(candidates, child);
+        if (candidate) {
+            // Copy propagation may leave the call itself as the base of accesses
+            bool isAllocationAnchor = isAnchor && tree == candidate->_allocationTree;
+            bool isStore = node == tree->getNode() && tree == candidate->_storeTree;
+            if (!isAllocationAnchor && !isStore)
+                recordAccess(candidate, node, i, underCheck);
+        } else if (child->getOpCode().isLoadVarDirect()
+            && (candidate = candidateForLocal(candidates, child->getSymbolReference()))) {
+            // An anchored load of the local exposes nothing
+            if (!isAnchor)
+                recordAccess(candidate, node, i, underCheck);
+        }
+
+        checkUses(child, tree, underCheck, candidates);
+    }
+}
+
+bool TR_AllocationEscapeAnalysis::hasScalarLayout(Candidate *candidate)
+{
+    std::sort(candidate->_accesses.begin(), candidate->_accesses.end(), accessPrecedes);
+
+    TR::Node *previous = NULL;
+    for (auto a = candidate->_accesses.begin(); a != candidate->_accesses.end(); ++a) {
+        TR::Node *access = *a;
+        if (previous) {
+            int32_t previousOffset = previous->getSymbolReference()->getOffset();
+            int32_t offset = access->getSymbolReference()->getOffset();
+            if (offset == previousOffset ? access->getDataType() != previous->getDataType()
+                                         : previousOffset + previous->getSize() > offset)
+                return false;
+        }
+        previous = access;
+    }
+    return true;
+}
+
+bool TR_AllocationEscapeAnalysis::canStackAllocate(Candidate *candidate)
+{
+    // A collector that scans or moves the object would find it in the frame,
+    // so the front end has to allow it for the helper
+    if (!TR::Compiler->om.allowsStackAllocation(candidate->_call))
+        return false;
+
+    // References stored into a stack allocated object would not be seen by the
+    // collector, so only objects that never hold one qualify
+    if (candidate->_sizeInBytes > MAX_STACK_ALLOCATION_SIZE)
+        return false;
+
+    for (auto a = candidate->_accesses.begin(); a != candidate->_accesses.end(); ++a) {
+        if ((*a)->getDataType() == TR::Address)
+            return false;
+    }
+    return true;
+}
+
+void TR_AllocationEscapeAnalysis::anchorArguments(Candidate *candidate)
+{
+    TR::Node *call = candidate->_call;
+    for (int32_t i = 0; i < call->getNumChildren(); i++) {
+        TR::Node *argument = call->getChild(i);
+        if (!argument->getOpCode().isLoadConst())
+            candidate->_allocationTree->insertBefore(
+                TR::TreeTop::create(comp(), TR::Node::create(call, TR::treetop, 1, argument)));
+    }
+}
+
+void TR_AllocationEscapeAnalysis::scalarReplace(Candidate *candidate)
+{
+    TR::Node *call = candidate->_call;
+    TR::TreeTop *allocationTree = candidate->_allocationTree;
+
+    anchorArguments(candidate);
+
+    // Accesses are sorted by offset, so each field is a run of accesses of one type
+    TR::SymbolReference *field = NULL;
+    int32_t fieldOffset = -1;
+    for (auto a = candidate->_accesses.begin(); a != candidate->_accesses.end(); ++a) {
+        TR::Node *access = *a;
+        TR::DataType dt = access->getDataType();
+        int32_t offset = access->getSymbolReference()->getOffset();
+        if (!field || offset != fieldOffset) {
+            field = comp()->getSymRefTab()->createTemporary(comp()->getMethodSymbol(), dt);
+            fieldOffset = offset;
+            TR::Node *zero = TR::Node::createConstZeroValue(call, dt);
+            allocationTree->insertBefore(TR::TreeTop::create(comp(), TR::Node::createStore(call, field, zero)));
+            logprintf(trace(), comp()->log(), "Field at offset %d of [%p] becomes #%d\n", offset, call,
+                field->getReferenceNumber());
+        }
+
+        access->removeChild(0);
+        if (access->getOpCode().isStore())
+            TR::Node::recreateWithSymRef(access, comp()->il.opCodeForDirectStore(dt), field);
+        else
+            TR::Node::recreateWithSymRef(access, comp()->il.opCodeForDirectLoad(dt), field);
+    }
+
+    // Any remaining load of the local is an anchor; give it something to read
+    if (candidate->_storeTree) {
+        TR::Node *store = candidate->_storeTree->getNode();
+        call->recursivelyDecReferenceCount();
+        store->setAndIncChild(0, TR::Node::aconst(call, 0));
+    }
+
+    // The call may first be evaluated under a field store that is now a
+    // store of a temporary, so only a tree of its own is removed
+    TR::Node *allocationNode = allocationTree->getNode();
+    if (allocationTree != candidate->_storeTree
+        && (allocationNode == call
+            || (allocationNode->getOpCodeValue() == TR::treetop && allocationNode->getFirstChild() == call)))
+        allocationTree->unlink(true);
+}
+
+void TR_AllocationEscapeAnalysis::stackAllocate(Candidate *candidate)
+{
+    TR::Node *call = candidate->_call;
+    TR::TreeTop *allocationTree = candidate->_allocationTree;
+
+    anchorArguments(candidate);
+
+    // Round up so the object can be cleared a word at a time
+    int32_t sizeInBytes = (candidate->_sizeInBytes + 7) & ~7;
+    TR::SymbolReference *object
+        = comp()->getSymRefTab()->createLocalPrimArray(sizeInBytes, comp()->getMethodSymbol(), 8);
+    object->setStackAllocatedArrayAccess();
+
+    // The helper returns zeroed memory.  Clearing through generic shadows
+    // rather than those of the fields keeps the zeroes from being forwarded
+    // to field loads that overlap other, later field stores.
+    for (int32_t offset = 0; offset < sizeInBytes; offset += 8) {
+        TR::Node *base = TR::Node::createWithSymRef(call, TR::loadaddr, 0, object);
+        TR::Node *zero = TR::Node::createConstZeroValue(call, TR::Int64);
+        allocationTree->insertBefore(TR::TreeTop::create(comp(),
+            TR::Node::createWithSymRef(comp()->il.opCodeForIndirectStore(TR::Int64), 2, 2, base, zero,
+                comp()->getSymRefTab()->findOrCreateGenericIntShadowSymbolReference(offset))));
+    }
+
+    // The local now points into the frame; the collector must not scan it
+    if (candidate->_local)
+        candidate->_local->getSymbol()->setNotCollected();
+
+    call->removeAllChildren();
+    TR::Node::recreateWithSymRef(call, TR::loadaddr, object);
+}
+
+int32_t TR_AllocationEscapeAnalysis::perform()
+{
+    if (!comp()->getStartTree())
+        return 0;
+
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+    CandidateList candidates(stackMemoryRegion);
+
+    findCandidates(candidates, stackMemoryRegion);
+    if (candidates.empty())
+        return 0;
+
+    comp()->incVisitCount();
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop()) {
+        TR::ILOpCode &op = tt->getNode()->getOpCode();
+        checkUses(tt->getNode(), tt, op.isCheck() || op.isNullCheck() || op.isResolveCheck(), candidates);
+    }
+
+    int32_t numTransformed = 0;
+    for (auto c = candidates.begin(); c != candidates.end(); ++c) {
+        Candidate *candidate = *c;
+        if (candidate->_escapes)
+            continue;
+
+        bool scalar = hasScalarLayout(candidate);
+        if (!scalar && !canStackAllocate(candidate))
+            continue;
+
+        if (!performTransformation(comp(), "%s%s allocation [%p] of %d bytes\n", optDetailString(),
+                scalar ? "Scalar replacing" : "Stack allocating", candidate->_call, candidate->_sizeInBytes))
+            continue;
+
+        TR::DebugCounter::prependDebugCounter(comp(), "allocationEscapeAnalysis/bytesAvoided",
+            candidate->_allocationTree, candidate->_sizeInBytes);
+        TR::DebugCounter::incStaticDebugCounter(comp(),
+            TR::DebugCounter::debugCounterName(comp(), "allocationEscapeAnalysis/%s/(%s)",
+                scalar ? "scalarReplaced" : "stackAllocated", comp()->signature()));
+
+        if (scalar)
+            scalarReplace(candidate);
+        else
+            stackAllocate(candidate);
+        numTransformed++;
+    }
+
+    if (numTransformed > 0) {
+        optimizer()->setUseDefInfo(NULL);
+        optimizer()->setValueNumberInfo(NULL);
+        optimizer()->setAliasSetsAreValid(false);
+        requestOpt(OMR::localCSE);
+        requestOpt(OMR::treeSimplification);
+        requestOpt(OMR::deadTreesElimination);
+        requestOpt(OMR::globalDeadStoreElimination);
+    }
+
+    return numTransformed;
+}
+
+const char *TR_AllocationEscapeAnalysis::optDetailString() const throw()
+{
+    return "O^O ALLOCATION ESCAPE ANALYSIS: ";
+}
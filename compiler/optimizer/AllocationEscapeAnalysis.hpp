@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef ALLOCATIONESCAPEANALYSIS_INCL
+#define ALLOCATIONESCAPEANALYSIS_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR {
+class Node;
+class SymbolReference;
+class TreeTop;
+} // namespace TR
+
+/**
+ * Escape analysis for objects returned by front-end allocation helpers.
+ *
+ * Allocation helpers are described to the optimizer through
+ * TR::ObjectModel::registerAllocationHelper.  A direct call to one with a
+ * constant size is a candidate if its result is either discarded or stored
+ * into a local that is defined nowhere else, and every other use of the call
+ * or load of that local is as the base of a field load or store within the
+ * bounds of the object.  Such an object cannot be seen outside the method.
+ *
+ * When the fields of a candidate are accessed at distinct, non-overlapping
+ * offsets with a single type each, the object is scalar replaced: every field
+ * becomes a temporary, zeroed where the object was allocated, and the
+ * allocation disappears.  Otherwise, if the object is small, holds no
+ * references and its helper was registered as allowing it, it is allocated
+ * on the stack instead and the local that holds it is no longer collected.
+ *
+ * Field layout is taken from the offsets and types of the shadows that access
+ * the object; the front end only supplies the allocation size.
+ */
+class TR_AllocationEscapeAnalysis : public TR::Optimization {
+public:
+    TR_AllocationEscapeAnalysis(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) TR_AllocationEscapeAnalysis(manager);
+    }
+
+    virtual bool shouldPerform();
+    virtual int32_t perform();
+    virtual const char *optDetailString() const throw();
+
+private:
+    struct Candidate {
+        Candidate(TR::Node *call, TR::TreeTop *allocationTree, int32_t sizeInBytes, TR::Region &region)
+            : _call(call)
+            , _allocationTree(allocationTree)
+            , _storeTree(NULL)
+            , _local(NULL)
+            , _sizeInBytes(sizeInBytes)
+            , _escapes(false)
+            , _accesses(region)
+        {}
+
+        TR::Node *_call;
+        TR::TreeTop *_allocationTree; // tree in which the call is first evaluated
+        TR::TreeTop *_storeTree; // the store of the call into _local, if any
+        TR::SymbolReference *_local;
+        int32_t _sizeInBytes;
+        bool _escapes;
+        TR::vector<TR::Node *, TR::Region &> _accesses; // field loads and stores based on _local
+    };
+
+    typedef TR::vector<Candidate *, TR::Region &> CandidateList;
+
+    static const int32_t MAX_STACK_ALLOCATION_SIZE = 256;
+
+    void findCandidates(CandidateList &candidates, TR::Region &region);
+    void findAllocations(TR::Node *node, TR::TreeTop *tree, CandidateList &candidates, TR::Region &region);
+    void checkUses(TR::Node *node, TR::TreeTop *tree, bool underCheck, CandidateList &candidates);
+    Candidate *candidateForCall(CandidateList &candidates, TR::Node *node);
+    Candidate *candidateForLocal(CandidateList &candidates, TR::SymbolReference *symRef);
+    void recordAccess(Candidate *candidate, TR::Node *node, int32_t childIndex, bool underCheck);
+    void markEscaped(Candidate *candidate, TR::Node *node, const char *reason);
+
+    bool hasScalarLayout(Candidate *candidate);
+    bool canStackAllocate(Candidate *candidate);
+    void anchorArguments(Candidate *candidate);
+    void scalarReplace(Candidate *candidate);
+    void stackAllocate(Candidate *candidate);
+};
+
+#endif
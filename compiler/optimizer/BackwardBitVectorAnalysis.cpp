@@ -1471,3 +1471,4 @@ template<class Container> TR_DataFlowAnalysis::Kind TR_BackwardDFSetAnalysis<Con
 
 template class TR_BackwardDFSetAnalysis<TR_BitVector *>;
 template class TR_BackwardDFSetAnalysis<TR_SingleBitContainer *>;
+template class TR_BackwardDFSetAnalysis<TR_HybridBitVector *>;
@@ -80,3 +80,4 @@ template<class Container> TR_DataFlowAnalysis::Kind TR_BackwardIntersectionDFSet
 }
 
 template class TR_BackwardIntersectionDFSetAnalysis<TR_BitVector *>;
+template class TR_BackwardIntersectionDFSetAnalysis<TR_HybridBitVector *>;
@@ -1467,4 +1467,6 @@ TR_BasicDFSetAnalysis<Container *>::ExtraAnalysisInfo::getContainerNodeNumberPai
 template class TR_BasicDFSetAnalysis<TR_BitVector *>;
 template class TR_ForwardDFSetAnalysis<TR_BitVector *>;
 template class TR_BasicDFSetAnalysis<TR_SingleBitContainer *>;
+template class TR_BasicDFSetAnalysis<TR_HybridBitVector *>;
 template class TR_ForwardDFSetAnalysis<TR_SingleBitContainer *>;
+template class TR_ForwardDFSetAnalysis<TR_HybridBitVector *>;
@@ -0,0 +1,337 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/BlockFrequencyProfiler.hpp"
+
+#include <stdint.h>
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/PersistentInfo.hpp"
+#include "env/TRMemory.hpp"
+#include "il/Block.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/CfgEdge.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "ras/Logger.hpp"
+
+TR_BlockFrequencyProfile::TR_BlockFrequencyProfile(const char *signature, int32_t numBlocks, int32_t numBranches,
+    uint32_t shapeHash)
+    : _numBlocks(numBlocks)
+    , _numBranches(numBranches)
+    , _shapeHash(shapeHash)
+    , _next(NULL)
+{
+    _signature = (char *)TR_Memory::jitPersistentAlloc(strlen(signature) + 1, TR_Memory::MethodBranchProfileInfo);
+    strcpy(_signature, signature);
+
+    // A single allocation holds the block counters followed by the taken counters
+    size_t numCounters = (size_t)numBlocks + (size_t)numBranches;
+    _blockCounts = (int64_t *)TR_Memory::jitPersistentAlloc((numCounters > 0 ? numCounters : 1) * sizeof(int64_t),
+        TR_Memory::MethodBranchProfileInfo);
+    memset(_blockCounts, 0, numCounters * sizeof(int64_t));
+    _takenCounts = _blockCounts + numBlocks;
+}
+
+static uint32_t hashSignature(const char *signature)
+{
+    uint32_t hash = 2166136261u;
+    for (const char *c = signature; *c; ++c)
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+    return hash;
+}
+
+TR_BlockFrequencyProfileTable::TR_BlockFrequencyProfileTable()
+    : _monitor(TR::Monitor::create("JIT-BlockFrequencyProfileTableMonitor"))
+{
+    memset(_buckets, 0, sizeof(_buckets));
+}
+
+TR_BlockFrequencyProfile *TR_BlockFrequencyProfileTable::findLocked(const char *signature,
+    TR_BlockFrequencyProfile ***link)
+{
+    TR_BlockFrequencyProfile **cursor = &_buckets[hashSignature(signature) % NUM_BUCKETS];
+    for (; *cursor; cursor = &(*cursor)->_next) {
+        if (!strcmp((*cursor)->getSignature(), signature))
+            break;
+    }
+
+    if (link)
+        *link = cursor;
+    return *cursor;
+}
+
+TR_BlockFrequencyProfile *TR_BlockFrequencyProfileTable::find(const char *signature)
+{
+    OMR::CriticalSection findProfile(_monitor);
+    return findLocked(signature, NULL);
+}
+
+TR_BlockFrequencyProfile *TR_BlockFrequencyProfileTable::findOrCreate(const char *signature, int32_t numBlocks,
+    int32_t numBranches, uint32_t shapeHash)
+{
+    OMR::CriticalSection createProfile(_monitor);
+
+    TR_BlockFrequencyProfile **link = NULL;
+    TR_BlockFrequencyProfile *profile = findLocked(signature, &link);
+    if (profile && profile->matches(numBlocks, numBranches, shapeHash))
+        return profile;
+
+    // Any stale profile is unlinked but not freed; bodies instrumented against it may still be running
+    TR_BlockFrequencyProfile *newProfile
+        = new (PERSISTENT_NEW) TR_BlockFrequencyProfile(signature, numBlocks, numBranches, shapeHash);
+    if (!newProfile)
+        return NULL;
+
+    newProfile->setNext(profile ? profile->getNext() : NULL);
+    *link = newProfile;
+    return newProfile;
+}
+
+TR_BlockFrequencyProfiler::TR_BlockFrequencyProfiler(TR::OptimizationManager *manager)
+    : TR::Optimization(manager)
+    , _blocks(NULL)
+    , _branches(NULL)
+    , _branchOfBlock(NULL)
+    , _numBlocks(0)
+    , _numBranches(0)
+    , _shapeHash(0)
+{}
+
+bool TR_BlockFrequencyProfiler::shouldPerform()
+{
+    return comp()->getOption(TR_EnableBlockFrequencyProfiling) && comp()->isOutermostMethod()
+        && !comp()->isPeekingMethod();
+}
+
+static bool isProfiledBranch(TR::Node *node)
+{
+    return node->getOpCode().isIf() && node->getNumChildren() == 2
+        && node->getOpCode().convertIfCmpToCmp() != TR::BadILOp;
+}
+
+static inline uint32_t mixShapeHash(uint32_t hash, uint32_t value) { return (hash ^ value) * 16777619u; }
+
+void TR_BlockFrequencyProfiler::collectShape()
+{
+    _numBlocks = 0;
+    _numBranches = 0;
+    for (TR::Block *block = comp()->getStartBlock(); block; block = block->getNextBlock()) {
+        _numBlocks++;
+        if (isProfiledBranch(block->getLastRealTreeTop()->getNode()))
+            _numBranches++;
+    }
+
+    _blocks = (TR::Block **)trMemory()->allocateStackMemory((_numBlocks + 1) * sizeof(TR::Block *));
+    _branches = (TR::Node **)trMemory()->allocateStackMemory((_numBranches + 1) * sizeof(TR::Node *));
+    _branchOfBlock = (int32_t *)trMemory()->allocateStackMemory((_numBlocks + 1) * sizeof(int32_t));
+
+    uint32_t hash = mixShapeHash(2166136261u, _numBlocks);
+    int32_t blockIndex = 0;
+    int32_t branchIndex = 0;
+    for (TR::Block *block = comp()->getStartBlock(); block; block = block->getNextBlock(), blockIndex++) {
+        TR::Node *lastNode = block->getLastRealTreeTop()->getNode();
+        _blocks[blockIndex] = block;
+        _branchOfBlock[blockIndex] = -1;
+        if (isProfiledBranch(lastNode)) {
+            _branches[branchIndex] = lastNode;
+            _branchOfBlock[blockIndex] = branchIndex++;
+        }
+
+        hash = mixShapeHash(hash, (uint32_t)block->getSuccessors().size());
+        hash = mixShapeHash(hash, (uint32_t)lastNode->getOpCodeValue());
+    }
+
+    _shapeHash = hash;
+}
+
+TR::TreeTop *TR_BlockFrequencyProfiler::createCounterBump(TR::Node *originatingNode, int64_t *counter,
+    TR::Node *increment)
+{
+    TR::SymbolReference *counterRef = comp()->getSymRefTab()->createKnownStaticDataSymbolRef(counter, TR::Int64);
+    TR::Node *load = TR::Node::createWithSymRef(originatingNode, TR::lload, 0, counterRef);
+    TR::Node *add = TR::Node::create(originatingNode, TR::ladd, 2, load, increment);
+    return TR::TreeTop::create(comp(), TR::Node::createWithSymRef(originatingNode, TR::lstore, 1, add, counterRef));
+}
+
+void TR_BlockFrequencyProfiler::instrument(TR_BlockFrequencyProfile *profile)
+{
+    OMR::Logger *log = comp()->log();
+
+    for (int32_t i = 0; i < _numBlocks; i++) {
+        TR::Block *block = _blocks[i];
+        TR::Node *entryNode = block->getEntry()->getNode();
+        block->getEntry()->insertAfter(
+            createCounterBump(entryNode, profile->getBlockCounter(i), TR::Node::lconst(entryNode, 1)));
+
+        int32_t branch = _branchOfBlock[i];
+        if (branch < 0)
+            continue;
+
+        // Count taken branches without introducing control flow by adding the
+        // result of the equivalent boolean compare.  The compare commons the
+        // branch's children so they are still evaluated only once.
+        TR::Node *ifNode = _branches[branch];
+        TR::Node *compare = TR::Node::create(ifNode, ifNode->getOpCode().convertIfCmpToCmp(), 2,
+            ifNode->getFirstChild(), ifNode->getSecondChild());
+        TR::Node *increment = TR::Node::create(ifNode, TR::iu2l, 1, compare);
+        block->getLastRealTreeTop()->insertBefore(createCounterBump(ifNode, profile->getTakenCounter(branch), increment));
+
+        logprintf(trace(), log, "Instrumented branch %d n%dn in block_%d\n", branch, ifNode->getGlobalIndex(),
+            block->getNumber());
+    }
+
+    logprintf(trace(), log, "Instrumented %d blocks and %d branches of %s\n", _numBlocks, _numBranches,
+        comp()->signature());
+}
+
+static int32_t scaledFrequency(int64_t count, int64_t maxCount)
+{
+    if (count <= 0)
+        return 0;
+
+    double ratio = (double)count / (double)maxCount;
+    return MAX_COLD_BLOCK_COUNT + 1 + (int32_t)(ratio * (MAX_BLOCK_COUNT - MAX_COLD_BLOCK_COUNT - 1));
+}
+
+bool TR_BlockFrequencyProfiler::applyProfile(TR_BlockFrequencyProfile *profile)
+{
+    OMR::Logger *log = comp()->log();
+    TR::CFG *cfg = comp()->getFlowGraph();
+
+    int64_t maxCount = 0;
+    for (int32_t i = 0; i < _numBlocks; i++) {
+        if (profile->getBlockCount(i) > maxCount)
+            maxCount = profile->getBlockCount(i);
+    }
+
+    if (maxCount <= 0)
+        return false;
+
+    int32_t numNodes = cfg->getNextNodeNumber();
+    int32_t *indexOfNode = (int32_t *)trMemory()->allocateStackMemory(numNodes * sizeof(int32_t));
+    for (int32_t n = 0; n < numNodes; n++)
+        indexOfNode[n] = -1;
+    for (int32_t i = 0; i < _numBlocks; i++)
+        indexOfNode[_blocks[i]->getNumber()] = i;
+
+    int32_t maxFrequency = 0;
+    int32_t maxEdgeFrequency = 0;
+    for (int32_t i = 0; i < _numBlocks; i++) {
+        TR::Block *block = _blocks[i];
+        int64_t blockCount = profile->getBlockCount(i);
+        int32_t frequency = scaledFrequency(blockCount, maxCount);
+        block->setFrequency(frequency);
+        if (frequency > maxFrequency)
+            maxFrequency = frequency;
+
+        int32_t branch = _branchOfBlock[i];
+        TR::Block *takenTarget = NULL;
+        int64_t takenCount = 0;
+        if (branch >= 0) {
+            takenTarget = _branches[branch]->getBranchDestination()->getNode()->getBlock();
+            takenCount = profile->getTakenCount(branch);
+            if (takenCount > blockCount)
+                takenCount = blockCount;
+        }
+
+        TR::CFGEdgeList &successors = block->getSuccessors();
+        for (auto edge = successors.begin(); edge != successors.end(); ++edge) {
+            TR::CFGNode *to = (*edge)->getTo();
+            int64_t edgeCount = blockCount;
+            if (takenTarget && takenTarget != block->getNextBlock()) {
+                edgeCount = (to == takenTarget) ? takenCount : blockCount - takenCount;
+            } else if (!takenTarget && successors.size() > 1 && indexOfNode[to->getNumber()] >= 0) {
+                int64_t toCount = profile->getBlockCount(indexOfNode[to->getNumber()]);
+                if (toCount < edgeCount)
+                    edgeCount = toCount;
+            }
+
+            int32_t edgeFrequency = scaledFrequency(edgeCount, maxCount);
+            (*edge)->setFrequency(edgeFrequency);
+            if (edgeFrequency > maxEdgeFrequency)
+                maxEdgeFrequency = edgeFrequency;
+        }
+
+        logprintf(trace(), log, "block_%d count %lld frequency %d\n", block->getNumber(), (long long)blockCount,
+            frequency);
+    }
+
+    cfg->getStart()->setFrequency(_blocks[0]->getFrequency());
+    cfg->getEnd()->setFrequency(_blocks[0]->getFrequency());
+    cfg->setMaxFrequency(maxFrequency);
+    cfg->setMaxEdgeFrequency(maxEdgeFrequency);
+
+    logprintf(trace(), log, "Applied block frequency profile of %s (%lld entries)\n", comp()->signature(),
+        (long long)profile->getEntryCount());
+    return true;
+}
+
+int32_t TR_BlockFrequencyProfiler::perform()
+{
+    if (!comp()->getStartBlock())
+        return 0;
+
+    collectShape();
+
+    TR_BlockFrequencyProfileTable *table = comp()->getPersistentInfo()->getBlockFrequencyProfiles();
+    if (!table)
+        return 0;
+
+    TR_BlockFrequencyProfile *profile = table->find(comp()->signature());
+    if (profile && profile->matches(_numBlocks, _numBranches, _shapeHash)
+        && profile->getEntryCount() >= comp()->getOptions()->getBlockFrequencyProfileThreshold()) {
+        if (performTransformation(comp(), "%sUsing block frequency profile for %s\n", optDetailString(),
+                comp()->signature())) {
+            applyProfile(profile);
+            return 1;
+        }
+        return 0;
+    }
+
+    // Only warm bodies pay for the instrumentation; code relocated to another
+    // process cannot refer to this process' counters
+    if (comp()->getMethodHotness() != warm || comp()->compileRelocatableCode())
+        return 0;
+
+    if (!performTransformation(comp(), "%sInstrumenting %s with block frequency counters\n", optDetailString(),
+            comp()->signature()))
+        return 0;
+
+    profile = table->findOrCreate(comp()->signature(), _numBlocks, _numBranches, _shapeHash);
+    if (profile)
+        instrument(profile);
+
+    return 1;
+}
+
+const char *TR_BlockFrequencyProfiler::optDetailString() const throw() { return "O^O BLOCK FREQUENCY PROFILER: "; }
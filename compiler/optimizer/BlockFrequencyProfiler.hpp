@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef BLOCKFREQUENCYPROFILER_INCL
+#define BLOCKFREQUENCYPROFILER_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR {
+class Block;
+class Monitor;
+class Node;
+class SymbolReference;
+class TreeTop;
+} // namespace TR
+
+/**
+ * Block and branch counts recorded by an instrumented body of one method.
+ *
+ * The counters are indexed by the position of a block (or of a block ending
+ * in a conditional branch) in tree order immediately after IL generation.
+ * The shape hash guards against a later compilation producing different IL
+ * for the same signature, in which case the counts cannot be mapped back.
+ *
+ * Counters are bumped without synchronization by compiled code, so counts
+ * may drop samples under contention.  Profiles are never freed because
+ * instrumented bodies may continue to update them.
+ */
+class TR_BlockFrequencyProfile {
+public:
+    TR_ALLOC(TR_Memory::MethodBranchProfileInfo)
+
+    TR_BlockFrequencyProfile(const char *signature, int32_t numBlocks, int32_t numBranches, uint32_t shapeHash);
+
+    const char *getSignature() { return _signature; }
+
+    int32_t getNumBlocks() { return _numBlocks; }
+
+    int32_t getNumBranches() { return _numBranches; }
+
+    bool matches(int32_t numBlocks, int32_t numBranches, uint32_t shapeHash)
+    {
+        return _numBlocks == numBlocks && _numBranches == numBranches && _shapeHash == shapeHash;
+    }
+
+    int64_t *getBlockCounter(int32_t blockIndex) { return &_blockCounts[blockIndex]; }
+
+    int64_t *getTakenCounter(int32_t branchIndex) { return &_takenCounts[branchIndex]; }
+
+    int64_t getBlockCount(int32_t blockIndex) { return _blockCounts[blockIndex]; }
+
+    int64_t getTakenCount(int32_t branchIndex) { return _takenCounts[branchIndex]; }
+
+    /**
+     * Number of times the first block of the method was entered, used to decide
+     * whether enough samples have been collected to trust the profile.
+     */
+    int64_t getEntryCount() { return _numBlocks > 0 ? _blockCounts[0] : 0; }
+
+    TR_BlockFrequencyProfile *getNext() { return _next; }
+
+    void setNext(TR_BlockFrequencyProfile *next) { _next = next; }
+
+private:
+    friend class TR_BlockFrequencyProfileTable;
+
+    char *_signature;
+    int32_t _numBlocks;
+    int32_t _numBranches;
+    uint32_t _shapeHash;
+    int64_t *_blockCounts;
+    int64_t *_takenCounts;
+    TR_BlockFrequencyProfile *_next;
+};
+
+/**
+ * Process-wide table of block frequency profiles keyed by method signature.
+ * Owned by TR::PersistentInfo.
+ */
+class TR_BlockFrequencyProfileTable {
+public:
+    TR_ALLOC(TR_Memory::BranchProfileInfoManager)
+
+    TR_BlockFrequencyProfileTable();
+
+    /**
+     * Find the profile for a signature, or NULL if the method was never instrumented.
+     */
+    TR_BlockFrequencyProfile *find(const char *signature);
+
+    /**
+     * Find the profile for a signature whose shape matches the given IL shape.
+     * A new, zeroed profile replaces any existing one whose shape differs.
+     */
+    TR_BlockFrequencyProfile *findOrCreate(const char *signature, int32_t numBlocks, int32_t numBranches,
+        uint32_t shapeHash);
+
+private:
+    static const int32_t NUM_BUCKETS = 251;
+
+    TR_BlockFrequencyProfile *findLocked(const char *signature, TR_BlockFrequencyProfile ***link);
+
+    TR::Monitor *_monitor;
+    TR_BlockFrequencyProfile *_buckets[NUM_BUCKETS];
+};
+
+/**
+ * Lightweight block frequency profiling.
+ *
+ * At warm, plants a counter bump at the entry of every block and a branch-free
+ * taken counter in front of every conditional branch.  When the same method is
+ * later recompiled and its profile has recorded enough entries, the counts are
+ * converted into block and edge frequencies in place of the static, structure
+ * based estimates, so that block ordering, global register allocation and any
+ * other frequency driven transformation see the observed branch biases.
+ *
+ * Must run before any transformation so that the IL shape seen at
+ * instrumentation and at feedback time is identical.
+ */
+class TR_BlockFrequencyProfiler : public TR::Optimization {
+public:
+    TR_BlockFrequencyProfiler(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) TR_BlockFrequencyProfiler(manager);
+    }
+
+    virtual bool shouldPerform();
+    virtual int32_t perform();
+    virtual const char *optDetailString() const throw();
+
+private:
+    void collectShape();
+    void instrument(TR_BlockFrequencyProfile *profile);
+    bool applyProfile(TR_BlockFrequencyProfile *profile);
+    TR::TreeTop *createCounterBump(TR::Node *originatingNode, int64_t *counter, TR::Node *increment);
+
+    TR::Block **_blocks;
+    TR::Node **_branches;
+    int32_t *_branchOfBlock;
+    int32_t _numBlocks;
+    int32_t _numBranches;
+    uint32_t _shapeHash;
+};
+
+#endif
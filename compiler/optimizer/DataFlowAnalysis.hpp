@@ -508,6 +508,18 @@ public:
     {}
 };
 
+// Analyses over very large, sparsely populated index spaces can derive from this
+// instead of TR_UnionBitVectorAnalysis to keep their sets in hybrid bit vectors.
+//
+class TR_UnionHybridBitVectorAnalysis : public TR_UnionDFSetAnalysis<TR_HybridBitVector *> {
+public:
+    typedef TR_HybridBitVector ContainerType;
+
+    TR_UnionHybridBitVectorAnalysis(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer *optimizer, bool trace)
+        : TR_UnionDFSetAnalysis<TR_HybridBitVector *>(comp, cfg, optimizer, trace)
+    {}
+};
+
 class TR_ReachingDefinitions : public TR_UnionBitVectorAnalysis {
 public:
     TR_ReachingDefinitions(TR::Compilation *comp, TR::CFG *cfg, TR::Optimizer *optimizer, TR_UseDefInfo *,
@@ -521,6 +521,7 @@ void TR::DeadTreesElimination::prePerformOnBlocks()
                        ->isSideEffectFree()
                 && performTransformation(comp(), "%sRemove dead check of side-effect free call: %p\n",
                     optDetailString(), node)) {
+                optimizer()->prepareForNodeRemoval(node);
                 TR::TransformUtil::removeTree(comp(), tt);
                 removed = true;
             }
@@ -647,6 +648,7 @@ bool TR::DeadTreesElimination::fixUpTree(TR::Node *node, TR::TreeTop *treeTop, T
         node->incFutureUseCount();
         TR::TreeTop *anchorTreeTop = TR::TreeTop::create(comp(), TR::Node::create(TR::treetop, 1, node));
         anchorTreeTop->getNode()->setFutureUseCount(0);
+        optimizer()->reportNewNode(anchorTreeTop->getNode());
         treeTop->join(anchorTreeTop);
         anchorTreeTop->join(nextTree);
     } else {
@@ -968,9 +970,14 @@ int32_t TR::DeadTreesElimination::process(TR::TreeTop *startTree, TR::TreeTop *e
         anchor->setNumChildren(1);
 
         if (!heapBase->getOpCode().isLoadConst()) {
-            it->tree->insertAfter(TR::TreeTop::create(comp(), TR::Node::create(heapBase, TR::treetop, 1, heapBase)));
+            TR::TreeTop *anchorTreeTop
+                = TR::TreeTop::create(comp(), TR::Node::create(heapBase, TR::treetop, 1, heapBase));
+            optimizer()->reportNewNode(anchorTreeTop->getNode());
+            it->tree->insertAfter(anchorTreeTop);
         }
 
+        if (load->getReferenceCount() == 1)
+            optimizer()->prepareForNodeRemoval(load);
         load->recursivelyDecReferenceCount();
         heapBase->recursivelyDecReferenceCount();
 
@@ -73,6 +73,7 @@
 #include "optimizer/GlobalRegister.hpp"
 #include "optimizer/GlobalRegister_inlines.hpp"
 #include "ras/Debug.hpp"
+#include "ras/DebugCounter.hpp"
 #include "ras/Logger.hpp"
 
 #define GRA_COMPLEXITY_LIMIT 1000000000
@@ -437,25 +438,6 @@ int32_t TR_GlobalRegisterAllocator::perform()
             comp()->failCompilation<TR::CompilationInterrupted>("interrupted during GRA");
         }
 
-        bool canAffordAssignment = true;
-        if (!comp()->getOption(TR_ProcessHugeMethods)) {
-            int32_t numCands = 0;
-            for (TR::RegisterCandidate *rc = _candidates->getFirst(); rc; rc = rc->getNext())
-                numCands++;
-
-            int32_t hotnessFactor = 1;
-            if (comp()->getMethodHotness() >= scorching)
-                hotnessFactor = 4;
-            else if (comp()->getMethodHotness() >= hot)
-                hotnessFactor = 2;
-
-            // Use double here so we don't need to worry about overflow
-            //
-            double complexityEstimate = comp()->getFlowGraph()->getNumberOfNodes() * (double)numCands * numCands;
-            if (complexityEstimate / hotnessFactor > (double)GRA_COMPLEXITY_LIMIT)
-                canAffordAssignment = false;
-        }
-
         _valueModifiedSymRefs = new (trStackMemory()) TR_BitVector(_origSymRefCount, trMemory(), stackAlloc);
         TR_BitVector splitSymRefs(_origSymRefCount, trMemory(), stackAlloc);
         TR_BitVector nonSplittingCopyStored(_origSymRefCount, trMemory(), stackAlloc);
@@ -463,9 +445,8 @@ int32_t TR_GlobalRegisterAllocator::perform()
         //
         // Assign registers to candidates
         //
-        if (canAffordAssignment) {
-            globalFPAssignmentDone
-                = _candidates->assign(cfgBlocks, numberOfBlocks, _firstGlobalRegisterNumber, _lastGlobalRegisterNumber);
+        if (canAffordAssignment()) {
+            globalFPAssignmentDone = assignCandidates(cfgBlocks, numberOfBlocks);
 
             if (_lastGlobalRegisterNumber > -1) {
                 _visitCount = comp()->incVisitCount();
@@ -604,6 +585,38 @@ int32_t TR_GlobalRegisterAllocator::perform()
     return 1; // actual cost
 }
 
+bool TR_GlobalRegisterAllocator::shouldPerform()
+{
+    // Linear scan precedes tactical GRA in the strategies that have it
+    return !comp()->cg()->getLinearScanGRACompleted();
+}
+
+bool TR_GlobalRegisterAllocator::canAffordAssignment()
+{
+    if (comp()->getOption(TR_ProcessHugeMethods))
+        return true;
+
+    int32_t numCands = 0;
+    for (TR::RegisterCandidate *rc = _candidates->getFirst(); rc; rc = rc->getNext())
+        numCands++;
+
+    int32_t hotnessFactor = 1;
+    if (comp()->getMethodHotness() >= scorching)
+        hotnessFactor = 4;
+    else if (comp()->getMethodHotness() >= hot)
+        hotnessFactor = 2;
+
+    // Use double here so we don't need to worry about overflow
+    //
+    double complexityEstimate = comp()->getFlowGraph()->getNumberOfNodes() * (double)numCands * numCands;
+    return complexityEstimate / hotnessFactor <= (double)GRA_COMPLEXITY_LIMIT;
+}
+
+bool TR_GlobalRegisterAllocator::assignCandidates(TR::Block **cfgBlocks, int32_t numberOfBlocks)
+{
+    return _candidates->assign(cfgBlocks, numberOfBlocks, _firstGlobalRegisterNumber, _lastGlobalRegisterNumber);
+}
+
 bool TR_GlobalRegisterAllocator::isSplittingCopy(TR::Node *node)
 {
     bool trace = comp()->getOptions()->trace(OMR::tacticalGlobalRegisterAllocator);
@@ -4188,3 +4201,39 @@ void TR_LiveRangeSplitter::placeStoresInLoopExits(TR::Node *node, TR_StructureSu
 }
 
 const char *TR_LiveRangeSplitter::optDetailString() const throw() { return "O^O LIVE RANGE SPLITTER: "; }
+
+TR_LinearScanGlobalRegisterAllocator::TR_LinearScanGlobalRegisterAllocator(TR::OptimizationManager *manager)
+    : TR_GlobalRegisterAllocator(manager)
+{}
+
+bool TR_LinearScanGlobalRegisterAllocator::isPreferred(TR::Compilation *comp)
+{
+    if (comp->getOptions()->isDisabled(OMR::linearScanGlobalRegisterAllocator))
+        return false;
+
+    if (comp->getOption(TR_EnableLinearScanGRA))
+        return true;
+
+    int32_t threshold = comp->getOptions()->getLinearScanGRANodeThreshold();
+    return threshold >= 0 && comp->getMethodHotness() <= warm && comp->getAccurateNodeCount() > (ncount_t)threshold;
+}
+
+int32_t TR_LinearScanGlobalRegisterAllocator::perform()
+{
+    comp()->cg()->setLinearScanGRACompleted();
+    TR::DebugCounter::incStaticDebugCounter(comp(), "globalRegisterAllocator.linearScan/performed");
+    return TR_GlobalRegisterAllocator::perform();
+}
+
+bool TR_LinearScanGlobalRegisterAllocator::shouldPerform() { return isPreferred(comp()); }
+
+bool TR_LinearScanGlobalRegisterAllocator::assignCandidates(TR::Block **cfgBlocks, int32_t numberOfBlocks)
+{
+    return _candidates->assignLinearScan(cfgBlocks, numberOfBlocks, _firstGlobalRegisterNumber,
+        _lastGlobalRegisterNumber);
+}
+
+const char *TR_LinearScanGlobalRegisterAllocator::optDetailString() const throw()
+{
+    return "O^O LINEAR SCAN GLOBAL REGISTER ASSIGNER: ";
+}
@@ -155,6 +155,7 @@ public:
         return new (manager->allocator()) TR_GlobalRegisterAllocator(manager);
     }
 
+    virtual bool shouldPerform();
     virtual int32_t perform();
     virtual const char *optDetailString() const throw();
 
@@ -261,6 +262,9 @@ private:
     TR::SymbolReference *loadSymRef, TR::Block *block, TR::Node *node);
     */
 protected:
+    virtual bool canAffordAssignment();
+    virtual bool assignCandidates(TR::Block **cfgBlocks, int32_t numberOfBlocks);
+
     void findLoopAutoRegisterCandidates();
     TR::Block *createNewSuccessorBlock(TR::Block *, TR::Block *, TR::TreeTop *, TR::Node *, TR::RegisterCandidate *rc);
     void appendGotoBlock(TR::Block *gotoBlock, TR::Block *curBlock);
@@ -319,4 +323,38 @@ protected:
     int32_t _origSymRefCount;
     TR::Block *_osrCatchSucc;
 };
+
+/**
+ * Global register allocator that assigns registers to the candidates with a
+ * linear scan over their live ranges instead of the iterative tactical
+ * assignment.  Candidate selection and the transformation of the IL into
+ * RegLoads, RegStores and GlRegDeps are shared with TR_GlobalRegisterAllocator.
+ *
+ * Only runs when selected, either for every method under enableLinearScanGRA or
+ * for cold and warm methods whose trees have more than linearScanGRANodeThreshold
+ * nodes. Tactical GRA is skipped once it has run.
+ */
+class TR_LinearScanGlobalRegisterAllocator : public TR_GlobalRegisterAllocator {
+public:
+    TR_LinearScanGlobalRegisterAllocator(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) TR_LinearScanGlobalRegisterAllocator(manager);
+    }
+
+    /**
+     * Whether linear scan should replace tactical GRA for this compilation.
+     */
+    static bool isPreferred(TR::Compilation *comp);
+
+    virtual int32_t perform();
+    virtual bool shouldPerform();
+    virtual const char *optDetailString() const throw();
+
+protected:
+    virtual bool canAffordAssignment() { return true; }
+
+    virtual bool assignCandidates(TR::Block **cfgBlocks, int32_t numberOfBlocks);
+};
 #endif
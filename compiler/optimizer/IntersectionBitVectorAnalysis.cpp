@@ -76,3 +76,4 @@ template<class Container> TR_DataFlowAnalysis::Kind TR_IntersectionDFSetAnalysis
 }
 
 template class TR_IntersectionDFSetAnalysis<TR_BitVector *>;
+template class TR_IntersectionDFSetAnalysis<TR_HybridBitVector *>;
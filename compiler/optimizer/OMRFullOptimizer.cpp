@@ -361,6 +361,7 @@ static const OptimizationStrategy tacticalGlobalRegisterAllocatorOpts[] = {
     { OMR::liveRangeSplitter, OMR::IfLoops },
     { OMR::redundantGotoElimination, OMR::IfNotJitProfiling }, // need to be run before global register allocator
     { OMR::treeSimplification, OMR::MarkLastRun }, // Cleanup the trees after redundantGotoElimination
+    { OMR::linearScanGlobalRegisterAllocator, OMR::IfEnabled }, // must precede tactical GRA; only one of them runs
     { OMR::tacticalGlobalRegisterAllocator, OMR::IfEnabled },
     { OMR::localCSE },
     { OMR::globalCopyPropagation, OMR::IfEnabledAndMoreThanOneBlock }, // if live range splitting created copies
@@ -416,6 +417,7 @@ static const OptimizationStrategy fullNoOptStrategyOpts[] = {
 };
 
 static const OptimizationStrategy fullColdStrategyOpts[] = {
+    { OMR::blockFrequencyProfiler }, // must run before any transformation
     { OMR::basicBlockExtension },
     { OMR::localCSE },
     { OMR::treeSimplification },
@@ -424,16 +426,20 @@ static const OptimizationStrategy fullColdStrategyOpts[] = {
 };
 
 static const OptimizationStrategy fullWarmStrategyOpts[] = {
+    { OMR::blockFrequencyProfiler }, // must run before any transformation
     { OMR::basicBlockExtension },
     { OMR::localCSE },
     { OMR::treeSimplification },
+    { OMR::allocationEscapeAnalysis },
     { OMR::localCSE },
+    { OMR::slpVectorization },
     { OMR::localDeadStoreElimination },
     { OMR::globalDeadStoreGroup },
     { OMR::endOpts },
 };
 
 static const OptimizationStrategy fullHotStrategyOpts[] = {
+    { OMR::blockFrequencyProfiler }, // must run before any transformation
     { OMR::coldBlockOutlining },
     { OMR::earlyGlobalGroup },
     { OMR::earlyLocalGroup },
@@ -442,6 +448,7 @@ static const OptimizationStrategy fullHotStrategyOpts[] = {
     { OMR::loopReplicator }, // tail-duplication in loops
     { OMR::blockSplitter }, // treeSimplification + blockSplitter + VP => opportunity for EA
     { OMR::arrayPrivatizationGroup }, // must preceed escape analysis
+    { OMR::allocationEscapeAnalysis },
     { OMR::veryExpensiveGlobalValuePropagationGroup },
     { OMR::globalDeadStoreGroup },
     { OMR::globalCopyPropagation },
@@ -467,6 +474,7 @@ static const OptimizationStrategy fullHotStrategyOpts[] = {
     { OMR::trivialBlockExtension },
     { OMR::localDeadStoreElimination }, //  remove the astore if no literal pool is required
     { OMR::localCSE }, //  common up lit pool refs in the same block
+    { OMR::slpVectorization }, // after unrolling and commoning have exposed adjacent stores
     { OMR::arraysetStoreElimination },
     { OMR::localValuePropagation, OMR::MarkLastRun },
     { OMR::checkcastAndProfiledGuardCoalescer },
@@ -21,6 +21,7 @@
 
 #include "optimizer/LocalCSE.hpp"
 
+#include <algorithm>
 #include <stdlib.h>
 #include <string.h>
 #include "codegen/CodeGenerator.hpp"
@@ -64,6 +65,7 @@
 #define MAX_COPY_PROP 400
 #define REPLACE_MARKER (MAX_SCOUNT - 2)
 #define NUM_BUCKETS 107
+#define MAX_HASH_BUCKETS 4096
 
 #define VOLATILE_ONLY 0
 #define NON_VOLATILE_ONLY 1
@@ -145,6 +147,7 @@ int32_t OMR::LocalCSE::perform()
 
     TR::Region &stackRegion = comp()->trMemory()->currentStackRegion();
     _storeMap = new (stackRegion) StoreMap((StoreMapComparator()), StoreMapAllocator(stackRegion));
+    allocateHashTables(stackRegion);
 
     TR::TreeTop *tt, *exitTreeTop;
     for (tt = comp()->getStartTree(); tt; tt = exitTreeTop->getNextTreeTop()) {
@@ -193,6 +196,7 @@ void OMR::LocalCSE::prePerformOnBlocks()
 {
     TR::Region &stackRegion = comp()->trMemory()->currentStackRegion();
     _storeMap = new (stackRegion) StoreMap((StoreMapComparator()), StoreMapAllocator(stackRegion));
+    allocateHashTables(stackRegion);
 
     int32_t symRefCount = 0; // comp()->getSymRefCount();
     int32_t nodeCount = 0; // comp()->getNodeCount();
@@ -293,10 +297,13 @@ void OMR::LocalCSE::transformBlock(TR::TreeTop *entryTree, TR::TreeTop *exitTree
     memset(_replacedNodesAsArray, 0, _numNodes * sizeof(TR::Node *));
     memset(_replacedNodesByAsArray, 0, _numNodes * sizeof(TR::Node *));
 
-    _hashTable = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-    _hashTableWithSyms = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-    _hashTableWithCalls = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
-    _hashTableWithConsts = new (stackMemoryRegion) HashTable(std::less<int32_t>(), stackMemoryRegion);
+    // The hash tables are allocated once per pass; clearing them only touches
+    // the buckets the previous block used
+    //
+    _hashTable->clear();
+    _hashTableWithSyms->clear();
+    _hashTableWithCalls->clear();
+    _hashTableWithConsts->clear();
 
     _nextReplacedNode = 0;
     TR_BitVector seenAvailableLoadedSymbolReferences(stackMemoryRegion);
@@ -1201,10 +1208,8 @@ TR::Node *OMR::LocalCSE::getAvailableExpression(TR::Node *parent, TR::Node *node
         hashTable = _hashTable;
 
     int32_t hashValue = hash(parent, node);
-    auto range = hashTable->equal_range(hashValue);
-
-    for (auto it = range.first; it != range.second;) {
-        TR::Node *other = it->second;
+    for (HashTable::Entry *entry = hashTable->first(hashValue); entry; entry = hashTable->next(entry)) {
+        TR::Node *other = entry->_node;
         bool remove = false;
         if (areSyntacticallyEquivalent(other, node, &remove)) {
             logprintf(trace(), log, "node %p is syntactically equivalent to other %p\n", node, other);
@@ -1213,13 +1218,8 @@ TR::Node *OMR::LocalCSE::getAvailableExpression(TR::Node *parent, TR::Node *node
 
         if (remove) {
             logprintf(trace(), log, "remove is true, removing entry %p\n", other);
-            auto nextIt = it;
-            ++nextIt;
-            hashTable->erase(it);
-            it = nextIt;
+            hashTable->erase(entry);
             _killedNodes.set(other->getGlobalIndex());
-        } else {
-            ++it;
         }
     }
 
@@ -1330,14 +1330,9 @@ void OMR::LocalCSE::killAvailableExpressionsUsingBitVector(HashTable *hashTable,
     TR_BitVectorIterator bvi(vec);
     while (bvi.hasMoreElements()) {
         int32_t nextSymRefNum = bvi.getNextElement();
-        auto range = hashTable->equal_range(nextSymRefNum);
-        if (range.first != range.second) {
-            auto lastItem = range.second;
-            --lastItem;
-            _killedNodes.set(lastItem->second->getGlobalIndex());
-
-            hashTable->erase(range.first, range.second);
-        }
+        TR::Node *lastNode = hashTable->eraseKey(nextSymRefNum);
+        if (lastNode)
+            _killedNodes.set(lastNode->getGlobalIndex());
     }
 }
 
@@ -1519,26 +1514,129 @@ void OMR::LocalCSE::addToHashTable(TR::Node *node, int32_t hashValue)
         _arrayRefNodes->add(node);
     }
 
-    auto pair = std::make_pair(hashValue, node);
-
     if (node->getOpCode().hasSymbolReference() && ((node->getOpCodeValue() != TR::loadaddr) || _loadaddrAsLoad)) {
         if (node->getOpCode().isCall()) {
-            _hashTableWithCalls->insert(pair);
+            _hashTableWithCalls->insert(hashValue, node);
             _availableCallExprs.set(node->getSymbolReference()->getReferenceNumber());
         } else {
-            _hashTableWithSyms->insert(pair);
+            _hashTableWithSyms->insert(hashValue, node);
             _availableLoadExprs.set(node->getSymbolReference()->getReferenceNumber());
         }
     } else if (node->getOpCode().isLoadConst())
-        _hashTableWithConsts->insert(pair);
+        _hashTableWithConsts->insert(hashValue, node);
     else
-        _hashTable->insert(pair);
+        _hashTable->insert(hashValue, node);
 }
 
 void OMR::LocalCSE::removeFromHashTable(HashTable *hashTable, int32_t hashValue)
 {
-    auto range = hashTable->equal_range(hashValue);
-    hashTable->erase(range.first, range.second);
+    hashTable->eraseKey(hashValue);
+}
+
+void OMR::LocalCSE::allocateHashTables(TR::Region &region)
+{
+    int32_t numBuckets = std::max<int32_t>(comp()->getSymRefCount(), NUM_BUCKETS);
+    _hashTable = new (region) HashTable(region, numBuckets);
+    _hashTableWithSyms = new (region) HashTable(region, numBuckets);
+    _hashTableWithCalls = new (region) HashTable(region, numBuckets);
+    _hashTableWithConsts = new (region) HashTable(region, numBuckets);
+}
+
+OMR::LocalCSE::HashTable::HashTable(TR::Region &region, int32_t minBuckets)
+    : _region(region)
+    , _numOccupied(0)
+    , _shift(32)
+    , _freeEntries(NULL)
+{
+    uint32_t numBuckets = 1;
+    while (numBuckets < (uint32_t)minBuckets && numBuckets < MAX_HASH_BUCKETS) {
+        numBuckets <<= 1;
+        _shift--;
+    }
+
+    // A single bucket would need a shift by 32, which is undefined
+    //
+    if (numBuckets == 1) {
+        numBuckets = 2;
+        _shift = 31;
+    }
+
+    _buckets = (Entry **)region.allocate(numBuckets * sizeof(Entry *));
+    _tails = (Entry **)region.allocate(numBuckets * sizeof(Entry *));
+    _occupied = (uint32_t *)region.allocate(numBuckets * sizeof(uint32_t));
+    _isOccupied = (uint8_t *)region.allocate(numBuckets * sizeof(uint8_t));
+    memset(_buckets, 0, numBuckets * sizeof(Entry *));
+    memset(_tails, 0, numBuckets * sizeof(Entry *));
+    memset(_isOccupied, 0, numBuckets * sizeof(uint8_t));
+}
+
+void OMR::LocalCSE::HashTable::insert(int32_t key, TR::Node *node)
+{
+    Entry *entry = _freeEntries;
+    if (entry)
+        _freeEntries = entry->_next;
+    else
+        entry = (Entry *)_region.allocate(sizeof(Entry));
+
+    entry->_next = NULL;
+    entry->_key = key;
+    entry->_node = node;
+
+    uint32_t b = bucketFor(key);
+    if (_tails[b])
+        _tails[b]->_next = entry;
+    else
+        _buckets[b] = entry;
+    _tails[b] = entry;
+
+    if (!_isOccupied[b]) {
+        _isOccupied[b] = 1;
+        _occupied[_numOccupied++] = b;
+    }
+}
+
+TR::Node *OMR::LocalCSE::HashTable::eraseKey(int32_t key)
+{
+    uint32_t b = bucketFor(key);
+    TR::Node *lastNode = NULL;
+    Entry *prev = NULL;
+    Entry *entry = _buckets[b];
+    while (entry) {
+        Entry *next = entry->_next;
+        if (entry->_key == key) {
+            if (entry->_node)
+                lastNode = entry->_node;
+
+            if (prev)
+                prev->_next = next;
+            else
+                _buckets[b] = next;
+
+            entry->_next = _freeEntries;
+            _freeEntries = entry;
+        } else {
+            prev = entry;
+        }
+        entry = next;
+    }
+
+    _tails[b] = prev;
+    return lastNode;
+}
+
+void OMR::LocalCSE::HashTable::clear()
+{
+    for (uint32_t i = 0; i < _numOccupied; i++) {
+        uint32_t b = _occupied[i];
+        if (_tails[b]) {
+            _tails[b]->_next = _freeEntries;
+            _freeEntries = _buckets[b];
+        }
+        _buckets[b] = NULL;
+        _tails[b] = NULL;
+        _isOccupied[b] = 0;
+    }
+    _numOccupied = 0;
 }
 
 // Returns true if the two subtrees are exactly the same syntactically
@@ -83,8 +83,61 @@ public:
     virtual void postPerformOnBlocks();
     virtual const char *optDetailString() const throw();
 
-    typedef TR::typed_allocator<std::pair<const int32_t, TR::Node *>, TR::Region &> HashTableAllocator;
-    typedef std::multimap<int32_t, TR::Node *, std::less<int32_t>, HashTableAllocator> HashTable;
+    /**
+     * Table of available expressions keyed by their LocalCSE hash value.
+     *
+     * Keys are bucketed into a power-of-two array so that lookup, insertion
+     * and removal of a key are constant time. Entries with the same key are
+     * kept in insertion order, which the commoning and kill logic rely on.
+     * Entries removed while scanning a key are only marked dead; their storage
+     * is recycled when the key or the whole table is cleared.
+     */
+    class HashTable {
+    public:
+        struct Entry {
+            Entry *_next;
+            int32_t _key;
+            TR::Node *_node;
+        };
+
+        HashTable(TR::Region &region, int32_t minBuckets);
+
+        void insert(int32_t key, TR::Node *node);
+
+        // Iteration over the live entries for a key, oldest first
+        //
+        Entry *first(int32_t key) { return nextLive(_buckets[bucketFor(key)], key); }
+
+        Entry *next(Entry *entry) { return nextLive(entry->_next, entry->_key); }
+
+        void erase(Entry *entry) { entry->_node = NULL; }
+
+        // Removes every entry for a key and returns the most recently inserted
+        // live node for that key, or NULL if there was none
+        //
+        TR::Node *eraseKey(int32_t key);
+
+        void clear();
+
+    private:
+        uint32_t bucketFor(int32_t key) const { return ((uint32_t)key * 2654435761U) >> _shift; }
+
+        Entry *nextLive(Entry *entry, int32_t key)
+        {
+            while (entry && (entry->_key != key || entry->_node == NULL))
+                entry = entry->_next;
+            return entry;
+        }
+
+        TR::Region &_region;
+        Entry **_buckets;
+        Entry **_tails;
+        uint32_t *_occupied;
+        uint8_t *_isOccupied;
+        uint32_t _numOccupied;
+        uint32_t _shift;
+        Entry *_freeEntries;
+    };
 
 protected:
     virtual bool shouldTransformBlock(TR::Block *block);
@@ -102,6 +155,7 @@ protected:
 protected:
     bool doExtraPassForVolatiles();
     int32_t hash(TR::Node *parent, TR::Node *node);
+    void allocateHashTables(TR::Region &region);
     void addToHashTable(TR::Node *node, int32_t hashValue);
     void removeFromHashTable(HashTable *hashTable, int32_t hashValue);
     TR::Node *replaceCopySymbolReferenceByOriginalIn(TR::SymbolReference *, /* TR::SymbolReference *,*/ TR::Node *,
@@ -114,11 +114,15 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
             _flags.set(requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs);
             break;
         case OMR::deadTreesElimination:
+            // Never reads use/def info, and reports the nodes it creates and
+            // removes, so the info already built is kept across it
+            _flags.set(maintainsUseDefInfo);
             break;
         case OMR::constRefPrivatization:
             _flags.set(requiresStructure);
             break;
         case OMR::tacticalGlobalRegisterAllocator:
+        case OMR::linearScanGlobalRegisterAllocator:
             _flags.set(requiresStructure);
             if (self()->comp()->getMethodHotness() >= hot && o->comp()->target().is64Bit())
                 _flags.set(requiresLocalsUseDefInfo | doesNotRequireLoadsAsDefs);
@@ -217,6 +221,9 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
         case OMR::virtualGuardHeadMerger:
             _flags.set(doesNotRequireAliasSets);
             break;
+        case OMR::blockFrequencyProfiler:
+            _flags.set(doesNotRequireAliasSets | doNotSetFrequencies | verifyTrees | verifyBlocks);
+            break;
         default:
             // do nothing
             break;
@@ -1900,6 +1900,44 @@ static void assign_candidate_loop_trace_increment(TR::Compilation *comp, TR::Reg
     }
 }
 
+bool OMR::RegisterCandidates::isAllocatable(TR::RegisterCandidate *rc, bool trace)
+{
+    OMR::Logger *log = comp()->log();
+    TR::DataType type = rc->getType();
+    TR::DataType dt = rc->getDataType();
+
+    if (type.isInt64() && comp()->cg()->getDisableLongGRA()) {
+        logprints(trace, log, "Leaving candidate because LongGRA is disabled and candidate is 64 bit\n");
+        return false;
+    }
+
+    if (dt == TR::Aggregate && (1 || rc->getSymbolReference()->getSymbol()->getSize() > 8)) {
+        logprints(trace, log, "Leaving candidate because its an aggregate and > 64 bits\n");
+        return false;
+    }
+
+    if ((!rc->getSymbolReference()->getSymbol()->isAutoOrParm())
+        || rc->getSymbolReference()->getSymbol()->holdsMonitoredObject()) {
+        logprints(trace, log, "Leaving candidate because it holdsMonitoredObject\n");
+        return false; // todo: handle statics and fields?
+    }
+
+    // exclude symbols that can define other symbols
+    if (aliasesPreventAllocation(comp(), rc->getSymbolReference())) {
+        logprints(trace, log, "Leaving candidate because it has use_def_aliases\n");
+        return false;
+    }
+
+    if ((dt.isVector() || dt.isMask()) && !comp()->cg()->hasGlobalVRF()) {
+        logprintf(trace, log, "Leaving candidate because it has %s type but no global vector registers provided\n",
+            TR::DataType::getName(dt));
+        TR_ASSERT(!comp()->target().cpu.isZ(), "ed : debug : Should never get here for vector GRA on z");
+        return false;
+    }
+
+    return true;
+}
+
 bool OMR::RegisterCandidates::assign(TR::Block **cfgBlocks, int32_t numberOfBlocks, int32_t &lowestNumber,
     int32_t &highestNumber)
 {
@@ -2263,37 +2301,10 @@ bool OMR::RegisterCandidates::assign(TR::Block **cfgBlocks, int32_t numberOfBloc
             }
         }
 
-        TR::DataType type = rc->getType();
         TR::DataType dt = rc->getDataType();
 
-        if (type.isInt64() && cg->getDisableLongGRA()) {
-            logprints(trace, log, "Leaving candidate because LongGRA is disabled and candidate is 64 bit\n");
-            continue;
-        }
-
-        if (dt == TR::Aggregate && (1 || rc->getSymbolReference()->getSymbol()->getSize() > 8)) {
-            logprints(trace, log, "Leaving candidate because its an aggregate and > 64 bits\n");
+        if (!isAllocatable(rc, trace))
             continue;
-        }
-
-        if ((!rc->getSymbolReference()->getSymbol()->isAutoOrParm())
-            || rc->getSymbolReference()->getSymbol()->holdsMonitoredObject()) {
-            logprints(trace, log, "Leaving candidate because it holdsMonitoredObject\n");
-            continue; // todo: handle statics and fields?
-        }
-
-        // exclude symbols that can define other symbols
-        if (aliasesPreventAllocation(comp(), rc->getSymbolReference())) {
-            logprints(trace, log, "Leaving candidate because it has use_def_aliases\n");
-            continue;
-        }
-
-        if ((dt.isVector() || dt.isMask()) && !comp()->cg()->hasGlobalVRF()) {
-            logprintf(trace, log, "Leaving candidate because it has %s type but no global vector registers provided\n",
-                TR::DataType::getName(dt));
-            TR_ASSERT(!comp()->target().cpu.isZ(), "ed : debug : Should never get here for vector GRA on z");
-            continue;
-        }
 
         // don't put this auto into a global register if it can be accessed from a catch clause
         //
@@ -3208,6 +3219,458 @@ bool OMR::RegisterCandidates::assign(TR::Block **cfgBlocks, int32_t numberOfBloc
     return globalFPAssignmentDone;
 }
 
+namespace {
+
+enum LinearScanRegisterKind {
+    LinearScanGPR = 0,
+    LinearScanFPR,
+    LinearScanVRF,
+    NumLinearScanRegisterKinds
+};
+
+/**
+ * Live range of a register candidate for the linear scan assigner.  Its
+ * span is the range of extended blocks, in tree order, across whose entry
+ * or exit the candidate is live.  Candidates whose spans do not overlap
+ * never share a block and can be given the same global register.
+ */
+struct LinearScanInterval {
+    TR::RegisterCandidate *_rc;
+    int32_t _start;
+    int32_t _end;
+    int32_t _kind;
+    bool _needs2Regs;
+    TR_GlobalRegisterNumber _lowRegister;
+    TR_GlobalRegisterNumber _highRegister;
+};
+
+struct LinearScanIntervalOrder {
+    bool operator()(const LinearScanInterval *a, const LinearScanInterval *b) const
+    {
+        if (a->_start != b->_start)
+            return a->_start < b->_start;
+        return a->_rc->getWeight() > b->_rc->getWeight();
+    }
+};
+
+} // namespace
+
+static bool fitsAcrossExits(LinearScanInterval *interval, int32_t **liveOnExitCount, int32_t **maxLiveOnExit)
+{
+    int32_t numRegs = interval->_needs2Regs ? 2 : 1;
+    int32_t *count = liveOnExitCount[interval->_kind];
+    int32_t *max = maxLiveOnExit[interval->_kind];
+    TR_BitVectorIterator bvi(interval->_rc->getBlocksLiveOnExit());
+    while (bvi.hasMoreElements()) {
+        int32_t blockNum = bvi.getNextElement();
+        if (count[blockNum] > max[blockNum] - numRegs)
+            return false;
+    }
+    return true;
+}
+
+static void adjustLiveOnExitCounts(LinearScanInterval *interval, int32_t **liveOnExitCount, int32_t delta)
+{
+    int32_t numRegs = interval->_needs2Regs ? 2 : 1;
+    int32_t *count = liveOnExitCount[interval->_kind];
+    TR_BitVectorIterator bvi(interval->_rc->getBlocksLiveOnExit());
+    while (bvi.hasMoreElements())
+        count[bvi.getNextElement()] += delta * numRegs;
+}
+
+bool OMR::RegisterCandidates::assignLinearScan(TR::Block **cfgBlocks, int32_t numberOfBlocks, int32_t &lowestNumber,
+    int32_t &highestNumber)
+{
+    LexicalTimer t("assignLinearScan", comp()->phaseTimer());
+
+    OMR::Logger *log = comp()->log();
+    bool trace = comp()->getOptions()->trace(OMR::linearScanGlobalRegisterAllocator);
+    TR::CodeGenerator *cg = comp()->cg();
+    TR::Block **blocks = cfgBlocks;
+
+    bool globalFPAssignmentDone = false;
+    highestNumber = -1;
+    lowestNumber = INT_MAX;
+
+    if (!_candidates.getFirst())
+        return globalFPAssignmentDone;
+
+    // Number the extended blocks in tree order and collect the block
+    // properties that candidate weights and exception handling depend on
+    //
+    int32_t *extendedBlockIndex = (int32_t *)trMemory()->allocateStackMemory(numberOfBlocks * sizeof(int32_t));
+    int32_t *blockStructureWeight = (int32_t *)trMemory()->allocateStackMemory(numberOfBlocks * sizeof(int32_t));
+    memset(extendedBlockIndex, 0, numberOfBlocks * sizeof(int32_t));
+    memset(blockStructureWeight, 0, numberOfBlocks * sizeof(int32_t));
+
+    TR_BitVector catchBlockLiveLocals(comp()->getSymRefCount(), trMemory(), stackAlloc, growable);
+    bool catchBlockLiveLocalsExist = false;
+    bool hasCatchBlocks = false;
+    int32_t numberOfExtendedBlocks = 0;
+    for (TR::Block *block = comp()->getStartBlock(); block; block = block->getNextBlock()) {
+        if (!block->isExtensionOfPreviousBlock())
+            numberOfExtendedBlocks++;
+        extendedBlockIndex[block->getNumber()] = numberOfExtendedBlocks - 1;
+
+        if (block->getStructureOf()) {
+            int32_t blockWeight = 1;
+            TR::Optimizer *optimizer = (TR::Optimizer *)comp()->getOptimizer();
+            optimizer->getStaticFrequency(block, &blockWeight);
+            blockStructureWeight[block->getNumber()] = blockWeight;
+        }
+
+        if (!block->getExceptionPredecessors().empty()) {
+            hasCatchBlocks = true;
+            TR_BitVector *liveLocals = block->getLiveLocals();
+            if (cg->getLiveLocals() && liveLocals) {
+                catchBlockLiveLocalsExist = true;
+                catchBlockLiveLocals |= *liveLocals;
+            }
+        }
+    }
+
+    collectCfgProperties(blocks, numberOfBlocks);
+
+    TR_Array<int32_t> totalGPRCount(trMemory(), numberOfBlocks, true, stackAlloc);
+    TR_Array<int32_t> totalFPRCount(trMemory(), numberOfBlocks, true, stackAlloc);
+    TR_Array<int32_t> totalVRFCount(trMemory(), numberOfBlocks, true, stackAlloc);
+    for (int32_t i = 0; i < numberOfBlocks; ++i) {
+        totalGPRCount[i] = 0;
+        totalFPRCount[i] = 0;
+        totalVRFCount[i] = 0;
+    }
+    TR_BitVector referencedBlocks(numberOfBlocks, trMemory(), stackAlloc, growable);
+
+    // Compute the live range of every candidate and turn it into an interval
+    //
+    int32_t numCandidates = 0;
+    for (TR::RegisterCandidate *rc = _candidates.getFirst(); rc; rc = rc->getNext())
+        numCandidates++;
+
+    LinearScanInterval *intervals
+        = (LinearScanInterval *)trMemory()->allocateStackMemory(numCandidates * sizeof(LinearScanInterval));
+    LinearScanInterval **order
+        = (LinearScanInterval **)trMemory()->allocateStackMemory(numCandidates * sizeof(LinearScanInterval *));
+    int32_t numIntervals = 0;
+
+    for (TR::RegisterCandidate *rc = _candidates.getFirst(); rc; rc = rc->getNext()) {
+        rc->setWeight(blocks, blockStructureWeight, comp(), totalGPRCount, totalFPRCount, totalVRFCount,
+            &referencedBlocks, _startOfExtendedBBForBB, _firstBlock, _isExtensionOfPreviousBlock);
+
+        TR::DataType dt = rc->getDataType();
+        bool isFloat = (dt == TR::Float || dt == TR::Double);
+        bool isVector = dt.isVector() || dt.isMask();
+        bool needs2Regs = rc->rcNeeds2Regs(comp());
+
+        TR_Array<int32_t> &totalCount = isFloat ? totalFPRCount : (isVector ? totalVRFCount : totalGPRCount);
+        TR_BitVectorIterator exits(rc->getBlocksLiveOnExit());
+        while (exits.hasMoreElements())
+            totalCount[exits.getNextElement()] += needs2Regs ? 2 : 1;
+
+        if (!isAllocatable(rc, trace))
+            continue;
+
+        if (isFloat && cg->getDisableFloatingPointGRA())
+            continue;
+
+        // Keep the value in memory as well if an exception handler can see it, and
+        // never expect it in a register on entry to a catch block
+        //
+        TR::Symbol *sym = rc->getSymbol();
+        if ((catchBlockLiveLocalsExist && sym->isAuto()
+                && catchBlockLiveLocals.get(sym->getAutoSymbol()->getLiveLocalIndex()))
+            || ((!catchBlockLiveLocalsExist || !sym->isAuto())
+                && !rc->getSymbolReference()->getUseonlyAliases().isZero(comp())))
+            rc->setLiveAcrossExceptionEdge(true);
+
+        if (hasCatchBlocks) {
+            TR_BitVectorIterator entries(rc->getBlocksLiveOnEntry());
+            while (entries.hasMoreElements()) {
+                int32_t blockNum = entries.getNextElement();
+                if (!blocks[blockNum]->getExceptionPredecessors().empty())
+                    rc->getBlocksLiveOnEntry().reset(blockNum);
+            }
+        }
+
+        int32_t start = INT_MAX;
+        int32_t end = -1;
+        TR_BitVectorIterator bvi(rc->getBlocksLiveOnEntry());
+        while (bvi.hasMoreElements()) {
+            int32_t index = extendedBlockIndex[bvi.getNextElement()];
+            start = std::min(start, index);
+            end = std::max(end, index);
+        }
+        bvi.setBitVector(rc->getBlocksLiveOnExit());
+        while (bvi.hasMoreElements()) {
+            int32_t index = extendedBlockIndex[bvi.getNextElement()];
+            start = std::min(start, index);
+            end = std::max(end, index);
+        }
+
+        if (end < 0) {
+            logprintf(trace, log, "Leaving candidate #%d because it is not live across any block boundary\n",
+                rc->getSymbolReference()->getReferenceNumber());
+            continue;
+        }
+
+        LinearScanInterval *interval = &intervals[numIntervals];
+        interval->_rc = rc;
+        interval->_start = start;
+        interval->_end = end;
+        interval->_kind = isFloat ? LinearScanFPR : (isVector ? LinearScanVRF : LinearScanGPR);
+        interval->_needs2Regs = needs2Regs;
+        interval->_lowRegister = -1;
+        interval->_highRegister = -1;
+        order[numIntervals++] = interval;
+    }
+
+    std::sort(order, order + numIntervals, LinearScanIntervalOrder());
+
+    // Per register class limits on the number of registers live across the
+    // exit of each block, as imposed by the code generator
+    //
+    int32_t *liveOnExitCount[NumLinearScanRegisterKinds];
+    int32_t *maxLiveOnExit[NumLinearScanRegisterKinds];
+    for (int32_t kind = 0; kind < NumLinearScanRegisterKinds; ++kind) {
+        liveOnExitCount[kind] = (int32_t *)trMemory()->allocateStackMemory(numberOfBlocks * sizeof(int32_t));
+        maxLiveOnExit[kind] = (int32_t *)trMemory()->allocateStackMemory(numberOfBlocks * sizeof(int32_t));
+        memset(liveOnExitCount[kind], 0, numberOfBlocks * sizeof(int32_t));
+        memset(maxLiveOnExit[kind], 0, numberOfBlocks * sizeof(int32_t));
+    }
+
+    for (TR::Block *b = comp()->getStartBlock(); b; b = b->getNextBlock()) {
+        int32_t blockNumber = b->getNumber();
+        TR::Node *node = b->getLastRealTreeTop()->getNode();
+        maxLiveOnExit[LinearScanGPR][blockNumber] = cg->getMaximumNumberOfGPRsAllowedAcrossEdge(b);
+        maxLiveOnExit[LinearScanFPR][blockNumber] = cg->getMaximumNumberOfFPRsAllowedAcrossEdge(node);
+        maxLiveOnExit[LinearScanVRF][blockNumber] = cg->getMaximumNumberOfVRFsAllowedAcrossEdge(node);
+    }
+
+    int32_t firstRegister[NumLinearScanRegisterKinds]
+        = { cg->getFirstGlobalGPR(), cg->getFirstGlobalFPR(), cg->getFirstGlobalVRF() };
+    int32_t lastRegister[NumLinearScanRegisterKinds]
+        = { cg->getLastGlobalGPR(), cg->getLastGlobalFPR(), cg->getLastGlobalVRF() };
+
+    // Registers the code generator reserves on entry to or exit from particular blocks
+    //
+    int32_t numberOfGlobalRegisters = cg->getNumberOfGlobalRegisters();
+    _liveOnEntryUsage.init(trMemory(), numberOfGlobalRegisters, true, stackAlloc);
+    _liveOnExitUsage.init(trMemory(), numberOfGlobalRegisters, true, stackAlloc);
+    for (int32_t i = _liveOnEntryUsage.internalSize() - 1; i >= 0; --i) {
+        _liveOnEntryUsage[i].init(numberOfBlocks, trMemory(), stackAlloc, growable);
+        _liveOnExitUsage[i].init(numberOfBlocks, trMemory(), stackAlloc, growable);
+    }
+    cg->setUnavailableRegistersUsage(_liveOnEntryUsage, _liveOnExitUsage);
+
+    TR_BitVector reservedRegisters(numberOfGlobalRegisters, trMemory(), stackAlloc);
+    for (int32_t i = 0; i < numberOfGlobalRegisters; ++i) {
+        if (!_liveOnEntryUsage[i].isEmpty() || !_liveOnExitUsage[i].isEmpty())
+            reservedRegisters.set(i);
+    }
+
+    LinearScanInterval **active
+        = (LinearScanInterval **)trMemory()->allocateStackMemory(numberOfGlobalRegisters * sizeof(LinearScanInterval *));
+    memset(active, 0, numberOfGlobalRegisters * sizeof(LinearScanInterval *));
+
+    bool enableVectorGRA = cg->getSupportsVectorRegisters() && !comp()->getOption(TR_DisableVectorRegGRA);
+    int32_t entryBlockNumber = comp()->getStartBlock()->getNumber();
+    TR_BitVector allowedRegisters(numberOfGlobalRegisters, trMemory(), stackAlloc);
+    TR_BitVector availableRegisters(numberOfGlobalRegisters, trMemory(), stackAlloc);
+
+    // pickRegister looks up the registers of the candidates it meets through
+    // the candidate list, so as in the tactical assigner only candidates that
+    // currently hold a register are kept on it during the walk
+    //
+    _candidates.setFirst(0);
+    _candidateForSymRefs->clear();
+
+    // Walk the intervals in order of their start, giving each a register that
+    // is not held by an overlapping interval.  When none is left, the register
+    // of the lightest overlapping interval is taken over if this one is heavier.
+    //
+    for (int32_t i = 0; i < numIntervals; ++i) {
+        if ((i & 0xff) == 0xff && comp()->compilationShouldBeInterrupted(GRA_ASSIGN_CONTEXT))
+            comp()->failCompilation<TR::CompilationInterrupted>("interrupted in GRA");
+
+        LinearScanInterval *interval = order[i];
+        TR::RegisterCandidate *rc = interval->_rc;
+        TR::Symbol *sym = rc->getSymbol();
+        int32_t kind = interval->_kind;
+
+        if (!fitsAcrossExits(interval, liveOnExitCount, maxLiveOnExit)) {
+            logprintf(trace, log, "Leaving candidate #%d because too many registers are live across one of its exits\n",
+                rc->getSymbolReference()->getReferenceNumber());
+            continue;
+        }
+
+        allowedRegisters.empty();
+        for (int32_t reg = firstRegister[kind]; reg <= lastRegister[kind]; ++reg) {
+            if (!cg->isGlobalRegisterAvailable(reg, rc->getDataType()))
+                continue;
+            if (reservedRegisters.get(reg)
+                && (_liveOnEntryUsage[reg].intersects(rc->getBlocksLiveOnEntry())
+                    || _liveOnExitUsage[reg].intersects(rc->getBlocksLiveOnExit())))
+                continue;
+            allowedRegisters.set(reg);
+        }
+
+        // A parameter live on entry to the method can only be kept in its own linkage register
+        //
+        if (sym->isParm() && rc->getBlocksLiveOnEntry().get(entryBlockNumber)) {
+            int8_t lri = sym->getParmSymbol()->getLinkageRegisterIndex();
+            if (lri >= 0) {
+                TR_GlobalRegisterNumber parmReg = cg->getLinkageGlobalRegisterNumber(lri, sym->getDataType());
+                TR_BitVectorIterator linkageRegs(*cg->getGlobalRegisters(TR_linkageSpill, TR_System));
+                while (linkageRegs.hasMoreElements()) {
+                    int32_t reg = linkageRegs.getNextElement();
+                    if (reg != parmReg)
+                        allowedRegisters.reset(reg);
+                }
+            }
+        }
+
+        cg->removeUnavailableRegisters(rc, blocks, allowedRegisters);
+
+        availableRegisters = allowedRegisters;
+        for (int32_t reg = firstRegister[kind]; reg <= lastRegister[kind]; ++reg) {
+            if (active[reg] && active[reg]->_end >= interval->_start)
+                availableRegisters.reset(reg);
+        }
+
+        if (enableVectorGRA) {
+            for (int32_t reg = firstRegister[kind]; reg <= lastRegister[kind]; ++reg) {
+                if ((cg->isGlobalFPR(reg) || cg->isGlobalVRF(reg)) && cg->isAliasedGRN(reg)
+                    && !availableRegisters.isSet(cg->getOverlappedAliasForGRN(reg))) {
+                    availableRegisters.reset(cg->getOverlappedAliasForGRN(reg));
+                    availableRegisters.reset(reg);
+                }
+            }
+        }
+
+        TR_GlobalRegisterNumber otherRegisterNumber = 0;
+        TR_GlobalRegisterNumber registerNumber
+            = cg->pickRegister(rc, blocks, availableRegisters, otherRegisterNumber, &_candidates);
+        TR_GlobalRegisterNumber highRegisterNumber = -1;
+        if (interval->_needs2Regs && registerNumber > -1) {
+            otherRegisterNumber = 1;
+            availableRegisters.reset(registerNumber);
+            highRegisterNumber = cg->pickRegister(rc, blocks, availableRegisters, otherRegisterNumber, &_candidates);
+            if (highRegisterNumber == -1)
+                registerNumber = -1;
+        }
+
+        if (registerNumber == -1 && !interval->_needs2Regs) {
+            LinearScanInterval *victim = NULL;
+            for (int32_t reg = firstRegister[kind]; reg <= lastRegister[kind]; ++reg) {
+                LinearScanInterval *holder = active[reg];
+                if (!holder || holder->_end < interval->_start || holder->_needs2Regs || !allowedRegisters.get(reg)
+                    || holder->_rc->getWeight() >= rc->getWeight())
+                    continue;
+                if (!victim || holder->_rc->getWeight() < victim->_rc->getWeight())
+                    victim = holder;
+            }
+
+            if (victim) {
+                adjustLiveOnExitCounts(victim, liveOnExitCount, -1);
+                if (fitsAcrossExits(interval, liveOnExitCount, maxLiveOnExit)) {
+                    availableRegisters.empty();
+                    availableRegisters.set(victim->_lowRegister);
+                    otherRegisterNumber = 0;
+                    registerNumber = cg->pickRegister(rc, blocks, availableRegisters, otherRegisterNumber, &_candidates);
+                }
+
+                if (registerNumber == -1) {
+                    adjustLiveOnExitCounts(victim, liveOnExitCount, 1);
+                } else {
+                    logprintf(trace, log, "Candidate #%d (weight %d) takes register %d from candidate #%d (weight %d)\n",
+                        rc->getSymbolReference()->getReferenceNumber(), rc->getWeight(), registerNumber,
+                        victim->_rc->getSymbolReference()->getReferenceNumber(), victim->_rc->getWeight());
+                    active[registerNumber] = NULL;
+                    victim->_lowRegister = -1;
+                    victim->_rc->setGlobalRegisterNumber(-1);
+                    _candidates.remove(victim->_rc);
+                    _candidateForSymRefs->clear();
+                }
+            }
+        }
+
+        if (registerNumber == -1) {
+            logprintf(trace, log, "Leaving candidate #%d (weight %d) because no register is free over [%d,%d]\n",
+                rc->getSymbolReference()->getReferenceNumber(), rc->getWeight(), interval->_start, interval->_end);
+            continue;
+        }
+
+        interval->_lowRegister = registerNumber;
+        interval->_highRegister = highRegisterNumber;
+        active[registerNumber] = interval;
+        if (highRegisterNumber > -1)
+            active[highRegisterNumber] = interval;
+        adjustLiveOnExitCounts(interval, liveOnExitCount, 1);
+        rc->setLowGlobalRegisterNumber(registerNumber);
+        rc->setHighGlobalRegisterNumber(highRegisterNumber);
+        _candidates.add(rc);
+    }
+
+    // Commit the surviving assignments exactly as the tactical assigner does,
+    // so that the IL transformation sees the same per block register state
+    //
+    _candidates.setFirst(0);
+    _candidateForSymRefs->clear();
+    for (int32_t i = 0; i < numIntervals; ++i) {
+        LinearScanInterval *interval = order[i];
+        TR::RegisterCandidate *rc = interval->_rc;
+        TR_GlobalRegisterNumber registerNumber = interval->_lowRegister;
+        TR_GlobalRegisterNumber highRegisterNumber = interval->_highRegister;
+        if (registerNumber == -1)
+            continue;
+
+        if (!performTransformation(comp(), "%s assign auto #%d to reg %d (%s) over extended blocks [%d,%d]\n",
+                OPT_DETAILS, rc->getSymbolReference()->getReferenceNumber(), registerNumber,
+                comp()->getDebug() ? comp()->getDebug()->getGlobalRegisterName(registerNumber) : "?",
+                interval->_start, interval->_end))
+            continue;
+
+        if (interval->_kind == LinearScanFPR)
+            globalFPAssignmentDone = true;
+
+        _candidates.add(rc);
+        (*_candidateForSymRefs)[GET_INDEX_FOR_CANDIDATE_FOR_SYMREF(rc->getSymbolReference())] = rc;
+
+        if (interval->_needs2Regs) {
+            rc->setLowGlobalRegisterNumber(registerNumber);
+            rc->setHighGlobalRegisterNumber(highRegisterNumber);
+        } else
+            rc->setGlobalRegisterNumber(registerNumber);
+
+        rc->setIs8BitGlobalGPR(cg->is8BitGlobalGPR(registerNumber));
+
+        highestNumber = std::max<int32_t>(highestNumber, registerNumber);
+        lowestNumber = std::min<int32_t>(lowestNumber, registerNumber);
+        if (interval->_needs2Regs) {
+            highestNumber = std::max<int32_t>(highestNumber, highRegisterNumber);
+            lowestNumber = std::min<int32_t>(lowestNumber, highRegisterNumber);
+        }
+
+        TR_BitVectorIterator bvi(rc->getBlocksLiveOnEntry());
+        while (bvi.hasMoreElements()) {
+            TR::Block *b = blocks[bvi.getNextElement()];
+            b->getGlobalRegisters(comp())[registerNumber].setRegisterCandidateOnEntry(rc);
+            if (interval->_needs2Regs)
+                b->getGlobalRegisters(comp())[highRegisterNumber].setRegisterCandidateOnEntry(rc);
+        }
+
+        bvi.setBitVector(rc->getBlocksLiveOnExit());
+        while (bvi.hasMoreElements()) {
+            TR::Block *b = blocks[bvi.getNextElement()];
+            b->getGlobalRegisters(comp())[registerNumber].setRegisterCandidateOnExit(rc);
+            if (interval->_needs2Regs)
+                b->getGlobalRegisters(comp())[highRegisterNumber].setRegisterCandidateOnExit(rc);
+        }
+    }
+
+    return globalFPAssignmentDone;
+}
+
 static void ComputeOverlaps(TR::Node *node, TR::Compilation *comp, OMR::RegisterCandidates::Coordinates &overlaps,
     uint32_t &seqno)
 {
@@ -370,6 +370,15 @@ public:
     TR_BitVector *getBlocksReferencingSymRef(uint32_t symRefNum);
 
     virtual bool assign(TR::Block **, int32_t, int32_t &, int32_t &);
+
+    /**
+     * Assign global registers with a single linear scan over the candidates'
+     * live ranges in block order, rather than the iterative prioritized
+     * assignment of assign().  Produces the same per block register state,
+     * trading some allocation quality for compile time that grows linearly
+     * with the number of candidates.
+     */
+    virtual bool assignLinearScan(TR::Block **, int32_t, int32_t &, int32_t &);
     virtual void computeAvailableRegisters(TR::RegisterCandidate *, int32_t, int32_t, TR::Block **, TR_BitVector *);
 
     static int32_t getWeightForType(TR_RegisterCandidateTypes type) { return _candidateTypeWeights[type]; }
@@ -402,6 +411,7 @@ public:
     bool aliasesPreventAllocation(TR::Compilation *comp, TR::SymbolReference *symRef);
 
 protected:
+    bool isAllocatable(TR::RegisterCandidate *, bool trace);
     bool candidatesOverlap(TR::Block *, TR::RegisterCandidate *, TR::RegisterCandidate *, bool);
     void lookForCandidates(TR::Node *, TR::Symbol *, TR::Symbol *, bool &, bool &);
     bool prioritizeCandidate(TR::RegisterCandidate *, TR::RegisterCandidate *&);
@@ -44,6 +44,7 @@
 #include "env/PersistentInfo.hpp"
 #include "env/StackMemoryRegion.hpp"
 #include "env/TRMemory.hpp"
+#include "env/VerboseLog.hpp"
 #include "env/jittypes.h"
 #include "il/Block.hpp"
 #include "il/DataTypes.hpp"
@@ -72,6 +73,8 @@
 #include "optimizer/StructuralAnalysis.hpp"
 #include "optimizer/UseDefInfo.hpp"
 #include "optimizer/ValueNumberInfo.hpp"
+#include "optimizer/AllocationEscapeAnalysis.hpp"
+#include "optimizer/BlockFrequencyProfiler.hpp"
 #include "optimizer/DeadStoreElimination.hpp"
 #include "optimizer/DeadTreesElimination.hpp"
 #include "optimizer/CopyPropagation.hpp"
@@ -84,10 +87,12 @@
 #include "optimizer/Simplifier.hpp"
 #include "optimizer/Inliner.hpp"
 #include "ras/Debug.hpp"
+#include "ras/DebugCounter.hpp"
 #include "optimizer/InductionVariable.hpp"
 #include "optimizer/GlobalValuePropagation.hpp"
 #include "optimizer/LocalValuePropagation.hpp"
 #include "optimizer/RegDepCopyRemoval.hpp"
+#include "optimizer/SLPVectorizer.hpp"
 #include "optimizer/GlobalRegisterAllocator.hpp"
 #include "optimizer/SwitchAnalyzer.hpp"
 #include "env/RegionProfiler.hpp"
@@ -109,6 +114,7 @@ TR_Stats statGlobalValNumTiming("Global Value Numbering");
 
 static const OptimizationStrategy cheapTacticalGlobalRegisterAllocatorOpts[] = {
     { OMR::redundantGotoElimination, OMR::IfNotProfiling }, // need to be run before global register allocator
+    { OMR::linearScanGlobalRegisterAllocator, OMR::IfEnabled }, // must precede tactical GRA; only one of them runs
     { OMR::tacticalGlobalRegisterAllocator, OMR::IfEnabled },
     { OMR::endGroup }
 };
@@ -131,6 +137,7 @@ static const OptimizationStrategy smallNoOptStrategyOpts[] = {
 };
 
 static const OptimizationStrategy smallColdStrategyOpts[] = {
+    { OMR::blockFrequencyProfiler }, // must run before any transformation
     { OMR::deadTreesElimination },
     { OMR::treeSimplification },
     { OMR::localCSE },
@@ -140,10 +147,12 @@ static const OptimizationStrategy smallColdStrategyOpts[] = {
 };
 
 static const OptimizationStrategy smallWarmStrategyOpts[] = {
+    { OMR::blockFrequencyProfiler }, // must run before any transformation
     { OMR::deadTreesElimination },
     { OMR::inlining },
     { OMR::treeSimplification },
     { OMR::localCSE },
+    { OMR::allocationEscapeAnalysis }, // after inlining has exposed allocations and localCSE has commoned their uses
     { OMR::basicBlockOrdering }, // straighten goto's
     { OMR::globalCopyPropagation },
     { OMR::globalDeadStoreElimination, OMR::IfMoreThanOneBlock },
@@ -165,6 +174,7 @@ static const OptimizationStrategy smallWarmStrategyOpts[] = {
     { OMR::basicBlockExtension, OMR::MarkLastRun }, // clean up order and extend blocks now
     { OMR::treeSimplification },
     { OMR::localCSE },
+    { OMR::slpVectorization }, // pack straight-line stores once unrolling and commoning are done
     { OMR::treeSimplification, OMR::IfEnabled },
     { OMR::trivialDeadTreeRemoval, OMR::IfEnabled },
     { OMR::cheapTacticalGlobalRegisterAllocatorGroup },
@@ -227,6 +237,8 @@ OMR::SmallOptimizer::SmallOptimizer(TR::Compilation *comp, TR::ResolvedMethodSym
     , _cantBuildLocalsUseDefInfo(false)
     , _cantBuildGlobalsValueNumberInfo(false)
     , _cantBuildLocalsValueNumberInfo(false)
+    , _numReportedNodes(0)
+    , _useDefInfoNeedsRebuild(false)
     , _canRunBlockByBlockOptimizations(true)
     , _cachedExtendedBBInfoValid(false)
     , _inlineSynchronized(true)
@@ -240,6 +252,10 @@ OMR::SmallOptimizer::SmallOptimizer(TR::Compilation *comp, TR::ResolvedMethodSym
     , _stackedOptimizer(false)
     , _firstTimeStructureIsBuilt(true)
     , _disableLoopOptsThatCanCreateLoops(false)
+    , _budgetProfiler(NULL)
+    , _budgetStartTime(0)
+    , _numOptsSkippedForBudget(0)
+    , _overBudget(false)
 {
     // zero opts table
     memset(_opts, 0, sizeof(_opts));
@@ -291,8 +307,16 @@ OMR::SmallOptimizer::SmallOptimizer(TR::Compilation *comp, TR::ResolvedMethodSym
         TR::OptimizationManager(self(), TR::RegDepCopyRemoval::create, OMR::regDepCopyRemoval);
     _opts[OMR::tacticalGlobalRegisterAllocator] = new (comp->allocator())
         TR::OptimizationManager(self(), TR_GlobalRegisterAllocator::create, OMR::tacticalGlobalRegisterAllocator);
+    _opts[OMR::linearScanGlobalRegisterAllocator] = new (comp->allocator()) TR::OptimizationManager(self(),
+        TR_LinearScanGlobalRegisterAllocator::create, OMR::linearScanGlobalRegisterAllocator);
     _opts[OMR::switchAnalyzer]
         = new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
+    _opts[OMR::blockFrequencyProfiler] = new (comp->allocator())
+        TR::OptimizationManager(self(), TR_BlockFrequencyProfiler::create, OMR::blockFrequencyProfiler);
+    _opts[OMR::allocationEscapeAnalysis] = new (comp->allocator())
+        TR::OptimizationManager(self(), TR_AllocationEscapeAnalysis::create, OMR::allocationEscapeAnalysis);
+    _opts[OMR::slpVectorization]
+        = new (comp->allocator()) TR::OptimizationManager(self(), TR_SLPVectorizer::create, OMR::slpVectorization);
     // NOTE: Please add new OMR optimizations here!
 
     // initialize OMR small optimization groups
@@ -309,6 +333,7 @@ OMR::SmallOptimizer::SmallOptimizer(TR::Compilation *comp, TR::ResolvedMethodSym
     self()->setRequestOptimization(OMR::cheapTacticalGlobalRegisterAllocatorGroup, true);
     self()->setRequestOptimization(OMR::tacticalGlobalRegisterAllocatorGroup, true);
     self()->setRequestOptimization(OMR::tacticalGlobalRegisterAllocator, true);
+    self()->setRequestOptimization(OMR::linearScanGlobalRegisterAllocator, true);
 
     TR_Hotness hotness = comp->getMethodHotness();
     TR_ASSERT(hotness <= lastOMRStrategy, "Invalid optimization strategy");
@@ -519,6 +544,19 @@ void OMR::SmallOptimizer::optimize()
         self()->switchToProfiling(2, 30);
     }
 
+    // The budget covers everything the optimizer does for this method,
+    // including the scratch memory taken by the analyses it builds.
+    TR::RegionProfiler budgetProfiler(comp->trMemory()->heapMemoryRegion(), *comp, "opt/%s",
+        comp->getHotnessName(comp->getMethodHotness()));
+    if (!isIlGenOpt()
+        && (comp->getOptions()->getOptimizerTimeBudget() > 0
+            || comp->getOptions()->getOptimizerMemoryBudget() > 0)) {
+        _budgetProfiler = &budgetProfiler;
+        _budgetStartTime = TR::Compiler->vm.getUSecClock();
+        _numOptsSkippedForBudget = 0;
+        _overBudget = false;
+    }
+
     const OptimizationStrategy *opt = _strategy;
     while (opt->_num != endOpts) {
         int32_t actualCost = performOptimization(opt, firstOptIndex, lastOptIndex, doTiming);
@@ -528,6 +566,15 @@ void OMR::SmallOptimizer::optimize()
         }
     }
 
+    if (_numOptsSkippedForBudget > 0 && TR::Options::getVerboseOption(TR_VerbosePerformance)) {
+        TR_VerboseLog::writeLineLocked(TR_Vlog_PERF,
+            "%s: skipped %d optimizations over compile-time budget (%llu ms, %llu KB scratch)", comp->signature(),
+            _numOptsSkippedForBudget,
+            static_cast<unsigned long long>((TR::Compiler->vm.getUSecClock() - _budgetStartTime) / 1000),
+            static_cast<unsigned long long>(budgetProfiler.segmentBytesAllocated() / 1024));
+    }
+    _budgetProfiler = NULL;
+
     if (comp->getOption(TR_EnableDeterministicOrientedCompilation) && comp->isOutermostMethod()
         && (comp->getMethodHotness() > cold) && (comp->getMethodHotness() < scorching)) {
         TR_Hotness nextHotness = checkMaxHotnessOfInlinedMethods(comp);
@@ -565,6 +612,56 @@ void OMR::SmallOptimizer::dumpPostOptTrees()
         comp()->dumpMethodTrees(comp()->log(), "Post Optimization Trees");
 }
 
+bool OMR::SmallOptimizer::isOverBudget()
+{
+    if (_overBudget || _budgetProfiler == NULL)
+        return _overBudget;
+
+    int32_t timeBudget = comp()->getOptions()->getOptimizerTimeBudget();
+    int32_t memoryBudget = comp()->getOptions()->getOptimizerMemoryBudget();
+    uint64_t elapsedMs = (TR::Compiler->vm.getUSecClock() - _budgetStartTime) / 1000;
+    size_t scratchKB = _budgetProfiler->segmentBytesAllocated() / 1024;
+
+    if ((timeBudget > 0 && elapsedMs > static_cast<uint64_t>(timeBudget))
+        || (memoryBudget > 0 && scratchKB > static_cast<size_t>(memoryBudget))) {
+        _overBudget = true;
+        if (comp()->getOption(TR_TraceOpts) || comp()->getOption(TR_TraceOptDetails))
+            comp()->log()->printf("<budgetExceeded elapsedMs=%llu scratchKB=%llu/>\n",
+                static_cast<unsigned long long>(elapsedMs), static_cast<unsigned long long>(scratchKB));
+    }
+
+    return _overBudget;
+}
+
+bool OMR::SmallOptimizer::isExpensiveOptimization(OMR::Optimizations optNum)
+{
+    switch (optNum) {
+        case OMR::partialRedundancyElimination:
+        case OMR::loopVersioner:
+        case OMR::globalValuePropagation:
+        case OMR::generalLoopUnroller:
+        case OMR::loopSpecializer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void OMR::SmallOptimizer::reportSkippedForBudget(TR::OptimizationManager *manager, int32_t optIndex)
+{
+    _numOptsSkippedForBudget++;
+
+    if (comp()->getOption(TR_TraceOpts) || comp()->getOption(TR_TraceOptDetails))
+        comp()->log()->printf("   %s (%d) skipped: compile-time budget exceeded\n", manager->name(), optIndex);
+
+    if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "%s: compile-time budget exceeded, skipping %s",
+            comp()->signature(), manager->name());
+
+    TR::DebugCounter::incStaticDebugCounter(comp(),
+        TR::DebugCounter::debugCounterName(comp(), "optimizer.skippedOverBudget/%s", manager->name()));
+}
+
 static bool hasMoreThanOneBlock(TR::Compilation *comp)
 {
     return (comp->getStartBlock() && comp->getStartBlock()->getNextBlock());
@@ -992,6 +1089,11 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
         if (regex && TR::SimpleRegex::match(regex, manager->name()))
             return 0;
 
+        if (!mustBeDone && isExpensiveOptimization(optNum) && isOverBudget()) {
+            reportSkippedForBudget(manager, optIndex);
+            return 0;
+        }
+
         // actually doing optimization
         regex = comp()->getOptions()->getBreakOnOpts();
         if (regex && TR::SimpleRegex::match(regex, optIndex))
@@ -1078,11 +1180,17 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
             setUseDefInfo(NULL);
         }
 
-        if (manager->getDoesNotRequireLoadsAsDefsInUseDefs() && getUseDefInfo() && getUseDefInfo()->hasLoadsAsDefs()) {
+        // An optimization that never reads use/def info but keeps it up to date
+        // through the optimizer can run with info of either kind
+        //
+        bool keepsUseDefInfo = manager->getMaintainsUseDefInfo() && !manager->getRequiresUseDefInfo();
+
+        if (!keepsUseDefInfo && manager->getDoesNotRequireLoadsAsDefsInUseDefs() && getUseDefInfo()
+            && getUseDefInfo()->hasLoadsAsDefs()) {
             setUseDefInfo(NULL);
         }
 
-        if (!manager->getDoesNotRequireLoadsAsDefsInUseDefs() && getUseDefInfo()
+        if (!keepsUseDefInfo && !manager->getDoesNotRequireLoadsAsDefsInUseDefs() && getUseDefInfo()
             && !getUseDefInfo()->hasLoadsAsDefs()) {
             setUseDefInfo(NULL);
         }
@@ -1112,6 +1220,8 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
                     !manager->getDoesNotRequireLoadsAsDefsInUseDefs(), manager->getCannotOmitTrivialDefs(),
                     false, // conversionRegsOnly
                     true); // doCompletion
+                TR::DebugCounter::incStaticDebugCounter(comp(),
+                    TR::DebugCounter::debugCounterName(comp(), "optimizer.useDefInfoBuilt/%s", manager->name()));
 
 #ifdef OPT_TIMING
                 if (doTiming) {
@@ -1152,6 +1262,8 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
                     !manager->getDoesNotRequireLoadsAsDefsInUseDefs(), manager->getCannotOmitTrivialDefs(),
                     false, // conversionRegsOnly
                     true); // doCompletion
+                TR::DebugCounter::incStaticDebugCounter(comp(),
+                    TR::DebugCounter::debugCounterName(comp(), "optimizer.useDefInfoBuilt/%s", manager->name()));
 
 #ifdef OPT_TIMING
                 if (doTiming) {
@@ -1262,6 +1374,7 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
 
         int32_t origSymRefCount = comp()->getSymRefCount();
         int32_t origNodeCount = comp()->getNodeCount();
+        ncount_t origNumReportedNodes = _numReportedNodes;
         int32_t origCfgNodeCount = comp()->getFlowGraph()->getNextNodeNumber();
         int32_t origOptMsgIndex = self()->getOptMessageIndex();
 
@@ -1374,14 +1487,21 @@ int32_t OMR::SmallOptimizer::performOptimization(const OptimizationStrategy *opt
         if ((finalOptMsgIndex != origOptMsgIndex) && !manager->getDoesNotRequireTreeDumps())
             comp()->reportOptimizationPhaseForSnap(optNum);
 
-        if (comp()->getNodeCount() > unsigned(origNodeCount)) {
-            // If nodes were added, invalidate
-            //
+        // If nodes were added that the optimization did not report, invalidate
+        //
+        bool addedUnreportedNodes
+            = comp()->getNodeCount() > unsigned(origNodeCount) + (_numReportedNodes - origNumReportedNodes);
+        if (addedUnreportedNodes) {
             setValueNumberInfo(NULL);
             if (!manager->getMaintainsUseDefInfo())
                 setUseDefInfo(NULL);
         }
 
+        if (_useDefInfoNeedsRebuild) {
+            setUseDefInfo(NULL);
+            _useDefInfoNeedsRebuild = false;
+        }
+
         if ((comp()->getSymRefCount() != origSymRefCount) /* || manager->getCanAddSymbolReference()*/) {
             setSymReferencesTable(NULL);
             // invalidate any alias sets so that they are rebuilt
@@ -1520,18 +1640,23 @@ bool OMR::SmallOptimizer::prepareForNodeRemoval(TR::Node *node, bool deferInvali
     if (udInfo) {
         index = node->getUseDefIndex();
         if (udInfo->isUseIndex(index)) {
-            // udInfo->setUseDefInfoToNull(index);
-            udInfo->resetDefUseInfo();
-
             // If the node is both a use and a def we can't repair the info, since
             // it is a def to other uses that we don't know about (it's an unresolved
             // load, which acts like a call def node).
             //
             if (udInfo->isDefIndex(index)) {
+                udInfo->resetDefUseInfo();
                 if (!deferInvalidatingUseDefInfo)
                     setUseDefInfo(NULL);
                 useDefInfoAreInvalid = true;
+            } else {
+                udInfo->removeUse(node);
             }
+        } else if (udInfo->isDefIndex(index)) {
+            // Uses reached by a removed def still refer to it, so the info
+            // is rebuilt once the optimization is done
+            //
+            _useDefInfoNeedsRebuild = true;
         }
         node->setUseDefIndex(0);
     }
@@ -1550,6 +1675,19 @@ bool OMR::SmallOptimizer::prepareForNodeRemoval(TR::Node *node, bool deferInvali
     return useDefInfoAreInvalid;
 }
 
+void OMR::SmallOptimizer::reportNewNode(TR::Node *node)
+{
+    _numReportedNodes++;
+
+    TR_ValueNumberInfo *vnInfo = getValueNumberInfo();
+    if (vnInfo)
+        vnInfo->setUniqueValueNumber(node);
+
+    if (getUseDefInfo() && node->getOpCode().hasSymbolReference()
+        && (node->getOpCode().isLoadVarOrStore() || node->getOpCode().isCall()))
+        _useDefInfoNeedsRebuild = true;
+}
+
 void OMR::SmallOptimizer::getStaticFrequency(TR::Block *block, int32_t *currentWeight)
 {
     if (comp()->getUsesBlockFrequencyInGRA())
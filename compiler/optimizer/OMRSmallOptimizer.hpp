@@ -60,6 +60,7 @@ class Compilation;
 class OptimizationManager;
 class SmallOptimizer;
 class Optimizer;
+class RegionProfiler;
 class ResolvedMethodSymbol;
 } // namespace TR
 struct OptimizationStrategy;
@@ -264,6 +265,16 @@ public:
 
     bool prepareForNodeRemoval(TR::Node *node, bool deferInvalidatingUseDefInfo = false);
 
+    /**
+     * Report a node created by the current optimization so that use/def and
+     * value number info can be kept up to date instead of being rebuilt.
+     *
+     * The node gets a unique value number. A new load or store of a symbol
+     * cannot be given reaching definitions without analysis, so reporting one
+     * still causes use/def info to be rebuilt.
+     */
+    void reportNewNode(TR::Node *node);
+
     void prepareForTreeRemoval(TR::TreeTop *treeTop) { prepareForNodeRemoval(treeTop->getNode()); }
 
     bool cachedExtendedBBInfoValid() { return _cachedExtendedBBInfoValid; }
@@ -350,6 +361,16 @@ public:
 
     bool isEnabled(OMR::Optimizations i);
 
+    /**
+     * Whether this method has used up its compile-time budget, i.e. the time
+     * or scratch memory spent in the optimizer exceeds the optimizerTimeBudget
+     * or optimizerMemoryBudget option. Once over budget, expensive optional
+     * optimizations are skipped for the rest of the strategy.
+     */
+    bool isOverBudget();
+
+    int32_t getNumOptsSkippedForBudget() { return _numOptsSkippedForBudget; }
+
 #include "optimizer/OptimizerAnalysisPhasesEnum.hpp"
 
     /**
@@ -380,6 +401,10 @@ private:
 
     void dumpStrategy(const OptimizationStrategy *);
 
+    // Optimizations that may be skipped when the method is over budget
+    static bool isExpensiveOptimization(OMR::Optimizations);
+    void reportSkippedForBudget(TR::OptimizationManager *, int32_t optIndex);
+
     TR::Compilation *_compilation;
     TR_Memory *_trMemory;
     TR::CodeGenerator *_cg;
@@ -416,6 +441,12 @@ private:
     int32_t _lastDumpOptPhaseTrees;
     int32_t _optMessageIndex;
 
+    // Nodes reported through reportNewNode(). If an optimization reports
+    // every node it creates, the info does not need to be thrown away just
+    // because the node count went up.
+    ncount_t _numReportedNodes;
+    bool _useDefInfoNeedsRebuild;
+
     bool _aliasSetsAreValid;
     bool _cantBuildGlobalsUseDefInfo;
     bool _cantBuildLocalsUseDefInfo;
@@ -433,6 +464,13 @@ private:
     bool _firstTimeStructureIsBuilt;
     bool _disableLoopOptsThatCanCreateLoops;
 
+    // Compile-time budget; _budgetProfiler is only set while optimize() runs
+    // with a budget in effect
+    TR::RegionProfiler *_budgetProfiler;
+    uint64_t _budgetStartTime;
+    int32_t _numOptsSkippedForBudget;
+    bool _overBudget;
+
     TR_BitVector *_seenBlocksGRA; // used during the GRA as a global
     TR_BitVector *_resetExitsGRA; // used during the GRA as a global
     TR_BitVector *_successorBitsGRA; // used during the GRA as a global
@@ -0,0 +1,591 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/SLPVectorizer.hpp"
+
+#include <stdint.h>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "env/TRMemory.hpp"
+#include "il/AliasSetInterface.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "ras/DebugCounter.hpp"
+#include "ras/Logger.hpp"
+
+TR_SLPVectorizer::TR_SLPVectorizer(TR::OptimizationManager *manager)
+    : TR::Optimization(manager)
+    , _runStart(0)
+{}
+
+bool TR_SLPVectorizer::shouldPerform()
+{
+    if (comp()->getOption(TR_DisableAutoSIMD))
+        return false;
+
+    return supports(TR::vstorei, TR::DataType::createVectorType(TR::Int32, TR::VectorLength128));
+}
+
+bool TR_SLPVectorizer::supports(TR::VectorOperation operation, TR::DataType vectorType)
+{
+    return cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode::createVectorOpCode(operation, vectorType));
+}
+
+/**
+ * The vector operation that applies op to every lane, for the operations
+ * whose vector form has the same result in each lane as the scalar form.
+ * Integer division and floating point min and max are left out: the former
+ * can trap, the latter disagree with the scalar forms on NaN and signed zero.
+ */
+static TR::VectorOperation vectorOperationFor(TR::ILOpCodes op)
+{
+    switch (op) {
+        case TR::badd:
+        case TR::sadd:
+        case TR::iadd:
+        case TR::ladd:
+        case TR::fadd:
+        case TR::dadd:
+            return TR::vadd;
+        case TR::bsub:
+        case TR::ssub:
+        case TR::isub:
+        case TR::lsub:
+        case TR::fsub:
+        case TR::dsub:
+            return TR::vsub;
+        case TR::bmul:
+        case TR::smul:
+        case TR::imul:
+        case TR::lmul:
+        case TR::fmul:
+        case TR::dmul:
+            return TR::vmul;
+        case TR::fdiv:
+        case TR::ddiv:
+            return TR::vdiv;
+        case TR::bneg:
+        case TR::sneg:
+        case TR::ineg:
+        case TR::lneg:
+        case TR::fneg:
+        case TR::dneg:
+            return TR::vneg;
+        case TR::iabs:
+        case TR::labs:
+        case TR::fabs:
+        case TR::dabs:
+            return TR::vabs;
+        case TR::band:
+        case TR::sand:
+        case TR::iand:
+        case TR::land:
+            return TR::vand;
+        case TR::bor:
+        case TR::sor:
+        case TR::ior:
+        case TR::lor:
+            return TR::vor;
+        case TR::bxor:
+        case TR::sxor:
+        case TR::ixor:
+        case TR::lxor:
+            return TR::vxor;
+        case TR::fsqrt:
+        case TR::dsqrt:
+            return TR::vsqrt;
+        case TR::imin:
+        case TR::lmin:
+            return TR::vmin;
+        case TR::imax:
+        case TR::lmax:
+            return TR::vmax;
+        default:
+            return TR::vBadOperation;
+    }
+}
+
+static bool isPackableAccess(TR::Node *node)
+{
+    TR::SymbolReference *symRef = node->getSymbolReference();
+    return !symRef->isUnresolved() && !symRef->getSymbol()->isVolatile() && node->getDataType().isVectorElement();
+}
+
+bool TR_SLPVectorizer::isPackableStore(TR::Node *node)
+{
+    TR::ILOpCode &op = node->getOpCode();
+    return op.isStoreIndirect() && !op.isWrtBar() && node->getNumChildren() == 2 && isPackableAccess(node);
+}
+
+bool TR_SLPVectorizer::isPackableLoad(TR::Node *node)
+{
+    TR::ILOpCode &op = node->getOpCode();
+    return op.isLoadIndirect() && node->getNumChildren() == 1 && isPackableAccess(node);
+}
+
+static bool isIntegralConstant(TR::Node *node)
+{
+    return node->getOpCode().isLoadConst() && node->getType().isIntegral();
+}
+
+static bool isIntegralConversion(TR::Node *node)
+{
+    return node->getOpCodeValue() == TR::i2l || node->getOpCodeValue() == TR::iu2l;
+}
+
+/**
+ * Move a constant addend of node, scaled, into displacement.
+ */
+static void stripConstantTerm(TR::Node *&node, int64_t &displacement, int64_t scale)
+{
+    TR::ILOpCodes op = node->getOpCodeValue();
+    if ((op == TR::iadd || op == TR::ladd) && isIntegralConstant(node->getSecondChild())) {
+        displacement += node->getSecondChild()->get64bitIntegralValue() * scale;
+        node = node->getFirstChild();
+    } else if ((op == TR::isub || op == TR::lsub) && isIntegralConstant(node->getSecondChild())) {
+        displacement -= node->getSecondChild()->get64bitIntegralValue() * scale;
+        node = node->getFirstChild();
+    }
+}
+
+void TR_SLPVectorizer::decomposeIndex(TR::Node *node, Address &address)
+{
+    int64_t displacement = 0;
+    int64_t scale = 1;
+
+    stripConstantTerm(node, displacement, 1);
+
+    TR::ILOpCodes op = node->getOpCodeValue();
+    if ((op == TR::imul || op == TR::lmul) && isIntegralConstant(node->getSecondChild())) {
+        scale = node->getSecondChild()->get64bitIntegralValue();
+        node = node->getFirstChild();
+    } else if ((op == TR::ishl || op == TR::lshl) && isIntegralConstant(node->getSecondChild())) {
+        scale = (int64_t)1 << (node->getSecondChild()->get64bitIntegralValue() & 63);
+        node = node->getFirstChild();
+    }
+
+    if (isIntegralConversion(node))
+        node = node->getFirstChild();
+    stripConstantTerm(node, displacement, scale);
+    if (isIntegralConversion(node))
+        node = node->getFirstChild();
+
+    address._index = node;
+    address._scale = scale;
+    address._offset += displacement;
+}
+
+bool TR_SLPVectorizer::decompose(TR::Node *access, Address &address)
+{
+    address._index = NULL;
+    address._scale = 0;
+    address._offset = access->getSymbolReference()->getOffset();
+
+    TR::Node *node = access->getFirstChild();
+    while (node->getOpCodeValue() == TR::aladd || node->getOpCodeValue() == TR::aiadd) {
+        TR::Node *addend = node->getSecondChild();
+        if (isIntegralConstant(addend)) {
+            address._offset += addend->get64bitIntegralValue();
+        } else if (address._index) {
+            return false;
+        } else {
+            decomposeIndex(addend, address);
+        }
+        node = node->getFirstChild();
+    }
+
+    address._base = node;
+    return true;
+}
+
+bool TR_SLPVectorizer::sameTerm(TR::Node *a, TR::Node *b)
+{
+    if (a == b)
+        return true;
+    if (!a || !b)
+        return false;
+
+    // Separate loads of the same local agree if both are evaluated within the
+    // run being packed, which stores only through shadows
+    return a->getOpCode().isLoadVarDirect() && b->getOpCode().isLoadVarDirect()
+        && a->getSymbolReference() == b->getSymbolReference() && a->getSymbol()->isAutoOrParm()
+        && (int32_t)a->getLocalIndex() >= _runStart && (int32_t)b->getLocalIndex() >= _runStart;
+}
+
+bool TR_SLPVectorizer::sameBase(Address &a, Address &b)
+{
+    return sameTerm(a._base, b._base) && sameTerm(a._index, b._index) && a._scale == b._scale;
+}
+
+/**
+ * Find a run of stores beginning at trees[start] that together write every
+ * element of one vector of the given length.  On success the stores are
+ * returned in lanes, ordered by address.
+ */
+bool TR_SLPVectorizer::findRun(TreeTopList &trees, int32_t start, TR::VectorLength length, TR::Node **lanes,
+    int32_t &numLanes)
+{
+    TR::Node *first = trees[start]->getNode();
+    if (!isPackableStore(first))
+        return false;
+
+    TR::DataType elementType = first->getDataType();
+    TR::DataType vectorType = TR::DataType::createVectorType(elementType, length);
+    int32_t elementSize = TR::DataType::getSize(elementType);
+
+    numLanes = TR::DataType::getSize(vectorType) / elementSize;
+    if (numLanes > MAX_LANES || start + numLanes > (int32_t)trees.size() || !supports(TR::vstorei, vectorType))
+        return false;
+
+    Address addresses[MAX_LANES];
+    int64_t lowest = 0;
+    for (int32_t k = 0; k < numLanes; k++) {
+        TR::Node *store = trees[start + k]->getNode();
+        if (!isPackableStore(store) || store->getDataType() != elementType || !decompose(store, addresses[k]))
+            return false;
+        if (k > 0 && !sameBase(addresses[0], addresses[k]))
+            return false;
+        if (k == 0 || addresses[k]._offset < lowest)
+            lowest = addresses[k]._offset;
+    }
+
+    for (int32_t lane = 0; lane < numLanes; lane++)
+        lanes[lane] = NULL;
+
+    for (int32_t k = 0; k < numLanes; k++) {
+        int64_t delta = addresses[k]._offset - lowest;
+        if (delta % elementSize != 0 || delta / elementSize >= numLanes || lanes[delta / elementSize])
+            return false;
+        lanes[delta / elementSize] = trees[start + k]->getNode();
+    }
+
+    return true;
+}
+
+/**
+ * Whether load may read memory written by store.  Accesses from a common base
+ * are compared by offset whatever their shadows say, the rest by aliasing.
+ */
+bool TR_SLPVectorizer::mayOverlap(TR::Node *store, TR::Node *load)
+{
+    Address storeAddress, loadAddress;
+    if (load->getOpCode().isLoadIndirect() && decompose(store, storeAddress) && decompose(load, loadAddress)
+        && sameBase(storeAddress, loadAddress))
+        return storeAddress._offset < loadAddress._offset + TR::DataType::getSize(load->getDataType())
+            && loadAddress._offset < storeAddress._offset + TR::DataType::getSize(store->getDataType());
+
+    return store->mayKill().contains(load->getSymbolReference(), comp());
+}
+
+/**
+ * Check the nodes first evaluated by tree number `tree` of the run.  Packing
+ * evaluates them all before the first store of the run, so none may read
+ * memory written by an earlier store of the run.  A commoned node may also
+ * end up evaluated only by a later reference after the run, so it must not
+ * read memory written by any store of the run.
+ *
+ * @returns true if node reads memory the run may write
+ */
+bool TR_SLPVectorizer::scanForReordering(TR::Node *node, TreeTopList &trees, int32_t numLanes, int32_t tree,
+    bool &safe)
+{
+    if (node->getVisitCount() == comp()->getVisitCount() || (int32_t)node->getLocalIndex() != _runStart + tree)
+        return false;
+    node->setVisitCount(comp()->getVisitCount());
+
+    TR::ILOpCode &op = node->getOpCode();
+    if (op.isCall() || op.isStore() || (op.hasSymbolReference() && node->getSymbol()->isVolatile())) {
+        safe = false;
+        return false;
+    }
+
+    bool readsRunMemory = false;
+    for (int32_t c = 0; c < node->getNumChildren(); c++) {
+        if (scanForReordering(node->getChild(c), trees, numLanes, tree, safe))
+            readsRunMemory = true;
+    }
+
+    if (op.isLoadVar()) {
+        for (int32_t k = 0; k < numLanes; k++) {
+            TR::Node *store = trees[_runStart + k]->getNode();
+            if (!mayOverlap(store, node))
+                continue;
+
+            readsRunMemory = true;
+            if (k < tree) {
+                logprintf(trace(), comp()->log(), "   load [%p] may read the value stored by [%p]\n", node, store);
+                safe = false;
+            }
+        }
+    }
+
+    if (readsRunMemory && node->getReferenceCount() > 1) {
+        logprintf(trace(), comp()->log(), "   [%p] reads memory written by the run and is commoned\n", node);
+        safe = false;
+    }
+
+    return readsRunMemory;
+}
+
+bool TR_SLPVectorizer::checkRunOrder(TreeTopList &trees, int32_t numLanes)
+{
+    bool safe = true;
+    comp()->incVisitCount();
+    for (int32_t k = 0; k < numLanes && safe; k++) {
+        TR::Node *store = trees[_runStart + k]->getNode();
+        for (int32_t c = 0; c < store->getNumChildren(); c++)
+            scanForReordering(store->getChild(c), trees, numLanes, k, safe);
+    }
+    return safe;
+}
+
+bool TR_SLPVectorizer::isSplat(TR::Node **lanes, int32_t numLanes)
+{
+    TR::Node *first = lanes[0];
+    for (int32_t lane = 1; lane < numLanes; lane++) {
+        TR::Node *node = lanes[lane];
+        if (sameTerm(node, first))
+            continue;
+        if (!isIntegralConstant(node) || !isIntegralConstant(first) || node->getDataType() != first->getDataType()
+            || node->get64bitIntegralValue() != first->get64bitIntegralValue())
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Decide whether the values in lanes can be computed by one vector tree of
+ * vectorType, and add the cost of both forms to cost.
+ */
+bool TR_SLPVectorizer::analyzePack(TR::Node **lanes, int32_t numLanes, TR::DataType vectorType, Cost &cost,
+    int32_t depth)
+{
+    TR::Node *first = lanes[0];
+    TR::DataType elementType = vectorType.getVectorElementType();
+    if (depth > MAX_PACK_DEPTH || first->getDataType() != elementType)
+        return false;
+
+    if (isSplat(lanes, numLanes)) {
+        cost._vector++;
+        return supports(TR::vsplats, vectorType);
+    }
+
+    // Lanes that are computed separately must not be needed elsewhere
+    for (int32_t lane = 0; lane < numLanes; lane++) {
+        if (lanes[lane]->getOpCodeValue() != first->getOpCodeValue() || lanes[lane]->getReferenceCount() > 1)
+            return false;
+    }
+
+    cost._scalar += numLanes;
+    cost._vector++;
+
+    if (isPackableLoad(first)) {
+        if (!supports(TR::vloadi, vectorType))
+            return false;
+
+        int32_t elementSize = TR::DataType::getSize(elementType);
+        Address laneZero;
+        if (!decompose(first, laneZero))
+            return false;
+
+        for (int32_t lane = 1; lane < numLanes; lane++) {
+            Address address;
+            if (!isPackableLoad(lanes[lane]) || !decompose(lanes[lane], address) || !sameBase(laneZero, address)
+                || address._offset != laneZero._offset + lane * elementSize)
+                return false;
+        }
+        return true;
+    }
+
+    TR::VectorOperation operation = vectorOperationFor(first->getOpCodeValue());
+    if (operation == TR::vBadOperation || !supports(operation, vectorType))
+        return false;
+
+    TR::Node *children[MAX_LANES];
+    for (int32_t c = 0; c < first->getNumChildren(); c++) {
+        for (int32_t lane = 0; lane < numLanes; lane++)
+            children[lane] = lanes[lane]->getChild(c);
+        if (!analyzePack(children, numLanes, vectorType, cost, depth + 1))
+            return false;
+    }
+
+    return true;
+}
+
+TR::SymbolReference *TR_SLPVectorizer::createVectorShadow(TR::DataType vectorType, TR::Node *laneZeroAccess)
+{
+    TR::SymbolReferenceTable *symRefTab = comp()->getSymRefTab();
+    TR::SymbolReference *laneZeroSymRef = laneZeroAccess->getSymbolReference();
+
+    // The new shadow overlaps every lane's shadow; opaque shadows alias
+    // conservatively rather than by name
+    TR::Symbol *sym = TR::Symbol::createNamedShadow(comp()->trHeapMemory(), vectorType,
+        TR::DataType::getSize(vectorType), (char *)"<slp vector>");
+    sym->setMemoryOrdering(TR::Symbol::MemoryOrdering::Opaque);
+
+    TR::SymbolReference *symRef = new (comp()->trHeapMemory())
+        TR::SymbolReference(symRefTab, sym, laneZeroSymRef->getOwningMethodIndex(), -1);
+    symRef->setOffset(laneZeroSymRef->getOffset());
+    symRefTab->aliasBuilder.nonIntPrimitiveShadowSymRefs().set(symRef->getReferenceNumber());
+    return symRef;
+}
+
+TR::Node *TR_SLPVectorizer::buildPack(TR::Node **lanes, int32_t numLanes, TR::DataType vectorType)
+{
+    TR::Node *first = lanes[0];
+
+    if (isSplat(lanes, numLanes))
+        return TR::Node::create(first, TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType), 1, first);
+
+    if (isPackableLoad(first))
+        return TR::Node::createWithSymRef(first, TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType), 1,
+            first->getFirstChild(), createVectorShadow(vectorType, first));
+
+    TR::ILOpCodes op = TR::ILOpCode::createVectorOpCode(vectorOperationFor(first->getOpCodeValue()), vectorType);
+    TR::Node *vector = TR::Node::create(first, op, first->getNumChildren());
+
+    TR::Node *children[MAX_LANES];
+    for (int32_t c = 0; c < first->getNumChildren(); c++) {
+        for (int32_t lane = 0; lane < numLanes; lane++)
+            children[lane] = lanes[lane]->getChild(c);
+        vector->setAndIncChild(c, buildPack(children, numLanes, vectorType));
+    }
+
+    return vector;
+}
+
+/**
+ * Number every node with the index of the tree that first evaluates it.
+ */
+static void numberNodes(TR::Node *node, int32_t tree, vcount_t visitCount)
+{
+    if (node->getVisitCount() == visitCount)
+        return;
+    node->setVisitCount(visitCount);
+    node->setLocalIndex(tree);
+
+    for (int32_t c = 0; c < node->getNumChildren(); c++)
+        numberNodes(node->getChild(c), tree, visitCount);
+}
+
+bool TR_SLPVectorizer::packRun(TreeTopList &trees, TR::VectorLength length, int32_t &numLanes)
+{
+    TR::Node *lanes[MAX_LANES];
+    if (!findRun(trees, _runStart, length, lanes, numLanes) || !checkRunOrder(trees, numLanes))
+        return false;
+
+    TR::DataType vectorType = TR::DataType::createVectorType(lanes[0]->getDataType(), length);
+
+    TR::Node *values[MAX_LANES];
+    for (int32_t lane = 0; lane < numLanes; lane++)
+        values[lane] = lanes[lane]->getSecondChild();
+
+    Cost cost;
+    cost._scalar = numLanes;
+    cost._vector = 1;
+    if (!analyzePack(values, numLanes, vectorType, cost, 0)) {
+        logprintf(trace(), comp()->log(), "   values of run at [%p] do not pack\n", lanes[0]);
+        return false;
+    }
+
+    logprintf(trace(), comp()->log(), "   run at [%p] costs %d scalar, %d vector\n", lanes[0], cost._scalar,
+        cost._vector);
+    if (cost._vector >= cost._scalar)
+        return false;
+
+    if (!performTransformation(comp(), "%sPacking %d stores starting at [%p] into a %d byte vector store\n",
+            optDetailString(), numLanes, trees[_runStart]->getNode(), TR::DataType::getSize(vectorType)))
+        return false;
+
+    TR::Node *laneZero = lanes[0];
+    TR::Node *vectorStore = TR::Node::createWithSymRef(TR::ILOpCode::createVectorOpCode(TR::vstorei, vectorType), 2,
+        2, laneZero->getFirstChild(), buildPack(values, numLanes, vectorType),
+        createVectorShadow(vectorType, laneZero));
+    trees[_runStart]->insertBefore(TR::TreeTop::create(comp(), vectorStore));
+
+    for (int32_t k = 0; k < numLanes; k++)
+        trees[_runStart + k]->unlink(true);
+
+    TR::DebugCounter::incStaticDebugCounter(comp(),
+        TR::DebugCounter::debugCounterName(comp(), "slpVectorization/%d/(%s)", numLanes, comp()->signature()));
+    return true;
+}
+
+int32_t TR_SLPVectorizer::perform()
+{
+    if (!comp()->getStartTree())
+        return 0;
+
+    TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+    TreeTopList trees(stackMemoryRegion);
+
+    vcount_t visitCount = comp()->incVisitCount();
+    for (TR::TreeTop *tt = comp()->getStartTree(); tt; tt = tt->getNextTreeTop()) {
+        numberNodes(tt->getNode(), (int32_t)trees.size(), visitCount);
+        trees.push_back(tt);
+    }
+
+    static const TR::VectorLength lengths[] = { TR::VectorLength256, TR::VectorLength128 };
+    static const int32_t numLengths = sizeof(lengths) / sizeof(lengths[0]);
+
+    int32_t numPacked = 0;
+    for (int32_t i = 0; i < (int32_t)trees.size();) {
+        int32_t numLanes = 0;
+        bool packed = false;
+        _runStart = i;
+        for (int32_t l = 0; l < numLengths && !packed; l++) {
+            if (lengths[l] <= TR::NumVectorLengths)
+                packed = packRun(trees, lengths[l], numLanes);
+        }
+
+        if (packed) {
+            numPacked++;
+            i += numLanes;
+        } else {
+            i++;
+        }
+    }
+
+    if (numPacked > 0) {
+        optimizer()->setUseDefInfo(NULL);
+        optimizer()->setValueNumberInfo(NULL);
+        optimizer()->setAliasSetsAreValid(false);
+        requestOpt(OMR::deadTreesElimination);
+    }
+
+    return numPacked;
+}
+
+const char *TR_SLPVectorizer::optDetailString() const throw() { return "O^O SLP VECTORIZATION: "; }
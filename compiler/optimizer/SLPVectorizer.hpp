@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef SLPVECTORIZER_INCL
+#define SLPVECTORIZER_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR {
+class Node;
+class SymbolReference;
+class TreeTop;
+} // namespace TR
+
+/**
+ * Superword-level parallelism within a basic block.
+ *
+ * A run of consecutive indirect stores of one element type that write a
+ * whole vector of adjacent elements from a common base is a seed.  The values
+ * stored are then packed lane by lane: lanes that are all the same value
+ * become a splat, adjacent indirect loads become a vector load, and
+ * isomorphic arithmetic becomes the matching vector operation over packed
+ * operands.  If every operand packs, and the vector tree is cheaper than the
+ * scalar trees it replaces, the run is replaced by a single vector store.
+ *
+ * Only operations the code generator reports through
+ * getSupportsOpCodeForAutoSIMD are generated.  Widths of 256 and then 128 bits
+ * are tried for each seed.
+ *
+ * Packing moves the loads of every lane up to the first store of the run, so
+ * a run is only packed if no load in it may read memory written by an
+ * earlier store of the same run.
+ */
+class TR_SLPVectorizer : public TR::Optimization {
+public:
+    TR_SLPVectorizer(TR::OptimizationManager *manager);
+
+    static TR::Optimization *create(TR::OptimizationManager *manager)
+    {
+        return new (manager->allocator()) TR_SLPVectorizer(manager);
+    }
+
+    virtual bool shouldPerform();
+    virtual int32_t perform();
+    virtual const char *optDetailString() const throw();
+
+private:
+    static const int32_t MAX_LANES = 32;
+    static const int32_t MAX_PACK_DEPTH = 16;
+
+    /**
+     * An address decomposed as _base + _index * _scale + _offset, where the
+     * offset includes that of the shadow.  _index is NULL for a constant
+     * displacement from _base.
+     */
+    struct Address {
+        TR::Node *_base;
+        TR::Node *_index;
+        int64_t _scale;
+        int64_t _offset;
+    };
+
+    struct Cost {
+        Cost()
+            : _scalar(0)
+            , _vector(0)
+        {}
+
+        int32_t _scalar;
+        int32_t _vector;
+    };
+
+    typedef TR::vector<TR::TreeTop *, TR::Region &> TreeTopList;
+
+    void decomposeIndex(TR::Node *node, Address &address);
+    bool decompose(TR::Node *access, Address &address);
+    bool sameTerm(TR::Node *a, TR::Node *b);
+    bool sameBase(Address &a, Address &b);
+    bool mayOverlap(TR::Node *store, TR::Node *load);
+    bool isSplat(TR::Node **lanes, int32_t numLanes);
+    bool isPackableStore(TR::Node *node);
+    bool isPackableLoad(TR::Node *node);
+
+    bool packRun(TreeTopList &trees, TR::VectorLength length, int32_t &numLanes);
+    bool findRun(TreeTopList &trees, int32_t start, TR::VectorLength length, TR::Node **lanes, int32_t &numLanes);
+    bool checkRunOrder(TreeTopList &trees, int32_t numLanes);
+    bool scanForReordering(TR::Node *node, TreeTopList &trees, int32_t numLanes, int32_t tree, bool &safe);
+
+    bool analyzePack(TR::Node **lanes, int32_t numLanes, TR::DataType vectorType, Cost &cost, int32_t depth);
+    TR::Node *buildPack(TR::Node **lanes, int32_t numLanes, TR::DataType vectorType);
+    TR::SymbolReference *createVectorShadow(TR::DataType vectorType, TR::Node *laneZeroAccess);
+
+    bool supports(TR::VectorOperation operation, TR::DataType vectorType);
+
+    // Index of the first tree of the run being considered; every node is
+    // numbered with the index of the tree that first evaluates it
+    int32_t _runStart;
+};
+
+#endif
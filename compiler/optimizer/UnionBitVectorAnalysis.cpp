@@ -78,3 +78,4 @@ template<class Container> TR_DataFlowAnalysis::Kind TR_UnionDFSetAnalysis<Contai
 
 template class TR_UnionDFSetAnalysis<TR_BitVector *>;
 template class TR_UnionDFSetAnalysis<TR_SingleBitContainer *>;
+template class TR_UnionDFSetAnalysis<TR_HybridBitVector *>;
@@ -1573,11 +1573,11 @@ void TR_UseDefInfo::buildUseDefs(void *vblockInfo, AuxiliaryData &aux)
 
         int32_t i, ii;
         TR::Method *method = comp()->getMethodSymbol()->getMethod();
-        TR_BitVectorIterator bvi(*analysisInfo);
-        while (bvi.hasMoreElements()) {
+        for (TR_ReachingDefinitions::ContainerType::Cursor cursor(*analysisInfo); cursor.Valid();
+             cursor.SetToNextOne()) {
             // Convert from expanded index to normal index
             //
-            i = bvi.getNextElement();
+            i = cursor;
             bool externalAutoParm = false;
 
             if (i >= _numDefsOnEntry) {
@@ -2365,6 +2365,20 @@ void TR_UseDefInfo::clearUseDef(int32_t useIndex)
     }
 }
 
+void TR_UseDefInfo::removeUse(TR::Node *use)
+{
+    int32_t index = use->getUseDefIndex();
+    if (!isUseIndex(index))
+        return;
+
+    TR_ASSERT(!isDefIndex(index), "removeUse: node %p is also a def and cannot be removed incrementally", use);
+
+    clearUseDef(index);
+    clearNode(index);
+    resetDefUseInfo();
+    use->setUseDefIndex(0);
+}
+
 TR::Node *TR_UseDefInfo::getNode(int32_t index)
 {
     TR_ASSERT(index < getTotalNodes(), "TR_UseDefInfo::getNode index(%d) is bigger than total(%d)\n", index,
@@ -246,6 +246,13 @@ public:
     void resetUseDef(int32_t useIndex, int32_t defIndex);
     void clearUseDef(int32_t useIndex);
 
+    /**
+     * Forget a use that is about to be removed from the trees. Defs cannot be
+     * removed incrementally because the uses they reach would have to see the
+     * definitions they were hiding.
+     */
+    void removeUse(TR::Node *use);
+
 private:
     bool isLoadAddrUse(TR::Node *node);
 
@@ -4949,6 +4949,13 @@ TR::Node *constrainAcall(OMR::ValuePropagation *vp, TR::Node *node)
     if (!node->getOpCode().isCall())
         return node;
 
+    // Front-end allocation helpers always return a new object
+    int32_t allocationSize;
+    if (TR::Compiler->om.isAllocationCall(vp->comp(), node, allocationSize)) {
+        vp->addGlobalConstraint(node, TR::VPNonNullObject::create(vp));
+        node->setIsNonNull(true);
+    }
+
     return vp->innerConstrainAcall(node);
 }
 
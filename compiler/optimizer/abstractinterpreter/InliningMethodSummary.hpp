@@ -28,7 +28,8 @@
 
 namespace TR {
 class PotentialOptimizationPredicate;
-}
+class PotentialOptimizationVPPredicate;
+} // namespace TR
 
 namespace TR {
 
@@ -57,6 +58,18 @@ public:
 
     void addPotentialOptimizationByArgument(TR::PotentialOptimizationPredicate *predicate, uint32_t argPos);
 
+    uint32_t getNumArguments() { return static_cast<uint32_t>(_optsByArg.size()); }
+
+    uint32_t getNumPotentialOptimizationsByArgument(uint32_t argPos)
+    {
+        return _optsByArg[argPos] == NULL ? 0 : static_cast<uint32_t>(_optsByArg[argPos]->size());
+    }
+
+    TR::PotentialOptimizationPredicate *getPotentialOptimizationByArgument(uint32_t argPos, uint32_t i)
+    {
+        return (*_optsByArg[argPos])[i];
+    }
+
 private:
     TR::Region &region() { return _region; }
 
@@ -90,10 +103,14 @@ public:
      */
     virtual bool test(TR::AbsValue *value) = 0;
 
+    virtual TR::PotentialOptimizationVPPredicate *asVPPredicate() { return NULL; }
+
     const char *getName();
 
     uint32_t getBytecodeIndex() { return _bytecodeIndex; }
 
+    TR::PotentialOptimizationPredicate::Kind getKind() { return _kind; }
+
 protected:
     uint32_t _bytecodeIndex;
     TR::PotentialOptimizationPredicate::Kind _kind;
@@ -111,6 +128,10 @@ public:
     virtual bool test(TR::AbsValue *value);
     virtual void trace(TR::Compilation *comp);
 
+    virtual TR::PotentialOptimizationVPPredicate *asVPPredicate() { return this; }
+
+    TR::VPConstraint *getConstraint() { return _constraint; }
+
 private:
     bool holdPartialOrderRelation(TR::VPConstraint *valueConstraint, TR::VPConstraint *testConstraint);
 
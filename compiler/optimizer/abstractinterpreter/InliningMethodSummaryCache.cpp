@@ -0,0 +1,269 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
+
+#include <string.h>
+#include "compile/Compilation.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "env/PersistentInfo.hpp"
+#include "env/Region.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+#include "optimizer/VPConstraint.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummary.hpp"
+
+TR::InliningMethodSummaryCache::InliningMethodSummaryCache()
+    : _monitor(TR::Monitor::create("JIT-InliningMethodSummaryCacheMonitor"))
+    , _numEntries(0)
+{
+    memset(_buckets, 0, sizeof(_buckets));
+}
+
+bool TR::InliningMethodSummaryCache::persistConstraint(TR::VPConstraint *constraint, Predicate &predicate)
+{
+    predicate._low = 0;
+    predicate._high = 0;
+    predicate._class = NULL;
+
+    if (constraint->asIntConstraint()) {
+        predicate._constraintKind = IntRange;
+        predicate._low = constraint->getLowInt();
+        predicate._high = constraint->getHighInt();
+        return true;
+    }
+
+    if (constraint->asNullObject()) {
+        predicate._constraintKind = NullObject;
+        return true;
+    }
+
+    if (constraint->asNonNullObject()) {
+        predicate._constraintKind = NonNullObject;
+        return true;
+    }
+
+    // Known objects and constant strings are specific to the compilation that found them
+    TR::VPConstraint *type = constraint;
+    bool isNonNull = false;
+    if (constraint->asClass()) {
+        if (!constraint->isNonNullObject() || constraint->getPreexistence() || constraint->getArrayInfo()
+            || constraint->getObjectLocation() || constraint->getClassType() == NULL)
+            return false;
+
+        type = constraint->getClassType();
+        isNonNull = true;
+    }
+
+    if (!type->asResolvedClass() || type->asKnownObject() || type->asConstString())
+        return false;
+
+    if (type->asFixedClass())
+        predicate._constraintKind = isNonNull ? NonNullFixedClass : FixedClass;
+    else
+        predicate._constraintKind = isNonNull ? NonNullResolvedClass : ResolvedClass;
+
+    predicate._class = type->getClass();
+    return predicate._class != NULL;
+}
+
+TR::VPConstraint *TR::InliningMethodSummaryCache::rebuildConstraint(TR::ValuePropagation *vp,
+    const Predicate &predicate)
+{
+    switch (predicate._constraintKind) {
+        case IntRange:
+            return TR::VPIntRange::create(vp, predicate._low, predicate._high);
+        case NullObject:
+            return TR::VPNullObject::create(vp);
+        case NonNullObject:
+            return TR::VPNonNullObject::create(vp);
+        case ResolvedClass:
+            return TR::VPResolvedClass::create(vp, predicate._class);
+        case FixedClass:
+            return TR::VPFixedClass::create(vp, predicate._class);
+        case NonNullResolvedClass:
+            return TR::VPClass::create(vp, TR::VPResolvedClass::create(vp, predicate._class),
+                TR::VPNonNullObject::create(vp), NULL, NULL, NULL);
+        case NonNullFixedClass:
+            return TR::VPClass::create(vp, TR::VPFixedClass::create(vp, predicate._class),
+                TR::VPNonNullObject::create(vp), NULL, NULL, NULL);
+        default:
+            TR_ASSERT_FATAL(false, "Unexpected constraint kind %d", predicate._constraintKind);
+            return NULL;
+    }
+}
+
+TR::InliningMethodSummaryCache::Entry **TR::InliningMethodSummaryCache::findLocked(TR_OpaqueMethodBlock *method)
+{
+    Entry **link = &_buckets[((uintptr_t)method >> 3) % NUM_BUCKETS];
+    while (*link && (*link)->_method != method)
+        link = &(*link)->_next;
+    return link;
+}
+
+bool TR::InliningMethodSummaryCache::isObsolete(TR::Compilation *comp, Entry *entry)
+{
+    for (uint32_t i = 0; i < entry->_numPredicates; i++) {
+        TR_OpaqueClassBlock *clazz = entry->_predicates[i]._class;
+        if (clazz && comp->getPersistentInfo()->isObsoleteClass(clazz, comp->fe()))
+            return true;
+    }
+    return false;
+}
+
+void TR::InliningMethodSummaryCache::removeLocked(Entry **link)
+{
+    Entry *entry = *link;
+    *link = entry->_next;
+    if (entry->_predicates)
+        TR_Memory::jitPersistentFree(entry->_predicates);
+    TR_Memory::jitPersistentFree(entry);
+    _numEntries--;
+}
+
+TR::InliningMethodSummary *TR::InliningMethodSummaryCache::find(TR::Compilation *comp, TR_ResolvedMethod *method,
+    TR::ValuePropagation *vp, TR::Region &region, bool &hasCallSites)
+{
+    TR_OpaqueMethodBlock *key = method->getPersistentIdentifier();
+    if (key == NULL)
+        return NULL;
+
+    OMR::CriticalSection findSummary(_monitor);
+    Entry **link = findLocked(key);
+    Entry *entry = *link;
+    if (!entry)
+        return NULL;
+
+    if (entry->_bytecodeSize != method->maxBytecodeIndex() || isObsolete(comp, entry)) {
+        removeLocked(link);
+        return NULL;
+    }
+
+    TR::InliningMethodSummary *summary = new (region) TR::InliningMethodSummary(region);
+    for (uint32_t i = 0; i < entry->_numPredicates; i++) {
+        const Predicate &predicate = entry->_predicates[i];
+        TR::PotentialOptimizationPredicate *rebuilt = new (region)
+            TR::PotentialOptimizationVPPredicate(rebuildConstraint(vp, predicate), predicate._bytecodeIndex,
+                static_cast<TR::PotentialOptimizationPredicate::Kind>(predicate._kind), vp);
+        summary->addPotentialOptimizationByArgument(rebuilt, predicate._argPos);
+    }
+
+    hasCallSites = entry->_hasCallSites;
+    return summary;
+}
+
+bool TR::InliningMethodSummaryCache::insert(TR_ResolvedMethod *method, TR::InliningMethodSummary *summary,
+    bool hasCallSites)
+{
+    TR_OpaqueMethodBlock *key = method->getPersistentIdentifier();
+    if (key == NULL)
+        return false;
+
+    uint32_t numPredicates = 0;
+    for (uint32_t argPos = 0; argPos < summary->getNumArguments(); argPos++)
+        numPredicates += summary->getNumPotentialOptimizationsByArgument(argPos);
+
+    Predicate *predicates = NULL;
+    if (numPredicates > 0) {
+        predicates = static_cast<Predicate *>(
+            TR_Memory::jitPersistentAlloc(numPredicates * sizeof(Predicate), TR_Memory::PersistentInfo));
+        if (!predicates)
+            return false;
+    }
+
+    uint32_t next = 0;
+    for (uint32_t argPos = 0; argPos < summary->getNumArguments(); argPos++) {
+        for (uint32_t i = 0; i < summary->getNumPotentialOptimizationsByArgument(argPos); i++) {
+            TR::PotentialOptimizationPredicate *source = summary->getPotentialOptimizationByArgument(argPos, i);
+            Predicate &predicate = predicates[next++];
+            predicate._argPos = argPos;
+            predicate._bytecodeIndex = source->getBytecodeIndex();
+            predicate._kind = static_cast<uint8_t>(source->getKind());
+
+            if (!source->asVPPredicate() || !persistConstraint(source->asVPPredicate()->getConstraint(), predicate)) {
+                TR_Memory::jitPersistentFree(predicates);
+                return false;
+            }
+        }
+    }
+
+    Entry *entry = new (PERSISTENT_NEW) Entry;
+    if (!entry) {
+        if (predicates)
+            TR_Memory::jitPersistentFree(predicates);
+        return false;
+    }
+
+    entry->_method = key;
+    entry->_bytecodeSize = method->maxBytecodeIndex();
+    entry->_hasCallSites = hasCallSites;
+    entry->_numPredicates = numPredicates;
+    entry->_predicates = predicates;
+
+    OMR::CriticalSection insertSummary(_monitor);
+
+    // A later summary of the same method supersedes an earlier one
+    Entry **link = findLocked(key);
+    if (*link)
+        removeLocked(link);
+
+    entry->_next = NULL;
+    *link = entry;
+    _numEntries++;
+    return true;
+}
+
+void TR::InliningMethodSummaryCache::invalidateMethod(TR_OpaqueMethodBlock *method)
+{
+    OMR::CriticalSection invalidateSummary(_monitor);
+    Entry **link = findLocked(method);
+    if (*link)
+        removeLocked(link);
+}
+
+void TR::InliningMethodSummaryCache::invalidateClass(TR_OpaqueClassBlock *clazz)
+{
+    OMR::CriticalSection invalidateSummaries(_monitor);
+    for (int32_t i = 0; i < NUM_BUCKETS; i++) {
+        Entry **link = &_buckets[i];
+        while (*link) {
+            Entry *entry = *link;
+            bool refersToClass = false;
+            for (uint32_t p = 0; p < entry->_numPredicates && !refersToClass; p++)
+                refersToClass = entry->_predicates[p]._class == clazz;
+
+            if (refersToClass)
+                removeLocked(link);
+            else
+                link = &entry->_next;
+        }
+    }
+}
+
+void TR::InliningMethodSummaryCache::invalidateAll()
+{
+    OMR::CriticalSection invalidateSummaries(_monitor);
+    for (int32_t i = 0; i < NUM_BUCKETS; i++) {
+        while (_buckets[i])
+            removeLocked(&_buckets[i]);
+    }
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef INLINING_METHOD_SUMMARY_CACHE_INCL
+#define INLINING_METHOD_SUMMARY_CACHE_INCL
+
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+
+class TR_OpaqueClassBlock;
+class TR_OpaqueMethodBlock;
+class TR_ResolvedMethod;
+
+namespace TR {
+class Compilation;
+class InliningMethodSummary;
+class Monitor;
+class Region;
+class ValuePropagation;
+class VPConstraint;
+} // namespace TR
+
+namespace TR {
+
+/**
+ * Process-wide cache of the results of abstractly interpreting a method for the BenefitInliner. Owned by
+ * TR::PersistentInfo.
+ *
+ * An InliningMethodSummary lives in the region of the compilation that built it and refers to VP constraints of
+ * that compilation. The cache keeps a compilation-independent copy of each predicate in persistent memory and
+ * rebuilds the summary in the region of whichever compilation asks for it.
+ *
+ * Besides the summary, the cache records whether abstract interpretation of the method found any call sites. The
+ * IDT fragment below a method depends on the budget and call stack of the caller, so only the empty fragment of a
+ * method without call sites can be reused; for such a method the summary is all abstract interpretation produces,
+ * and a cache hit saves interpreting it again.
+ *
+ * Entries are keyed by the persistent identifier of the method. They are dropped when the method changes size or
+ * when a class a predicate refers to has become obsolete, and the runtime is expected to call invalidateMethod()
+ * and invalidateClass() when it redefines methods or unloads classes.
+ */
+class InliningMethodSummaryCache {
+public:
+    TR_ALLOC(TR_Memory::PersistentInfo)
+
+    InliningMethodSummaryCache();
+
+    /**
+     * @brief Find the cached summary of a method and rebuild it for the current compilation
+     *
+     * @param comp the current compilation
+     * @param method the method to look up
+     * @param vp the value propagation the predicates of the rebuilt summary should use
+     * @param region the region to rebuild the summary in
+     * @param hasCallSites set to whether abstract interpretation of the method found call sites
+     *
+     * @return the summary, or NULL if none is cached
+     */
+    TR::InliningMethodSummary *find(TR::Compilation *comp, TR_ResolvedMethod *method, TR::ValuePropagation *vp,
+        TR::Region &region, bool &hasCallSites);
+
+    /**
+     * @brief Record the summary that abstract interpretation built for a method
+     *
+     * @return false if the summary refers to something that cannot outlive the compilation, in which case nothing
+     *         is recorded
+     */
+    bool insert(TR_ResolvedMethod *method, TR::InliningMethodSummary *summary, bool hasCallSites);
+
+    /**
+     * @brief Drop the summary of a method, for example when it is redefined or its class is unloaded
+     */
+    void invalidateMethod(TR_OpaqueMethodBlock *method);
+
+    /**
+     * @brief Drop every summary with a predicate that refers to a class
+     */
+    void invalidateClass(TR_OpaqueClassBlock *clazz);
+
+    void invalidateAll();
+
+    uint32_t getNumEntries() { return _numEntries; }
+
+private:
+    static const int32_t NUM_BUCKETS = 127;
+
+    enum ConstraintKind {
+        IntRange,
+        NullObject,
+        NonNullObject,
+        ResolvedClass,
+        FixedClass,
+        NonNullResolvedClass,
+        NonNullFixedClass
+    };
+
+    struct Predicate {
+        uint32_t _argPos;
+        uint32_t _bytecodeIndex;
+        uint8_t _kind;
+        uint8_t _constraintKind;
+        int32_t _low;
+        int32_t _high;
+        TR_OpaqueClassBlock *_class;
+    };
+
+    struct Entry {
+        TR_ALLOC(TR_Memory::PersistentInfo)
+
+        TR_OpaqueMethodBlock *_method;
+        uint32_t _bytecodeSize;
+        bool _hasCallSites;
+        uint32_t _numPredicates;
+        Predicate *_predicates;
+        Entry *_next;
+    };
+
+    static bool persistConstraint(TR::VPConstraint *constraint, Predicate &predicate);
+    static TR::VPConstraint *rebuildConstraint(TR::ValuePropagation *vp, const Predicate &predicate);
+
+    Entry **findLocked(TR_OpaqueMethodBlock *method);
+    bool isObsolete(TR::Compilation *comp, Entry *entry);
+    void removeLocked(Entry **link);
+
+    TR::Monitor *_monitor;
+    Entry *_buckets[NUM_BUCKETS];
+    uint32_t _numEntries;
+};
+
+} // namespace TR
+
+#endif
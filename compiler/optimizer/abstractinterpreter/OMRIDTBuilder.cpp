@@ -21,6 +21,8 @@
 
 #include "optimizer/abstractinterpreter/IDTBuilder.hpp"
 #include "optimizer/abstractinterpreter/IDT.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
+#include "env/PersistentInfo.hpp"
 #include "il/Block.hpp"
 #ifdef J9_PROJECT_SPECIFIC
 #include "env/j9method.h"
@@ -91,12 +93,35 @@ void OMR::IDTBuilder::buildIDT2(TR::IDTNode *node, TR::vector<TR::AbsValue *, TR
     TR::ResolvedMethodSymbol *symbol = node->getResolvedMethodSymbol();
     TR_ResolvedMethod *method = node->getResolvedMethod();
 
-    TR_CallStack *nextCallStack = new (region()) TR_CallStack(comp(), symbol, method, callStack, budget, true);
+    TR::InliningMethodSummaryCache *summaryCache = NULL;
+    TR::ValuePropagation *vp = NULL;
+    if (comp()->getOption(TR_EnableInliningMethodSummaryCache)) {
+        vp = self()->getValuePropagation();
+        if (vp)
+            summaryCache = comp()->getPersistentInfo()->getInliningMethodSummaryCache();
+    }
+
+    // The summary is all that abstract interpretation of a method without call sites produces, so a cached one can
+    // stand in for it
+    bool hasCallSites = true;
+    TR::InliningMethodSummary *cachedSummary
+        = summaryCache && !node->isRoot() ? summaryCache->find(comp(), method, vp, region(), hasCallSites) : NULL;
+
+    if (cachedSummary && !hasCallSites) {
+        logprintf(comp()->getOption(TR_TraceBIIDTGen), comp()->log(),
+            "+ IDTBuilder: Reusing cached inlining method summary for %s\n", node->getName(comp()->trMemory()));
+        node->setInliningMethodSummary(cachedSummary);
+    } else {
+        TR_CallStack *nextCallStack = new (region()) TR_CallStack(comp(), symbol, method, callStack, budget, true);
 
-    // Abstract interpretation will identify and find callsites thus they will be added to the IDT
-    OMR::IDTBuilder::Visitor visitor(self(), node, nextCallStack);
+        // Abstract interpretation will identify and find callsites thus they will be added to the IDT
+        OMR::IDTBuilder::Visitor visitor(self(), node, nextCallStack);
 
-    self()->performAbstractInterpretation(node, visitor, arguments);
+        self()->performAbstractInterpretation(node, visitor, arguments);
+
+        if (summaryCache && node->getInliningMethodSummary())
+            summaryCache->insert(method, node->getInliningMethodSummary(), visitor.getNumCallSites() > 0);
+    }
 
     // At this point we have the inlining summary generated by abstract interpretation
     // So we can use the summary and the arguments passed from callers to calculate the static benefit.
@@ -211,6 +236,8 @@ uint32_t OMR::IDTBuilder::computeStaticBenefit(TR::InliningMethodSummary *summar
 void OMR::IDTBuilder::Visitor::visitCallSite(TR_CallSite *callSite, TR::Block *callBlock,
     TR::vector<TR::AbsValue *, TR::Region &> *arguments)
 {
+    _numCallSites++;
+
     float callRatio = (float)callBlock->getFrequency()
         / (float)_idtNode->getCallTarget()->_cfg->getStart()->asBlock()->getFrequency();
 
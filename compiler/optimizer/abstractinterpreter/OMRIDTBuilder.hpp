@@ -73,15 +73,19 @@ protected:
             : _idtBuilder(idtBuilder)
             , _idtNode(idtNode)
             , _callStack(callStack)
+            , _numCallSites(0)
         {}
 
         virtual void visitCallSite(TR_CallSite *callSite, TR::Block *callBlock,
             TR::vector<TR::AbsValue *, TR::Region &> *arguments);
 
+        uint32_t getNumCallSites() { return _numCallSites; }
+
     private:
         TR::IDTBuilder *_idtBuilder;
         TR::IDTNode *_idtNode;
         TR_CallStack *_callStack;
+        uint32_t _numCallSites;
     };
 
     TR::Compilation *comp() { return _comp; };
@@ -104,6 +108,15 @@ protected:
         return NULL;
     }
 
+    /**
+     * @brief get the value propagation that the predicates of inlining method summaries use.
+     *
+     * @note: This method needs language specific implementation for summaries to be reused across compilations.
+     *
+     * @return the value propagation, or NULL if summaries should not be cached
+     */
+    TR::ValuePropagation *getValuePropagation() { return NULL; }
+
     /**
      * @brief Perform the abstract interpretation on the method in the IDTNode.
      *
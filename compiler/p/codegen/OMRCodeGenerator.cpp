@@ -1452,7 +1452,7 @@ TR::Instruction *OMR::Power::CodeGenerator::generateDebugCounterBump(TR::Instruc
         return cursor;
     }
 
-    intptr_t addr = counter->getBumpCountAddress();
+    intptr_t addr = counter->getBumpCountAddress(comp());
 
     TR_ASSERT(addr, "Expecting a non-null debug counter address");
 
@@ -1482,7 +1482,7 @@ TR::Instruction *OMR::Power::CodeGenerator::generateDebugCounterBump(TR::Instruc
     TR::DebugCounterBase *counter, TR::Register *deltaReg, TR::RegisterDependencyConditions *cond)
 {
     TR::Node *node = cursor->getNode();
-    intptr_t addr = counter->getBumpCountAddress();
+    intptr_t addr = counter->getBumpCountAddress(comp());
 
     TR_ASSERT(addr, "Expecting a non-null debug counter address");
 
@@ -1521,7 +1521,7 @@ TR::Instruction *OMR::Power::CodeGenerator::generateDebugCounterBump(TR::Instruc
         return cursor;
     }
 
-    intptr_t addr = counter->getBumpCountAddress();
+    intptr_t addr = counter->getBumpCountAddress(comp());
 
     TR_ASSERT(addr, "Expecting a non-null debug counter address");
 
@@ -1543,7 +1543,7 @@ TR::Instruction *OMR::Power::CodeGenerator::generateDebugCounterBump(TR::Instruc
     TR::DebugCounterBase *counter, TR::Register *deltaReg, TR_ScratchRegisterManager &srm)
 {
     TR::Node *node = cursor->getNode();
-    intptr_t addr = counter->getBumpCountAddress();
+    intptr_t addr = counter->getBumpCountAddress(comp());
 
     TR_ASSERT(addr, "Expecting a non-null debug counter address");
 
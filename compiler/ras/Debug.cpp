@@ -661,6 +661,20 @@ void TR_Debug::print(OMR::Logger *log, TR_BitVector *bv)
 
 void TR_Debug::print(OMR::Logger *log, TR_SingleBitContainer *sbc) { log->prints(sbc->isEmpty() ? "{}" : "{0}"); }
 
+void TR_Debug::print(OMR::Logger *log, TR_HybridBitVector *bv)
+{
+    log->printc('{');
+    int32_t num = 0;
+    for (TR_HybridBitVectorCursor cursor(*bv); cursor.Valid(); cursor.SetToNextOne()) {
+        log->printf(num ? ", %d" : "%d", (int32_t)cursor);
+
+        if (num % 32 == 31)
+            log->println();
+        num++;
+    }
+    log->printc('}');
+}
+
 void TR_Debug::print(OMR::Logger *log, TR::BitVector *bv)
 {
     log->printc('{');
@@ -628,6 +628,7 @@ public:
     virtual void print(TR::LabelSymbol *, TR_PrettyPrinterString &);
     virtual void print(OMR::Logger *log, TR_BitVector *);
     virtual void print(OMR::Logger *log, TR_SingleBitContainer *);
+    virtual void print(OMR::Logger *log, TR_HybridBitVector *);
     virtual void print(OMR::Logger *log, TR::BitVector *bv);
     virtual void print(OMR::Logger *log, TR::SparseBitVector *sparse);
     virtual void print(OMR::Logger *log, TR::SymbolReferenceTable *);
@@ -23,8 +23,10 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include "AtomicSupport.hpp"
 #include "env/FrontEnd.hpp"
 #include "compile/Compilation.hpp"
 #include "compile/SymbolReferenceTable.hpp"
@@ -49,6 +51,7 @@
 #include "infra/Monitor.hpp"
 #include "infra/CriticalSection.hpp"
 #include "infra/Bit.hpp"
+#include "omrformatconsts.h"
 
 #if defined(_MSC_VER)
 #include <malloc.h> // alloca on Windows
@@ -252,6 +255,16 @@ const char *TR::DebugCounter::debugCounterBucketName(TR::Compilation *comp, int3
 /** Use long operations in 64 bit platforms and int operations in 32 bit platforms */
 TR::Node *TR::DebugCounterBase::createBumpCounterNode(TR::Compilation *comp, TR::Node *deltaNode)
 {
+    if (_numShards > 1 && !comp->compileRelocatableCode()) {
+        bool is64Bit = comp->target().is64Bit();
+        TR::SymbolReference *shardSymRef
+            = comp->getSymRefTab()->findOrCreateArrayShadowSymbolRef(is64Bit ? TR::Int64 : TR::Int32, NULL);
+        TR::Node *address = createShardAddressNode(comp, deltaNode);
+        TR::Node *load = TR::Node::createWithSymRef(is64Bit ? TR::lloadi : TR::iloadi, 1, 1, address, shardSymRef);
+        TR::Node *add = TR::Node::create(is64Bit ? TR::ladd : TR::iadd, 2, load, deltaNode);
+        return TR::Node::createWithSymRef(is64Bit ? TR::lstorei : TR::istorei, 2, 2, address, add, shardSymRef);
+    }
+
     TR::SymbolReference *symref = getBumpCountSymRef(comp);
     TR::Node *load = TR::Node::createWithSymRef(deltaNode, comp->target().is64Bit() ? TR::lload : TR::iload, 0, symref);
     TR::Node *add = TR::Node::create(comp->target().is64Bit() ? TR::ladd : TR::iadd, 2, load, deltaNode);
@@ -263,6 +276,74 @@ TR::Node *TR::DebugCounterBase::createBumpCounterNode(TR::Compilation *comp, TR:
     return store;
 }
 
+// Threads run on separate stacks, and no two stacks share a region of
+// FRAME_REGION_BITS (PTHREAD_STACK_MIN is 16KB on Linux), so the address of a
+// local tells threads apart without the thread-local storage that compiled
+// code has no portable way to reach.  Fibonacci hashing spreads the regions
+// over the shards.
+//
+static const int32_t FRAME_REGION_BITS = 14;
+
+int32_t TR::DebugCounterBase::shardIndex(uintptr_t frameAddress, int32_t numShards)
+{
+    int32_t shardBits = trailingZeroes(numShards);
+    if (shardBits == 0)
+        return 0;
+    if (sizeof(uintptr_t) == 8)
+        return (int32_t)(((uint64_t)(frameAddress >> FRAME_REGION_BITS) * 0x9e3779b97f4a7c15ULL) >> (64 - shardBits));
+    return (int32_t)(((uint32_t)(frameAddress >> FRAME_REGION_BITS) * 0x9e3779b9u) >> (32 - shardBits));
+}
+
+uint64_t TR::DebugCounterBase::getShardCount()
+{
+    // A reader racing with getCounter may not see the shards yet, but no
+    // compiled code can have bumped them before getCounter returns.
+    //
+    uint64_t count = 0;
+    uint8_t *shards = (uint8_t *)_shards;
+    if (shards != NULL) {
+        for (int32_t i = 0; i < _numShards; i++)
+            count += *(uint64_t *)(shards + i * TR::DebugCounterGroup::SLOT_SIZE);
+    }
+    return count;
+}
+
+void TR::DebugCounterBase::bumpShard(int64_t delta)
+{
+    uint8_t frame;
+    int32_t shard = shardIndex((uintptr_t)&frame, _numShards);
+    VM_AtomicSupport::addU64((volatile uint64_t *)((uint8_t *)_shards + shard * TR::DebugCounterGroup::SLOT_SIZE),
+        (uint64_t)delta);
+}
+
+// The same computation as shardIndex, on the address of a temporary in the
+// frame of the compiled body, scaled to a shard address.
+//
+TR::Node *TR::DebugCounterBase::createShardAddressNode(TR::Compilation *comp, TR::Node *node)
+{
+    int32_t shardBits = trailingZeroes(_numShards);
+    int32_t slotBits = trailingZeroes((int32_t)TR::DebugCounterGroup::SLOT_SIZE);
+    TR::Node *frame = TR::Node::createWithSymRef(node, TR::loadaddr, 0, comp->getDebugCounterFrameTemp());
+    TR::Node *shards = TR::Node::aconst(node, (uintptr_t)_shards);
+
+    if (comp->target().is64Bit()) {
+        TR::Node *region = TR::Node::create(TR::lushr, 2, TR::Node::create(TR::a2l, 1, frame),
+            TR::Node::iconst(node, FRAME_REGION_BITS));
+        TR::Node *hash
+            = TR::Node::create(TR::lmul, 2, region, TR::Node::lconst(node, (int64_t)0x9e3779b97f4a7c15ULL));
+        TR::Node *shard = TR::Node::create(TR::lushr, 2, hash, TR::Node::iconst(node, 64 - shardBits));
+        TR::Node *offset = TR::Node::create(TR::lshl, 2, shard, TR::Node::iconst(node, slotBits));
+        return TR::Node::create(TR::aladd, 2, shards, offset);
+    }
+
+    TR::Node *region = TR::Node::create(TR::iushr, 2, TR::Node::create(TR::a2i, 1, frame),
+        TR::Node::iconst(node, FRAME_REGION_BITS));
+    TR::Node *hash = TR::Node::create(TR::imul, 2, region, TR::Node::iconst(node, (int32_t)0x9e3779b9u));
+    TR::Node *shard = TR::Node::create(TR::iushr, 2, hash, TR::Node::iconst(node, 32 - shardBits));
+    TR::Node *offset = TR::Node::create(TR::ishl, 2, shard, TR::Node::iconst(node, slotBits));
+    return TR::Node::create(TR::aiadd, 2, shards, offset);
+}
+
 bool TR::DebugCounterBase::initializeReloData(TR::Compilation *comp, int32_t delta, int8_t fidelity,
     int32_t staticDelta)
 {
@@ -287,13 +368,26 @@ void TR::DebugCounterBase::finalizeReloData(TR::Compilation *comp, TR::Node *nod
 TR::SymbolReference *TR::DebugCounter::getBumpCountSymRef(TR::Compilation *comp)
 {
     TR::SymbolReference *symRef = comp->getSymRefTab()->findOrCreateCounterSymRef(const_cast<char *>(_name),
-        comp->target().is64Bit() ? TR::Int64 : TR::Int32, &_bumpCount);
+        comp->target().is64Bit() ? TR::Int64 : TR::Int32, (void *)getBumpCountAddress(comp));
     symRef->getSymbol()->setIsDebugCounter();
     return symRef;
 }
 
 intptr_t TR::DebugCounter::getBumpCountAddress() { return (intptr_t)&_bumpCount; }
 
+intptr_t TR::DebugCounter::getBumpCountAddress(TR::Compilation *comp)
+{
+    // Relocatable code must bump the address its relocation resolves to.
+    //
+    if (_shards == NULL || comp->compileRelocatableCode())
+        return getBumpCountAddress();
+
+    // Bumps emitted straight from the code generators cannot pick a shard for
+    // the running thread; createBumpCounterNode does for every other bump.
+    //
+    return (intptr_t)_shards;
+}
+
 void TR::DebugCounter::getInsertionCounterNames(TR::Compilation *comp, TR_OpaqueMethodBlock *method,
     int32_t bytecodeIndex, const char *(&counterNames)[3])
 {
@@ -396,14 +490,17 @@ void TR::DebugCounterAggregation::aggregateDebugCounterHistogram(TR::Compilation
     }
 }
 
-intptr_t TR::DebugCounterAggregation::getBumpCountAddress() { return (intptr_t)&_bumpCount; }
+intptr_t TR::DebugCounterAggregation::getBumpCountAddress()
+{
+    return _shards ? (intptr_t)_shards : (intptr_t)&_bumpCount;
+}
 
 TR::SymbolReference *TR::DebugCounterAggregation::getBumpCountSymRef(TR::Compilation *comp)
 {
     if (_symRef == NULL) {
         TR::StaticSymbol *symbol = TR::StaticSymbol::create(_mem, TR::Int64);
         TR_ASSERT(symbol, "StaticSymbol *symbol must not be null. Ensure availability of persistent memory");
-        symbol->setStaticAddress(&_bumpCount);
+        symbol->setStaticAddress((void *)getBumpCountAddress());
         symbol->setNotDataAddress();
         _symRef = new (_mem) TR::SymbolReference(comp->getSymRefTab(), symbol);
         TR_ASSERT(_symRef, "SymbolReference *_symRef must not be null. Ensure availability of persistent memory");
@@ -414,7 +511,7 @@ TR::SymbolReference *TR::DebugCounterAggregation::getBumpCountSymRef(TR::Compila
 
 void TR::DebugCounterAggregation::accumulate()
 {
-    int64_t bumpCountCopy = _bumpCount;
+    int64_t bumpCountCopy = getBumpCount();
     int64_t increment = bumpCountCopy - _lastBumpCount;
     _lastBumpCount = bumpCountCopy;
     ListIterator<CounterDelta> it(_counterDeltas);
@@ -423,6 +520,8 @@ void TR::DebugCounterAggregation::accumulate()
     }
 }
 
+void TR::DebugCounterAggregation::reset() { _lastBumpCount = getBumpCount(); }
+
 int64_t TR::DebugCounterAggregation::getCount()
 {
     int64_t count = 0;
@@ -493,10 +592,15 @@ TR::DebugCounterAggregation *TR::DebugCounterGroup::createAggregation(TR::Compil
 {
     TR::DebugCounterAggregation *aggregatedCounters
         = new (comp->trPersistentMemory()) TR::DebugCounterAggregation(name, comp->trPersistentMemory());
-    _aggregations.add(aggregatedCounters);
 
     OMR::CriticalSection createAggregationCS(_countersMutex);
 
+    if (numShards(comp) > 0 && !comp->compileRelocatableCode()) {
+        aggregatedCounters->_numShards = _numShards;
+        aggregatedCounters->_shards = (uint64_t *)allocateSlots(_numShards);
+    }
+
+    _aggregations.add(aggregatedCounters);
     _aggregateCountersHashTable.Add(aggregatedCounters->getName(), aggregatedCounters);
 
     return aggregatedCounters;
@@ -548,10 +652,10 @@ TR::DebugCounter *TR::DebugCounterGroup::createCounter(const char *name, int8_t
     }
     TR::DebugCounter *result = new (persistentMemory) TR::DebugCounter(name, fidelity, denominator, flags);
     TR_ASSERT(result, "DebugCounter *result must not be null. Ensure availability of persistent memory");
-    _counters.add(result);
 
     OMR::CriticalSection createCounterLock(_countersMutex);
 
+    _counters.add(result);
     _countersHashTable.Add(result->getName(), result);
 
     return result;
@@ -578,6 +682,14 @@ TR::DebugCounter *TR::DebugCounterGroup::getCounter(TR::Compilation *comp, const
     if (!result)
         result = createCounter(name, fidelity, comp->trPersistentMemory());
 
+    if (result->_shards == NULL && numShards(comp) > 0) {
+        OMR::CriticalSection shardCounterLock(_countersMutex);
+        if (result->_shards == NULL) {
+            result->_numShards = _numShards;
+            result->_shards = (uint64_t *)allocateSlots(_numShards);
+        }
+    }
+
     TR_ASSERT(result->getFidelity() >= fidelity,
         "Request for counter at fidelity %d is too high; counter only has fidelity %d: %s\n", fidelity,
         result->getFidelity(), name);
@@ -604,11 +716,153 @@ void TR::DebugCounterGroup::accumulate()
 
 void TR::DebugCounterGroup::resetAll()
 {
+    OMR::CriticalSection resetAllLock(_countersMutex);
+
     ListIterator<TR::DebugCounter> li(&_counters);
     for (TR::DebugCounter *counter = li.getCurrent(); counter; counter = li.getNext())
         counter->reset();
 
-    // TODO: Aggregations??
+    // Drop bumps the aggregations have not yet passed on, so that they are not
+    // credited to the freshly reset counters at the next accumulation.
+    //
+    ListIterator<TR::DebugCounterAggregation> li2(&_aggregations);
+    for (TR::DebugCounterAggregation *aggregatedCounters = li2.getCurrent(); aggregatedCounters;
+         aggregatedCounters = li2.getNext())
+        aggregatedCounters->reset();
+}
+
+int32_t TR::DebugCounterGroup::numShards(TR::Compilation *comp)
+{
+    // The slot layout of a counter cannot change once compiled code refers to
+    // it, so the first compilation to ask fixes the shard count for the group.
+    //
+    if (_numShards < 0) {
+        // Shards are picked by hashing to a number of bits, so only a power of
+        // two of them can be used
+        //
+        int32_t shards = comp->getOptions()->getDebugCounterShards();
+        _numShards = shards <= 0 ? 0 : (shards > MAX_SHARDS ? MAX_SHARDS : 1 << (31 - leadingZeroes(shards)));
+    }
+    return _numShards;
+}
+
+void *TR::DebugCounterGroup::allocateSlots(int32_t numSlots)
+{
+    size_t size = numSlots * SLOT_SIZE;
+    if (size > _slabRemaining) {
+        size_t slabSize = (numSlots > SLOTS_PER_SLAB ? numSlots : SLOTS_PER_SLAB) * SLOT_SIZE;
+        uint8_t *slab = (uint8_t *)_mem->allocatePersistentMemory(slabSize + SLOT_SIZE - 1);
+        TR_ASSERT_FATAL(slab, "Failed to allocate a debug counter slab of %d bytes", (int)slabSize);
+
+        _slab = (uint8_t *)(((uintptr_t)slab + SLOT_SIZE - 1) & ~(uintptr_t)(SLOT_SIZE - 1));
+        _slabRemaining = slabSize;
+        memset(_slab, 0, slabSize);
+    }
+
+    void *slots = _slab;
+    _slab += size;
+    _slabRemaining -= size;
+    return slots;
+}
+
+static int compareCounterNames(const void *a, const void *b)
+{
+    return strcmp((*(TR::DebugCounter **)a)->getName(), (*(TR::DebugCounter **)b)->getName());
+}
+
+TR::DebugCounter **TR::DebugCounterGroup::sortedCounters(uint32_t &numCounters)
+{
+    accumulate();
+
+    numCounters = 0;
+    ListIterator<TR::DebugCounter> li(&_counters);
+    for (TR::DebugCounter *counter = li.getCurrent(); counter; counter = li.getNext())
+        numCounters++;
+
+    if (numCounters == 0)
+        return NULL;
+
+    TR::DebugCounter **counters
+        = (TR::DebugCounter **)_mem->allocatePersistentMemory(numCounters * sizeof(TR::DebugCounter *));
+    if (counters == NULL) {
+        numCounters = 0;
+        return NULL;
+    }
+
+    uint32_t i = 0;
+    for (TR::DebugCounter *counter = li.getFirst(); counter; counter = li.getNext())
+        counters[i++] = counter;
+
+    qsort(counters, numCounters, sizeof(TR::DebugCounter *), compareCounterNames);
+    return counters;
+}
+
+uint32_t TR::DebugCounterGroup::snapshot(const char **names, int64_t *counts, uint32_t maxCounters)
+{
+    OMR::CriticalSection snapshotLock(_countersMutex);
+
+    uint32_t numCounters;
+    TR::DebugCounter **counters = sortedCounters(numCounters);
+    for (uint32_t i = 0; i < numCounters && i < maxCounters; i++) {
+        names[i] = counters[i]->getName();
+        counts[i] = counters[i]->getCount();
+    }
+
+    if (counters)
+        _mem->freePersistentMemory(counters);
+    return numCounters;
+}
+
+static void appendCSV(char *buffer, size_t bufferSize, size_t &length, const char *format, ...)
+{
+    size_t offset = length < bufferSize ? length : bufferSize - 1;
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(buffer + offset, bufferSize - offset, format, args);
+    va_end(args);
+    if (written > 0)
+        length += written;
+}
+
+size_t TR::DebugCounterGroup::formatCSV(char *buffer, size_t bufferSize)
+{
+    OMR::CriticalSection formatLock(_countersMutex);
+
+    size_t length = 0;
+    char dummy;
+    if (buffer == NULL || bufferSize == 0) {
+        buffer = &dummy;
+        bufferSize = 1;
+    }
+    buffer[0] = '\0';
+
+    appendCSV(buffer, bufferSize, length, "name,count\n");
+
+    uint32_t numCounters;
+    TR::DebugCounter **counters = sortedCounters(numCounters);
+    for (uint32_t i = 0; i < numCounters; i++) {
+        const char *name = counters[i]->getName();
+
+        // Quote names that contain CSV metacharacters, doubling embedded quotes
+        //
+        if (strpbrk(name, ",\"\r\n")) {
+            appendCSV(buffer, bufferSize, length, "\"");
+            for (const char *c = name; *c; c++) {
+                if (*c == '"')
+                    appendCSV(buffer, bufferSize, length, "\"\"");
+                else
+                    appendCSV(buffer, bufferSize, length, "%c", *c);
+            }
+            appendCSV(buffer, bufferSize, length, "\"");
+        } else {
+            appendCSV(buffer, bufferSize, length, "%s", name);
+        }
+        appendCSV(buffer, bufferSize, length, ",%" OMR_PRId64 "\n", counters[i]->getCount());
+    }
+
+    if (counters)
+        _mem->freePersistentMemory(counters);
+    return length;
 }
 
 void OMR::PersistentInfo::createCounters(TR_PersistentMemory *mem)
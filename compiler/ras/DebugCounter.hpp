@@ -79,9 +79,18 @@ public:
     DebugCounterBase(const char *name)
         : _name(name)
         , _reloData(NULL)
+        , _shards(NULL)
+        , _numShards(0)
     {}
 
+    // The unsharded bump target; relocations always resolve to this address.
+    //
     virtual intptr_t getBumpCountAddress() = 0;
+
+    // The bump target that code generated for comp should increment when it
+    // cannot pick a shard for the running thread; the first shard, if any.
+    //
+    virtual intptr_t getBumpCountAddress(TR::Compilation *comp) = 0;
     virtual TR::SymbolReference *getBumpCountSymRef(TR::Compilation *comp) = 0;
     TR::Node *createBumpCounterNode(TR::Compilation *comp, TR::Node *deltaNode);
     bool initializeReloData(TR::Compilation *comp, int32_t delta, int8_t fidelity, int32_t staticDelta);
@@ -93,9 +102,26 @@ public:
 
     DebugCounterReloData *getReloData() { return _reloData; }
 
+    // The shard, out of a power-of-two numShards, that a thread whose stack
+    // contains frameAddress bumps.
+    //
+    static int32_t shardIndex(uintptr_t frameAddress, int32_t numShards);
+
 protected:
+    // Sum of the shards.
+    //
+    uint64_t getShardCount();
+
+    // Atomically add delta to the running thread's shard.
+    //
+    void bumpShard(int64_t delta);
+
+    TR::Node *createShardAddressNode(TR::Compilation *comp, TR::Node *node);
+
     const char *_name;
     DebugCounterReloData *_reloData;
+    uint64_t *_shards; // Cache-line isolated bump slots in production mode, or NULL
+    int32_t _numShards;
 };
 
 class DebugCounter : public DebugCounterBase {
@@ -221,10 +247,24 @@ public:
 
     TR::SymbolReference *getBumpCountSymRef(TR::Compilation *comp);
     intptr_t getBumpCountAddress();
+    intptr_t getBumpCountAddress(TR::Compilation *comp);
+
+    // Sum of every bump target compiled code may increment for this counter.
+    //
+    uint64_t getBumpCount() { return _bumpCount + getShardCount(); }
 
     // Commands
     //
-    void increment(int64_t i) { accumulate(i); }
+    void increment(int64_t i)
+    {
+        // Compilation threads bumping a sharded counter each use their own
+        // shard, like compiled code does, and leave the folding to accumulate.
+        //
+        if (_shards != NULL)
+            bumpShard(i);
+        else
+            accumulate(i);
+    }
 
     void accumulate()
     {
@@ -235,7 +275,7 @@ public:
         //
         // TODO: This is an n^2 algorithm; we should be able to do better
         //
-        uint64_t count = _bumpCount;
+        uint64_t count = getBumpCount();
         accumulate(count - _bumpCountBase);
         _bumpCountBase = count;
     }
@@ -250,7 +290,7 @@ public:
     void reset()
     {
         _totalCount = 0;
-        _bumpCountBase = _bumpCount;
+        _bumpCountBase = getBumpCount();
     }
 };
 
@@ -305,9 +345,13 @@ public:
     bool hasAnyCounters() { return !_counterDeltas->isEmpty(); }
 
     intptr_t getBumpCountAddress();
+    intptr_t getBumpCountAddress(TR::Compilation *comp) { return getBumpCountAddress(); }
     TR::SymbolReference *getBumpCountSymRef(TR::Compilation *comp);
 
+    int64_t getBumpCount() { return _bumpCount + (int64_t)getShardCount(); }
+
     void accumulate();
+    void reset();
     int64_t getCount();
     void printCounters(bool printZeroCounters = true);
 };
@@ -322,6 +366,23 @@ class DebugCounterGroup {
     TR::Monitor *_countersMutex; /**< Monitor used to synchronize read/write actions to _countersHashTable, otherwise we
                                     may have a race */
 
+    // Production counter mode.  Every bump target handed to compiled code is
+    // carved out of a slab as its own SLOT_SIZE-aligned slot, so app threads
+    // bumping different counters never write the same cache line, and never
+    // the lines the accumulating thread writes.  Each counter and bump site
+    // has a power-of-two number of shards, and the shard a bump goes to is
+    // picked by the running thread, so threads bumping the same counter do
+    // not contend either.
+    //
+    TR_PersistentMemory *_mem;
+    int32_t _numShards; // -1 until fixed by the first compilation that asks for a counter
+    uint8_t *_slab;
+    size_t _slabRemaining;
+
+    int32_t numShards(TR::Compilation *comp);
+    void *allocateSlots(int32_t numSlots);
+    DebugCounter **sortedCounters(uint32_t &numCounters);
+
     friend class ::TR_Debug;
 
 public:
@@ -330,6 +391,10 @@ public:
     DebugCounterGroup(TR_PersistentMemory *mem)
         : _countersHashTable(TRPersistentMemoryAllocator(mem))
         , _aggregateCountersHashTable(TRPersistentMemoryAllocator(mem))
+        , _mem(mem)
+        , _numShards(-1)
+        , _slab(NULL)
+        , _slabRemaining(0)
     {
         _countersMutex = TR::Monitor::create("countersMutex");
     }
@@ -345,6 +410,23 @@ public:
     void accumulate();
     void resetAll();
 
+    // Accumulate every counter and return them sorted by name.  Up to maxCounters
+    // names and counts are stored; the result is the total number of counters.
+    //
+    uint32_t snapshot(const char **names, int64_t *counts, uint32_t maxCounters);
+
+    // Accumulate every counter and write them as CSV with a "name,count" header,
+    // one row per counter sorted by name.  Behaves like snprintf: the result is
+    // the length of the full text, which is truncated if bufferSize is too small.
+    //
+    size_t formatCSV(char *buffer, size_t bufferSize);
+
+    enum {
+        SLOT_SIZE = 128, // Covers adjacent-line prefetch on x86 and the POWER line size
+        SLOTS_PER_SLAB = 64,
+        MAX_SHARDS = 64,
+    };
+
     enum SpecialCharacters {
         RATIO_SEPARATOR = ':', // Counter has a denominator counter
         FRACTION_SEPARATOR = '/', // Counter has a denominator counter and contributes to it
@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "runtime/CodeCacheLayout.hpp"
+
+#include <algorithm>
+#include <new>
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
+
+namespace {
+
+struct Cluster {
+    std::vector<TR_OpaqueMethodBlock *> _methods;
+    uint64_t _weight;
+    size_t _size;
+};
+
+struct WeightedMethod {
+    TR_OpaqueMethodBlock *_method;
+    uint64_t _weight;
+};
+
+bool heavierMethod(const WeightedMethod &a, const WeightedMethod &b) { return a._weight > b._weight; }
+
+// Methods whose code size is not known yet are given one byte so that an uncompiled hot method can be placed
+double clusterDensity(const Cluster &cluster)
+{
+    return static_cast<double>(cluster._weight) / static_cast<double>(std::max<size_t>(cluster._size, 1));
+}
+
+bool denserCluster(const Cluster *a, const Cluster *b) { return clusterDensity(*a) > clusterDensity(*b); }
+
+} // namespace
+
+TR::CodeCacheLayout *TR::CodeCacheLayout::create(TR::RawAllocator rawAllocator, size_t clusterSizeLimit)
+{
+    TR::Monitor *monitor = TR::Monitor::create("CodeCacheLayoutMonitor");
+    if (monitor == NULL)
+        return NULL;
+
+    return new (rawAllocator) TR::CodeCacheLayout(rawAllocator, monitor, clusterSizeLimit);
+}
+
+TR::CodeCacheLayout::CodeCacheLayout(TR::RawAllocator rawAllocator, TR::Monitor *monitor, size_t clusterSizeLimit)
+    : _rawAllocator(rawAllocator)
+    , _monitor(monitor)
+    , _clusterSizeLimit(clusterSizeLimit)
+{}
+
+void TR::CodeCacheLayout::destroy()
+{
+    TR::Monitor::destroy(_monitor);
+
+    TR::RawAllocator rawAllocator(_rawAllocator);
+    this->~CodeCacheLayout();
+    rawAllocator.deallocate(this);
+}
+
+void TR::CodeCacheLayout::recordInvocations(TR_OpaqueMethodBlock *method, uint64_t count)
+{
+    OMR::CriticalSection layoutLock(_monitor);
+    _methods[method]._invocations += count;
+}
+
+void TR::CodeCacheLayout::recordCall(TR_OpaqueMethodBlock *caller, void *callSite, TR_OpaqueMethodBlock *callee,
+    uint64_t count)
+{
+    OMR::CriticalSection layoutLock(_monitor);
+    CallEdge edge(caller, callee);
+    _callEdges[edge] += count;
+    _methods[caller];
+    _methods[callee]._incomingCalls += count;
+    if (callSite != NULL)
+        _callSites[static_cast<uint8_t *>(callSite)] = edge;
+}
+
+void TR::CodeCacheLayout::recordCode(TR_OpaqueMethodBlock *method, void *startPC, size_t size)
+{
+    OMR::CriticalSection layoutLock(_monitor);
+    MethodInfo &info = _methods[method];
+    if (info._startPC != NULL)
+        forgetCallSites(info._startPC, info._startPC + info._size);
+
+    info._startPC = static_cast<uint8_t *>(startPC);
+    info._size = size;
+}
+
+void TR::CodeCacheLayout::codeFreed(void *start, void *end)
+{
+    OMR::CriticalSection layoutLock(_monitor);
+    uint8_t *startPC = static_cast<uint8_t *>(start);
+    uint8_t *endPC = static_cast<uint8_t *>(end);
+    forgetCallSites(startPC, endPC);
+
+    // The size of the freed body remains the best estimate of the size of the next one
+    for (MethodMap::iterator it = _methods.begin(); it != _methods.end(); ++it) {
+        if (it->second._startPC >= startPC && it->second._startPC < endPC)
+            it->second._startPC = NULL;
+    }
+}
+
+void TR::CodeCacheLayout::forgetCallSites(uint8_t *start, uint8_t *end)
+{
+    _callSites.erase(_callSites.lower_bound(start), _callSites.lower_bound(end));
+}
+
+void TR::CodeCacheLayout::computeLayout(uint64_t minWeight)
+{
+    OMR::CriticalSection layoutLock(_monitor);
+
+    // A method is as hot as the larger of its invocation count and its sampled incoming calls, as the runtime
+    // may report either or both
+    std::vector<WeightedMethod> candidates;
+    for (MethodMap::iterator it = _methods.begin(); it != _methods.end(); ++it) {
+        it->second._hot = false;
+        uint64_t weight = std::max(it->second._invocations, it->second._incomingCalls);
+        if (weight > 0 && weight >= minWeight) {
+            WeightedMethod candidate = { it->first, weight };
+            candidates.push_back(candidate);
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), heavierMethod);
+
+    std::vector<Cluster> clusters(candidates.size());
+    std::map<TR_OpaqueMethodBlock *, size_t> clusterOf;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        clusters[i]._methods.push_back(candidates[i]._method);
+        clusters[i]._weight = candidates[i]._weight;
+        clusters[i]._size = _methods[candidates[i]._method]._size;
+        clusterOf[candidates[i]._method] = i;
+    }
+
+    std::map<TR_OpaqueMethodBlock *, std::pair<TR_OpaqueMethodBlock *, uint64_t> > heaviestCaller;
+    for (CallEdgeMap::iterator it = _callEdges.begin(); it != _callEdges.end(); ++it) {
+        TR_OpaqueMethodBlock *caller = it->first.first;
+        TR_OpaqueMethodBlock *callee = it->first.second;
+        if (caller == callee || clusterOf.find(caller) == clusterOf.end() || clusterOf.find(callee) == clusterOf.end())
+            continue;
+
+        std::pair<TR_OpaqueMethodBlock *, uint64_t> &heaviest = heaviestCaller[callee];
+        if (it->second > heaviest.second)
+            heaviest = std::make_pair(caller, it->second);
+    }
+
+    // Starting from the hottest method, append each method's cluster to the cluster of its most frequent caller
+    // so that callees follow their callers in memory
+    for (size_t i = 0; i < candidates.size(); i++) {
+        TR_OpaqueMethodBlock *callee = candidates[i]._method;
+        std::map<TR_OpaqueMethodBlock *, std::pair<TR_OpaqueMethodBlock *, uint64_t> >::iterator caller
+            = heaviestCaller.find(callee);
+        if (caller == heaviestCaller.end())
+            continue;
+
+        Cluster &from = clusters[clusterOf[callee]];
+        Cluster &to = clusters[clusterOf[caller->second.first]];
+        if (&from == &to || to._size + from._size > _clusterSizeLimit)
+            continue;
+
+        size_t toIndex = clusterOf[caller->second.first];
+        for (size_t m = 0; m < from._methods.size(); m++)
+            clusterOf[from._methods[m]] = toIndex;
+        to._methods.insert(to._methods.end(), from._methods.begin(), from._methods.end());
+        to._weight += from._weight;
+        to._size += from._size;
+        from._methods.clear();
+    }
+
+    std::vector<Cluster *> order;
+    for (size_t i = 0; i < clusters.size(); i++) {
+        if (!clusters[i]._methods.empty())
+            order.push_back(&clusters[i]);
+    }
+    std::stable_sort(order.begin(), order.end(), denserCluster);
+
+    _hotMethods.clear();
+    for (size_t i = 0; i < order.size(); i++) {
+        for (size_t m = 0; m < order[i]->_methods.size(); m++) {
+            _hotMethods.push_back(order[i]->_methods[m]);
+            _methods[order[i]->_methods[m]]._hot = true;
+        }
+    }
+}
+
+bool TR::CodeCacheLayout::isHot(TR_OpaqueMethodBlock *method)
+{
+    OMR::CriticalSection layoutLock(_monitor);
+    MethodMap::iterator it = _methods.find(method);
+    return it != _methods.end() && it->second._hot;
+}
+
+std::vector<TR_OpaqueMethodBlock *> TR::CodeCacheLayout::hotMethods()
+{
+    OMR::CriticalSection layoutLock(_monitor);
+    return _hotMethods;
+}
+
+std::vector<void *> TR::CodeCacheLayout::callSitesTo(TR_OpaqueMethodBlock *callee)
+{
+    OMR::CriticalSection layoutLock(_monitor);
+    std::vector<void *> callSites;
+    for (CallSiteMap::iterator it = _callSites.begin(); it != _callSites.end(); ++it) {
+        if (it->second.second == callee)
+            callSites.push_back(it->first);
+    }
+    return callSites;
+}
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TR_CODECACHELAYOUT_INCL
+#define TR_CODECACHELAYOUT_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <utility>
+#include <vector>
+#include "env/RawAllocator.hpp"
+#include "env/jittypes.h"
+
+namespace TR {
+class Monitor;
+
+/**
+ * Chooses which compiled methods belong in the hot code cache and in what
+ * order, so that methods calling each other frequently share pages and
+ * instruction cache lines instead of being scattered in arrival order.
+ *
+ * The runtime reports invocation counts and sampled call edges; methods are
+ * identified by the TR_ResolvedMethod::getPersistentIdentifier() of their
+ * compilations. computeLayout() then groups hot methods with their heaviest
+ * callers into clusters of at most clusterSizeLimit bytes of code (the call
+ * chain clustering of Ottoni and Maher, "Optimizing Function Placement for
+ * Large-Scale Data-Center Applications") and orders the clusters by their
+ * weight per byte.
+ *
+ * Compilations of hot methods are placed in a TR::CodeCacheKind::HOT_CODE_CC
+ * code cache. Code bodies cannot be moved in place, so the runtime recompiles
+ * the methods in hotMethods() order to lay them out contiguously, and the calls
+ * recorded into a recompiled method are patched to reach its new body.
+ */
+class CodeCacheLayout {
+public:
+    /**
+     * @param[in] rawAllocator the TR::RawAllocator the layout is allocated from
+     * @param[in] clusterSizeLimit the most code, in bytes, merged into one cluster
+     * @return the layout, or NULL if it could not be allocated
+     */
+    static CodeCacheLayout *create(TR::RawAllocator rawAllocator, size_t clusterSizeLimit);
+
+    void destroy();
+
+    /**
+     * Adds count invocations of method
+     */
+    void recordInvocations(TR_OpaqueMethodBlock *method, uint64_t count);
+
+    /**
+     * Adds count calls from caller to callee
+     * @param[in] callSite the address of the call in the code of caller, or NULL if unknown
+     */
+    void recordCall(TR_OpaqueMethodBlock *caller, void *callSite, TR_OpaqueMethodBlock *callee, uint64_t count);
+
+    /**
+     * Reports that the code of method now starts at startPC and is size bytes long.
+     * Call sites recorded in any previous body of method are forgotten.
+     */
+    void recordCode(TR_OpaqueMethodBlock *method, void *startPC, size_t size);
+
+    /**
+     * Reports that the code in [start, end) has been freed; call sites in it are forgotten
+     */
+    void codeFreed(void *start, void *end);
+
+    /**
+     * Recomputes the hot methods and their placement order from the counts reported so far
+     * @param[in] minWeight the fewest invocations or incoming calls for a method to be hot
+     */
+    void computeLayout(uint64_t minWeight);
+
+    /**
+     * @return true if the last computeLayout() placed method in the hot code cache
+     */
+    bool isHot(TR_OpaqueMethodBlock *method);
+
+    /**
+     * @return the hot methods in the order their code should be laid out
+     */
+    std::vector<TR_OpaqueMethodBlock *> hotMethods();
+
+    /**
+     * @return the recorded call sites to callee that are still in live code
+     */
+    std::vector<void *> callSitesTo(TR_OpaqueMethodBlock *callee);
+
+    size_t clusterSizeLimit() const { return _clusterSizeLimit; }
+
+private:
+    struct MethodInfo {
+        MethodInfo()
+            : _invocations(0)
+            , _incomingCalls(0)
+            , _startPC(NULL)
+            , _size(0)
+            , _hot(false)
+        {}
+
+        uint64_t _invocations;
+        uint64_t _incomingCalls;
+        uint8_t *_startPC;
+        size_t _size;
+        bool _hot;
+    };
+
+    typedef std::pair<TR_OpaqueMethodBlock *, TR_OpaqueMethodBlock *> CallEdge; /**< caller, callee */
+
+    typedef std::map<TR_OpaqueMethodBlock *, MethodInfo> MethodMap;
+    typedef std::map<CallEdge, uint64_t> CallEdgeMap;
+    typedef std::map<uint8_t *, CallEdge> CallSiteMap;
+
+    CodeCacheLayout(TR::RawAllocator rawAllocator, TR::Monitor *monitor, size_t clusterSizeLimit);
+
+    void forgetCallSites(uint8_t *start, uint8_t *end);
+
+    TR::RawAllocator _rawAllocator;
+    TR::Monitor *_monitor; /**< guards everything below */
+    size_t _clusterSizeLimit;
+
+    MethodMap _methods;
+    CallEdgeMap _callEdges;
+    CallSiteMap _callSites;
+    std::vector<TR_OpaqueMethodBlock *> _hotMethods;
+};
+
+} // namespace TR
+
+#endif // TR_CODECACHELAYOUT_INCL
@@ -20,6 +20,9 @@
  *******************************************************************************/
 
 #include "runtime/CodeCacheTypes.hpp"
+
+#include <string.h>
+#include "AtomicSupport.hpp"
 #include "runtime/CodeCacheManager.hpp"
 
 namespace OMR {
@@ -168,4 +171,205 @@ bool CodeCacheHashTable::remove(CodeCacheHashEntry *entry)
     return false;
 }
 
+// Free block index
+//
+void CodeCacheFreeBlockIndex::init()
+{
+    memset(_bins, 0, sizeof(_bins));
+    memset(_nonEmptyBins, 0, sizeof(_nonEmptyBins));
+}
+
+// Bin for a block size: the size class is the position of the highest set
+// bit, and the next SubBinBits bits below it select the bin within the class.
+//
+uint32_t CodeCacheFreeBlockIndex::binFor(size_t size)
+{
+    uint32_t sizeClass = 0;
+    for (size_t s = size; s > 1; s >>= 1)
+        sizeClass++;
+
+    if (sizeClass < MinSizeClass)
+        return 0;
+    if (sizeClass > MaxSizeClass)
+        return NumBins - 1;
+
+    uint32_t subBin = (uint32_t)(size >> (sizeClass - SubBinBits)) & (NumSubBins - 1);
+    return (sizeClass - MinSizeClass) * NumSubBins + subBin;
+}
+
+// The bin links live in the free blocks themselves, so they are written through
+// the writable view when the code cache is dual mapped
+static CodeCacheFreeCacheBlock *writableBlock(CodeCacheFreeCacheBlock *block)
+{
+    TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+    return manager ? manager->writableAddress(block) : block;
+}
+
+void CodeCacheFreeBlockIndex::insert(CodeCacheFreeCacheBlock *block)
+{
+    uint32_t bin = binFor(block->_size);
+    writableBlock(block)->_prevInBin = NULL;
+    writableBlock(block)->_nextInBin = _bins[bin];
+    if (_bins[bin])
+        writableBlock(_bins[bin])->_prevInBin = block;
+    _bins[bin] = block;
+    _nonEmptyBins[bin / 64] |= (uint64_t)1 << (bin % 64);
+}
+
+void CodeCacheFreeBlockIndex::remove(CodeCacheFreeCacheBlock *block)
+{
+    uint32_t bin = binFor(block->_size);
+    if (block->_prevInBin)
+        writableBlock(block->_prevInBin)->_nextInBin = block->_nextInBin;
+    else
+        _bins[bin] = block->_nextInBin;
+
+    if (block->_nextInBin)
+        writableBlock(block->_nextInBin)->_prevInBin = block->_prevInBin;
+
+    if (!_bins[bin])
+        _nonEmptyBins[bin / 64] &= ~((uint64_t)1 << (bin % 64));
+
+    writableBlock(block)->_nextInBin = NULL;
+    writableBlock(block)->_prevInBin = NULL;
+}
+
+int32_t CodeCacheFreeBlockIndex::firstNonEmptyBin(uint32_t from)
+{
+    for (uint32_t word = from / 64; word < NumBitmapWords; word++) {
+        uint64_t bits = _nonEmptyBins[word];
+        if (word == from / 64)
+            bits &= ~(uint64_t)0 << (from % 64);
+        if (bits) {
+            uint32_t bit = 0;
+            while (!(bits & 1)) {
+                bits >>= 1;
+                bit++;
+            }
+            return word * 64 + bit;
+        }
+    }
+    return -1;
+}
+
+int32_t CodeCacheFreeBlockIndex::lastNonEmptyBin()
+{
+    for (int32_t word = NumBitmapWords - 1; word >= 0; word--) {
+        uint64_t bits = _nonEmptyBins[word];
+        if (bits) {
+            int32_t bit = 63;
+            while (!(bits & ((uint64_t)1 << bit)))
+                bit--;
+            return word * 64 + bit;
+        }
+    }
+    return -1;
+}
+
+CodeCacheFreeCacheBlock *CodeCacheFreeBlockIndex::findFit(size_t size)
+{
+    uint32_t bin = binFor(size);
+
+    // Blocks in the request's own bin may be too small; take the best fit
+    //
+    CodeCacheFreeCacheBlock *bestFit = NULL;
+    for (CodeCacheFreeCacheBlock *block = _bins[bin]; block; block = block->_nextInBin) {
+        if (block->_size >= size && (!bestFit || block->_size < bestFit->_size)) {
+            bestFit = block;
+            if (block->_size == size)
+                break;
+        }
+    }
+
+    if (bestFit)
+        return bestFit;
+
+    int32_t largerBin = firstNonEmptyBin(bin + 1);
+    return largerBin >= 0 ? _bins[largerBin] : NULL;
+}
+
+size_t CodeCacheFreeBlockIndex::largestBlockSize()
+{
+    int32_t bin = lastNonEmptyBin();
+    if (bin < 0)
+        return 0;
+
+    size_t largest = 0;
+    for (CodeCacheFreeCacheBlock *block = _bins[bin]; block; block = block->_nextInBin) {
+        if (block->_size > largest)
+            largest = block->_size;
+    }
+    return largest;
+}
+
+bool CodeCacheFreeBlockIndex::isEmpty() { return lastNonEmptyBin() < 0; }
+
+size_t CodeCacheAddressMap::sizeInBytes(uintptr_t base, uintptr_t top)
+{
+    size_t numGranules = ((top - base) + ((uintptr_t)1 << GranuleShift) - 1) >> GranuleShift;
+    return numGranules * RangesPerGranule * sizeof(Range);
+}
+
+void CodeCacheAddressMap::initialize(uintptr_t base, uintptr_t top, void *memory)
+{
+    memset(memory, 0, sizeInBytes(base, top));
+    _ranges = static_cast<Range *>(memory);
+    _base = base;
+
+    // Readers test addresses against _size alone, so publish it last
+    VM_AtomicSupport::writeBarrier();
+    _size = top - base;
+}
+
+void CodeCacheAddressMap::insert(uintptr_t start, uintptr_t end, void *value)
+{
+    if (end <= start)
+        return;
+
+    if (start - _base >= _size || end - _base > _size) {
+        _numUnmappedRanges++;
+        return;
+    }
+
+    uintptr_t lastGranule = (end - 1 - _base) >> GranuleShift;
+    for (uintptr_t granule = (start - _base) >> GranuleShift; granule <= lastGranule; granule++) {
+        Range *ranges = &_ranges[granule * RangesPerGranule];
+        int32_t i = 0;
+        while (i < RangesPerGranule && ranges[i]._value)
+            i++;
+
+        if (i == RangesPerGranule) {
+            // Granules already filled in stay valid; the rest of the range
+            // can only be found by the caller's fallback search
+            _numUnmappedRanges++;
+            return;
+        }
+
+        ranges[i]._start = start;
+        ranges[i]._end = end;
+        VM_AtomicSupport::writeBarrier();
+        ranges[i]._value = value;
+    }
+}
+
+void *CodeCacheAddressMap::lookup(uintptr_t address) const
+{
+    uintptr_t offset = address - _base;
+    if (offset >= _size)
+        return NULL;
+
+    const Range *ranges = &_ranges[(offset >> GranuleShift) * RangesPerGranule];
+    for (int32_t i = 0; i < RangesPerGranule; i++) {
+        void *value = ranges[i]._value;
+        if (!value)
+            break;
+
+        VM_AtomicSupport::readBarrier();
+        if (address >= ranges[i]._start && address < ranges[i]._end)
+            return value;
+    }
+
+    return NULL;
+}
+
 } // namespace OMR
@@ -148,13 +148,155 @@ struct CodeCacheMethodHeader {
 
 CodeCacheMethodHeader *getCodeCacheMethodHeader(char *p, int searchLimit, MethodExceptionData *metaData);
 
+/**
+ * A free block of code cache memory. The header lives at the start of the
+ * free space itself.
+ *
+ * Free blocks are chained in address order through _next and _prev, which is
+ * what coalescing needs, and separately into size bins of a
+ * CodeCacheFreeBlockIndex through _nextInBin and _prevInBin, which is what
+ * allocation needs.
+ */
 struct CodeCacheFreeCacheBlock {
     size_t _size;
     CodeCacheFreeCacheBlock *_next;
+    CodeCacheFreeCacheBlock *_prev;
+    CodeCacheFreeCacheBlock *_nextInBin;
+    CodeCacheFreeCacheBlock *_prevInBin;
 };
 
 #define MIN_SIZE_BLOCK (sizeof(CodeCacheFreeCacheBlock) > 96 ? sizeof(CodeCacheFreeCacheBlock) : 96)
 
+// Free blocks closer than this are merged; anything in between is alignment
+// padding and cannot hold a method.
+#define FREE_BLOCK_MERGE_DISTANCE (sizeof(size_t) + sizeof(void *))
+
+/**
+ * Segregated-fit index over the free blocks of one region (warm or cold) of a
+ * code cache.
+ *
+ * Block sizes are split into power-of-two classes, and each class into
+ * NumSubBins linear bins, so that a bin spans at most 1/NumSubBins of its
+ * smallest size. A bitmap of non-empty bins lets a lookup jump straight to the
+ * first bin that can satisfy a request. Only the bin matching the request
+ * size is searched for the best fit; any block in a higher bin fits, so the
+ * first one is taken. The result is within one bin width of the true best fit.
+ */
+class CodeCacheFreeBlockIndex {
+public:
+    enum {
+        SubBinBits = 3,
+        NumSubBins = 1 << SubBinBits,
+        MinSizeClass = 4, // blocks smaller than 16 bytes are never indexed
+        MaxSizeClass = 40, // nor are code caches anywhere near 1TB
+        NumBins = (MaxSizeClass - MinSizeClass + 1) * NumSubBins,
+        NumBitmapWords = (NumBins + 63) / 64
+    };
+
+    void init();
+
+    void insert(CodeCacheFreeCacheBlock *block);
+    void remove(CodeCacheFreeCacheBlock *block);
+
+    /**
+     * @brief Find a block of at least the given size
+     * @returns a block that fits, or NULL if none does; the block is not removed
+     */
+    CodeCacheFreeCacheBlock *findFit(size_t size);
+
+    /**
+     * @returns the size of the largest indexed block, or 0 if the index is empty
+     */
+    size_t largestBlockSize();
+
+    bool isEmpty();
+
+    static uint32_t binFor(size_t size);
+
+private:
+    int32_t firstNonEmptyBin(uint32_t from);
+    int32_t lastNonEmptyBin();
+
+    CodeCacheFreeCacheBlock *_bins[NumBins];
+    uint64_t _nonEmptyBins[NumBitmapWords];
+};
+
+/**
+ * Flat map from code addresses to the code cache (or per-cache structure)
+ * covering them, for lookups on the stack walking path.
+ *
+ * The map spans one contiguous address range, normally the code cache
+ * repository, split into granules of 2^GranuleShift bytes. Each granule holds
+ * up to RangesPerGranule ranges that overlap it, so a lookup is an index
+ * computation plus a bounds check on at most two entries, and needs no lock.
+ *
+ * Entries are written once and never removed: code caches are not returned
+ * to the repository while the JIT is running. A writer fills in the bounds of
+ * an entry and publishes its value last, behind a write barrier, so a reader
+ * that sees a value also sees its bounds. Writers must be serialized by the
+ * caller.
+ *
+ * Ranges that cannot be recorded, because they fall outside the mapped span
+ * or because a granule is already full, are counted. Until that happens the
+ * map is exhaustive and a miss is authoritative; afterwards callers must fall
+ * back on a slower search when the map misses.
+ */
+class CodeCacheAddressMap {
+public:
+    enum {
+        GranuleShift = 18,
+        RangesPerGranule = 2
+    };
+
+    struct Range {
+        uintptr_t _start;
+        uintptr_t _end;
+        void *volatile _value;
+    };
+
+    CodeCacheAddressMap()
+        : _base(0)
+        , _size(0)
+        , _ranges(NULL)
+        , _numUnmappedRanges(0)
+    {}
+
+    /**
+     * @returns the number of bytes of memory needed to map [base, top)
+     */
+    static size_t sizeInBytes(uintptr_t base, uintptr_t top);
+
+    /**
+     * @brief Start mapping [base, top) using the given memory, which must be
+     *        at least sizeInBytes(base, top) bytes long
+     */
+    void initialize(uintptr_t base, uintptr_t top, void *memory);
+
+    /**
+     * @brief Record that [start, end) belongs to value
+     */
+    void insert(uintptr_t start, uintptr_t end, void *value);
+
+    /**
+     * @returns the value whose range contains address, or NULL if the map
+     *          has none
+     */
+    void *lookup(uintptr_t address) const;
+
+    bool isInitialized() const { return _ranges != NULL; }
+
+    /**
+     * @returns true if every range inserted so far can be found by lookup
+     */
+    bool isExhaustive() const { return _numUnmappedRanges == 0; }
+
+private:
+    uintptr_t _base;
+    uintptr_t _size;
+    Range *_ranges;
+    uint32_t _numUnmappedRanges;
+};
+
 struct FaintCacheBlock {
     FaintCacheBlock *_next;
     OMR::MethodExceptionData *_metaData;
@@ -28,11 +28,13 @@
 #include <string.h>
 #include "AtomicSupport.hpp"
 #include "env/FrontEnd.hpp"
+#include "control/CompiledBodyCache.hpp"
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/IO.hpp"
 #include "env/defines.h"
+#include "env/PersistentInfo.hpp"
 #include "env/jittypes.h"
 #include "env/VerboseLog.hpp"
 #include "il/DataTypes.hpp"
@@ -44,6 +46,8 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/CodeCacheMemorySegment.hpp"
 #include "runtime/CodeCacheConfig.hpp"
+#include "runtime/CodeCacheLayout.hpp"
+#include "runtime/PerfJitDump.hpp"
 #include "runtime/Runtime.hpp"
 
 #ifdef LINUX
@@ -106,6 +110,13 @@ TR::CodeCache *OMR::CodeCache::self() { return static_cast<TR::CodeCache *>(this
 
 void OMR::CodeCache::destroy(TR::CodeCacheManager *manager)
 {
+    // bodies in this cache must not be handed out to later compilations
+    TR_PersistentMemory *persistentMemory = TR::Compiler->persistentMemory();
+    TR_CompiledBodyCache *compiledBodyCache
+        = persistentMemory ? persistentMemory->getPersistentInfo()->getCompiledBodyCacheIfCreated() : NULL;
+    if (compiledBodyCache)
+        compiledBodyCache->discard(self()->getCodeBase(), self()->getCodeTop());
+
     while (_hashEntrySlab) {
         CodeCacheHashEntrySlab *slab = _hashEntrySlab;
         _hashEntrySlab = slab->_next;
@@ -149,6 +160,8 @@ const char *OMR::CodeCache::getCodeCacheKindString()
             return "TRANSIENT_CODE_CC";
         case TR::CodeCacheKind::FILE_BACKED_CC:
             return "FILE_BACKED_CC";
+        case TR::CodeCacheKind::HOT_CODE_CC:
+            return "HOT_CODE_CC";
         default:
             return "UNKNOWN";
     }
@@ -170,7 +183,7 @@ void OMR::CodeCache::writeMethodHeader(void *freeBlock, size_t size, bool isCold
 {
     omrthread_jit_write_protect_disable();
 
-    CodeCacheMethodHeader *block = (CodeCacheMethodHeader *)freeBlock;
+    CodeCacheMethodHeader *block = _manager->writableAddress((CodeCacheMethodHeader *)freeBlock);
     block->_size = static_cast<uint32_t>(size);
 
     TR::CodeCacheConfig &config = _manager->codeCacheConfig();
@@ -220,7 +233,7 @@ bool OMR::CodeCache::trimCodeMemoryAllocation(void *codeMemoryStart, size_t actu
         _warmCodeAlloc -= shrinkage;
 
         omrthread_jit_write_protect_disable();
-        cacheHeader->_size = static_cast<uint32_t>(actualSizeInBytes);
+        _manager->writableAddress(cacheHeader)->_size = static_cast<uint32_t>(actualSizeInBytes);
         omrthread_jit_write_protect_enable();
         return true;
     } else // the allocation could have been from a free block or from the cold portion
@@ -232,7 +245,7 @@ bool OMR::CodeCache::trimCodeMemoryAllocation(void *codeMemoryStart, size_t actu
                 // fprintf(stderr, "---ccr--- addFreeBlock due to shrinkage\n");
             }
             omrthread_jit_write_protect_disable();
-            cacheHeader->_size = static_cast<uint32_t>(actualSizeInBytes);
+            _manager->writableAddress(cacheHeader)->_size = static_cast<uint32_t>(actualSizeInBytes);
             omrthread_jit_write_protect_enable();
             return true;
         }
@@ -277,6 +290,8 @@ bool OMR::CodeCache::initialize(TR::CodeCacheManager *manager, TR::CodeCacheMemo
 
     _hashEntryFreeList = NULL;
     _freeBlockList = NULL;
+    _warmFreeBlocks.init();
+    _coldFreeBlocks.init();
     _flags = 0;
     _CCPreLoadedCodeInitialized = false;
     self()->unreserve();
@@ -386,7 +401,7 @@ bool OMR::CodeCache::initialize(TR::CodeCacheManager *manager, TR::CodeCacheMemo
     // write a pointer to this cache at the beginning of the segment
     VM_AtomicSupport::writeBarrier();
     omrthread_jit_write_protect_disable();
-    *((TR::CodeCache **)(_segment->segmentBase())) = self();
+    *_manager->writableAddress((TR::CodeCache **)(_segment->segmentBase())) = self();
     omrthread_jit_write_protect_enable();
 
     return true;
@@ -690,9 +705,11 @@ void OMR::CodeCache::patchCallPoint(TR_OpaqueMethodBlock *method, void *callSite
                 callSite, method, resolvedTramp, methodRunAddress, newStartPC, extraArg);
         }
 
-        // Patch the code for a method trampoline
-        int32_t rc = _manager->codeCacheConfig().mccCallbacks().patchTrampoline(method, callSite, methodRunAddress,
-            resolvedTramp, newStartPC, extraArg);
+        // Patch the code for a method trampoline. The call site and trampoline are written through
+        // their writable views, which differ from the executable ones on a dual-mapped cache
+        int32_t rc = _manager->codeCacheConfig().mccCallbacks().patchTrampoline(method, callSite,
+            _manager->writableAddress(callSite), methodRunAddress, resolvedTramp,
+            _manager->writableAddress(resolvedTramp), newStartPC, extraArg);
     }
 }
 
@@ -705,7 +722,8 @@ void OMR::CodeCache::createTrampoline(CodeCacheTrampolineCode *trampoline, void
     TR_OpaqueMethodBlock *method)
 {
     TR::CodeCacheConfig &config = _manager->codeCacheConfig();
-    config.mccCallbacks().createMethodTrampoline(trampoline, targetStartPC, method);
+    config.mccCallbacks().createMethodTrampoline(trampoline, _manager->writableAddress(trampoline), targetStartPC,
+        method);
 }
 
 bool OMR::CodeCache::saveTempTrampoline(CodeCacheHashEntry *entry)
@@ -851,6 +869,19 @@ bool OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start, uint8_t *end, con
 {
     TR::CodeCacheConfig &config = _manager->codeCacheConfig();
 
+    // a body shared through the compiled body cache stays until its last user frees it
+    TR_PersistentMemory *persistentMemory = TR::Compiler->persistentMemory();
+    TR_CompiledBodyCache *compiledBodyCache
+        = persistentMemory ? persistentMemory->getPersistentInfo()->getCompiledBodyCacheIfCreated() : NULL;
+    if (compiledBodyCache && !compiledBodyCache->release(start, end))
+        return false;
+
+    // the code is gone even if the block is too small to be reused
+    if (_manager->perfJitDump())
+        _manager->perfJitDump()->codeUnload(start, end);
+    if (_manager->codeCacheLayout())
+        _manager->codeCacheLayout()->codeFreed(start, end);
+
     // align start on a code cache alignment boundary
     uint8_t *start_o = start;
     uint32_t round = static_cast<uint32_t>(config.codeCacheAlignment());
@@ -874,7 +905,7 @@ bool OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start, uint8_t *end, con
     // Destroy the eyeCatcher; note that there might not be an eyecatcher at all
     //
     if (size >= sizeof(CodeCacheMethodHeader))
-        ((CodeCacheMethodHeader *)start)->_eyeCatcher[0] = 0;
+        _manager->writableAddress((CodeCacheMethodHeader *)start)->_eyeCatcher[0] = 0;
 
     // fprintf(stderr, "--ccr-- newFreeBlock size %d at %p\n", size, start);
     CodeCacheFreeCacheBlock *mergedBlock = NULL;
@@ -885,7 +916,7 @@ bool OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start, uint8_t *end, con
         for (curr = _freeBlockList; curr->_next && (uint8_t *)(curr->_next) < start; curr = curr->_next) {
         }
 
-        if (start < (uint8_t *)curr && (uint8_t *)curr - end < sizeof(CodeCacheFreeCacheBlock)) {
+        if (start < (uint8_t *)curr && (uint8_t *)curr - end < FREE_BLOCK_MERGE_DISTANCE) {
             // merge with the curr block ahead, which is also the first block
             TR_ASSERT(end <= (uint8_t *)curr, "assertion failure"); // check for no overlap of blocks
             // we should not merge warm block with cold blocks
@@ -895,43 +926,59 @@ bool OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start, uint8_t *end, con
                 mergedBlock = curr;
                 // fprintf(stderr, "--ccr-- merging new free block of the size %d with a block of the size %d at %p\n",
                 // size, curr->size, link);
-                link->_size = (uint8_t *)curr + curr->_size - start;
-                link->_next = curr->_next;
+                self()->freeBlockIndexFor(curr).remove(curr);
+                CodeCacheFreeCacheBlock *writableLink = _manager->writableAddress(link);
+                writableLink->_size = (uint8_t *)curr + curr->_size - start;
+                writableLink->_next = curr->_next;
+                writableLink->_prev = NULL;
+                if (link->_next)
+                    _manager->writableAddress(link->_next)->_prev = link;
                 _freeBlockList = link;
                 // fprintf(stderr, "--ccr-- new merged free block's size is %d\n", link->size);
             }
-        } else if (curr->_next && ((uint8_t *)curr->_next - end < sizeof(CodeCacheFreeCacheBlock))
+        } else if (curr->_next && ((uint8_t *)curr->_next - end < FREE_BLOCK_MERGE_DISTANCE)
             && !(start < _warmCodeAlloc && (uint8_t *)curr->_next >= _coldCodeAlloc)) {
             // merge with the next block, but don't merge warm blocks with cold blocks
-            if ((start - ((uint8_t *)curr + curr->_size) < sizeof(CodeCacheFreeCacheBlock))
+            CodeCacheFreeCacheBlock *next = curr->_next;
+            self()->freeBlockIndexFor(next).remove(next);
+            if ((start - ((uint8_t *)curr + curr->_size) < FREE_BLOCK_MERGE_DISTANCE)
                 && !((uint8_t *)curr < _warmCodeAlloc && start >= _coldCodeAlloc)) {
                 // merge with the previous and the next blocks
                 mergedBlock = curr;
                 // fprintf(stderr, "--ccr-- merging new free block of the size %d with blocks of the size %d and %d at
                 // %p\n", size, curr->_size, curr->_next->_size, curr);
-                curr->_size = (uint8_t *)curr->_next + curr->_next->_size - (uint8_t *)curr;
-                curr->_next = curr->_next->_next;
+                self()->freeBlockIndexFor(curr).remove(curr);
+                CodeCacheFreeCacheBlock *writableCurr = _manager->writableAddress(curr);
+                writableCurr->_size = (uint8_t *)next + next->_size - (uint8_t *)curr;
+                writableCurr->_next = next->_next;
+                if (curr->_next)
+                    _manager->writableAddress(curr->_next)->_prev = curr;
                 // fprintf(stderr, "--ccr-- new merged free block's size is %d\n", curr->_size);
                 link = curr;
 #ifdef DEBUG
                 start = (uint8_t *)curr;
 #endif
             } else {
-                mergedBlock = curr->_next;
+                mergedBlock = next;
                 link = (CodeCacheFreeCacheBlock *)start;
                 // fprintf(stderr, "--ccr-- merging new free block of the size %d with a block of the size %d at %p\n",
                 // size, curr->next->size, link);
-                link->_size = (uint8_t *)curr->_next + curr->_next->_size - start;
-                link->_next = curr->_next->_next;
-                curr->_next = link;
+                CodeCacheFreeCacheBlock *writableLink = _manager->writableAddress(link);
+                writableLink->_size = (uint8_t *)next + next->_size - start;
+                writableLink->_next = next->_next;
+                writableLink->_prev = curr;
+                if (link->_next)
+                    _manager->writableAddress(link->_next)->_prev = link;
+                _manager->writableAddress(curr)->_next = link;
                 // fprintf(stderr, "--ccr-- new merged free block's size is %d\n", link->_size);
             }
         } else if ((uint8_t *)curr < start
-            && start - ((uint8_t *)curr + curr->_size) < sizeof(CodeCacheFreeCacheBlock)) {
+            && start - ((uint8_t *)curr + curr->_size) < FREE_BLOCK_MERGE_DISTANCE) {
             // merge with the previous block
             if (!((uint8_t *)curr < _warmCodeAlloc && start >= _coldCodeAlloc)) {
                 mergedBlock = curr;
-                curr->_size = start + size - (uint8_t *)curr;
+                self()->freeBlockIndexFor(curr).remove(curr);
+                _manager->writableAddress(curr)->_size = start + size - (uint8_t *)curr;
                 // fprintf(stderr, "--ccr-- new merged free block's size is %d\n", curr->_size);
                 link = curr;
 #ifdef DEBUG
@@ -942,24 +989,34 @@ bool OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start, uint8_t *end, con
         if (!link) // no merging happened
         {
             link = (CodeCacheFreeCacheBlock *)start;
-            link->_size = size;
+            CodeCacheFreeCacheBlock *writableLink = _manager->writableAddress(link);
+            writableLink->_size = size;
             if (start < (uint8_t *)curr) {
-                link->_next = _freeBlockList;
+                writableLink->_prev = NULL;
+                writableLink->_next = _freeBlockList;
+                _manager->writableAddress(_freeBlockList)->_prev = link;
                 _freeBlockList = link;
             } else {
-                link->_next = curr->_next;
-                curr->_next = link;
+                writableLink->_prev = curr;
+                writableLink->_next = curr->_next;
+                if (link->_next)
+                    _manager->writableAddress(link->_next)->_prev = link;
+                _manager->writableAddress(curr)->_next = link;
             }
         }
     } else // This is the first block in the list
     {
         _freeBlockList = (CodeCacheFreeCacheBlock *)start;
-        _freeBlockList->_size = size;
-        _freeBlockList->_next = NULL;
+        CodeCacheFreeCacheBlock *writableBlock = _manager->writableAddress(_freeBlockList);
+        writableBlock->_size = size;
+        writableBlock->_next = NULL;
+        writableBlock->_prev = NULL;
         // updateMaxSizeOfFreeBlocks(_freeBlockList, _freeBlockList->_size);
         link = _freeBlockList;
     }
 
+    self()->freeBlockIndexFor(link).insert(link);
+
     self()->updateMaxSizeOfFreeBlocks(link, link->_size);
 
     _manager->decreaseCurrTotalUsedInBytes(size);
@@ -973,7 +1030,8 @@ bool OMR::CodeCache::addFreeBlock2WithCallSite(uint8_t *start, uint8_t *end, con
     }
 #ifdef DEBUG
     uint8_t *paintStart = start + sizeof(CodeCacheFreeCacheBlock);
-    memset((void *)paintStart, 0xcc, ((CodeCacheFreeCacheBlock *)start)->_size - sizeof(CodeCacheFreeCacheBlock));
+    memset(_manager->writableAddress(paintStart), 0xcc,
+        ((CodeCacheFreeCacheBlock *)start)->_size - sizeof(CodeCacheFreeCacheBlock));
 #endif
 
     if (config.doSanityChecks())
@@ -1007,84 +1065,30 @@ void OMR::CodeCache::updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr
 //
 uint8_t *OMR::CodeCache::findFreeBlock(size_t size, bool isCold, bool isMethodHeaderNeeded)
 {
-    CodeCacheFreeCacheBlock *currLink;
-    CodeCacheFreeCacheBlock *prevLink;
-    CodeCacheFreeCacheBlock *bestFitLink = NULL, *bestFitLinkPrev = NULL;
-    CodeCacheFreeCacheBlock *biggestLink = NULL;
-    CodeCacheFreeCacheBlock *secondBiggestLink = NULL;
-
     TR_ASSERT(_freeBlockList, "Because we first checked that a freeBlockExists, freeBlockList cannot be null");
 
-    // Find the smallest free link to fit the requested blockSize
-    for (currLink = _freeBlockList, prevLink = NULL; currLink; prevLink = currLink, currLink = currLink->_next) {
-        if (isCold) {
-            if ((void *)currLink < (void *)_coldCodeAlloc)
-                continue;
-        } else {
-            if ((void *)currLink >= (void *)_warmCodeAlloc)
-                continue;
-            // curLink is warm code
-        }
-
-        // fprintf(stderr, "cache %p findFreeBlock bs=%u\n", this, currLink->size);
-        if (!biggestLink) {
-            biggestLink = currLink;
-        } else {
-            if (currLink->_size
-                >= biggestLink->_size) // >= is important; do not use > only as secondBiggestLink may be wrong
-            {
-                secondBiggestLink = biggestLink;
-                biggestLink = currLink;
-            } else {
-                if (secondBiggestLink) {
-                    if (currLink->_size >= secondBiggestLink->_size)
-                        secondBiggestLink = currLink;
-                } else {
-                    secondBiggestLink = currLink;
-                }
-            }
-        }
-
-        if (currLink->_size >= size) {
-            if (!bestFitLink) {
-                bestFitLink = currLink;
-                bestFitLinkPrev = prevLink;
-            } else if (bestFitLink->_size > currLink->_size) {
-                bestFitLink = currLink;
-                bestFitLinkPrev = prevLink;
-            }
-        }
-    } // end for
+    CodeCacheFreeBlockIndex &index = isCold ? _coldFreeBlocks : _warmFreeBlocks;
+    CodeCacheFreeCacheBlock *bestFitLink = index.findFit(size);
 
     // safety net
-    TR_ASSERT(biggestLink, "There must be a biggestLink");
     TR_ASSERT(bestFitLink, "There must be a bestFitLink");
 
     TR::CodeCacheConfig &config = _manager->codeCacheConfig();
-    if (!isCold) {
-        TR_ASSERT(!config.codeCacheFreeBlockRecylingEnabled() || _sizeOfLargestFreeWarmBlock == biggestLink->_size,
-            "_sizeOfLargestFreeWarmBlock=%d  biggestLink->_size=%d", _sizeOfLargestFreeWarmBlock,
-            (int32_t)biggestLink->_size);
-    } else {
-        TR_ASSERT(!config.codeCacheFreeBlockRecylingEnabled() || _sizeOfLargestFreeColdBlock == biggestLink->_size,
-            "assertion failure");
-    }
+    size_t &sizeOfLargestFreeBlock = isCold ? _sizeOfLargestFreeColdBlock : _sizeOfLargestFreeWarmBlock;
+    TR_ASSERT(!config.codeCacheFreeBlockRecylingEnabled() || sizeOfLargestFreeBlock == index.largestBlockSize(),
+        "sizeOfLargestFreeBlock=%d index.largestBlockSize()=%d isCold=%d", (int32_t)sizeOfLargestFreeBlock,
+        (int32_t)index.largestBlockSize(), isCold);
 
     if (bestFitLink) {
-        // Fix the linked list by removing the allocated block AND if there is any unused
-        // space left in the currLink chunk, reclaim it and put back on the freeList
-        CodeCacheFreeCacheBlock *leftBlock = self()->removeFreeBlock(size, bestFitLinkPrev, bestFitLink);
+        bool wasBiggest = bestFitLink->_size >= sizeOfLargestFreeBlock;
+
+        // Fix the lists by removing the allocated block AND if there is any unused
+        // space left in the bestFitLink chunk, reclaim it and put back on the free lists
+        CodeCacheFreeCacheBlock *leftBlock = self()->removeFreeBlock(size, bestFitLink);
+
+        if (wasBiggest) // Size of biggest might have changed
+            sizeOfLargestFreeBlock = index.largestBlockSize();
 
-        if (bestFitLink == biggestLink) // Size of biggest might have changed
-        {
-            uint64_t leftBlockSize = leftBlock ? leftBlock->_size : 0;
-            uint64_t secondBiggestSize = secondBiggestLink ? secondBiggestLink->_size : 0;
-            uint64_t biggestSize = leftBlockSize > secondBiggestSize ? leftBlockSize : secondBiggestSize;
-            if (!isCold) {
-                _sizeOfLargestFreeWarmBlock = (size_t)biggestSize;
-            } else
-                _sizeOfLargestFreeColdBlock = (size_t)biggestSize;
-        }
         // fprintf(stderr, "--ccr-- reallocate free'd block of size %d\n", size);
         if (config.verboseReclamation()) {
             TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,
@@ -1107,48 +1111,60 @@ uint8_t *OMR::CodeCache::findFreeBlock(size_t size, bool isCold, bool isMethodHe
     return (uint8_t *)bestFitLink;
 }
 
-// Remove a free block from the list of free blocks for this code cache to make
+// Remove a free block from the lists of free blocks for this code cache to make
 // it available for re-use.
 //
 // blockSize is the amount of memory needed from this free block.
 //
 // The function returns the remaining part of the block that was split
-OMR::CodeCacheFreeCacheBlock *OMR::CodeCache::removeFreeBlock(size_t blockSize, CodeCacheFreeCacheBlock *prev,
-    CodeCacheFreeCacheBlock *curr)
+OMR::CodeCacheFreeCacheBlock *OMR::CodeCache::removeFreeBlock(size_t blockSize, CodeCacheFreeCacheBlock *curr)
 {
+    CodeCacheFreeCacheBlock *prev = curr->_prev;
     CodeCacheFreeCacheBlock *next = curr->_next;
 
+    omrthread_jit_write_protect_disable();
+
+    CodeCacheFreeBlockIndex &index = self()->freeBlockIndexFor(curr);
+    index.remove(curr);
+
     // Is there any left over space in the current link? Save it as a
     // separate link and adjust the sizes of the two split resulting blocks
+    CodeCacheFreeCacheBlock *leftBlock = NULL;
     if (curr->_size - blockSize >= MIN_SIZE_BLOCK) {
-        omrthread_jit_write_protect_disable();
-
         size_t splitSize = curr->_size - blockSize; // remaining portion
-        curr->_size = blockSize;
-        curr = (CodeCacheFreeCacheBlock *)((uint8_t *)curr + blockSize);
-        curr->_size = splitSize;
-        curr->_next = next;
-
-        if (prev)
-            prev->_next = curr;
-        else
-            _freeBlockList = curr;
+        _manager->writableAddress(curr)->_size = blockSize;
+        leftBlock = (CodeCacheFreeCacheBlock *)((uint8_t *)curr + blockSize);
+        CodeCacheFreeCacheBlock *writableLeftBlock = _manager->writableAddress(leftBlock);
+        writableLeftBlock->_size = splitSize;
+        writableLeftBlock->_next = next;
+        writableLeftBlock->_prev = prev;
+        index.insert(leftBlock);
+    }
 
-        omrthread_jit_write_protect_enable();
+    CodeCacheFreeCacheBlock *replacement = leftBlock ? leftBlock : next;
+    if (prev)
+        _manager->writableAddress(prev)->_next = replacement;
+    else
+        _freeBlockList = replacement;
 
-        return curr;
-    } else // Use the entire block
-    {
-        omrthread_jit_write_protect_disable();
+    if (next)
+        _manager->writableAddress(next)->_prev = leftBlock ? leftBlock : prev;
 
-        if (prev)
-            prev->_next = next;
-        else
-            _freeBlockList = next;
+    omrthread_jit_write_protect_enable();
 
-        omrthread_jit_write_protect_enable();
+    return leftBlock;
+}
 
-        return NULL;
+void OMR::CodeCache::setFreeBlockList(CodeCacheFreeCacheBlock *fcb)
+{
+    _freeBlockList = fcb;
+    _warmFreeBlocks.init();
+    _coldFreeBlocks.init();
+
+    CodeCacheFreeCacheBlock *prev = NULL;
+    for (CodeCacheFreeCacheBlock *block = fcb; block; prev = block, block = block->_next) {
+        _manager->writableAddress(block)->_prev = prev;
+        self()->freeBlockIndexFor(block).insert(block);
     }
 }
 
@@ -1200,6 +1216,17 @@ void OMR::CodeCache::printOccupancyStats()
     fprintf(stderr, "   config size     = %8" OMR_PRIuSIZE " bytes\n", totalConfigSizeInBytes);
     fprintf(stderr, "   total free size = %8" OMR_PRIuSIZE " bytes\n", totalFreeSizeInBytes);
     fprintf(stderr, "   total used size = %8" OMR_PRIuSIZE " bytes\n", totalConfigSizeInBytes - totalFreeSizeInBytes);
+
+    TR::CodeCacheManager::HugePageBacking hugePageBacking = _manager->repositoryHugePageBacking();
+    if (hugePageBacking != TR::CodeCacheManager::NoHugePages) {
+        TR::CodeCacheMemorySegment *repository = _manager->getCodeCacheRepositorySegment();
+        size_t repositorySizeInBytes
+            = repository->segmentTop() + sizeof(TR::CodeCacheMemorySegment) - repository->segmentBase();
+        fprintf(stderr, "   huge page size  = %8" OMR_PRIuSIZE " bytes (%s)\n", config.largeCodePageSize(),
+            TR::CodeCacheManager::hugePageBackingString(hugePageBacking));
+        fprintf(stderr, "   repository huge page coverage = %" OMR_PRIuSIZE " of %" OMR_PRIuSIZE " bytes\n",
+            _manager->repositoryHugePageBytes(), repositorySizeInBytes);
+    }
 }
 
 void OMR::CodeCache::printFreeBlocks()
@@ -1254,6 +1281,12 @@ void OMR::CodeCache::checkForErrors()
                     doCrash = true;
                 }
                 // Next free block (if any) should be after the end of this free block
+                if (currLink->_next && currLink->_next->_prev != currLink) {
+                    fprintf(stderr,
+                        "checkForErrors cache %p: Error: next block (%p) of %p links back to %p instead\n", this,
+                        currLink->_next, currLink, currLink->_next->_prev);
+                    doCrash = true;
+                }
                 if (currLink->_next) {
                     if ((uint8_t *)currLink->_next == endBlock) {
                         // Two freed blocks can be adjacent if one belongs to the warm region
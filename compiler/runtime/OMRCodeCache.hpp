@@ -243,8 +243,12 @@ public:
 private:
     void updateMaxSizeOfFreeBlocks(CodeCacheFreeCacheBlock *blockPtr, size_t blockSize);
 
-    CodeCacheFreeCacheBlock *removeFreeBlock(size_t blockSize, CodeCacheFreeCacheBlock *prev,
-        CodeCacheFreeCacheBlock *curr);
+    CodeCacheFreeCacheBlock *removeFreeBlock(size_t blockSize, CodeCacheFreeCacheBlock *curr);
+
+    CodeCacheFreeBlockIndex &freeBlockIndexFor(CodeCacheFreeCacheBlock *block)
+    {
+        return (uint8_t *)block < _warmCodeAlloc ? _warmFreeBlocks : _coldFreeBlocks;
+    }
 
 public:
     bool addFreeBlock2WithCallSite(uint8_t *start, uint8_t *end, const char *file, uint32_t lineNumber);
@@ -315,9 +319,11 @@ public:
     /**
      * @brief Setter for freeBlockList
      *
+     * The blocks reachable from the new head through _next are re-indexed.
+     *
      * @param[in] : The new head of the CodeCacheFreeCacheBlock list
      */
-    void setFreeBlockList(CodeCacheFreeCacheBlock *fcb) { _freeBlockList = fcb; }
+    void setFreeBlockList(CodeCacheFreeCacheBlock *fcb);
 
     /**
      * @brief Getter for the base address of temporary trampolines
@@ -434,6 +440,8 @@ public:
     TR::CodeCacheMemorySegment *_segment;
 
     CodeCacheFreeCacheBlock *_freeBlockList;
+    CodeCacheFreeBlockIndex _warmFreeBlocks;
+    CodeCacheFreeBlockIndex _coldFreeBlocks;
 
     /**
      * @brief Returns pointer to the cold code RSS Region
@@ -49,15 +49,21 @@ class CodeGenerator;
 
 namespace OMR {
 
+// Code addresses passed to these callbacks are executable addresses, which are the ones
+// to encode in code. On a dual-mapped cache the executable view can't be written, so
+// createHelperTrampolines and createCCPreLoadedCode write through
+// TR::CodeCacheManager::writableAddress(), and the other callbacks are also given the
+// writable view of the code they modify. Without dual mapping both views are the same.
 struct CodeCacheCodeGenCallbacks {
     void (*codeCacheConfig)(int32_t codeCacheSizeInBytes, uint32_t *numTempTrampolines);
 
     void (*createHelperTrampolines)(uint8_t *helperBase, int32_t helperCount);
 
-    void (*createMethodTrampoline)(void *trampoline, void *targetStartPC, TR_OpaqueMethodBlock *method);
+    void (*createMethodTrampoline)(void *trampoline, void *writableTrampoline, void *targetStartPC,
+        TR_OpaqueMethodBlock *method);
 
-    int (*patchTrampoline)(void *method, void *callingPoint, void *currentStartPC, void *currentTrampoline,
-        void *newStartPC, void *extraArg);
+    int (*patchTrampoline)(void *method, void *callingPoint, void *writableCallingPoint, void *currentStartPC,
+        void *currentTrampoline, void *writableCurrentTrampoline, void *newStartPC, void *extraArg);
 
     void (*createCCPreLoadedCode)(uint8_t *CCPreLoadedCodeBase, uint8_t *CCPreLoadedCodeTop, void **CCPreLoadedCode,
         TR::CodeGenerator *cg);
@@ -94,6 +100,9 @@ public:
         , _codeCacheFreeBlockRecylingEnabled(false)
         , _emitExecutableELF(false)
         , _emitRelocatableELF(false)
+        , _emitPerfJitDump(false)
+        , _hotCodeLayout(false)
+        , _codeCacheDualMapping(false)
     {
 #if defined(J9ZOS390) // EBCDIC
         _warmEyeCatcher[0] = '\xD1';
@@ -184,6 +193,12 @@ public:
 
     bool emitRelocatableELF() const { return _emitRelocatableELF; }
 
+    bool emitPerfJitDump() const { return _emitPerfJitDump; }
+
+    bool hotCodeLayout() const { return _hotCodeLayout; }
+
+    bool codeCacheDualMapping() const { return _codeCacheDualMapping; }
+
     int32_t _trampolineCodeSize; /*!< size of the trampoline code in bytes */
     int32_t _CCPreLoadedCodeSize; /*!< size of the pre-Loaded CodeCache Helpers code in bytes */
     int32_t _numOfRuntimeHelpers; /*!< number of runtime helpers */
@@ -214,6 +229,9 @@ public:
 
     bool _emitExecutableELF; /*!< emit code cache as ELF object on shutdown */
     bool _emitRelocatableELF;
+    bool _emitPerfJitDump; /*!< describe compiled code in a perf jitdump file as it is loaded and freed */
+    bool _hotCodeLayout; /*!< place methods chosen by the code cache layout contiguously in a hot code cache */
+    bool _codeCacheDualMapping; /*!< map the repository read-execute for running code and read-write for writing it */
 
     char * const warmEyeCatcher() { return _warmEyeCatcher; }
 
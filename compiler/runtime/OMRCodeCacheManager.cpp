@@ -43,6 +43,8 @@
 #include "runtime/CodeCacheManager.hpp"
 #include "runtime/CodeCacheMemorySegment.hpp"
 #include "runtime/CodeCacheConfig.hpp"
+#include "runtime/CodeCacheLayout.hpp"
+#include "runtime/PerfJitDump.hpp"
 #include "runtime/Runtime.hpp"
 
 #if defined(OMR_OS_WINDOWS)
@@ -56,6 +58,13 @@
 #include <unistd.h>
 #include "codegen/ELFGenerator.hpp"
 
+// Encoding of the page size in the mmap flags for MAP_HUGETLB, from <linux/mman.h>
+#if defined(MAP_HUGE_SHIFT)
+#define HUGE_PAGE_SIZE_SHIFT MAP_HUGE_SHIFT
+#else
+#define HUGE_PAGE_SIZE_SHIFT 26
+#endif
+
 TR::CodeCacheSymbolContainer *OMR::CodeCacheManager::_symbolContainer = NULL;
 
 #endif // HOST_OS == OMR_LINUX
@@ -66,6 +75,12 @@ OMR::CodeCacheManager::CodeCacheManager(TR::RawAllocator rawAllocator)
     , _codeCacheFull(false)
     , _currTotalUsedInBytes(0)
     , _maxUsedInBytes(0)
+    , _perfJitDump(NULL)
+    , _codeCacheLayout(NULL)
+    , _repositoryHugePageBacking(NoHugePages)
+    , _executableViewBase(NULL)
+    , _executableViewTop(NULL)
+    , _writableViewOffset(0)
 {
     _codeCacheManager = self();
 }
@@ -86,6 +101,10 @@ OMR::CodeCacheManager::UsageMonitorCriticalSection::UsageMonitorCriticalSection(
     : CriticalSection(mgr->_usageMonitor)
 {}
 
+OMR::CodeCacheManager::SymbolMonitorCriticalSection::SymbolMonitorCriticalSection(TR::CodeCacheManager *mgr)
+    : CriticalSection(mgr->_symbolMonitor)
+{}
+
 TR::CodeCache *OMR::CodeCacheManager::initialize(bool allocateMonolithicCodeCache,
     uint32_t numberOfCodeCachesToCreateAtStartup)
 {
@@ -108,6 +127,21 @@ TR::CodeCache *OMR::CodeCacheManager::initialize(bool allocateMonolithicCodeCach
 
     TR::CodeCacheConfig &config = self()->codeCacheConfig();
 
+    if (config.emitPerfJitDump()) {
+        static const char *perfJitDumpDir = feGetEnv("TR_PerfJitDumpDir");
+        _perfJitDump = TR::PerfJitDump::create(_rawAllocator, perfJitDumpDir ? perfJitDumpDir : "/tmp");
+        if (_perfJitDump == NULL && config.verboseCodeCache())
+            TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "failed to create perf jitdump file");
+    }
+
+    if (config.hotCodeLayout()) {
+        // A cluster of methods calling each other should fit in one code page
+        size_t clusterSizeLimit = config.largeCodePageSize() > 0 ? config.largeCodePageSize() : 4096;
+        _codeCacheLayout = TR::CodeCacheLayout::create(_rawAllocator, clusterSizeLimit);
+        if (_codeCacheLayout == NULL && config.verboseCodeCache())
+            TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE, "failed to create code cache layout");
+    }
+
     if (allocateMonolithicCodeCache) {
         size_t size = config.codeCacheTotalKB() * 1024;
         if (self()->allocateCodeCacheRepository(size)) {
@@ -146,6 +180,9 @@ TR::CodeCache *OMR::CodeCacheManager::initialize(bool allocateMonolithicCodeCach
     if (!(_usageMonitor = TR::Monitor::create("CodeCacheUsageMonitor")))
         return NULL;
 
+    if (!(_symbolMonitor = TR::Monitor::create("CodeCacheSymbolMonitor")))
+        return NULL;
+
 #if defined(TR_HOST_POWER)
 #define REACHEABLE_RANGE_KB (32 * 1024)
 #elif defined(TR_HOST_ARM64)
@@ -214,6 +251,16 @@ void OMR::CodeCacheManager::destroy()
     }
 #endif // HOST_OS == OMR_LINUX
 
+    if (_perfJitDump) {
+        _perfJitDump->destroy();
+        _perfJitDump = NULL;
+    }
+
+    if (_codeCacheLayout) {
+        _codeCacheLayout->destroy();
+        _codeCacheLayout = NULL;
+    }
+
     TR::CodeCache *codeCache = self()->getFirstCodeCache();
     while (codeCache != NULL) {
         TR::CodeCache *nextCache = codeCache->next();
@@ -224,9 +271,14 @@ void OMR::CodeCacheManager::destroy()
 
     if (self()->usingRepository()) {
         self()->freeCodeCacheSegment(_codeCacheRepositorySegment);
+        _repositoryHugePageBacking = NoHugePages;
+        _executableViewBase = NULL;
+        _executableViewTop = NULL;
+        _writableViewOffset = 0;
     }
 
     TR::Monitor::destroy(_usageMonitor);
+    TR::Monitor::destroy(_symbolMonitor);
     TR::Monitor::destroy(_codeCacheList._mutex);
     TR::Monitor::destroy(_codeCacheRepositoryMonitor);
 
@@ -261,6 +313,8 @@ void OMR::CodeCacheManager::addCodeCache(TR::CodeCache *codeCache)
     codeCache->linkTo(_codeCacheList._head);
     FLUSH_MEMORY(true); // Insure codeCache contents are globally visible before adding it to the list!
     _codeCacheList._head = codeCache;
+
+    _codeCacheMap.insert((uintptr_t)codeCache->getCodeBase(), (uintptr_t)codeCache->getHelperTop() + 1, codeCache);
     _curNumberOfCodeCaches++;
 }
 
@@ -445,7 +499,11 @@ void OMR::CodeCacheManager::performSizeAdjustments(size_t &warmCodeSize, size_t
 //
 TR::CodeCache *OMR::CodeCacheManager::findCodeCacheFromPC(void *inCacheAddress)
 {
-    TR::CodeCache *codeCache = self()->getFirstCodeCache();
+    TR::CodeCache *codeCache = static_cast<TR::CodeCache *>(_codeCacheMap.lookup((uintptr_t)inCacheAddress));
+    if (codeCache || _codeCacheMap.isExhaustive())
+        return codeCache;
+
+    codeCache = self()->getFirstCodeCache();
     if (!codeCache)
         return NULL;
 
@@ -462,6 +520,30 @@ TR::CodeCache *OMR::CodeCacheManager::findCodeCacheFromPC(void *inCacheAddress)
     return NULL;
 }
 
+int32_t OMR::CodeCacheManager::patchCallsToHotMethod(TR_OpaqueMethodBlock *method, void *newStartPC)
+{
+    if (_codeCacheLayout == NULL || self()->codeCacheConfig().mccCallbacks().patchTrampoline == NULL)
+        return 0;
+
+    int32_t numPatched = 0;
+    std::vector<void *> callSites = _codeCacheLayout->callSitesTo(method);
+    for (size_t i = 0; i < callSites.size(); i++) {
+        TR::CodeCache *codeCache = self()->findCodeCacheFromPC(callSites[i]);
+        if (codeCache == NULL)
+            continue;
+
+        codeCache->patchCallPoint(method, callSites[i], newStartPC, NULL);
+        numPatched++;
+    }
+
+    if (numPatched > 0 && self()->codeCacheConfig().verboseCodeCache()) {
+        TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE, "patched %d call(s) to hot method %p at %p", numPatched,
+            method, newStartPC);
+    }
+
+    return numPatched;
+}
+
 // Trampoline Lookup
 // Find the trampoline for the given method in the code cache containing the
 // callingPC.
@@ -749,12 +831,35 @@ TR::CodeCacheMemorySegment *OMR::CodeCacheManager::allocateCodeCacheRepository(s
 
     void *startAddress = self()->chooseCacheStartAddress(repositorySize);
 
-    _codeCacheRepositorySegment
-        = self()->allocateCodeCacheSegment(repositorySize, codeCacheSizeAllocated, startAddress);
+    _codeCacheRepositorySegment = NULL;
+    if (config.codeCacheDualMapping()) {
+        intptr_t writableViewOffset = 0;
+        _codeCacheRepositorySegment
+            = self()->allocateDualMappedCodeCacheSegment(repositorySize, codeCacheSizeAllocated, writableViewOffset);
+        if (_codeCacheRepositorySegment) {
+            _executableViewBase = _codeCacheRepositorySegment->segmentBase();
+            _executableViewTop = _codeCacheRepositorySegment->segmentTop();
+            _writableViewOffset = writableViewOffset;
+        }
+    }
+    if (!_codeCacheRepositorySegment && config.largeCodePageSize() > 0)
+        _codeCacheRepositorySegment = self()->allocateHugePageCodeCacheSegment(repositorySize, codeCacheSizeAllocated,
+            _repositoryHugePageBacking);
+    if (!_codeCacheRepositorySegment)
+        _codeCacheRepositorySegment
+            = self()->allocateCodeCacheSegment(repositorySize, codeCacheSizeAllocated, startAddress);
     if (_codeCacheRepositorySegment) {
         _repositoryCodeCache = self()->allocateRepositoryCodeCache();
         new (_repositoryCodeCache) CodeCache();
 
+        // Every code cache is carved from the repository, so mapping it lets
+        // findCodeCacheFromPC avoid scanning the cache list
+        uintptr_t repositoryBase = (uintptr_t)_codeCacheRepositorySegment->segmentBase();
+        uintptr_t repositoryTop = (uintptr_t)_codeCacheRepositorySegment->segmentTop();
+        void *mapMemory = self()->getMemory(CodeCacheAddressMap::sizeInBytes(repositoryBase, repositoryTop));
+        if (mapMemory)
+            _codeCacheMap.initialize(repositoryBase, repositoryTop, mapMemory);
+
         // The VM expects the first entry in the segment to be a pointer to
         // a TR::CodeCache structure and the first two entries in the cache
         // to be warmCodeAlloc and coldCodeAlloc.
@@ -762,7 +867,7 @@ TR::CodeCacheMemorySegment *OMR::CodeCacheManager::allocateCodeCacheRepository(s
         omrthread_jit_write_protect_disable();
 
         uint8_t *start = _codeCacheRepositorySegment->segmentAlloc();
-        *((TR::CodeCache **)start) = self()->getRepositoryCodeCacheAddress();
+        *self()->writableAddress((TR::CodeCache **)start) = self()->getRepositoryCodeCacheAddress();
 
         omrthread_jit_write_protect_enable();
 
@@ -777,9 +882,12 @@ TR::CodeCacheMemorySegment *OMR::CodeCacheManager::allocateCodeCacheRepository(s
 
         if (config.verboseCodeCache()) {
             TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,
-                "allocateCodeCacheRepository: size=%u heapBase=%p heapAlloc=%p heapTop=%p", codeCacheSizeAllocated,
-                _codeCacheRepositorySegment->segmentBase(), _codeCacheRepositorySegment->segmentAlloc(),
-                _codeCacheRepositorySegment->segmentTop());
+                "allocateCodeCacheRepository: size=%u heapBase=%p heapAlloc=%p heapTop=%p hugePages=%s "
+                "writableView=%p",
+                codeCacheSizeAllocated, _codeCacheRepositorySegment->segmentBase(),
+                _codeCacheRepositorySegment->segmentAlloc(), _codeCacheRepositorySegment->segmentTop(),
+                hugePageBackingString(_repositoryHugePageBacking),
+                self()->writableAddress(_codeCacheRepositorySegment->segmentBase()));
         }
     }
 
@@ -826,8 +934,168 @@ TR::CodeCacheMemorySegment *OMR::CodeCacheManager::allocateCodeCacheSegment(size
     return memSegment;
 }
 
+TR::CodeCacheMemorySegment *OMR::CodeCacheManager::allocateHugePageCodeCacheSegment(size_t segmentSize,
+    size_t &codeCacheSizeToAllocate, HugePageBacking &backing)
+{
+    backing = NoHugePages;
+#if (HOST_OS == OMR_LINUX)
+    size_t hugePageSize = self()->codeCacheConfig().largeCodePageSize();
+    if (hugePageSize <= static_cast<size_t>(sysconf(_SC_PAGESIZE)) || (hugePageSize & (hugePageSize - 1)) != 0)
+        return NULL;
+
+    codeCacheSizeToAllocate = (segmentSize + hugePageSize - 1) & ~(hugePageSize - 1);
+
+    int hugePageShift = 0;
+    while ((static_cast<size_t>(1) << hugePageShift) < hugePageSize)
+        hugePageShift++;
+
+    uint8_t *memorySlab = reinterpret_cast<uint8_t *>(mmap(NULL, codeCacheSizeToAllocate,
+        PROT_READ | PROT_WRITE | PROT_EXEC,
+        MAP_ANONYMOUS | MAP_PRIVATE | MAP_HUGETLB | (hugePageShift << HUGE_PAGE_SIZE_SHIFT), -1, 0));
+    if (memorySlab != MAP_FAILED) {
+        backing = HugeTLBPages;
+    } else {
+        // The kernel only collapses huge page aligned ranges, so reserve an extra page to align within
+        size_t reservedSize = codeCacheSizeToAllocate + hugePageSize;
+        uint8_t *reservation = reinterpret_cast<uint8_t *>(
+            mmap(NULL, reservedSize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0));
+        if (reservation == MAP_FAILED)
+            return NULL;
+
+        memorySlab = reinterpret_cast<uint8_t *>(
+            (reinterpret_cast<uintptr_t>(reservation) + hugePageSize - 1) & ~(hugePageSize - 1));
+        if (memorySlab > reservation)
+            munmap(reservation, memorySlab - reservation);
+        uint8_t *reservationEnd = reservation + reservedSize;
+        if (reservationEnd > memorySlab + codeCacheSizeToAllocate)
+            munmap(memorySlab + codeCacheSizeToAllocate, reservationEnd - (memorySlab + codeCacheSizeToAllocate));
+
+        if (madvise(memorySlab, codeCacheSizeToAllocate, MADV_HUGEPAGE) != 0) {
+            munmap(memorySlab, codeCacheSizeToAllocate);
+            return NULL;
+        }
+        backing = TransparentHugePages;
+    }
+
+    TR::CodeCacheMemorySegment *memSegment = (TR::CodeCacheMemorySegment *)((size_t)memorySlab + codeCacheSizeToAllocate
+        - sizeof(TR::CodeCacheMemorySegment));
+    new (memSegment) TR::CodeCacheMemorySegment(memorySlab, reinterpret_cast<uint8_t *>(memSegment));
+    return memSegment;
+#else
+    return NULL;
+#endif // HOST_OS == OMR_LINUX
+}
+
+TR::CodeCacheMemorySegment *OMR::CodeCacheManager::allocateDualMappedCodeCacheSegment(size_t segmentSize,
+    size_t &codeCacheSizeToAllocate, intptr_t &writableViewOffset)
+{
+#if (HOST_OS == OMR_LINUX) && defined(TR_HOST_X86) && defined(TR_HOST_64BIT) && defined(MFD_CLOEXEC)
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    codeCacheSizeToAllocate = (segmentSize + pageSize - 1) & ~(pageSize - 1);
+
+    // Both views map the same file, so a store through one is seen through the other
+    int fd = memfd_create("omr-codecache", MFD_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+
+    uint8_t *executableView = reinterpret_cast<uint8_t *>(MAP_FAILED);
+    uint8_t *writableView = reinterpret_cast<uint8_t *>(MAP_FAILED);
+    if (ftruncate(fd, codeCacheSizeToAllocate) == 0) {
+        executableView = reinterpret_cast<uint8_t *>(
+            mmap(NULL, codeCacheSizeToAllocate, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0));
+        writableView = reinterpret_cast<uint8_t *>(
+            mmap(NULL, codeCacheSizeToAllocate, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+    }
+    close(fd); // the mappings keep the memory alive
+
+    TR::CodeCacheMemorySegment *memSegment = NULL;
+    if (executableView != MAP_FAILED && writableView != MAP_FAILED)
+        memSegment = static_cast<TR::CodeCacheMemorySegment *>(self()->getMemory(sizeof(TR::CodeCacheMemorySegment)));
+
+    if (memSegment == NULL) {
+        if (executableView != MAP_FAILED)
+            munmap(executableView, codeCacheSizeToAllocate);
+        if (writableView != MAP_FAILED)
+            munmap(writableView, codeCacheSizeToAllocate);
+        return NULL;
+    }
+
+    // The segment header is kept off the executable view so the runtime never writes into it
+    new (memSegment) TR::CodeCacheMemorySegment(executableView, executableView + codeCacheSizeToAllocate);
+    writableViewOffset = writableView - executableView;
+    return memSegment;
+#else
+    return NULL;
+#endif
+}
+
+void OMR::CodeCacheManager::freeDualMappedCodeCacheSegment(TR::CodeCacheMemorySegment *memSegment,
+    intptr_t writableViewOffset)
+{
+#if (HOST_OS == OMR_LINUX)
+    size_t size = memSegment->_top - memSegment->_base;
+    munmap(memSegment->_base, size);
+    munmap(memSegment->_base + writableViewOffset, size);
+    self()->freeMemory(memSegment);
+#endif // HOST_OS == OMR_LINUX
+}
+
+const char *OMR::CodeCacheManager::hugePageBackingString(HugePageBacking backing)
+{
+    switch (backing) {
+        case HugeTLBPages:
+            return "hugetlbfs";
+        case TransparentHugePages:
+            return "THP";
+        default:
+            return "none";
+    }
+}
+
+size_t OMR::CodeCacheManager::repositoryHugePageBytes()
+{
+    if (_repositoryHugePageBacking == NoHugePages || !self()->usingRepository())
+        return 0;
+
+    // The segment header at the top of the repository is part of the same mapping
+    uint8_t *start = _codeCacheRepositorySegment->segmentBase();
+    uint8_t *end = _codeCacheRepositorySegment->segmentTop() + sizeof(TR::CodeCacheMemorySegment);
+    if (_repositoryHugePageBacking == HugeTLBPages)
+        return end - start;
+
+    size_t hugePageBytes = 0;
+#if (HOST_OS == OMR_LINUX)
+    FILE *smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == NULL)
+        return 0;
+
+    // Each mapping starts with a "low-high perms ..." line followed by "Field: value" lines
+    size_t overlap = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), smaps)) {
+        unsigned long low, high, anonHugePagesKB;
+        if (sscanf(line, "%lx-%lx ", &low, &high) == 2) {
+            uint8_t *mappingStart = reinterpret_cast<uint8_t *>(low);
+            uint8_t *mappingEnd = reinterpret_cast<uint8_t *>(high);
+            overlap = (mappingStart < end && mappingEnd > start)
+                ? std::min(end, mappingEnd) - std::max(start, mappingStart)
+                : 0;
+        } else if (overlap > 0 && sscanf(line, "AnonHugePages: %lu kB", &anonHugePagesKB) == 1) {
+            hugePageBytes += std::min<size_t>(overlap, anonHugePagesKB * 1024);
+        }
+    }
+    fclose(smaps);
+#endif // HOST_OS == OMR_LINUX
+    return hugePageBytes;
+}
+
 void OMR::CodeCacheManager::freeCodeCacheSegment(TR::CodeCacheMemorySegment *memSegment)
 {
+    if (self()->isDualMapped() && memSegment->_base == _executableViewBase) {
+        self()->freeDualMappedCodeCacheSegment(memSegment, _writableViewOffset);
+        return;
+    }
+
 #if defined(OMR_OS_WINDOWS)
     VirtualFree(memSegment->_base, 0, MEM_RELEASE); // second arg must be zero when calling with MEM_RELEASE
 #elif defined(J9ZOS390)
@@ -855,6 +1123,7 @@ void OMR::CodeCacheManager::repositoryCodeCacheCreated()
 void OMR::CodeCacheManager::registerCompiledMethod(const char *sig, uint8_t *startPC, uint32_t codeSize)
 {
 #if (HOST_OS == OMR_LINUX)
+    SymbolMonitorCriticalSection registerSymbol(self());
 
     TR::CodeCacheSymbol *newSymbol = static_cast<TR::CodeCacheSymbol *>(self()->getMemory(sizeof(TR::CodeCacheSymbol)));
     uint32_t nameLength = strlen(sig) + 1;
@@ -897,6 +1166,8 @@ void OMR::CodeCacheManager::registerStaticRelocation(const TR::StaticRelocation
 {
 #if (HOST_OS == OMR_LINUX)
     if (_elfRelocatableGenerator) {
+        // the symbol index below is only valid while no other thread appends to the container
+        SymbolMonitorCriticalSection registerRelocation(self());
         const char * const symbolName(relocation.symbol());
         uint32_t nameLength = strlen(symbolName) + 1;
         char *name = static_cast<char *>(self()->getMemory(nameLength * sizeof(char)));
@@ -923,7 +1194,7 @@ void OMR::CodeCacheManager::registerStaticRelocation(const TR::StaticRelocation
         uint32_t relocationType = _resolver.resolveRelocationType(relocation);
         TR::CodeCacheRelocationInfo *newRelocation
             = static_cast<TR::CodeCacheRelocationInfo *>(self()->getMemory(sizeof(TR::CodeCacheRelocationInfo)));
-        newRelocation->_location = relocation.location();
+        newRelocation->_location = self()->executableAddress(relocation.location());
         newRelocation->_type = relocationType;
         newRelocation->_symbol = symbolNumber; // symbol index along the linked list
         if (_relocations->_head) {
@@ -41,10 +41,12 @@ class TR_Memory;
 
 namespace TR {
 class CodeCache;
+class CodeCacheLayout;
 class CodeCacheManager;
 class CodeCacheMemorySegment;
 class CodeGenerator;
 class Monitor;
+class PerfJitDump;
 } // namespace TR
 
 namespace OMR {
@@ -125,6 +127,15 @@ protected:
     };
 
 public:
+    /**
+     * @brief How the memory of the code cache repository is backed by huge pages
+     */
+    enum HugePageBacking {
+        NoHugePages,
+        HugeTLBPages, /*!< explicit pages reserved from the hugetlbfs pool */
+        TransparentHugePages /*!< normal pages the kernel is asked to collapse with MADV_HUGEPAGE */
+    };
+
     CodeCacheManager(TR::RawAllocator rawAllocator);
 
     static TR::CodeCacheManager *instance() { return _codeCacheManager; }
@@ -144,6 +155,11 @@ public:
         UsageMonitorCriticalSection(TR::CodeCacheManager *mgr);
     };
 
+    class SymbolMonitorCriticalSection : public CriticalSection {
+    public:
+        SymbolMonitorCriticalSection(TR::CodeCacheManager *mgr);
+    };
+
     TR::CodeCacheConfig &codeCacheConfig() { return _config; }
 
     /**
@@ -297,6 +313,8 @@ public:
 
     bool usingRepository() { return _codeCacheRepositorySegment != NULL; }
 
+    TR::CodeCacheMemorySegment *getCodeCacheRepositorySegment() { return _codeCacheRepositorySegment; }
+
     TR::CodeCache *getRepositoryCodeCacheAddress() { return _repositoryCodeCache; }
 
     TR::Monitor *getCodeCacheRepositoryMonitor() { return _codeCacheRepositoryMonitor; }
@@ -307,6 +325,85 @@ public:
     TR::CodeCacheMemorySegment *allocateCodeCacheSegment(size_t segmentSize, size_t &codeCacheSizeToAllocate,
         void *preferredStartAddress);
 
+    /**
+     * @brief Allocates a code cache segment backed by pages of TR::CodeCacheConfig::largeCodePageSize()
+     *
+     * Explicit hugetlbfs pages are used if the pool has enough of them; otherwise the segment is
+     * aligned to the huge page size and advised with MADV_HUGEPAGE so that the kernel backs it with
+     * transparent huge pages. The segment is laid out like one from allocateCodeCacheSegment() and
+     * is freed with freeCodeCacheSegment().
+     *
+     * @param[in] segmentSize : the requested size, rounded up to a multiple of the huge page size
+     * @param[out] codeCacheSizeToAllocate : the size actually allocated
+     * @param[out] backing : how the segment is backed
+     *
+     * @returns the segment, or NULL if huge pages are not configured or not supported
+     */
+    TR::CodeCacheMemorySegment *allocateHugePageCodeCacheSegment(size_t segmentSize, size_t &codeCacheSizeToAllocate,
+        HugePageBacking &backing);
+
+    HugePageBacking repositoryHugePageBacking() const { return _repositoryHugePageBacking; }
+
+    static const char *hugePageBackingString(HugePageBacking backing);
+
+    /**
+     * @brief Counts the bytes of the code cache repository currently backed by huge pages
+     *
+     * Transparent huge page coverage is read from /proc/self/smaps, which only reports it
+     * per mapping, so it is not available for the individual code caches in the repository.
+     */
+    size_t repositoryHugePageBytes();
+
+    /**
+     * @brief Allocates a code cache segment whose memory is mapped twice, read-execute at the
+     *        segment's own addresses and read-write at a fixed offset from them
+     *
+     * Neither view is ever both writable and executable. Code is run from the segment's
+     * addresses and written through writableAddress() once the segment is the repository.
+     * Only x86-64 Linux is supported, where the instruction cache stays coherent with stores
+     * made through either view. The segment is freed with freeDualMappedCodeCacheSegment().
+     *
+     * @param[in] segmentSize : the requested size, rounded up to a multiple of the page size
+     * @param[out] codeCacheSizeToAllocate : the size actually allocated
+     * @param[out] writableViewOffset : the distance from the segment to its writable view
+     *
+     * @returns the segment, or NULL if the memory cannot be dual mapped on this platform
+     */
+    TR::CodeCacheMemorySegment *allocateDualMappedCodeCacheSegment(size_t segmentSize,
+        size_t &codeCacheSizeToAllocate, intptr_t &writableViewOffset);
+
+    void freeDualMappedCodeCacheSegment(TR::CodeCacheMemorySegment *memSegment, intptr_t writableViewOffset);
+
+    /**
+     * @brief Whether the code cache repository is mapped read-execute and read-write at
+     *        different addresses; see TR::CodeCacheConfig::codeCacheDualMapping()
+     */
+    bool isDualMapped() const { return _writableViewOffset != 0; }
+
+    /**
+     * @brief Translates an address in the executable view of the repository to the address it
+     *        is written through; any other address is returned unchanged
+     */
+    template <typename T> T *writableAddress(T *address)
+    {
+        uint8_t *p = reinterpret_cast<uint8_t *>(address);
+        if (p >= _executableViewBase && p < _executableViewTop)
+            return reinterpret_cast<T *>(p + _writableViewOffset);
+        return address;
+    }
+
+    /**
+     * @brief Translates an address in the writable view of the repository to the address it
+     *        executes at; any other address is returned unchanged
+     */
+    template <typename T> T *executableAddress(T *address)
+    {
+        uint8_t *p = reinterpret_cast<uint8_t *>(address);
+        if (p >= _executableViewBase + _writableViewOffset && p < _executableViewTop + _writableViewOffset)
+            return reinterpret_cast<T *>(p - _writableViewOffset);
+        return address;
+    }
+
     void setHasFailedCodeCacheAllocation() {}
 
     bool initialized() const { return _initialized; }
@@ -339,6 +436,32 @@ public:
 
     size_t getMaxUsedInBytes() const { return _maxUsedInBytes; }
 
+    /**
+     * @brief The perf jitdump writer compiled code is reported to, or NULL if
+     *        TR::CodeCacheConfig::emitPerfJitDump() is not set
+     */
+    TR::PerfJitDump *perfJitDump() { return _perfJitDump; }
+
+    /**
+     * @brief The layout deciding which methods are placed in the hot code cache, or NULL if
+     *        TR::CodeCacheConfig::hotCodeLayout() is not set
+     */
+    TR::CodeCacheLayout *codeCacheLayout() { return _codeCacheLayout; }
+
+    /**
+     * @brief Patches the call sites to method recorded in the code cache layout to call
+     *        its new body in the hot code cache
+     *
+     * Calls are patched through TR::CodeCache::patchCallPoint, so nothing is patched
+     * unless the front end provides the patchTrampoline callback.
+     *
+     * @param[in] method : the persistent identifier of the recompiled method
+     * @param[in] newStartPC : the start of its new body
+     *
+     * @returns the number of call sites patched
+     */
+    int32_t patchCallsToHotMethod(TR_OpaqueMethodBlock *method, void *newStartPC);
+
 private:
     TR::CodeCache *reserveCodeCacheImpl(bool compilationCodeAllocationsMustBeContiguous, size_t sizeEstimate,
         int32_t compThreadID, int32_t *numReserved, TR::CodeCacheKind kind, bool ignoreKindAndSkipAllocate);
@@ -348,20 +471,30 @@ protected:
     TR::CodeCacheConfig _config;
     TR::CodeCache *_lastCache; /*!< last code cache round robined through */
     CodeCacheList _codeCacheList; /*!< list of allocated code caches */
+    CodeCacheAddressMap _codeCacheMap; /*!< code caches by address, for findCodeCacheFromPC */
     int32_t _curNumberOfCodeCaches;
 
     // The following 3 fields are for implementation of code cache consolidation
     TR::CodeCache *_repositoryCodeCache;
     TR::CodeCacheMemorySegment *_codeCacheRepositorySegment;
+    HugePageBacking _repositoryHugePageBacking;
     TR::Monitor *_codeCacheRepositoryMonitor;
 
+    // The executable view of a dual-mapped repository and the distance to its writable view
+    uint8_t *_executableViewBase;
+    uint8_t *_executableViewTop;
+    intptr_t _writableViewOffset;
+
     bool _initialized; /*!< flag to indicate if code cache manager has been initialized or not */
     bool _lowCodeCacheSpaceThresholdReached; /*!< true if close to exhausting available code cache */
     bool _codeCacheFull;
 
     TR::Monitor *_usageMonitor;
+    TR::Monitor *_symbolMonitor; /*!< serializes registration of compiled method symbols and relocations */
     size_t _currTotalUsedInBytes;
     size_t _maxUsedInBytes;
+    TR::PerfJitDump *_perfJitDump;
+    TR::CodeCacheLayout *_codeCacheLayout;
 #if (HOST_OS == OMR_LINUX)
 public:
     /**
@@ -385,8 +518,8 @@ protected:
     // collect information on code cache symbols here, will be post processed into the elf trailer structure
     static TR::CodeCacheSymbolContainer
         *_symbolContainer; /**< Symbol container used for tracking CodeCacheSymbols.
-                                 Note: This static member is not thread-safe. Synchronization is needed if multiple
-                              compilation threads are active */
+                                 Note: This static member is updated under _symbolMonitor, as multiple
+                              compilation threads may be active */
     TR::CodeCacheSymbolContainer
         *_relocatableSymbolContainer; /**< Symbol container used for tracking CodeCacheSymbols, for the purpose of
                                          writing to relocatable ELF object file */
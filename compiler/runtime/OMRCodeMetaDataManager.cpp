@@ -26,8 +26,11 @@
 #include "avl_api.h"
 #include "env/TRMemory.hpp"
 #include "infra/Assert.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
 #include "j9nongenerated.h"
 #include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
 #include "runtime/CodeCacheMemorySegment.hpp"
 #include "runtime/CodeMetaDataManager.hpp"
 #include "runtime/CodeMetaDataManager_inlines.hpp"
@@ -47,6 +50,7 @@ CodeMetaDataManager::CodeMetaDataManager()
     , _retrievedMetaDataCache(NULL)
 {
     _metaDataAVL = self()->allocateMetaDataAVL();
+    _hashTableMonitor = TR::Monitor::create("JIT-CodeMetaDataHashTableMonitor");
 }
 
 bool CodeMetaDataManager::initializeCodeMetaDataManager()
@@ -59,7 +63,7 @@ bool CodeMetaDataManager::initializeCodeMetaDataManager()
         // if (monitor)
         {
             _codeMetaDataManager = new (PERSISTENT_NEW) TR::CodeMetaDataManager();
-            if (_codeMetaDataManager)
+            if (_codeMetaDataManager && _codeMetaDataManager->_hashTableMonitor)
                 initSuccess = true;
         }
     }
@@ -142,6 +146,12 @@ const TR::MethodMetaDataPOD *CodeMetaDataManager::findMetaDataForPC(uintptr_t pc
     return _retrievedMetaDataCache;
 }
 
+const TR::MethodMetaDataPOD *CodeMetaDataManager::findMetaDataForPCLockFree(uintptr_t pc)
+{
+    TR::MetaDataHashTable *table = self()->findHashTableForPC(pc);
+    return table ? self()->findMetaDataInHash(table, pc) : NULL;
+}
+
 // protected
 bool CodeMetaDataManager::insertRange(TR::MethodMetaDataPOD *metaData, uintptr_t startPC, uintptr_t endPC)
 {
@@ -173,8 +183,7 @@ void CodeMetaDataManager::updateCache(uintptr_t currentPC)
     if (currentPC != _cachedPC) {
         _retrievedMetaDataCache = NULL;
         _cachedPC = currentPC;
-        _cachedHashTable
-            = static_cast<TR::MetaDataHashTable *>(static_cast<void *>(avl_search(_metaDataAVL, currentPC)));
+        _cachedHashTable = self()->findHashTableForPC(currentPC);
 
         TR_ASSERT(_cachedHashTable,
             "Either we lost a code cache or we attempted to find a hash table for a non-code cache startPC: Searched "
@@ -183,6 +192,18 @@ void CodeMetaDataManager::updateCache(uintptr_t currentPC)
     }
 }
 
+// protected
+TR::MetaDataHashTable *CodeMetaDataManager::findHashTableForPC(uintptr_t pc)
+{
+    TR::MetaDataHashTable *table = static_cast<TR::MetaDataHashTable *>(_hashTableMap.lookup(pc));
+    if (!table && !_hashTableMap.isExhaustive()) {
+        OMR::CriticalSection searchingHashTables(_hashTableMonitor);
+        table = static_cast<TR::MetaDataHashTable *>(static_cast<void *>(avl_search(_metaDataAVL, pc)));
+    }
+
+    return table;
+}
+
 #undef LOW_BIT_SET
 #undef SET_LOW_BIT
 #undef REMOVE_LOW_BIT
@@ -503,7 +524,25 @@ TR::MetaDataHashTable *CodeMetaDataManager::addCodeCache(TR::CodeCache *codeCach
         (uintptr_t)(codeCache->segment()->segmentTop()));
 
     if (newTable) {
-        avl_insert(_metaDataAVL, (J9AVLTreeNode *)newTable);
+        {
+            OMR::CriticalSection insertingHashTable(_hashTableMonitor);
+            avl_insert(_metaDataAVL, (J9AVLTreeNode *)newTable);
+        }
+
+        // Code caches carved from the repository can all be found through
+        // the address map, so map the whole repository when the first arrives
+        TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+        if (!_hashTableMap.isInitialized() && _hashTableMap.isExhaustive() && manager && manager->usingRepository()) {
+            TR::CodeCacheMemorySegment *repository = manager->getCodeCacheRepositorySegment();
+            uintptr_t repositoryBase = (uintptr_t)repository->segmentBase();
+            uintptr_t repositoryTop = (uintptr_t)repository->segmentTop();
+            void *mapMemory = TR_Memory::jitPersistentAlloc(
+                CodeCacheAddressMap::sizeInBytes(repositoryBase, repositoryTop), TR_Memory::CodeMetaDataAVL);
+            if (mapMemory)
+                _hashTableMap.initialize(repositoryBase, repositoryTop, mapMemory);
+        }
+
+        _hashTableMap.insert(newTable->start, newTable->end, newTable);
     }
 
     return newTable;
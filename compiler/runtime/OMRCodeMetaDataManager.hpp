@@ -47,11 +47,13 @@ typedef OMR::MetaDataHashTable MetaDataHashTableConnector;
 #include "env/TRMemory.hpp"
 #include "infra/Annotations.hpp"
 #include "j9nongenerated.h"
+#include "runtime/CodeCacheTypes.hpp"
 
 namespace TR {
 class CodeCache;
 class CodeMetaDataManager;
 class MetaDataHashTable;
+class Monitor;
 struct MethodMetaDataPOD;
 } // namespace TR
 
@@ -133,6 +135,21 @@ public:
      */
     const TR::MethodMetaDataPOD *findMetaDataForPC(uintptr_t pc);
 
+    /**
+     * @brief Retrieves the metadata for a PC without using or updating the
+     * lookup cache.
+     *
+     * Unlike findMetaDataForPC, this may be called by several threads at once
+     * without the JIT metadata monitor, e.g. from concurrent stack walks. It
+     * costs a code cache address map lookup and a hash bucket probe. If the
+     * address map could not record every hash table, a miss falls back on the
+     * AVL tree of hash tables, and that search takes the hash table monitor.
+     *
+     * @param pc The PC for which we require the JIT metadata.
+     * @return The metadata covering pc, or NULL if there is none.
+     */
+    const TR::MethodMetaDataPOD *findMetaDataForPCLockFree(uintptr_t pc);
+
     /**
      * @brief Register code cache with metadata manager.
      *
@@ -196,6 +213,13 @@ protected:
      */
     void updateCache(uintptr_t currentPC);
 
+    /**
+     * @brief Finds the hash table of the code cache containing a PC, using
+     * the address map and falling back on the AVL tree when the map cannot
+     * answer.
+     */
+    TR::MetaDataHashTable *findHashTableForPC(uintptr_t pc);
+
     TR::MethodMetaDataPOD *findMetaDataInHash(TR::MetaDataHashTable *table, uintptr_t searchValue);
 
     uintptr_t insertMetaDataRangeInHash(TR::MetaDataHashTable *table, TR::MethodMetaDataPOD *dataToInsert,
@@ -222,6 +246,10 @@ protected:
 
     J9AVLTree *_metaDataAVL;
 
+    CodeCacheAddressMap _hashTableMap; /*!< hash tables by address, over the code cache repository */
+
+    TR::Monitor *_hashTableMonitor; /*!< guards _metaDataAVL against lookups that bypass the metadata monitor */
+
 private:
     mutable uintptr_t _cachedPC;
     mutable TR::MetaDataHashTable *_cachedHashTable;
@@ -0,0 +1,368 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "runtime/PerfJitDump.hpp"
+
+#include <new>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(LINUX)
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+// Layout from tools/perf/Documentation/jitdump-specification.txt in the Linux sources
+namespace {
+
+const uint32_t JitDumpMagic = 0x4A695444; // "JiTD" in the byte order of the writer
+const uint32_t JitDumpVersion = 1;
+
+enum JitDumpRecordID {
+    JIT_CODE_LOAD = 0,
+    JIT_CODE_MOVE = 1,
+    JIT_CODE_DEBUG_INFO = 2,
+    JIT_CODE_CLOSE = 3
+};
+
+struct JitDumpFileHeader {
+    uint32_t _magic;
+    uint32_t _version;
+    uint32_t _totalSize;
+    uint32_t _elfMachine;
+    uint32_t _pad1;
+    uint32_t _pid;
+    uint64_t _timestamp;
+    uint64_t _flags;
+};
+
+// id(u32) total_size(u32) timestamp(u64)
+const size_t RecordHeaderSize = 16;
+const size_t RecordSizeOffset = 4;
+
+// records are padded so each one starts 8 byte aligned
+const size_t RecordAlignment = 8;
+
+template<typename T> void append(std::vector<uint8_t> &record, T value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    record.insert(record.end(), bytes, bytes + sizeof(T));
+}
+
+void appendString(std::vector<uint8_t> &record, const char *string)
+{
+    record.insert(record.end(), string, string + strlen(string) + 1);
+}
+
+uint32_t elfMachine()
+{
+#if defined(TR_HOST_X86) && defined(TR_HOST_64BIT)
+    return EM_X86_64;
+#elif defined(TR_HOST_X86)
+    return EM_386;
+#elif defined(TR_HOST_POWER) && defined(TR_HOST_64BIT)
+    return EM_PPC64;
+#elif defined(TR_HOST_POWER)
+    return EM_PPC;
+#elif defined(TR_HOST_S390)
+    return EM_S390;
+#elif defined(TR_HOST_ARM64)
+    return EM_AARCH64;
+#elif defined(TR_HOST_ARM)
+    return EM_ARM;
+#elif defined(TR_HOST_RISCV) && defined(EM_RISCV)
+    return EM_RISCV;
+#else
+    return EM_NONE;
+#endif
+}
+
+uint32_t currentThreadID() { return static_cast<uint32_t>(syscall(SYS_gettid)); }
+
+} // namespace
+
+TR::PerfJitDump *TR::PerfJitDump::create(TR::RawAllocator rawAllocator, const char *directory)
+{
+    char fileName[sizeof(_fileName)];
+    int length = snprintf(fileName, sizeof(fileName), "%s/jit-%d.dump", directory, static_cast<int>(getpid()));
+    if (length <= 0 || length >= static_cast<int>(sizeof(fileName)))
+        return NULL;
+
+    // A JIT shut down and started again in the same process adds to the file it created before: perf
+    // ignores close records, and starting over would lose code that may still be running
+    static char createdFileName[sizeof(_fileName)] = { 0 };
+    bool fileCreated = strcmp(fileName, createdFileName) == 0;
+    int fd = open(fileName, O_CREAT | O_RDWR | (fileCreated ? O_APPEND : O_TRUNC), 0666);
+    if (fd < 0)
+        return NULL;
+
+    if (!fileCreated) {
+        if (!writeHeader(fd)) {
+            close(fd);
+            return NULL;
+        }
+        strcpy(createdFileName, fileName);
+    }
+
+    // perf record finds the file through an executable mapping of it in the process
+    long pageSize = sysconf(_SC_PAGESIZE);
+    void *marker = mmap(NULL, pageSize, PROT_READ | PROT_EXEC, MAP_PRIVATE, fd, 0);
+    if (marker == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+
+    TR::PerfJitDump *jitDump = new (rawAllocator) TR::PerfJitDump(rawAllocator, fd, marker, fileName);
+    if (pthread_create(&jitDump->_writer, NULL, writerThread, jitDump) != 0) {
+        munmap(marker, pageSize);
+        close(fd);
+        jitDump->~PerfJitDump();
+        rawAllocator.deallocate(jitDump);
+        return NULL;
+    }
+
+    return jitDump;
+}
+
+bool TR::PerfJitDump::writeHeader(int fd)
+{
+    JitDumpFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header._magic = JitDumpMagic;
+    header._version = JitDumpVersion;
+    header._totalSize = sizeof(header);
+    header._elfMachine = elfMachine();
+    header._pid = static_cast<uint32_t>(getpid());
+    header._timestamp = timestamp();
+    return write(fd, &header, sizeof(header)) == sizeof(header);
+}
+
+TR::PerfJitDump::PerfJitDump(TR::RawAllocator rawAllocator, int fd, void *marker, const char *fileName)
+    : _rawAllocator(rawAllocator)
+    , _fd(fd)
+    , _marker(marker)
+    , _nextCodeIndex(0)
+    , _loadedCode()
+    , _pending()
+    , _bytesQueued(0)
+    , _bytesWritten(0)
+    , _closing(false)
+{
+    strncpy(_fileName, fileName, sizeof(_fileName) - 1);
+    _fileName[sizeof(_fileName) - 1] = '\0';
+    pthread_mutex_init(&_mutex, NULL);
+    pthread_cond_init(&_recordsQueued, NULL);
+    pthread_cond_init(&_recordsWritten, NULL);
+}
+
+void TR::PerfJitDump::destroy()
+{
+    std::vector<uint8_t> record;
+    pthread_mutex_lock(&_mutex);
+    beginRecord(record, JIT_CODE_CLOSE);
+    queueRecord(record);
+    _closing = true;
+    pthread_cond_signal(&_recordsQueued);
+    pthread_mutex_unlock(&_mutex);
+
+    pthread_join(_writer, NULL);
+
+    munmap(_marker, sysconf(_SC_PAGESIZE));
+    close(_fd);
+    pthread_cond_destroy(&_recordsWritten);
+    pthread_cond_destroy(&_recordsQueued);
+    pthread_mutex_destroy(&_mutex);
+
+    TR::RawAllocator rawAllocator(_rawAllocator);
+    this->~PerfJitDump();
+    rawAllocator.deallocate(this);
+}
+
+uint64_t TR::PerfJitDump::timestamp()
+{
+    // perf record -k mono samples with the same clock
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+void TR::PerfJitDump::beginRecord(std::vector<uint8_t> &record, uint32_t id)
+{
+    record.clear();
+    append<uint32_t>(record, id);
+    append<uint32_t>(record, 0); // total_size, filled in by queueRecord
+    append<uint64_t>(record, timestamp());
+}
+
+// Called with _mutex held
+void TR::PerfJitDump::queueRecord(std::vector<uint8_t> &record)
+{
+    record.resize((record.size() + RecordAlignment - 1) & ~(RecordAlignment - 1), 0);
+    uint32_t totalSize = static_cast<uint32_t>(record.size());
+    memcpy(&record[RecordSizeOffset], &totalSize, sizeof(totalSize));
+
+    _pending.insert(_pending.end(), record.begin(), record.end());
+    _bytesQueued += record.size();
+    pthread_cond_signal(&_recordsQueued);
+}
+
+void TR::PerfJitDump::codeLoad(const char *name, const uint8_t *start, uint32_t size, const char *fileName,
+    const LineEntry *lines, uint32_t numLines)
+{
+    std::vector<uint8_t> record;
+    uint32_t pid = static_cast<uint32_t>(getpid());
+    uint32_t tid = currentThreadID();
+
+    pthread_mutex_lock(&_mutex);
+
+    // debug info must precede the load of the code it describes
+    if (fileName != NULL && numLines > 0) {
+        beginRecord(record, JIT_CODE_DEBUG_INFO);
+        append<uint64_t>(record, reinterpret_cast<uintptr_t>(start));
+        append<uint64_t>(record, numLines);
+        for (uint32_t i = 0; i < numLines; i++) {
+            append<uint64_t>(record, reinterpret_cast<uintptr_t>(lines[i]._address));
+            append<int32_t>(record, static_cast<int32_t>(lines[i]._lineNumber));
+            append<int32_t>(record, 0); // discriminator
+            appendString(record, fileName);
+        }
+        queueRecord(record);
+    }
+
+    LoadedCode &code = _loadedCode[start];
+    code._codeIndex = _nextCodeIndex++;
+    code._size = size;
+
+    beginRecord(record, JIT_CODE_LOAD);
+    append<uint32_t>(record, pid);
+    append<uint32_t>(record, tid);
+    append<uint64_t>(record, reinterpret_cast<uintptr_t>(start)); // vma
+    append<uint64_t>(record, reinterpret_cast<uintptr_t>(start)); // code_addr
+    append<uint64_t>(record, size);
+    append<uint64_t>(record, code._codeIndex);
+    appendString(record, name);
+    record.insert(record.end(), start, start + size);
+    queueRecord(record);
+
+    pthread_mutex_unlock(&_mutex);
+}
+
+void TR::PerfJitDump::codeMove(const uint8_t *oldStart, const uint8_t *newStart)
+{
+    std::vector<uint8_t> record;
+    uint32_t pid = static_cast<uint32_t>(getpid());
+    uint32_t tid = currentThreadID();
+
+    pthread_mutex_lock(&_mutex);
+
+    LoadedCodeMap::iterator it = _loadedCode.find(oldStart);
+    if (it != _loadedCode.end()) {
+        LoadedCode code = it->second;
+        _loadedCode.erase(it);
+        _loadedCode[newStart] = code;
+
+        beginRecord(record, JIT_CODE_MOVE);
+        append<uint32_t>(record, pid);
+        append<uint32_t>(record, tid);
+        append<uint64_t>(record, reinterpret_cast<uintptr_t>(newStart)); // vma
+        append<uint64_t>(record, reinterpret_cast<uintptr_t>(oldStart));
+        append<uint64_t>(record, reinterpret_cast<uintptr_t>(newStart));
+        append<uint64_t>(record, code._size);
+        append<uint64_t>(record, code._codeIndex);
+        queueRecord(record);
+    }
+
+    pthread_mutex_unlock(&_mutex);
+}
+
+void TR::PerfJitDump::codeUnload(const uint8_t *start, const uint8_t *end)
+{
+    pthread_mutex_lock(&_mutex);
+    _loadedCode.erase(_loadedCode.lower_bound(start), _loadedCode.lower_bound(end));
+    pthread_mutex_unlock(&_mutex);
+}
+
+void TR::PerfJitDump::flush()
+{
+    pthread_mutex_lock(&_mutex);
+    while (_bytesWritten < _bytesQueued)
+        pthread_cond_wait(&_recordsWritten, &_mutex);
+    pthread_mutex_unlock(&_mutex);
+}
+
+void *TR::PerfJitDump::writerThread(void *writer)
+{
+    static_cast<TR::PerfJitDump *>(writer)->writeRecords();
+    return NULL;
+}
+
+void TR::PerfJitDump::writeRecords()
+{
+    std::vector<uint8_t> writing;
+
+    pthread_mutex_lock(&_mutex);
+    while (true) {
+        while (_pending.empty() && !_closing)
+            pthread_cond_wait(&_recordsQueued, &_mutex);
+        if (_pending.empty())
+            break;
+
+        writing.swap(_pending);
+        pthread_mutex_unlock(&_mutex);
+
+        // a failed write loses the records: there is nobody to report it to
+        size_t offset = 0;
+        while (offset < writing.size()) {
+            ssize_t written = write(_fd, &writing[offset], writing.size() - offset);
+            if (written <= 0)
+                break;
+            offset += written;
+        }
+
+        pthread_mutex_lock(&_mutex);
+        _bytesWritten += writing.size();
+        writing.clear();
+        pthread_cond_broadcast(&_recordsWritten);
+    }
+    pthread_mutex_unlock(&_mutex);
+}
+
+#else // !defined(LINUX)
+
+TR::PerfJitDump *TR::PerfJitDump::create(TR::RawAllocator rawAllocator, const char *directory) { return NULL; }
+
+void TR::PerfJitDump::destroy() {}
+
+void TR::PerfJitDump::codeLoad(const char *name, const uint8_t *start, uint32_t size, const char *fileName,
+    const LineEntry *lines, uint32_t numLines)
+{}
+
+void TR::PerfJitDump::codeMove(const uint8_t *oldStart, const uint8_t *newStart) {}
+
+void TR::PerfJitDump::codeUnload(const uint8_t *start, const uint8_t *end) {}
+
+void TR::PerfJitDump::flush() {}
+
+#endif // defined(LINUX)
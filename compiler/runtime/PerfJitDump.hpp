@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef TR_PERFJITDUMP_INCL
+#define TR_PERFJITDUMP_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <vector>
+#if defined(LINUX)
+#include <pthread.h>
+#endif
+#include "env/RawAllocator.hpp"
+
+namespace TR {
+
+/**
+ * Writes the Linux perf jitdump file (jit-<pid>.dump) describing compiled code,
+ * so that `perf record -k mono` followed by `perf inject --jit` can attribute
+ * samples in the code cache even when code is freed and the memory reused.
+ *
+ * Records are encoded on the calling thread into a pending buffer and written
+ * to the file by a background thread, so compilation threads never block on
+ * file I/O. The code bytes are copied when a load is reported, as perf needs
+ * them to disassemble methods that may have been freed since.
+ *
+ * The jitdump format has no unload record: perf attributes a sample to the
+ * most recent load covering its address at its timestamp, so unloading only
+ * forgets the code so that later moves cannot refer to it.
+ *
+ * Only supported on Linux; create() returns NULL elsewhere.
+ */
+class PerfJitDump {
+public:
+    /**
+     * Source position of the code starting at _address, reported in a debug
+     * info record preceding the load of the method containing it
+     */
+    struct LineEntry {
+        const uint8_t *_address;
+        uint32_t _lineNumber;
+    };
+
+    /**
+     * Creates <directory>/jit-<pid>.dump and starts the writer thread
+     * @param[in] rawAllocator the TR::RawAllocator the writer is allocated from
+     * @param[in] directory where the file is created
+     * @return the writer, or NULL if the file could not be created
+     */
+    static PerfJitDump *create(TR::RawAllocator rawAllocator, const char *directory);
+
+    /**
+     * Writes the close record, waits for everything to reach the file and frees the writer
+     */
+    void destroy();
+
+    /**
+     * Reports a method body now executable at [start, start + size)
+     * @param[in] name the symbol perf reports for the code
+     * @param[in] fileName the source file named by lines, or NULL
+     * @param[in] lines source positions within the code in address order, or NULL
+     */
+    void codeLoad(const char *name, const uint8_t *start, uint32_t size, const char *fileName = NULL,
+        const LineEntry *lines = NULL, uint32_t numLines = 0);
+
+    /**
+     * Reports that code previously loaded at oldStart now lives at newStart
+     */
+    void codeMove(const uint8_t *oldStart, const uint8_t *newStart);
+
+    /**
+     * Reports that all code loaded in [start, end) has been freed
+     */
+    void codeUnload(const uint8_t *start, const uint8_t *end);
+
+    /**
+     * Waits until every record reported so far has been written to the file
+     */
+    void flush();
+
+    const char *fileName() const { return _fileName; }
+
+private:
+    struct LoadedCode {
+        uint64_t _codeIndex;
+        uint32_t _size;
+    };
+
+    typedef std::map<const uint8_t *, LoadedCode> LoadedCodeMap;
+
+    PerfJitDump(TR::RawAllocator rawAllocator, int fd, void *marker, const char *fileName);
+
+    static bool writeHeader(int fd);
+    static uint64_t timestamp();
+    static void beginRecord(std::vector<uint8_t> &record, uint32_t id);
+    void queueRecord(std::vector<uint8_t> &record);
+    void writeRecords();
+
+    static void *writerThread(void *writer);
+
+    TR::RawAllocator _rawAllocator;
+    int _fd;
+    void *_marker; /**< executable mapping of the file perf record looks for */
+    char _fileName[256];
+
+    uint64_t _nextCodeIndex;
+    LoadedCodeMap _loadedCode;
+
+#if defined(LINUX)
+    pthread_mutex_t _mutex; /**< guards everything below and the loaded code */
+    pthread_cond_t _recordsQueued;
+    pthread_cond_t _recordsWritten;
+    pthread_t _writer;
+#endif
+    std::vector<uint8_t> _pending; /**< records not yet handed to the writer thread */
+    uint64_t _bytesQueued;
+    uint64_t _bytesWritten;
+    bool _closing;
+};
+
+} // namespace TR
+
+#endif // TR_PERFJITDUMP_INCL
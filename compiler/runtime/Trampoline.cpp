@@ -200,7 +200,9 @@ void amd64CodeCacheConfig(int32_t ccSizeInByte, uint32_t *numTempTrampolines)
 
 void amd64CreateHelperTrampolines(uint8_t *trampPtr, int32_t numHelpers)
 {
-    uint8_t *bufferStart = trampPtr, *buffer;
+    // The trampolines only address themselves RIP-relative, so they can be built through the writable view
+    TR::CodeCacheManager &manager = TR::FrontEnd::instance()->codeCacheManager();
+    uint8_t *bufferStart = manager.writableAddress(trampPtr), *buffer;
 
     for (int32_t i = 1; i < numHelpers; i++) {
         intptr_t helperAddr = (intptr_t)runtimeHelperValue((TR_RuntimeHelper)i);
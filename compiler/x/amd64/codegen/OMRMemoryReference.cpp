@@ -511,7 +511,8 @@ uint8_t *OMR::X86::AMD64::MemoryReference::generateBinaryEncoding(uint8_t *modRM
     //
     // address of next instruction = modRM + 4 (disp32) + sizeof(immediate for this instruction: 0, 1, or 4) + 1
     //
-    intptr_t nextInstructionAddress = (intptr_t)(modRM + 5) + containingInstruction->getOpCode().info().ImmediateSize();
+    intptr_t nextInstructionAddress
+        = (intptr_t)cg->toExecutableAddress(modRM + 5) + containingInstruction->getOpCode().info().ImmediateSize();
 
     if (self()->getDataSnippet() || self()->getLabel()) {
         // The inherited logic has a special case for RIP-based ConstantDataSnippet and label references.
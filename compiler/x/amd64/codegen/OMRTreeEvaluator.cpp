@@ -1602,11 +1602,6 @@ TR::Register *OMR::X86::AMD64::TreeEvaluator::ArrayCHKEvaluator(TR::Node *node,
     return TR::TreeEvaluator::badILOpEvaluator(node, cg);
 }
 
-TR::Register *OMR::X86::AMD64::TreeEvaluator::arraytranslateAndTestEvaluator(TR::Node *node, TR::CodeGenerator *cg)
-{
-    return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
-}
-
 TR::Register *OMR::X86::AMD64::TreeEvaluator::long2StringEvaluator(TR::Node *node, TR::CodeGenerator *cg)
 {
     return TR::TreeEvaluator::badILOpEvaluator(node, cg);
@@ -172,7 +172,8 @@ uint8_t *OMR::X86::AMD64::JitCodeRWXObjectFormat::encodeFunctionCall(TR::Functio
         disp32 = data.cg->branchDisplacementToHelperOrTrampoline(data.bufferAddress, data.methodSymRef);
     } else {
         intptr_t targetAddress = reinterpret_cast<intptr_t>(data.methodSymRef->getMethodAddress());
-        intptr_t nextInstructionAddress = reinterpret_cast<intptr_t>(data.bufferAddress + 5);
+        intptr_t nextInstructionAddress
+            = reinterpret_cast<intptr_t>(data.cg->toExecutableAddress(data.bufferAddress + 5));
 
         TR_ASSERT_FATAL(data.cg->comp()->target().cpu.isTargetWithinRIPRange(targetAddress, nextInstructionAddress),
             "Target function address %" OMR_PRIxPTR " not reachable from %" OMR_PRIxPTR, targetAddress,
@@ -97,7 +97,7 @@ TR::Instruction *OMR::X86::AMD64::JitCodeRXObjectFormat::emitFunctionCall(TR::Fu
     ccFunctionDataAddress->address = targetAddress;
 
     TR::StaticSymbol *functionDataSymbol = TR::StaticSymbol::createWithAddress(comp->trHeapMemory(), TR::Address,
-        reinterpret_cast<void *>(ccFunctionDataAddress));
+        data.cg->toExecutableAddress(reinterpret_cast<uint8_t *>(ccFunctionDataAddress)));
     functionDataSymbol->setNotDataAddress();
     TR::SymbolReference *functionDataSymRef
         = new (comp->trHeapMemory()) TR::SymbolReference(comp->getSymRefTab(), functionDataSymbol, 0);
@@ -160,8 +160,9 @@ uint8_t *OMR::X86::AMD64::JitCodeRXObjectFormat::encodeFunctionCall(TR::Function
     const uint8_t modRM = data.useCall ? 0x15 : 0x25; // RIP addressing mode
     *data.bufferAddress++ = modRM;
 
-    intptr_t functionAddress = reinterpret_cast<intptr_t>(ccFunctionDataAddress);
-    intptr_t nextInstructionAddress = reinterpret_cast<intptr_t>(data.bufferAddress + 4);
+    intptr_t functionAddress
+        = reinterpret_cast<intptr_t>(data.cg->toExecutableAddress(reinterpret_cast<uint8_t *>(ccFunctionDataAddress)));
+    intptr_t nextInstructionAddress = reinterpret_cast<intptr_t>(data.cg->toExecutableAddress(data.bufferAddress + 4));
 
     TR_ASSERT_FATAL_WITH_NODE(data.callNode,
         comp->target().cpu.isTargetWithinRIPRange(functionAddress, nextInstructionAddress),
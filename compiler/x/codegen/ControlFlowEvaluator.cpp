@@ -434,7 +434,7 @@ TR::Register *OMR::X86::TreeEvaluator::tableEvaluator(TR::Node *node, TR::CodeGe
         jumpMR = MRef_BIS(branchTableReg, selectorReg, 3, cg);
     } else {
         jumpMR = MRef_BISdisp32((TR::Register *)NULL, selectorReg, (uint8_t)(cg->comp()->target().is64Bit() ? 3 : 2),
-            (intptr_t)branchTable, cg);
+            (intptr_t)cg->toExecutableAddress(reinterpret_cast<uint8_t *>(branchTable)), cg);
 
         jumpMR->setNeedsCodeAbsoluteExternalRelocation();
     }
@@ -417,6 +417,7 @@ int32_t TR::X86HelperCallSnippet::branchDisplacementToHelper(uint8_t *callInstru
     TR::SymbolReference *helper, TR::CodeGenerator *cg)
 {
     intptr_t helperAddress = (intptr_t)helper->getMethodAddress();
+    callInstructionAddress = cg->toExecutableAddress(callInstructionAddress);
     intptr_t nextInstructionAddress = (intptr_t)(callInstructionAddress + 5);
 
     if (cg->directCallRequiresTrampoline(helperAddress, (intptr_t)callInstructionAddress)) {
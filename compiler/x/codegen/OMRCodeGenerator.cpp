@@ -452,6 +452,10 @@ void OMR::X86::CodeGenerator::initializeX86(TR::Compilation *comp)
                 self()->setSupportsArrayTranslateTROTNoBreak();
             }
         }
+        static bool disableX86TRT = feGetEnv("TR_disableX86TRT") != NULL;
+        if (!disableX86TRT) {
+            self()->setSupportsArrayTranslateAndTest();
+        }
     }
 
     self()->setSupportsRecompilation();
@@ -2098,7 +2102,7 @@ void OMR::X86::CodeGenerator::doBinaryEncoding()
     self()->setPrePrologueSize(self()->getBinaryBufferLength());
 
     comp->getSymRefTab()->findOrCreateStartPCSymbolRef()->getSymbol()->getStaticSymbol()->setStaticAddress(
-        self()->getBinaryBufferCursor());
+        self()->toExecutableAddress(self()->getBinaryBufferCursor()));
 
     // Generate binary for the rest of the instructions
     //
@@ -2498,6 +2502,7 @@ int32_t OMR::X86::CodeGenerator::branchDisplacementToHelperOrTrampoline(uint8_t
     TR::SymbolReference *helper)
 {
     intptr_t helperAddress = (intptr_t)helper->getMethodAddress();
+    branchInstructionAddress = self()->toExecutableAddress(branchInstructionAddress);
     uint8_t *nextInstructionAddress
         = branchInstructionAddress + 5; // 5 == length of wide displacement direct call or jump instruction
 
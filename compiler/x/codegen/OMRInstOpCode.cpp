@@ -93,6 +93,14 @@ const OMR::X86::InstOpCode::OpCode_t OMR::X86::InstOpCode::_binaries[] = {
 #undef BINARY
 };
 
+const OMR::X86::InstOpCode::OpCodeLength_t OMR::X86::InstOpCode::_lengths[] = {
+#define INSTRUCTION(name, mnemonic, binary, ...) binary
+#define BINARY(...) opCodeLength(__VA_ARGS__)
+#include "codegen/X86Ops.ins"
+#undef INSTRUCTION
+#undef BINARY
+};
+
 void OMR::X86::InstOpCode::trackUpperBitsOnReg(TR::Register *reg, TR::CodeGenerator *cg)
 {
     if (cg->comp()->target().is64Bit()) {
@@ -258,7 +266,40 @@ void OMR::X86::InstOpCode::CheckAndFinishGroup07(uint8_t *cursor) const
 
 uint8_t OMR::X86::InstOpCode::length(OMR::X86::Encoding encoding, uint8_t rex) const
 {
-    return encode<Estimator>(0, encoding, rex);
+    // Mirrors OpCode_t::encode(), which must be kept in sync
+    if (isPseudoOp())
+        return 0;
+
+    const OpCode_t &op = info();
+    const OpCodeLength_t &length = _lengths[_mnemonic];
+    if (length.x87)
+        return length.legacy;
+
+    uint32_t enc = encoding;
+    if (encoding == OMR::X86::Default) {
+        // Most instructions have no VEX form, so avoid the CPU query for them
+        if (op.vex_l == VEX_L___ || op.vex_l == VEX_LZ)
+            enc = op.vex_l;
+        else
+            enc = TR::comp()->target().cpu.supportsAVX() ? op.vex_l : OMR::X86::Legacy;
+    }
+
+    if (enc == VEX_L___) {
+#if defined(TR_TARGET_64BIT)
+        if (op.rex_w || rex)
+            return length.legacy + 1;
+#endif
+        return length.legacy;
+    }
+
+    if (enc >> 2 && enc != VEX_LZ)
+        return length.evex;
+
+    // The 2-byte VEX prefix can encode neither REX.X, REX.B nor REX.W, nor an
+    // escape other than 0F.
+    TR::Instruction::REX rexBits(rex);
+    bool shortVEX = !rexBits.X && !rexBits.B && !op.rex_w && op.escape == ESCAPE_0F__;
+    return shortVEX ? length.vex - 1 : length.vex;
 }
 
 uint8_t *OMR::X86::InstOpCode::binary(uint8_t *cursor, OMR::X86::Encoding encoding, uint8_t rex) const
@@ -448,7 +448,40 @@ class InstOpCode : public OMR::InstOpCode {
     // byte
     inline void CheckAndFinishGroup07(uint8_t *cursor) const;
 
+    // Length of the bytes encode() emits for an instruction, precomputed from
+    // X86Ops.ins for each form of encoding so that length() is a table lookup.
+    // The legacy length excludes the REX prefix and the VEX length assumes the
+    // 3-byte prefix; length() adjusts both for the REX bits of the instruction.
+    struct OpCodeLength_t {
+        uint8_t legacy;
+        uint8_t vex;
+        uint8_t evex;
+        bool x87;
+    };
+
+    static constexpr uint8_t prefixLength(uint8_t prefixes)
+    {
+        return prefixes == PREFIX___ ? 0 : ((prefixes == PREFIX_66_F2 || prefixes == PREFIX_66_F3) ? 2 : 1);
+    }
+
+    static constexpr uint8_t escapeLength(uint8_t escape)
+    {
+        return escape == ESCAPE_____ ? 0 : (escape == ESCAPE_0F__ ? 1 : 2);
+    }
+
+    static constexpr OpCodeLength_t opCodeLength(uint8_t vex_l, uint8_t vex_v, uint8_t prefixes, uint8_t rex_w,
+        uint8_t escape, uint8_t opcode, uint8_t modrm_opcode, uint8_t modrm_form, uint8_t immediate_size)
+    {
+        return (prefixes == PREFIX___ && opcode >= 0xd8 && opcode <= 0xdf)
+            ? OpCodeLength_t { 2, 2, 2, true }
+            : OpCodeLength_t {
+                  static_cast<uint8_t>(prefixLength(prefixes) + escapeLength(escape) + 1 + (modrm_form ? 1 : 0)),
+                  static_cast<uint8_t>(4 + (modrm_form ? 1 : 0)), static_cast<uint8_t>(5 + (modrm_form ? 1 : 0)),
+                  false };
+    }
+
     static const OpCode_t _binaries[];
+    static const OpCodeLength_t _lengths[];
     static const uint32_t _properties[];
     static const uint32_t _properties1[];
     static const uint32_t _properties2[];
@@ -0,0 +1,467 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "codegen/Peephole.hpp"
+
+#include "codegen/CodeGenerator.hpp"
+#include "codegen/CodeGenerator_inlines.hpp"
+#include "codegen/Instruction.hpp"
+#include "codegen/MemoryReference.hpp"
+#include "codegen/RealRegister.hpp"
+#include "compile/Compilation.hpp"
+#include "il/Symbol.hpp"
+#include "infra/Assert.hpp"
+#include "ras/DebugCounter.hpp"
+#include "x/codegen/X86Instruction.hpp"
+
+// Number of instructions to look past a zero idiom candidate for the next
+// write of the flags before assuming they are live
+#define ZERO_IDIOM_FLAGS_WINDOW 8
+
+#define ALL_EFLAGS (IA32EFlags_OF | IA32EFlags_SF | IA32EFlags_ZF | IA32EFlags_PF | IA32EFlags_CF)
+
+// clang-format off
+const OMR::X86::Peephole::Pattern OMR::X86::Peephole::_patterns[] = {
+    { TR::InstOpCode::MOV4RegReg,   "selfMove",           &OMR::X86::Peephole::tryToRemoveSelfMove               },
+    { TR::InstOpCode::MOV4RegReg,   "copyBack",           &OMR::X86::Peephole::tryToRemoveRedundantCopyBack      },
+    { TR::InstOpCode::MOV8RegReg,   "selfMove",           &OMR::X86::Peephole::tryToRemoveSelfMove               },
+    { TR::InstOpCode::MOV8RegReg,   "copyBack",           &OMR::X86::Peephole::tryToRemoveRedundantCopyBack      },
+    { TR::InstOpCode::MOVAPSRegReg, "selfMove",           &OMR::X86::Peephole::tryToRemoveSelfMove               },
+    { TR::InstOpCode::MOVAPDRegReg, "selfMove",           &OMR::X86::Peephole::tryToRemoveSelfMove               },
+    { TR::InstOpCode::MOVDQURegReg, "selfMove",           &OMR::X86::Peephole::tryToRemoveSelfMove               },
+    { TR::InstOpCode::MOVSDRegReg,  "selfMove",           &OMR::X86::Peephole::tryToRemoveSelfMove               },
+    { TR::InstOpCode::MOVSSRegReg,  "selfMove",           &OMR::X86::Peephole::tryToRemoveSelfMove               },
+    { TR::InstOpCode::L4RegMem,     "loadAfterStore",     &OMR::X86::Peephole::tryToRemoveLoadAfterStore         },
+    { TR::InstOpCode::L8RegMem,     "loadAfterStore",     &OMR::X86::Peephole::tryToRemoveLoadAfterStore         },
+    { TR::InstOpCode::S4MemReg,     "storeAfterLoad",     &OMR::X86::Peephole::tryToRemoveStoreAfterLoad         },
+    { TR::InstOpCode::S8MemReg,     "storeAfterLoad",     &OMR::X86::Peephole::tryToRemoveStoreAfterLoad         },
+    { TR::InstOpCode::CMP4RegImms,  "compareWithZero",    &OMR::X86::Peephole::tryToReduceCompareWithZeroToTest  },
+    { TR::InstOpCode::CMP4RegImm4,  "compareWithZero",    &OMR::X86::Peephole::tryToReduceCompareWithZeroToTest  },
+    { TR::InstOpCode::CMP8RegImms,  "compareWithZero",    &OMR::X86::Peephole::tryToReduceCompareWithZeroToTest  },
+    { TR::InstOpCode::CMP8RegImm4,  "compareWithZero",    &OMR::X86::Peephole::tryToReduceCompareWithZeroToTest  },
+    { TR::InstOpCode::TEST4RegReg,  "redundantTest",      &OMR::X86::Peephole::tryToRemoveRedundantTest          },
+    { TR::InstOpCode::TEST8RegReg,  "redundantTest",      &OMR::X86::Peephole::tryToRemoveRedundantTest          },
+    { TR::InstOpCode::LEA4RegMem,   "foldLEA",            &OMR::X86::Peephole::tryToFoldLEA                      },
+    { TR::InstOpCode::LEA8RegMem,   "foldLEA",            &OMR::X86::Peephole::tryToFoldLEA                      },
+    { TR::InstOpCode::MOV4RegImm4,  "zeroIdiom",          &OMR::X86::Peephole::tryToUseZeroIdiom                 },
+    { TR::InstOpCode::MOV8RegImm4,  "zeroIdiom",          &OMR::X86::Peephole::tryToUseZeroIdiom                 },
+    { TR::InstOpCode::bad,          NULL,                 NULL                                                   }
+};
+// clang-format on
+
+/**
+ * Instructions that carry register dependencies or a GC map describe the
+ * register state at that point, so none of them are touched.
+ */
+static bool isPeepholeCandidate(TR::Instruction *instr)
+{
+    return instr != NULL && instr->getDependencyConditions() == NULL && !instr->needsGCMap();
+}
+
+/**
+ * A register-immediate instruction whose immediate is zero and stays zero: an
+ * immediate that carries a relocation is a placeholder for a value patched in
+ * when the code is loaded.
+ */
+static bool hasZeroImmediate(TR::Instruction *instr)
+{
+    if (instr->getKind() != TR::Instruction::IsRegImm)
+        return false;
+
+    TR::X86RegImmInstruction *regImm = static_cast<TR::X86RegImmInstruction *>(instr);
+    return regImm->getSourceImmediate() == 0 && regImm->getReloKind() == TR_NoRelocation;
+}
+
+static bool isSameRealRegister(TR::Register *a, TR::Register *b)
+{
+    return a != NULL && b != NULL && a->getRealRegister() != NULL && a->getRealRegister() == b->getRealRegister();
+}
+
+/**
+ * A memory reference whose address is fully known after register assignment
+ * and that may be freely reordered with respect to its neighbours.
+ */
+static bool isPlainMemoryReference(TR::MemoryReference *mr)
+{
+    TR::SymbolReference &symRef = mr->getSymbolReference();
+    TR::Symbol *sym = symRef.getSymbol();
+
+    return mr->getUnresolvedDataSnippet() == NULL && mr->getDataSnippet() == NULL && mr->getLabel() == NULL
+        && !symRef.isUnresolved() && !mr->requiresLockPrefix() && (sym == NULL || !sym->isVolatile());
+}
+
+static bool isSameMemoryLocation(TR::MemoryReference *a, TR::MemoryReference *b)
+{
+    if (!isPlainMemoryReference(a) || !isPlainMemoryReference(b))
+        return false;
+
+    if (a->getSymbolReference().getSymbol() != b->getSymbolReference().getSymbol())
+        return false;
+
+    if (a->getBaseRegister() != NULL || b->getBaseRegister() != NULL) {
+        if (!isSameRealRegister(a->getBaseRegister(), b->getBaseRegister()))
+            return false;
+    }
+
+    if (a->getIndexRegister() != NULL || b->getIndexRegister() != NULL) {
+        if (!isSameRealRegister(a->getIndexRegister(), b->getIndexRegister()) || a->getStride() != b->getStride())
+            return false;
+    }
+
+    return a->getDisplacement() == b->getDisplacement();
+}
+
+/**
+ * @returns the width in bytes of an and/or/xor that leaves its result in its
+ *          target register, or 0 for any other instruction
+ */
+static int32_t logicalOperationWidth(TR::InstOpCode::Mnemonic op)
+{
+    switch (op) {
+        case TR::InstOpCode::AND4RegReg:
+        case TR::InstOpCode::AND4RegImms:
+        case TR::InstOpCode::AND4RegImm4:
+        case TR::InstOpCode::AND4RegMem:
+        case TR::InstOpCode::OR4RegReg:
+        case TR::InstOpCode::OR4RegImms:
+        case TR::InstOpCode::OR4RegImm4:
+        case TR::InstOpCode::OR4RegMem:
+        case TR::InstOpCode::XOR4RegReg:
+        case TR::InstOpCode::XOR4RegImms:
+        case TR::InstOpCode::XOR4RegImm4:
+        case TR::InstOpCode::XOR4RegMem:
+            return 4;
+        case TR::InstOpCode::AND8RegReg:
+        case TR::InstOpCode::AND8RegImms:
+        case TR::InstOpCode::AND8RegImm4:
+        case TR::InstOpCode::AND8RegMem:
+        case TR::InstOpCode::OR8RegReg:
+        case TR::InstOpCode::OR8RegImms:
+        case TR::InstOpCode::OR8RegImm4:
+        case TR::InstOpCode::OR8RegMem:
+        case TR::InstOpCode::XOR8RegReg:
+        case TR::InstOpCode::XOR8RegImms:
+        case TR::InstOpCode::XOR8RegImm4:
+        case TR::InstOpCode::XOR8RegMem:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @returns true if the flags are known to be overwritten after cursor before
+ *          anything can read them
+ */
+static bool flagsAreDeadAfter(TR::Instruction *cursor, int32_t window)
+{
+    for (TR::Instruction *instr = cursor->getNext(); instr != NULL && window > 0;
+         instr = instr->getNext(), window--) {
+        TR::InstOpCode &op = instr->getOpCode();
+
+        // Labels are merge points and calls and branches leave the window
+        if (op.isPseudoOp() || op.isBranchOp() || op.isCallOp() || op.testsSomeFlag())
+            return false;
+
+        if ((op.getModifiedEFlags() & ALL_EFLAGS) == ALL_EFLAGS)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * Index into _patterns of the first pattern for each mnemonic, or -1. It is
+ * sized from X86Ops.ins because TR::InstOpCode::NumOpCodes follows the
+ * aliases at the end of the enum, not the last instruction.
+ */
+static int16_t firstPatternOfMnemonic[] = {
+#define INSTRUCTION(name, mnemonic, binary, ...) -1
+#include "codegen/X86Ops.ins"
+#undef INSTRUCTION
+};
+
+int32_t OMR::X86::Peephole::firstPatternFor(TR::InstOpCode::Mnemonic mnemonic)
+{
+    // Built on first use. Every instruction the peephole pass visits looks
+    // itself up here, instead of scanning the whole table.
+    static struct Index {
+        Index()
+        {
+            for (int32_t i = 0; _patterns[i]._name != NULL; i++) {
+                TR::InstOpCode::Mnemonic mnemonic = _patterns[i]._mnemonic;
+                if (firstPatternOfMnemonic[mnemonic] < 0) {
+                    firstPatternOfMnemonic[mnemonic] = static_cast<int16_t>(i);
+                } else {
+                    TR_ASSERT_FATAL(_patterns[i - 1]._mnemonic == mnemonic,
+                        "x86 peephole patterns for one mnemonic must be adjacent in the table");
+                }
+            }
+        }
+    } index;
+
+    return firstPatternOfMnemonic[mnemonic];
+}
+
+OMR::X86::Peephole::Peephole(TR::Compilation *comp)
+    : OMR::Peephole(comp)
+    , cursor(NULL)
+{}
+
+bool OMR::X86::Peephole::performOnInstruction(TR::Instruction *cursor)
+{
+    if (self()->comp()->getOptLevel() == noOpt)
+        return false;
+
+    // Cache the cursor for use in the peephole functions
+    self()->cursor = cursor;
+
+    TR::InstOpCode::Mnemonic mnemonic = cursor->getOpCodeValue();
+    int32_t first = firstPatternFor(mnemonic);
+    if (first < 0)
+        return false;
+
+    for (const Pattern *pattern = &_patterns[first]; pattern->_mnemonic == mnemonic; pattern++) {
+        if ((self()->*(pattern->_transform))()) {
+            TR::DebugCounter::incStaticDebugCounter(self()->comp(),
+                TR::DebugCounter::debugCounterName(self()->comp(), "x86/peephole/%s", pattern->_name));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool OMR::X86::Peephole::tryToRemoveSelfMove()
+{
+    if (!isPeepholeCandidate(cursor) || cursor->getKind() != TR::Instruction::IsRegReg)
+        return false;
+
+    // A 32-bit move zeroes the upper half of a 64-bit register, and a VEX
+    // encoded move clears the upper half of a 256-bit register
+    TR::InstOpCode::Mnemonic mnemonic = cursor->getOpCodeValue();
+    if (mnemonic == TR::InstOpCode::MOV4RegReg && self()->comp()->target().is64Bit())
+        return false;
+
+    OMR::X86::Encoding encoding = cursor->getEncodingMethod();
+    if (encoding != OMR::X86::Default && encoding != OMR::X86::Legacy)
+        return false;
+
+    if (mnemonic != TR::InstOpCode::MOV4RegReg && mnemonic != TR::InstOpCode::MOV8RegReg
+        && self()->comp()->target().cpu.supportsAVX())
+        return false;
+
+    if (!isSameRealRegister(cursor->getTargetRegister(), cursor->getSourceRegister()))
+        return false;
+
+    if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Removing self move [%p]\n", cursor))
+        return false;
+
+    cursor->remove();
+    return true;
+}
+
+bool OMR::X86::Peephole::tryToRemoveRedundantCopyBack()
+{
+    TR::InstOpCode::Mnemonic mnemonic = cursor->getOpCodeValue();
+    if (mnemonic == TR::InstOpCode::MOV4RegReg && self()->comp()->target().is64Bit())
+        return false;
+
+    TR::Instruction *prev = cursor->getPrev();
+    if (!isPeepholeCandidate(cursor) || !isPeepholeCandidate(prev) || prev->getOpCodeValue() != mnemonic
+        || cursor->getKind() != TR::Instruction::IsRegReg || prev->getKind() != TR::Instruction::IsRegReg)
+        return false;
+
+    if (!isSameRealRegister(cursor->getTargetRegister(), prev->getSourceRegister())
+        || !isSameRealRegister(cursor->getSourceRegister(), prev->getTargetRegister()))
+        return false;
+
+    if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Removing copy back [%p] of [%p]\n", cursor, prev))
+        return false;
+
+    cursor->remove();
+    return true;
+}
+
+bool OMR::X86::Peephole::tryToRemoveLoadAfterStore()
+{
+    TR::InstOpCode::Mnemonic mnemonic = cursor->getOpCodeValue();
+
+    // A 32-bit load zeroes the upper half of a 64-bit register, which the
+    // store leaves as it was
+    if (mnemonic == TR::InstOpCode::L4RegMem && self()->comp()->target().is64Bit())
+        return false;
+
+    TR::InstOpCode::Mnemonic storeMnemonic
+        = mnemonic == TR::InstOpCode::L4RegMem ? TR::InstOpCode::S4MemReg : TR::InstOpCode::S8MemReg;
+
+    TR::Instruction *prev = cursor->getPrev();
+    if (!isPeepholeCandidate(cursor) || !isPeepholeCandidate(prev) || prev->getOpCodeValue() != storeMnemonic
+        || cursor->getKind() != TR::Instruction::IsRegMem || prev->getKind() != TR::Instruction::IsMemReg)
+        return false;
+
+    if (!isSameRealRegister(cursor->getTargetRegister(), prev->getSourceRegister())
+        || !isSameMemoryLocation(cursor->getMemoryReference(), prev->getMemoryReference()))
+        return false;
+
+    if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Removing load [%p] of value just stored by [%p]\n",
+            cursor, prev))
+        return false;
+
+    cursor->remove();
+    return true;
+}
+
+bool OMR::X86::Peephole::tryToRemoveStoreAfterLoad()
+{
+    TR::InstOpCode::Mnemonic loadMnemonic = cursor->getOpCodeValue() == TR::InstOpCode::S4MemReg
+        ? TR::InstOpCode::L4RegMem
+        : TR::InstOpCode::L8RegMem;
+
+    TR::Instruction *prev = cursor->getPrev();
+    if (!isPeepholeCandidate(cursor) || !isPeepholeCandidate(prev) || prev->getOpCodeValue() != loadMnemonic
+        || cursor->getKind() != TR::Instruction::IsMemReg || prev->getKind() != TR::Instruction::IsRegMem)
+        return false;
+
+    TR::Register *loadedReg = prev->getTargetRegister();
+    TR::MemoryReference *mr = cursor->getMemoryReference();
+
+    // The load must not have changed the address the store writes to
+    if (isSameRealRegister(loadedReg, mr->getBaseRegister()) || isSameRealRegister(loadedReg, mr->getIndexRegister()))
+        return false;
+
+    if (!isSameRealRegister(cursor->getSourceRegister(), loadedReg)
+        || !isSameMemoryLocation(mr, prev->getMemoryReference()))
+        return false;
+
+    if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Removing store [%p] of value just loaded by [%p]\n",
+            cursor, prev))
+        return false;
+
+    cursor->remove();
+    return true;
+}
+
+bool OMR::X86::Peephole::tryToReduceCompareWithZeroToTest()
+{
+    if (!isPeepholeCandidate(cursor) || !hasZeroImmediate(cursor))
+        return false;
+
+    TR::Register *reg = cursor->getTargetRegister();
+    if (reg == NULL || reg->getRealRegister() == NULL)
+        return false;
+
+    TR::InstOpCode::Mnemonic mnemonic = cursor->getOpCodeValue();
+    TR::InstOpCode::Mnemonic testMnemonic
+        = (mnemonic == TR::InstOpCode::CMP4RegImms || mnemonic == TR::InstOpCode::CMP4RegImm4)
+        ? TR::InstOpCode::TEST4RegReg
+        : TR::InstOpCode::TEST8RegReg;
+
+    if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Reducing compare with zero [%p] to test\n",
+            cursor))
+        return false;
+
+    TR::Instruction *test = generateRegRegInstruction(cursor->getPrev(), testMnemonic, reg, reg, self()->cg());
+    test->setNode(cursor->getNode());
+    cursor->remove();
+    return true;
+}
+
+bool OMR::X86::Peephole::tryToRemoveRedundantTest()
+{
+    TR::Instruction *prev = cursor->getPrev();
+    if (!isPeepholeCandidate(cursor) || prev == NULL || cursor->getKind() != TR::Instruction::IsRegReg)
+        return false;
+
+    TR::Register *reg = cursor->getTargetRegister();
+    if (!isSameRealRegister(reg, cursor->getSourceRegister()))
+        return false;
+
+    int32_t width = cursor->getOpCodeValue() == TR::InstOpCode::TEST4RegReg ? 4 : 8;
+    if (logicalOperationWidth(prev->getOpCodeValue()) != width || !isSameRealRegister(prev->getTargetRegister(), reg))
+        return false;
+
+    if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Removing test [%p] of result of [%p]\n", cursor,
+            prev))
+        return false;
+
+    cursor->remove();
+    return true;
+}
+
+bool OMR::X86::Peephole::tryToFoldLEA()
+{
+    if (!isPeepholeCandidate(cursor) || cursor->getKind() != TR::Instruction::IsRegMem)
+        return false;
+
+    TR::MemoryReference *mr = cursor->getMemoryReference();
+    TR::Register *target = cursor->getTargetRegister();
+    TR::Register *base = mr->getBaseRegister();
+
+    if (!isPlainMemoryReference(mr) || mr->getSymbolReference().getSymbol() != NULL || mr->getIndexRegister() != NULL
+        || mr->getDisplacement() != 0 || base == NULL || base->getRealRegister() == NULL
+        || target == NULL || target->getRealRegister() == NULL)
+        return false;
+
+    // Stack pointer and VFP relative addresses are adjusted during encoding
+    TR::RealRegister::RegNum baseNum = toRealRegister(base)->getRegisterNumber();
+    if (baseNum == TR::RealRegister::esp || baseNum == TR::RealRegister::vfp)
+        return false;
+
+    bool is4Byte = cursor->getOpCodeValue() == TR::InstOpCode::LEA4RegMem;
+    bool isNoOp = isSameRealRegister(target, base) && !(is4Byte && self()->comp()->target().is64Bit());
+
+    if (isNoOp) {
+        if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Removing no-op lea [%p]\n", cursor))
+            return false;
+    } else {
+        if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Folding lea [%p] into a move\n", cursor))
+            return false;
+
+        TR::Instruction *move = generateRegRegInstruction(cursor->getPrev(),
+            is4Byte ? TR::InstOpCode::MOV4RegReg : TR::InstOpCode::MOV8RegReg, target, base, self()->cg());
+        move->setNode(cursor->getNode());
+    }
+
+    cursor->remove();
+    return true;
+}
+
+bool OMR::X86::Peephole::tryToUseZeroIdiom()
+{
+    if (!isPeepholeCandidate(cursor) || !hasZeroImmediate(cursor))
+        return false;
+
+    TR::Register *reg = cursor->getTargetRegister();
+    if (reg == NULL || reg->getRealRegister() == NULL || !flagsAreDeadAfter(cursor, ZERO_IDIOM_FLAGS_WINDOW))
+        return false;
+
+    if (!performTransformation(self()->comp(), "O^O X86 PEEPHOLE: Replacing move of zero [%p] with xor\n", cursor))
+        return false;
+
+    // A 32-bit xor also clears the upper half of a 64-bit register
+    TR::Instruction *zero
+        = generateRegRegInstruction(cursor->getPrev(), TR::InstOpCode::XOR4RegReg, reg, reg, self()->cg());
+    zero->setNode(cursor->getNode());
+    cursor->remove();
+    return true;
+}
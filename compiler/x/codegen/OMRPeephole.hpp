@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef OMR_X86_PEEPHOLE_INCL
+#define OMR_X86_PEEPHOLE_INCL
+
+/*
+ * The following #define and typedef must appear before any #includes in this file
+ */
+#ifndef OMR_PEEPHOLE_CONNECTOR
+#define OMR_PEEPHOLE_CONNECTOR
+
+namespace OMR {
+namespace X86 {
+class Peephole;
+}
+
+typedef OMR::X86::Peephole PeepholeConnector;
+} // namespace OMR
+#else
+#error OMR::X86::Peephole expected to be a primary connector, but an OMR connector is already defined
+#endif
+
+#include "compiler/codegen/OMRPeephole.hpp"
+
+#include <stdint.h>
+#include "codegen/InstOpCode.hpp"
+
+namespace TR {
+class Compilation;
+class Instruction;
+} // namespace TR
+
+namespace OMR { namespace X86 {
+
+/**
+ * Post register assignment peephole optimizations for x86.
+ *
+ * Each peephole is an entry in a table that maps the mnemonic of the
+ * instruction at the cursor to the name of the peephole and the function that
+ * tries it, so adding one is a matter of writing the function and listing the
+ * mnemonics it applies to. The entries for a mnemonic are kept together and
+ * are tried in table order. Every peephole that fires bumps the static debug
+ * counter x86/peephole/<name>.
+ */
+class OMR_EXTENSIBLE Peephole : public OMR::Peephole {
+public:
+    Peephole(TR::Compilation *comp);
+
+    virtual bool performOnInstruction(TR::Instruction *cursor);
+
+private:
+    struct Pattern {
+        TR::InstOpCode::Mnemonic _mnemonic;
+        const char *_name;
+        bool (OMR::X86::Peephole::*_transform)();
+    };
+
+    static const Pattern _patterns[];
+
+    /**
+     * @returns the index of the first entry in _patterns for mnemonic, or -1
+     *          if no peephole applies to it
+     */
+    static int32_t firstPatternFor(TR::InstOpCode::Mnemonic mnemonic);
+
+    /** \brief
+     *     Tries to remove a register to register move whose source and target are the same register, e.g.
+     *
+     *     <code>
+     *     mov rax, rax
+     *     </code>
+     *
+     *     Moves that zero the upper half of a 64-bit register are left alone.
+     *
+     *  \return
+     *     true if the reduction was successful; false otherwise.
+     */
+    bool tryToRemoveSelfMove();
+
+    /** \brief
+     *     Tries to remove a register to register move that copies a value back to where it was just copied from:
+     *
+     *     <code>
+     *     mov rax, rbx
+     *     mov rbx, rax
+     *     </code>
+     *
+     *     can be reduced to:
+     *
+     *     <code>
+     *     mov rax, rbx
+     *     </code>
+     *
+     *  \return
+     *     true if the reduction was successful; false otherwise.
+     */
+    bool tryToRemoveRedundantCopyBack();
+
+    /** \brief
+     *     Tries to remove a load that immediately follows a store of the same register to the same location:
+     *
+     *     <code>
+     *     mov [rsp+8], rax
+     *     mov rax, [rsp+8]
+     *     </code>
+     *
+     *     can be reduced to:
+     *
+     *     <code>
+     *     mov [rsp+8], rax
+     *     </code>
+     *
+     *  \return
+     *     true if the reduction was successful; false otherwise.
+     */
+    bool tryToRemoveLoadAfterStore();
+
+    /** \brief
+     *     Tries to remove a store that immediately follows a load of the same register from the same location:
+     *
+     *     <code>
+     *     mov rax, [rsp+8]
+     *     mov [rsp+8], rax
+     *     </code>
+     *
+     *     can be reduced to:
+     *
+     *     <code>
+     *     mov rax, [rsp+8]
+     *     </code>
+     *
+     *  \return
+     *     true if the reduction was successful; false otherwise.
+     */
+    bool tryToRemoveStoreAfterLoad();
+
+    /** \brief
+     *     Tries to replace a compare against zero with a shorter test of the register against itself, which sets
+     *     the flags the same way:
+     *
+     *     <code>
+     *     cmp eax, 0
+     *     </code>
+     *
+     *     can be reduced to:
+     *
+     *     <code>
+     *     test eax, eax
+     *     </code>
+     *
+     *  \return
+     *     true if the reduction was successful; false otherwise.
+     */
+    bool tryToReduceCompareWithZeroToTest();
+
+    /** \brief
+     *     Tries to remove a test of a register against itself when the previous instruction is a logical operation
+     *     of the same width on that register, which has already set the flags the same way:
+     *
+     *     <code>
+     *     and eax, ebx
+     *     test eax, eax
+     *     </code>
+     *
+     *     can be reduced to:
+     *
+     *     <code>
+     *     and eax, ebx
+     *     </code>
+     *
+     *  \return
+     *     true if the reduction was successful; false otherwise.
+     */
+    bool tryToRemoveRedundantTest();
+
+    /** \brief
+     *     Tries to fold an \c lea that computes a plain register value into a move, or remove it if it is a no-op:
+     *
+     *     <code>
+     *     lea rax, [rbx]
+     *     lea rcx, [rcx]
+     *     </code>
+     *
+     *     can be reduced to:
+     *
+     *     <code>
+     *     mov rax, rbx
+     *     </code>
+     *
+     *  \return
+     *     true if the reduction was successful; false otherwise.
+     */
+    bool tryToFoldLEA();
+
+    /** \brief
+     *     Tries to replace a move of zero into a register with the shorter xor idiom, if the flags it clobbers are
+     *     dead:
+     *
+     *     <code>
+     *     mov eax, 0
+     *     </code>
+     *
+     *     can be reduced to:
+     *
+     *     <code>
+     *     xor eax, eax
+     *     </code>
+     *
+     *  \return
+     *     true if the reduction was successful; false otherwise.
+     */
+    bool tryToUseZeroIdiom();
+
+private:
+    /// The instruction cursor currently being processed by the peephole optimization
+    TR::Instruction *cursor;
+};
+
+}} // namespace OMR::X86
+
+#endif
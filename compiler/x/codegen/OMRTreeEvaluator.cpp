@@ -995,6 +995,14 @@ TR::Register *OMR::X86::TreeEvaluator::arraycmplenEvaluator(TR::Node *node, TR::
     return TR::TreeEvaluator::SSE2ArraycmpLenEvaluator(node, cg);
 }
 
+// Whether arraycmp, arraycmplen and arraytranslateAndTest should scan 32 bytes per iteration
+// with AVX2 before handing the residue to their 16-byte SSE2 loops
+static bool useAVX2ForArrayScans(TR::CodeGenerator *cg)
+{
+    static bool disableAVX2ArrayScans = feGetEnv("TR_disableAVX2ArrayScans") != NULL;
+    return !disableAVX2ArrayScans && cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX2);
+}
+
 TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpEvaluator(TR::Node *node, TR::CodeGenerator *cg)
 {
     TR::Node *s1AddrNode = node->getChild(0);
@@ -1011,6 +1019,7 @@ TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpEvaluator(TR::Node *node, TR:
     TR::LabelSymbol *greaterThanLabel = generateLabelSymbol(cg);
     TR::LabelSymbol *equalLabel = generateLabelSymbol(cg);
     TR::LabelSymbol *doneLabel = generateLabelSymbol(cg);
+    TR::LabelSymbol *unequalIndexFound = generateLabelSymbol(cg);
 
     startLabel->setStartInternalControlFlow();
     doneLabel->setEndInternalControlFlow();
@@ -1025,6 +1034,18 @@ TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpEvaluator(TR::Node *node, TR:
         strLenReg = strLenReg->getLowOrder();
     }
 
+    bool useAVX2 = useAVX2ForArrayScans(cg);
+    TR::LabelSymbol *ymmLoop = NULL;
+    TR::LabelSymbol *ymmUnequal = NULL;
+    TR::Register *ymm1Reg = NULL;
+    TR::Register *ymm2Reg = NULL;
+    if (useAVX2) {
+        ymmLoop = generateLabelSymbol(cg);
+        ymmUnequal = generateLabelSymbol(cg);
+        ymm1Reg = cg->allocateRegister(TR_VRF);
+        ymm2Reg = cg->allocateRegister(TR_VRF);
+    }
+
     TR::Register *deltaReg = cg->allocateRegister(TR_GPR);
     TR::Register *equalTestReg = cg->allocateRegister(TR_GPR);
     TR::Register *s2ByteVer1Reg = cg->allocateRegister(TR_GPR);
@@ -1041,6 +1062,36 @@ TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpEvaluator(TR::Node *node, TR:
     Inst_RegReg(OP::SUBRegReg(), node, deltaReg, s2Reg, cg); // delta = s1 - s2
     // If s1 and s2 are the same address, jump to equalLabel
     Inst_Label(OP::JE4, node, equalLabel, cg);
+
+    if (useAVX2) {
+        // Compare 32 bytes at a time while at least 32 bytes remain, and leave the remaining
+        // 0 to 31 bytes to the sixteen byte loop below
+        TR::LabelSymbol *ymmDone = generateLabelSymbol(cg);
+
+        Inst_RegReg(OP::MOVRegReg(), node, qwordCounterReg, strLenReg, cg);
+        Inst_RegImm(OP::SHRRegImm1(), node, qwordCounterReg, 5, cg);
+        Inst_Label(OP::JE4, node, ymmDone, cg);
+
+        Inst_Label(OP::label, node, ymmLoop, cg);
+        Inst_RegMem(OP::VMOVDQUYmmMem, node, ymm2Reg, MRef_Bdisp32(s2Reg, 0, cg), cg);
+        Inst_RegMem(OP::VMOVDQUYmmMem, node, ymm1Reg, MRef_BIS(s2Reg, deltaReg, 0, cg), cg);
+        Inst_RegRegReg(OP::PCMPEQBRegReg, node, ymm1Reg, ymm1Reg, ymm2Reg, cg, OMR::X86::VEX_L256);
+        Inst_RegReg(OP::PMOVMSKB4RegReg, node, equalTestReg, ymm1Reg, cg, OMR::X86::VEX_L256);
+        Inst_RegImm(OP::CMP4RegImms, node, equalTestReg, -1, cg);
+
+        cg->stopUsingRegister(ymm1Reg);
+        cg->stopUsingRegister(ymm2Reg);
+
+        Inst_Label(OP::JNE4, node, ymmUnequal, cg);
+        Inst_RegImm(OP::ADDRegImm4(), node, s2Reg, 32, cg);
+        Inst_RegImm(OP::SUBRegImm4(), node, qwordCounterReg, 1, cg);
+        Inst_Label(OP::JG4, node, ymmLoop, cg);
+
+        Inst(OP::VZEROUPPER, node, cg);
+        Inst_RegImm(OP::ANDRegImms(), node, strLenReg, 0x1f, cg);
+        Inst_Label(OP::label, node, ymmDone, cg);
+    }
+
     Inst_RegReg(OP::MOVRegReg(), node, qwordCounterReg, strLenReg, cg);
     Inst_RegImm(OP::SHRRegImm1(), node, qwordCounterReg, 4, cg);
     Inst_Label(OP::JE4, node, byteStart, cg);
@@ -1086,9 +1137,19 @@ TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpEvaluator(TR::Node *node, TR:
 
     Inst_Label(OP::JMP4, node, equalLabel, cg);
 
+    if (useAVX2) {
+        // Same as below, but with one bit for each of thirty-two bytes
+        Inst_Label(OP::label, node, ymmUnequal, cg);
+        Inst(OP::VZEROUPPER, node, cg);
+        Inst_Reg(OP::NOT4Reg, node, equalTestReg, cg);
+        Inst_RegReg(OP::BSF4RegReg, node, equalTestReg, equalTestReg, cg);
+        Inst_Label(OP::JMP4, node, unequalIndexFound, cg);
+    }
+
     Inst_Label(OP::label, node, qwordUnequal, cg);
     Inst_Reg(OP::NOT2Reg, node, equalTestReg, cg);
     Inst_RegReg(OP::BSF2RegReg, node, equalTestReg, equalTestReg, cg);
+    Inst_Label(OP::label, node, unequalIndexFound, cg);
     Inst_RegReg(OP::ADDRegReg(), node, deltaReg, equalTestReg, cg);
     Inst_RegMem(OP::L1RegMem, node, s2ByteVer2Reg, MRef_BIS(s2Reg, equalTestReg, 0, cg), cg);
     Inst_MemReg(OP::CMP1MemReg, node, MRef_BIS(s2Reg, deltaReg, 0, cg), s2ByteVer2Reg, cg);
@@ -1112,9 +1173,13 @@ TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpEvaluator(TR::Node *node, TR:
     Inst_Label(OP::label, node, equalLabel, cg);
     Inst_RegImm(OP::MOVRegImm4(), node, resultReg, 0, cg);
 
-    TR::RegisterDependencyConditions *deps = RegDeps((uint8_t)0, 8, cg);
+    TR::RegisterDependencyConditions *deps = RegDeps((uint8_t)0, useAVX2 ? 10 : 8, cg);
     deps->addPostCondition(xmm1Reg, TR::RealRegister::xmm1, cg);
     deps->addPostCondition(xmm2Reg, TR::RealRegister::xmm2, cg);
+    if (useAVX2) {
+        deps->addPostCondition(ymm1Reg, TR::RealRegister::NoReg, cg);
+        deps->addPostCondition(ymm2Reg, TR::RealRegister::NoReg, cg);
+    }
     deps->addPostCondition(resultReg, TR::RealRegister::NoReg, cg);
     deps->addPostCondition(s2Reg, TR::RealRegister::NoReg, cg);
     deps->addPostCondition(deltaReg, TR::RealRegister::NoReg, cg);
@@ -1174,6 +1239,10 @@ TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpLenEvaluator(TR::Node *node,
         highReg = strLenReg->getHighOrder();
     }
 
+    bool useAVX2 = useAVX2ForArrayScans(cg);
+    TR::Register *ymm1Reg = useAVX2 ? cg->allocateRegister(TR_VRF) : NULL;
+    TR::Register *ymm2Reg = useAVX2 ? cg->allocateRegister(TR_VRF) : NULL;
+
     // Test whether the address operands are equal - if so, arrays are equal, so finish with
     // resultReg containing the array length
     //
@@ -1186,6 +1255,47 @@ TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpLenEvaluator(TR::Node *node,
 
     Inst_RegReg(OP::XOR4RegReg, node, resultReg, resultReg, cg);
 
+    if (useAVX2) {
+        // Loop comparing thirty-two bytes at a time, for strLenReg >> 5 iterations, in the same
+        // way as the sixteen byte loop below, which then handles the remaining 0 to 31 bytes
+        //
+        TR::LabelSymbol *ymmLoop = generateLabelSymbol(cg);
+        TR::LabelSymbol *ymmUnequal = generateLabelSymbol(cg);
+        TR::LabelSymbol *ymmDone = generateLabelSymbol(cg);
+
+        Inst_RegReg(OP::MOVRegReg(), node, qwordCounterReg, strLenReg, cg);
+        Inst_RegImm(OP::SHRRegImm1(), node, qwordCounterReg, 5, cg);
+        Inst_Label(OP::JE4, node, ymmDone, cg);
+
+        Inst_Label(OP::label, node, ymmLoop, cg);
+        Inst_RegMem(OP::VMOVDQUYmmMem, node, ymm1Reg, MRef_BIS(s1Reg, resultReg, 0, cg), cg);
+        Inst_RegMem(OP::VMOVDQUYmmMem, node, ymm2Reg, MRef_BIS(s2Reg, resultReg, 0, cg), cg);
+        Inst_RegRegReg(OP::PCMPEQBRegReg, node, ymm1Reg, ymm1Reg, ymm2Reg, cg, OMR::X86::VEX_L256);
+        Inst_RegReg(OP::PMOVMSKB4RegReg, node, equalTestReg, ymm1Reg, cg, OMR::X86::VEX_L256);
+        Inst_RegImm(OP::CMP4RegImms, node, equalTestReg, -1, cg);
+
+        cg->stopUsingRegister(ymm1Reg);
+        cg->stopUsingRegister(ymm2Reg);
+
+        Inst_Label(OP::JNE4, node, ymmUnequal, cg);
+        Inst_RegImm(OP::ADDRegImm4(), node, resultReg, 32, cg);
+        Inst_RegImm(OP::SUBRegImm4(), node, qwordCounterReg, 1, cg);
+        Inst_Label(OP::JG4, node, ymmLoop, cg);
+
+        Inst(OP::VZEROUPPER, node, cg);
+        Inst_RegImm(OP::ANDRegImms(), node, strLenReg, 0x1f, cg);
+        Inst_Label(OP::JMP4, node, ymmDone, cg);
+
+        Inst_Label(OP::label, node, ymmUnequal, cg);
+        Inst(OP::VZEROUPPER, node, cg);
+        Inst_Reg(OP::NOT4Reg, node, equalTestReg, cg);
+        Inst_RegReg(OP::BSF4RegReg, node, equalTestReg, equalTestReg, cg);
+        Inst_RegReg(OP::ADDRegReg(), node, resultReg, equalTestReg, cg);
+        Inst_Label(OP::JMP4, node, doneLabel, cg);
+
+        Inst_Label(OP::label, node, ymmDone, cg);
+    }
+
     // Loop comparing sixteen bytes at a time, for strLenReg >> 4 iterations
     // Result of each byte of comparison is placed in xmm1RegResult - 0 if unequal; -1 if equal -
     // and MSB of each byte is copied into low order two bytes of equalTestReg to test whether
@@ -1247,9 +1357,13 @@ TR::Register *OMR::X86::TreeEvaluator::SSE2ArraycmpLenEvaluator(TR::Node *node,
     cg->stopUsingRegister(s1Reg);
     cg->stopUsingRegister(s2Reg);
 
-    TR::RegisterDependencyConditions *deps = RegDeps((uint8_t)0, 8, cg);
+    TR::RegisterDependencyConditions *deps = RegDeps((uint8_t)0, useAVX2 ? 10 : 8, cg);
     deps->addPostCondition(xmm1Reg, TR::RealRegister::xmm1, cg);
     deps->addPostCondition(xmm2Reg, TR::RealRegister::xmm2, cg);
+    if (useAVX2) {
+        deps->addPostCondition(ymm1Reg, TR::RealRegister::NoReg, cg);
+        deps->addPostCondition(ymm2Reg, TR::RealRegister::NoReg, cg);
+    }
 
     // The register pressure is 6  for above code.
     deps->addPostCondition(byteCounterReg, TR::RealRegister::NoReg, cg);
@@ -3285,6 +3399,143 @@ TR::Register *OMR::X86::TreeEvaluator::arraytranslateEvaluator(TR::Node *node, T
     return resultReg;
 }
 
+TR::Register *OMR::X86::TreeEvaluator::arraytranslateAndTestEvaluator(TR::Node *node, TR::CodeGenerator *cg)
+{
+    //
+    // tree looks as follows:
+    // arraytranslateAndTest
+    //    input ptr
+    //    byte to search for
+    //    input length (in bytes)
+    // The offset of the first occurrence of the byte is returned, or the length if there is none
+    //
+    TR_ASSERT_FATAL_WITH_NODE(node, !node->isArrayTRT() && node->getNumChildren() == 3,
+        "Only the single search byte form of arraytranslateAndTest is supported on x86");
+
+    TR::Node *inputNode = node->getChild(0);
+    TR::Node *charNode = node->getChild(1);
+    TR::Node *lengthNode = node->getChild(2);
+
+    bool useAVX2 = useAVX2ForArrayScans(cg);
+
+    TR::Register *inputReg = cg->evaluate(inputNode);
+    TR::Register *charReg = cg->evaluate(charNode);
+    TR::Register *lengthReg = cg->evaluate(lengthNode);
+    TR::Register *resultReg = cg->allocateRegister(TR_GPR);
+    TR::Register *limitReg = cg->allocateRegister(TR_GPR);
+    TR::Register *maskReg = cg->allocateRegister(TR_GPR);
+    TR::Register *charVectorReg = cg->allocateRegister(TR_VRF);
+    TR::Register *dataVectorReg = cg->allocateRegister(TR_VRF);
+
+    TR::LabelSymbol *startLabel = generateLabelSymbol(cg);
+    TR::LabelSymbol *xmmLoop = generateLabelSymbol(cg);
+    TR::LabelSymbol *byteStart = generateLabelSymbol(cg);
+    TR::LabelSymbol *byteLoop = generateLabelSymbol(cg);
+    TR::LabelSymbol *foundLabel = generateLabelSymbol(cg);
+    TR::LabelSymbol *doneLabel = generateLabelSymbol(cg);
+
+    startLabel->setStartInternalControlFlow();
+    doneLabel->setEndInternalControlFlow();
+
+    // Every byte of the vector holds the byte being searched for
+    Inst_RegReg(OP::MOVDRegReg4, node, charVectorReg, charReg, cg);
+    TR::TreeEvaluator::broadcastHelper(node, charVectorReg, useAVX2 ? TR::VectorLength256 : TR::VectorLength128,
+        TR::Int8, cg);
+
+    Inst_Label(OP::label, node, startLabel, cg);
+    Inst_RegReg(OP::XOR4RegReg, node, resultReg, resultReg, cg);
+
+    TR::LabelSymbol *ymmFound = NULL;
+    if (useAVX2) {
+        TR::LabelSymbol *ymmLoop = generateLabelSymbol(cg);
+        TR::LabelSymbol *ymmDone = generateLabelSymbol(cg);
+        ymmFound = generateLabelSymbol(cg);
+
+        // Search thirty-two bytes at a time while at least that many remain
+        Inst_RegReg(OP::MOV4RegReg, node, limitReg, lengthReg, cg);
+        Inst_RegImm(OP::SUB4RegImms, node, limitReg, 32, cg);
+        Inst_Label(OP::JL4, node, ymmDone, cg);
+
+        Inst_Label(OP::label, node, ymmLoop, cg);
+        Inst_RegMem(OP::VMOVDQUYmmMem, node, dataVectorReg, MRef_BIS(inputReg, resultReg, 0, cg), cg);
+        Inst_RegRegReg(OP::PCMPEQBRegReg, node, dataVectorReg, dataVectorReg, charVectorReg, cg, OMR::X86::VEX_L256);
+        Inst_RegReg(OP::PMOVMSKB4RegReg, node, maskReg, dataVectorReg, cg, OMR::X86::VEX_L256);
+        Inst_RegReg(OP::TEST4RegReg, node, maskReg, maskReg, cg);
+        Inst_Label(OP::JNE4, node, ymmFound, cg);
+        Inst_RegImm(OP::ADD4RegImms, node, resultReg, 32, cg);
+        Inst_RegReg(OP::CMP4RegReg, node, resultReg, limitReg, cg);
+        Inst_Label(OP::JLE4, node, ymmLoop, cg);
+
+        Inst_Label(OP::label, node, ymmDone, cg);
+        Inst(OP::VZEROUPPER, node, cg);
+    }
+
+    // Search sixteen bytes at a time while at least that many remain
+    Inst_RegReg(OP::MOV4RegReg, node, limitReg, lengthReg, cg);
+    Inst_RegImm(OP::SUB4RegImms, node, limitReg, 16, cg);
+    Inst_RegReg(OP::CMP4RegReg, node, resultReg, limitReg, cg);
+    Inst_Label(OP::JG4, node, byteStart, cg);
+
+    Inst_Label(OP::label, node, xmmLoop, cg);
+    Inst_RegMem(OP::MOVDQURegMem, node, dataVectorReg, MRef_BIS(inputReg, resultReg, 0, cg), cg);
+    Inst_RegReg(OP::PCMPEQBRegReg, node, dataVectorReg, charVectorReg, cg);
+    Inst_RegReg(OP::PMOVMSKB4RegReg, node, maskReg, dataVectorReg, cg);
+    Inst_RegReg(OP::TEST4RegReg, node, maskReg, maskReg, cg);
+    Inst_Label(OP::JNE4, node, foundLabel, cg);
+    Inst_RegImm(OP::ADD4RegImms, node, resultReg, 16, cg);
+    Inst_RegReg(OP::CMP4RegReg, node, resultReg, limitReg, cg);
+    Inst_Label(OP::JLE4, node, xmmLoop, cg);
+
+    cg->stopUsingRegister(limitReg);
+    cg->stopUsingRegister(charVectorReg);
+    cg->stopUsingRegister(dataVectorReg);
+
+    // Search the remaining 0 to 15 bytes one at a time
+    Inst_Label(OP::label, node, byteStart, cg);
+    Inst_RegReg(OP::CMP4RegReg, node, resultReg, lengthReg, cg);
+    Inst_Label(OP::JGE4, node, doneLabel, cg);
+
+    Inst_Label(OP::label, node, byteLoop, cg);
+    Inst_MemReg(OP::CMP1MemReg, node, MRef_BIS(inputReg, resultReg, 0, cg), charReg, cg);
+    Inst_Label(OP::JE4, node, doneLabel, cg);
+    Inst_RegImm(OP::ADD4RegImms, node, resultReg, 1, cg);
+    Inst_RegReg(OP::CMP4RegReg, node, resultReg, lengthReg, cg);
+    Inst_Label(OP::JL4, node, byteLoop, cg);
+    Inst_Label(OP::JMP4, node, doneLabel, cg);
+
+    if (useAVX2) {
+        Inst_Label(OP::label, node, ymmFound, cg);
+        Inst(OP::VZEROUPPER, node, cg);
+    }
+
+    // One bit of maskReg is set for each matching byte, so the lowest one gives the match offset
+    Inst_Label(OP::label, node, foundLabel, cg);
+    Inst_RegReg(OP::BSF4RegReg, node, maskReg, maskReg, cg);
+    Inst_RegReg(OP::ADD4RegReg, node, resultReg, maskReg, cg);
+
+    cg->stopUsingRegister(maskReg);
+
+    TR::RegisterDependencyConditions *deps = RegDeps((uint8_t)0, 8, cg);
+    deps->addPostCondition(inputReg, TR::RealRegister::NoReg, cg);
+    deps->addPostCondition(charReg, TR::RealRegister::ByteReg, cg);
+    deps->addPostCondition(lengthReg, TR::RealRegister::NoReg, cg);
+    deps->addPostCondition(resultReg, TR::RealRegister::NoReg, cg);
+    deps->addPostCondition(limitReg, TR::RealRegister::NoReg, cg);
+    deps->addPostCondition(maskReg, TR::RealRegister::NoReg, cg);
+    deps->addPostCondition(charVectorReg, TR::RealRegister::NoReg, cg);
+    deps->addPostCondition(dataVectorReg, TR::RealRegister::NoReg, cg);
+
+    Inst_Label(OP::label, node, doneLabel, deps, cg);
+
+    node->setRegister(resultReg);
+
+    cg->decReferenceCount(inputNode);
+    cg->decReferenceCount(charNode);
+    cg->decReferenceCount(lengthNode);
+
+    return resultReg;
+}
+
 static void packUsingShift(TR::Node *node, TR::Register *tempReg, TR::Register *sourceReg, int32_t size,
     TR::CodeGenerator *cg)
 {
@@ -3664,6 +3915,18 @@ static void arraySet64ByteLoop(TR::Node *node, uint8_t elementSize, TR::Register
 {
     TR::LabelSymbol *loopLabel = generateLabelSymbol(cg);
     TR::LabelSymbol *residueLabel = generateLabelSymbol(cg);
+    TR::LabelSymbol *unalignedLabel = NULL;
+    TR::LabelSymbol *endLabel = NULL;
+
+    // Rounding the address up to a 16-byte boundary only moves it by whole elements when the
+    // destination is aligned to the element size. Anything else takes the unaligned loop below,
+    // which keeps every store a multiple of the element size away from the start of the array.
+    if (elementSize > 1) {
+        unalignedLabel = generateLabelSymbol(cg);
+        endLabel = generateLabelSymbol(cg);
+        Inst_RegImm(OP::TEST4RegImm4, node, addressReg, elementSize - 1, cg);
+        Inst_Label(OP::JNE4, node, unalignedLabel, cg);
+    }
 
     // Unaligned store to the first 16 bytes
     Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(addressReg, 0, cg), xmmValueReg, cg);
@@ -3702,6 +3965,30 @@ static void arraySet64ByteLoop(TR::Node *node, uint8_t elementSize, TR::Register
     Inst_MemReg(OP::MOVAPSMemReg, node, MRef_Bdisp32(scratch1Reg, 16, cg), xmmValueReg, cg);
     Inst_MemReg(OP::MOVAPSMemReg, node, MRef_Bdisp32(scratch1Reg, 32, cg), xmmValueReg, cg);
     Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(scratch2Reg, 0, cg), xmmValueReg, cg);
+
+    if (elementSize > 1) {
+        TR::LabelSymbol *unalignedLoopLabel = generateLabelSymbol(cg);
+
+        Inst_Label(OP::JMP4, node, endLabel, cg);
+        Inst_Label(OP::label, node, unalignedLabel, cg);
+        // Point scratch2Reg at the last 64 bytes, then store 64 bytes per iteration from the start
+        // of the array until fewer than 64 are left
+        Inst_RegMem(OP::LEARegMem(), node, scratch2Reg, MRef_BISdisp32(addressReg, sizeReg, 0, -64, cg), cg);
+        Inst_Label(OP::label, node, unalignedLoopLabel, cg);
+        Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(addressReg, 0, cg), xmmValueReg, cg);
+        Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(addressReg, 16, cg), xmmValueReg, cg);
+        Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(addressReg, 32, cg), xmmValueReg, cg);
+        Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(addressReg, 48, cg), xmmValueReg, cg);
+        Inst_RegImm(OP::ADDRegImms(), node, addressReg, 64, cg);
+        Inst_RegReg(OP::CMPRegReg(), node, addressReg, scratch2Reg, cg);
+        Inst_Label(OP::JB4, node, unalignedLoopLabel, cg);
+        // The last 64 bytes end on the end of the array, so they overlap earlier stores by whole elements
+        Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(scratch2Reg, 0, cg), xmmValueReg, cg);
+        Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(scratch2Reg, 16, cg), xmmValueReg, cg);
+        Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(scratch2Reg, 32, cg), xmmValueReg, cg);
+        Inst_MemReg(OP::MOVUPSMemReg, node, MRef_Bdisp32(scratch2Reg, 48, cg), xmmValueReg, cg);
+        Inst_Label(OP::label, node, endLabel, cg);
+    }
 }
 
 static void arraySetXMM(TR::Node *node, uint8_t elementSize, TR::Register *addressReg, TR::Register *valueReg,
@@ -3714,6 +4001,11 @@ static void arraySetXMM(TR::Node *node, uint8_t elementSize, TR::Register *addre
     // by setting some bytes multiple times, on the assumption
     // that stores to overlapping memory ranges are cheaper than executing
     // extra comparisons and branches to set each byte exactly once.
+    //
+    // Elements wider than a byte are handled the same way once the value has been
+    // broadcast across the vector. Every store starts at a multiple of the element size
+    // from either end of the array, except in the aligned 64-byte loop, which is only
+    // entered when the destination is aligned to the element size.
     TR::LabelSymbol *startLabel = generateLabelSymbol(cg);
     TR::LabelSymbol *doneLabel = generateLabelSymbol(cg);
 
@@ -3726,12 +4018,35 @@ static void arraySetXMM(TR::Node *node, uint8_t elementSize, TR::Register *addre
     TR::Register *scratch2Reg = cg->allocateRegister(TR_GPR);
     TR::Register *xmmValueReg = cg->allocateRegister(TR_VRF);
 
-    if (cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX512VL)
-        || cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX512BW)) {
+    TR::DataType elementType;
+    switch (elementSize) {
+        case 1:
+            elementType = TR::Int8;
+            break;
+        case 2:
+            elementType = TR::Int16;
+            break;
+        case 4:
+            elementType = TR::Int32;
+            break;
+        case 8:
+            elementType = TR::Int64;
+            break;
+        default:
+            TR_ASSERT_FATAL(0, "Arrayset Evaluator: unsupported fill size %d", elementSize);
+            break;
+    }
+
+    if (elementSize == 1
+        && (cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX512VL)
+            || cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX512BW))) {
         Inst_RegReg(OP::VPBROADCASTBRegMaskGPR, node, xmmValueReg, valueReg, cg);
     } else {
-        Inst_RegReg(OP::MOVDRegReg4, node, xmmValueReg, valueReg, cg);
-        TR::TreeEvaluator::broadcastHelper(node, xmmValueReg, TR::VectorLength128, TR::Int8, cg);
+        if (valueReg->getKind() == TR_GPR)
+            Inst_RegReg(elementSize == 8 ? OP::MOVQRegReg8 : OP::MOVDRegReg4, node, xmmValueReg, valueReg, cg);
+        else
+            Inst_RegReg(OP::MOVDQURegReg, node, xmmValueReg, valueReg, cg);
+        TR::TreeEvaluator::broadcastHelper(node, xmmValueReg, TR::VectorLength128, elementType, cg);
     }
 
     // If we don't know the size at compile-time or it's known to be less than 64 bytes, generate
@@ -3762,18 +4077,32 @@ static void arraySetXMM(TR::Node *node, uint8_t elementSize, TR::Register *addre
 
         Inst_Label(OP::label, node, lt16Label, cg);
         Inst_RegImm(OP::CMPRegImm4(), node, sizeReg, 4, cg);
-        Inst_Label(OP::JAE4, node, ge4lt16Label, cg);
-        Inst_RegReg(OP::TEST4RegReg, node, sizeReg, sizeReg, cg);
-        Inst_Label(OP::JE4, node, doneLabel, cg);
+        if (elementSize > 2) {
+            // The size is a multiple of the element size, so there is nothing to set
+            Inst_Label(OP::JB4, node, doneLabel, cg);
+        } else {
+            Inst_Label(OP::JAE4, node, ge4lt16Label, cg);
+            Inst_RegReg(OP::TEST4RegReg, node, sizeReg, sizeReg, cg);
+            Inst_Label(OP::JE4, node, doneLabel, cg);
 
-        arraySet1to3Bytes(node, elementSize, addressReg, valueReg, sizeReg, cg, doneLabel);
-        Inst_Label(OP::JMP4, node, doneLabel, cg);
+            if (elementSize == 1)
+                arraySet1to3Bytes(node, elementSize, addressReg, valueReg, sizeReg, cg, doneLabel);
+            else
+                Inst_MemReg(OP::S2MemReg, node, MRef_Bdisp32(addressReg, 0, cg), valueReg, cg);
+            Inst_Label(OP::JMP4, node, doneLabel, cg);
+
+            Inst_Label(OP::label, node, ge4lt16Label, cg);
+        }
 
-        Inst_Label(OP::label, node, ge4lt16Label, cg);
-        // The value is packed into the XMM reg, but arraySet4to15Bytes() needs a packed GPR. The original valueReg
-        // can't be clobbered, so we use scratch2Reg to hold the packed value.
-        Inst_RegReg(OP::MOVDReg4Reg, node, scratch2Reg, xmmValueReg, cg);
-        arraySet4to15Bytes(node, elementSize, addressReg, scratch2Reg, sizeReg, scratch1Reg, cg);
+        if (elementSize == 8) {
+            // A single element
+            Inst_MemReg(OP::MOVQMemReg, node, MRef_Bdisp32(addressReg, 0, cg), xmmValueReg, cg);
+        } else {
+            // The value is packed into the XMM reg, but arraySet4to15Bytes() needs a packed GPR. The original
+            // valueReg can't be clobbered, so we use scratch2Reg to hold the packed value.
+            Inst_RegReg(OP::MOVDReg4Reg, node, scratch2Reg, xmmValueReg, cg);
+            arraySet4to15Bytes(node, elementSize, addressReg, scratch2Reg, sizeReg, scratch1Reg, cg);
+        }
         Inst_Label(OP::JMP4, node, doneLabel, cg);
 
         Inst_Label(OP::label, node, ge64Label, cg);
@@ -3794,6 +4123,10 @@ static void arraySetXMM(TR::Node *node, uint8_t elementSize, TR::Register *addre
     deps->stopAddingConditions();
 
     Inst_Label(OP::label, node, doneLabel, deps, cg);
+
+    cg->stopUsingRegister(scratch1Reg);
+    cg->stopUsingRegister(scratch2Reg);
+    cg->stopUsingRegister(xmmValueReg);
 }
 
 TR::Register *OMR::X86::TreeEvaluator::arraysetEvaluator(TR::Node *node, TR::CodeGenerator *cg)
@@ -3882,8 +4215,7 @@ TR::Register *OMR::X86::TreeEvaluator::arraysetEvaluator(TR::Node *node, TR::Cod
             arraySet64BitPrimitiveOnIA32(node, addressReg, valueReg, sizeReg, cg);
         } else {
             static bool disableArraySetXMM = feGetEnv("TR_disableArraySetXMM") != NULL;
-            if (cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX2) && elementSize == 1
-                && !disableArraySetXMM) {
+            if (cg->comp()->target().cpu.supportsFeature(OMR_FEATURE_X86_AVX2) && !disableArraySetXMM) {
                 arraySetXMM(node, elementSize, addressReg, valueReg, sizeReg, isSizeConst ? &size : NULL, cg);
             } else {
                 arraySetDefault(node, elementSize, addressReg, valueReg, sizeReg, cg);
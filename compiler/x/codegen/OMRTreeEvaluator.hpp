@@ -218,6 +218,7 @@ public:
     static TR::Register *passThroughEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *arraysetEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *arraytranslateEvaluator(TR::Node *node, TR::CodeGenerator *cg);
+    static TR::Register *arraytranslateAndTestEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *arraycmpEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *arraycmplenEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *arraycopyEvaluator(TR::Node *node, TR::CodeGenerator *cg);
@@ -122,12 +122,14 @@ TR::Register *OMR::X86::TreeEvaluator::unaryVectorArithmeticEvaluator(TR::Node *
     TR_ASSERT_FATAL_WITH_NODE(node, opcode.isVectorOpCode(), "unaryVectorArithmeticEvaluator expects a vector opcode");
     OMR::X86::Encoding simdEncoding = regMemOpcode.getSIMDEncoding(&cg->comp()->target().cpu, type.getVectorLength());
 
-    // We can use the RegMem instruction form if valueNode has no future references and the
+    // We can use the RegMem instruction form if valueNode is a vector load with no future references and the
     // instruction is valid to encode. Don't use RegMem instruction form with legacy instructions.
     // Some legacy SSE instructions require alignment of their memory operands, which cannot be
     // guaranteed.
     if (simdEncoding != OMR::X86::Legacy && !opcode.isVectorMasked() && valueNode->getRegister() == NULL
-        && valueNode->getReferenceCount() == 1 && regMemOpcode.getMnemonic() != OP::bad) {
+        && valueNode->getReferenceCount() == 1
+        && valueNode->getOpCodeValue() == TR::ILOpCode::createVectorOpCode(TR::vload, type)
+        && regMemOpcode.getMnemonic() != OP::bad) {
         if (simdEncoding != OMR::X86::Encoding::Bad) {
             TR::MemoryReference *mr = MRef_node(valueNode, cg);
             Inst_RegMem(regMemOpcode.getMnemonic(), node, resultReg, mr, cg, simdEncoding);
@@ -172,6 +172,15 @@ uint8_t getMemoryBarrierBinaryLengthLowerBound(int32_t barrier, TR::CodeGenerato
     return estimateMemoryBarrierBinaryLength(barrier, cg);
 }
 
+// An EVEX memory operand can only use an 8-bit displacement when it is a multiple of the operand size. Frame offsets are
+// not final when the estimate is made, so allow for the displacement widening to 32 bits.
+static int32_t estimateEVEXDisplacementPadding(TR::Instruction *instr)
+{
+    bool isEvex = instr->getOpCode().info().isEvex()
+        || (instr->getEncodingMethod() >= OMR::X86::EVEX_L128 && instr->getEncodingMethod() <= OMR::X86::EVEX_L512);
+    return isEvex ? 3 : 0;
+}
+
 // -----------------------------------------------------------------------------
 // OMR::X86::Instruction:: member functions
 bool OMR::X86::Instruction::needsRepPrefix() { return getOpCode().needsRepPrefix() != 0; }
@@ -640,20 +649,20 @@ uint8_t *TR::X86VirtualGuardNOPInstruction::generateBinaryEncoding()
     // so setup the patching location to use this previous guard and generate no instructions
     // ourselves
     if (guardForPatching != this) {
-        _site->setLocation(guardForPatching->getBinaryEncoding());
+        _site->setLocation(cg()->toExecutableAddress(guardForPatching->getBinaryEncoding()));
         setBinaryLength(0);
         setBinaryEncoding(cursor);
         if (label->getCodeLocation() == NULL) {
             cg()->addRelocation(
                 new (cg()->trHeapMemory()) TR::LabelAbsoluteRelocation((uint8_t *)(&_site->getDestination()), label));
         } else {
-            _site->setDestination(label->getCodeLocation());
+            _site->setDestination(cg()->toExecutableAddress(label->getCodeLocation()));
         }
         cg()->addAccumulatedInstructionLengthError(getEstimatedBinaryLength() - getBinaryLength());
         return cursor;
     }
 
-    _site->setLocation(patchCursor);
+    _site->setLocation(cg()->toExecutableAddress(patchCursor));
     if (label->getCodeLocation() == NULL) {
         // Conservative offset estimate
         //
@@ -667,7 +676,7 @@ uint8_t *TR::X86VirtualGuardNOPInstruction::generateBinaryEncoding()
             new (cg()->trHeapMemory()) TR::LabelAbsoluteRelocation((uint8_t *)(&_site->getDestination()), label));
     } else {
         offset = label->getCodeLocation() - (patchCursor + IA32LengthOfShortBranch);
-        _site->setDestination(label->getCodeLocation());
+        _site->setDestination(cg()->toExecutableAddress(label->getCodeLocation()));
     }
 
     // guards that do not require atomic patching have a more relaxed sizing constraing since they are only patched
@@ -806,7 +815,7 @@ uint8_t *TR::X86ImmInstruction::generateOperand(uint8_t *cursor)
     if (getOpCode().hasIntImmediate()) {
         *(int32_t *)cursor = (int32_t)getSourceImmediate();
         if (getOpCode().isCallImmOp()) {
-            *(int32_t *)cursor -= (int32_t)(intptr_t)(cursor + 4);
+            *(int32_t *)cursor -= (int32_t)(intptr_t)cg()->toExecutableAddress(cursor + 4);
         }
         cursor += 4;
     } else if (getOpCode().hasByteImmediate() || getOpCode().hasSignExtendImmediate()) {
@@ -872,7 +881,7 @@ uint8_t *TR::X86ImmSnippetInstruction::generateOperand(uint8_t *cursor)
         }
 
         if (getOpCode().isCallImmOp()) {
-            *(int32_t *)cursor -= (int32_t)(intptr_t)(cursor + 4);
+            *(int32_t *)cursor -= (int32_t)(intptr_t)cg()->toExecutableAddress(cursor + 4);
         }
         cursor += 4;
     } else if (getOpCode().hasByteImmediate() || getOpCode().hasSignExtendImmediate()) {
@@ -1082,8 +1091,8 @@ uint8_t *TR::X86ImmSymInstruction::generateOperand(uint8_t *cursor)
                 cg()->redoTrampolineReservationIfNecessary(this, getSymbolReference());
             }
 
-            intptr_t currentInstructionAddress = (intptr_t)(cursor - 1);
-            intptr_t nextInstructionAddress = (intptr_t)(cursor + 4);
+            intptr_t currentInstructionAddress = (intptr_t)cg()->toExecutableAddress(cursor - 1);
+            intptr_t nextInstructionAddress = (intptr_t)cg()->toExecutableAddress(cursor + 4);
 
             if (comp->isRecursiveMethodTarget(sym)) {
                 targetAddress = cg()->getLinkage()->entryPointFromCompiledMethod();
@@ -1141,7 +1150,7 @@ uint8_t *TR::X86ImmSymInstruction::generateOperand(uint8_t *cursor)
                         if (isTrampolineRequired) {
                             // TODO:AMD64: Consider AOT ramifications
                             targetAddress = TR::CodeCacheManager::instance()->findHelperTrampoline(
-                                getSymbolReference()->getReferenceNumber(), (void *)cursor);
+                                getSymbolReference()->getReferenceNumber(), cg()->toExecutableAddress(cursor));
                         }
                     } else if (methodSym && methodSym->isJNI() && getNode() && getNode()->isPreparedForDirectJNI()) {
                         if (isTrampolineRequired) {
@@ -1155,7 +1164,8 @@ uint8_t *TR::X86ImmSymInstruction::generateOperand(uint8_t *cursor)
 
                         if (isTrampolineRequired) {
                             targetAddress
-                                = cg()->fe()->methodTrampolineLookup(comp, getSymbolReference(), (void *)cursor);
+                                = cg()->fe()->methodTrampolineLookup(comp, getSymbolReference(),
+                                    cg()->toExecutableAddress(cursor));
                         }
                     }
 
@@ -1850,7 +1860,7 @@ int32_t TR::X86MemInstruction::estimateBinaryLength(int32_t currentEstimate)
     if (getOpCode().needsLockPrefix() || (barrier & LockPrefix))
         length++;
 
-    length += getMemoryReference()->estimateBinaryLength(cg());
+    length += getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(this);
 
     if (barrier & NeedsExplicitBarrier)
         length += estimateMemoryBarrierBinaryLength(barrier, cg());
@@ -1975,7 +1985,7 @@ uint8_t *TR::X86MemImmInstruction::generateOperand(uint8_t *cursor)
                                     ->findOrCreateGCRPatchPointSymbolRef()
                                     ->getSymbol()
                                     ->getStaticSymbol()
-                                    ->setStaticAddress(cursor - 1);
+                                    ->setStaticAddress(cg()->toExecutableAddress(cursor - 1));
                             }
                         }
                     }
@@ -2015,7 +2025,7 @@ uint8_t TR::X86MemImmInstruction::getBinaryLengthLowerBound()
 
 int32_t TR::X86MemImmInstruction::estimateBinaryLength(int32_t currentEstimate)
 {
-    int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+    int32_t length = getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(this);
 
     int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
@@ -2244,7 +2254,7 @@ uint8_t TR::X86MemRegImmInstruction::getBinaryLengthLowerBound()
 
 int32_t TR::X86MemRegImmInstruction::estimateBinaryLength(int32_t currentEstimate)
 {
-    int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+    int32_t length = getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(this);
 
     int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
@@ -2313,7 +2323,7 @@ int32_t TR::X86RegMemInstruction::estimateBinaryLength(int32_t currentEstimate)
 {
     int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
-    int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+    int32_t length = getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(this);
 
     if (barrier & LockPrefix)
         length++;
@@ -2455,7 +2465,7 @@ int32_t TR::X86RegMemImmInstruction::estimateBinaryLength(int32_t currentEstimat
 {
     int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
-    int32_t length = getMemoryReference()->estimateBinaryLength(cg());
+    int32_t length = getMemoryReference()->estimateBinaryLength(cg()) + estimateEVEXDisplacementPadding(this);
 
     if (barrier & LockPrefix)
         length++;
@@ -57,7 +57,7 @@ uint8_t *TR::X86FPConversionSnippet::emitSnippetBody()
 
 uint8_t *TR::X86FPConversionSnippet::emitCallToConversionHelper(uint8_t *buffer)
 {
-    intptr_t callInstructionAddress = (intptr_t)buffer;
+    intptr_t callInstructionAddress = (intptr_t)cg()->toExecutableAddress(buffer);
     intptr_t nextInstructionAddress = callInstructionAddress + 5;
 
     *buffer++ = 0xe8; // CallImm4
@@ -65,7 +65,7 @@ uint8_t *TR::X86FPConversionSnippet::emitCallToConversionHelper(uint8_t *buffer)
     intptr_t helperAddress = (intptr_t)getHelperSymRef()->getMethodAddress();
     if (cg()->directCallRequiresTrampoline(helperAddress, callInstructionAddress)) {
         helperAddress = TR::CodeCacheManager::instance()->findHelperTrampoline(getHelperSymRef()->getReferenceNumber(),
-            (void *)buffer);
+            cg()->toExecutableAddress(buffer));
 
         TR_ASSERT_FATAL(cg()->comp()->target().cpu.isTargetWithinRIPRange(helperAddress, nextInstructionAddress),
             "Local helper trampoline must be reachable directly");
@@ -708,11 +708,11 @@ int32_t TR::X86SystemLinkage::layoutTypeOnStack(TR::DataType type, int32_t &data
 
 intptr_t TR::X86SystemLinkage::entryPointFromCompiledMethod()
 {
-    return reinterpret_cast<intptr_t>(cg()->getCodeStart());
+    return reinterpret_cast<intptr_t>(cg()->toExecutableAddress(cg()->getCodeStart()));
 }
 
 intptr_t TR::X86SystemLinkage::entryPointFromInterpretedMethod()
 {
-    return reinterpret_cast<intptr_t>(cg()->getCodeStart());
+    return reinterpret_cast<intptr_t>(cg()->toExecutableAddress(cg()->getCodeStart()));
 }
 
@@ -1683,11 +1683,6 @@ TR::Register *OMR::X86::I386::TreeEvaluator::ArrayCHKEvaluator(TR::Node *node, T
     return TR::TreeEvaluator::badILOpEvaluator(node, cg);
 }
 
-TR::Register *OMR::X86::I386::TreeEvaluator::arraytranslateAndTestEvaluator(TR::Node *node, TR::CodeGenerator *cg)
-{
-    return TR::TreeEvaluator::unImpOpEvaluator(node, cg);
-}
-
 TR::Register *OMR::X86::I386::TreeEvaluator::long2StringEvaluator(TR::Node *node, TR::CodeGenerator *cg)
 {
     return TR::TreeEvaluator::badILOpEvaluator(node, cg);
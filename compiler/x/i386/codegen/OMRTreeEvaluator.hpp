@@ -341,7 +341,6 @@ public:
     static TR::Register *SpineCHKEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *ArrayStoreCHKEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *ArrayCHKEvaluator(TR::Node *node, TR::CodeGenerator *cg);
-    static TR::Register *arraytranslateAndTestEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *long2StringEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *bitOpMemEvaluator(TR::Node *node, TR::CodeGenerator *cg);
     static TR::Register *allocationFenceEvaluator(TR::Node *node, TR::CodeGenerator *cg);
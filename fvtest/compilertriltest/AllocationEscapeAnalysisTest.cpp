@@ -0,0 +1,268 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/ObjectModel.hpp"
+
+static uint8_t objectHeap[4096];
+static size_t objectHeapTop = 0;
+static int32_t numAllocations = 0;
+
+/**
+ * A bump allocator standing in for a front-end allocation helper: it returns
+ * zeroed memory of the requested size and counts how often it is called.
+ */
+static void *allocateObject(int32_t size)
+   {
+   size_t aligned = (static_cast<size_t>(size) + 15) & ~static_cast<size_t>(15);
+   if (objectHeapTop + aligned > sizeof(objectHeap))
+      objectHeapTop = 0;
+
+   void *object = &objectHeap[objectHeapTop];
+   objectHeapTop += aligned;
+   memset(object, 0, size);
+   numAllocations++;
+   return object;
+   }
+
+// Calls are not yet supported by every code generator (see issue #1645)
+#define SKIP_WITHOUT_CALLS() \
+   SKIP_ON_PPC(MissingImplementation) << "Calls are not currently supported on POWER"; \
+   SKIP_ON_PPC64(MissingImplementation) << "Calls are not currently supported on POWER 64"; \
+   SKIP_ON_PPC64LE(MissingImplementation) << "Calls are not currently supported on POWER 64le"; \
+   SKIP_ON_S390_LINUX(MissingImplementation) << "Calls are not currently supported on S390 Linux"; \
+   SKIP_ON_S390X_LINUX(MissingImplementation) << "Calls are not currently supported on S390x Linux"; \
+   SKIP_ON_ARM(MissingImplementation) << "Calls are not currently supported on ARM"; \
+   SKIP_ON_AARCH64(MissingImplementation) << "Calls are not currently supported on AArch64"
+
+class AllocationEscapeAnalysisTest : public TRTest::JitTest
+   {
+   public:
+   AllocationEscapeAnalysisTest()
+      {
+      // The JIT, and with it the object model, is set up afresh for every test
+      EXPECT_TRUE(TR::Compiler->om.registerAllocationHelper(reinterpret_cast<void *>(&allocateObject), 0));
+      numAllocations = 0;
+      }
+   };
+
+TEST_F(AllocationEscapeAnalysisTest, ScalarReplacesFields)
+   {
+   SKIP_WITHOUT_CALLS();
+
+   char inputTrees[1024] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees),
+      "(method return=Int32 args=[Int32]                                           "
+      " (block                                                                     "
+      "  (astore temp=\"obj\" (acall address=0x%jX args=[Int32] (iconst 16)))     "
+      "  (istorei offset=0 (aload temp=\"obj\") (iload parm=0))                   "
+      "  (istorei offset=4 (aload temp=\"obj\") (iconst 7))                       "
+      "  (ireturn                                                                  "
+      "   (iadd                                                                    "
+      "    (iadd (iloadi offset=0 (aload temp=\"obj\")) (iloadi offset=4 (aload temp=\"obj\")))"
+      "    (iloadi offset=8 (aload temp=\"obj\"))))))                             ",
+      reinterpret_cast<uintmax_t>(&allocateObject));
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees) << "Trees failed to parse\n" << inputTrees;
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_EQ(12, entry_point(5));
+   EXPECT_EQ(-3, entry_point(-10));
+   EXPECT_EQ(0, numAllocations);
+   }
+
+TEST_F(AllocationEscapeAnalysisTest, StackAllocatesOverlappingFields)
+   {
+   SKIP_WITHOUT_CALLS();
+
+   EXPECT_TRUE(TR::Compiler->om.registerAllocationHelper(reinterpret_cast<void *>(&allocateObject), 0, 0, true));
+
+   char inputTrees[1024] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees),
+      "(method return=Int64 args=[Int32]                                           "
+      " (block                                                                     "
+      "  (astore temp=\"obj\" (acall address=0x%jX args=[Int32] (iconst 8)))      "
+      "  (istorei offset=0 (aload temp=\"obj\") (iload parm=0))                   "
+      "  (istorei offset=4 (aload temp=\"obj\") (iload parm=0))                   "
+      "  (lreturn (lloadi offset=0 (aload temp=\"obj\")))))                       ",
+      reinterpret_cast<uintmax_t>(&allocateObject));
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees) << "Trees failed to parse\n" << inputTrees;
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto entry_point = compiler.getEntryPoint<int64_t (*)(int32_t)>();
+   EXPECT_EQ(static_cast<int64_t>(0x0000001100000011LL), entry_point(0x11));
+   EXPECT_EQ(0, numAllocations);
+   }
+
+TEST_F(AllocationEscapeAnalysisTest, KeepsEscapingAllocation)
+   {
+   SKIP_WITHOUT_CALLS();
+
+   char inputTrees[1024] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees),
+      "(method return=Address args=[Int32]                                         "
+      " (block                                                                     "
+      "  (astore temp=\"obj\" (acall address=0x%jX args=[Int32] (iconst 16)))     "
+      "  (istorei offset=0 (aload temp=\"obj\") (iload parm=0))                   "
+      "  (areturn (aload temp=\"obj\"))))                                         ",
+      reinterpret_cast<uintmax_t>(&allocateObject));
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees) << "Trees failed to parse\n" << inputTrees;
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto entry_point = compiler.getEntryPoint<int32_t *(*)(int32_t)>();
+   int32_t *object = entry_point(42);
+   ASSERT_NOTNULL(object);
+   EXPECT_EQ(42, object[0]);
+   EXPECT_EQ(1, numAllocations);
+   }
+
+TEST_F(AllocationEscapeAnalysisTest, KeepsOverlappingFieldsOnHeapUnlessAllowed)
+   {
+   SKIP_WITHOUT_CALLS();
+
+   char inputTrees[1024] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees),
+      "(method return=Int64 args=[Int32]                                           "
+      " (block                                                                     "
+      "  (astore temp=\"obj\" (acall address=0x%jX args=[Int32] (iconst 8)))      "
+      "  (istorei offset=0 (aload temp=\"obj\") (iload parm=0))                   "
+      "  (istorei offset=4 (aload temp=\"obj\") (iload parm=0))                   "
+      "  (lreturn (lloadi offset=0 (aload temp=\"obj\")))))                       ",
+      reinterpret_cast<uintmax_t>(&allocateObject));
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees) << "Trees failed to parse\n" << inputTrees;
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto entry_point = compiler.getEntryPoint<int64_t (*)(int32_t)>();
+   EXPECT_EQ(static_cast<int64_t>(0x0000002200000022LL), entry_point(0x22));
+   EXPECT_EQ(1, numAllocations);
+   }
+
+TEST_F(AllocationEscapeAnalysisTest, ScalarReplacesAllocationFirstUsedByFieldStore)
+   {
+   SKIP_WITHOUT_CALLS();
+
+   char inputTrees[1024] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees),
+      "(method return=Int32 args=[Int32]                                           "
+      " (block                                                                     "
+      "  (istorei offset=0 (acall id=\"obj\" address=0x%jX args=[Int32] (iconst 16)) (iload parm=0))"
+      "  (istorei offset=4 (@id \"obj\") (iconst 7))                               "
+      "  (ireturn (iadd (iloadi offset=0 (@id \"obj\")) (iloadi offset=4 (@id \"obj\"))))))",
+      reinterpret_cast<uintmax_t>(&allocateObject));
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees) << "Trees failed to parse\n" << inputTrees;
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_EQ(12, entry_point(5));
+   EXPECT_EQ(-3, entry_point(-10));
+   EXPECT_EQ(0, numAllocations);
+   }
+
+TEST_F(AllocationEscapeAnalysisTest, ScalarReplacesAllocationInLoop)
+   {
+   SKIP_WITHOUT_CALLS();
+
+   char inputTrees[2048] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees),
+      "(method return=Int32 args=[Int32]                                           "
+      " (block name=\"entry\"                                                      "
+      "  (istore temp=\"i\" (iconst 0))                                           "
+      "  (istore temp=\"sum\" (iconst 0)))                                         "
+      " (block name=\"check\"                                                      "
+      "  (ificmpge target=\"done\" (iload temp=\"i\") (iload parm=0)))            "
+      " (block name=\"body\"                                                       "
+      "  (astore temp=\"obj\" (acall address=0x%jX args=[Int32] (iconst 16)))     "
+      "  (istorei offset=0 (aload temp=\"obj\") (iload temp=\"i\"))              "
+      "  (istorei offset=4 (aload temp=\"obj\") (iadd (iload temp=\"i\") (iconst 1)))"
+      "  (istore temp=\"sum\" (iadd (iload temp=\"sum\")                          "
+      "   (iadd (iloadi offset=0 (aload temp=\"obj\")) (iloadi offset=4 (aload temp=\"obj\")))))"
+      "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))                "
+      "  (goto target=\"check\"))                                                  "
+      " (block name=\"done\"                                                       "
+      "  (ireturn (iload temp=\"sum\"))))                                          ",
+      reinterpret_cast<uintmax_t>(&allocateObject));
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees) << "Trees failed to parse\n" << inputTrees;
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   // The sum over i of (2i + 1) is n squared
+   auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_EQ(0, entry_point(0));
+   EXPECT_EQ(1, entry_point(1));
+   EXPECT_EQ(100, entry_point(10));
+   EXPECT_EQ(0, numAllocations);
+   }
+
+TEST_F(AllocationEscapeAnalysisTest, ScalarReplacesAllocationAcrossBlocks)
+   {
+   SKIP_WITHOUT_CALLS();
+
+   char inputTrees[2048] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees),
+      "(method return=Int32 args=[Int32]                                           "
+      " (block name=\"entry\"                                                      "
+      "  (astore temp=\"obj\" (acall address=0x%jX args=[Int32] (iconst 16)))     "
+      "  (istorei offset=8 (aload temp=\"obj\") (iconst 100))                     "
+      "  (ificmplt target=\"negative\" (iload parm=0) (iconst 0)))                 "
+      " (block name=\"positive\"                                                   "
+      "  (istorei offset=0 (aload temp=\"obj\") (iload parm=0))                   "
+      "  (goto target=\"join\"))                                                   "
+      " (block name=\"negative\"                                                   "
+      "  (istorei offset=4 (aload temp=\"obj\") (ineg (iload parm=0))))           "
+      " (block name=\"join\"                                                       "
+      "  (ireturn                                                                  "
+      "   (iadd                                                                    "
+      "    (isub (iloadi offset=0 (aload temp=\"obj\")) (iloadi offset=4 (aload temp=\"obj\")))"
+      "    (iloadi offset=8 (aload temp=\"obj\"))))))                             ",
+      reinterpret_cast<uintmax_t>(&allocateObject));
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees) << "Trees failed to parse\n" << inputTrees;
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   // Whichever field is not stored keeps the zero the helper returned
+   auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_EQ(107, entry_point(7));
+   EXPECT_EQ(93, entry_point(-7));
+   EXPECT_EQ(100, entry_point(0));
+   EXPECT_EQ(0, numAllocations);
+   }
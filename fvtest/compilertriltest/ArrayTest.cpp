@@ -21,6 +21,8 @@
 
 #include "OpCodeTest.hpp"
 #include "default_compiler.hpp"
+#include <cstring>
+#include <set>
 #include <vector>
 
 static const int32_t returnValueForArraycmpGreaterThan = 2;
@@ -467,3 +469,211 @@ TEST_P(ArraycmplenNotEqualTest, ArraycmpLenNotEqualVariableLen) {
 }
 
 INSTANTIATE_TEST_CASE_P(ArraycmplenTest, ArraycmplenNotEqualTest, ::testing::ValuesIn(createArraycmpNotEqualParam()));
+
+/**
+ * @brief TestFixture class for arrayset test
+ *
+ * @details Used for arrayset test with a variable length. The parameter is
+ * the number of elements to set.
+ */
+class ArraysetTest : public TRTest::JitTest, public ::testing::WithParamInterface<int64_t> {
+public:
+    /**
+     * @brief Compile an arrayset of the given element type and check that it sets
+     * exactly the requested elements
+     *
+     * @param misalignment the number of bytes by which the array is moved off
+     * its natural alignment
+     */
+    template<typename T> void checkArrayset(const char *type, const char *load, T value, size_t misalignment = 0) {
+        auto length = GetParam();
+        char inputTrees[1024] = {0};
+        std::snprintf(inputTrees, sizeof(inputTrees),
+          "(method return=NoType args=[Address, %s, Int64]"
+          "  (block"
+          "    (treetop"
+          "      (arrayset address=0 args=[Address, %s, Int64]"
+          "        (aload parm=0)"
+          "        (%s parm=1)"
+          "        (lload parm=2)))"
+          "    (return)))",
+          type, type, load
+          );
+        auto trees = parseString(inputTrees);
+
+        ASSERT_NOTNULL(trees);
+
+        Tril::DefaultCompiler compiler(trees);
+
+        ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+        // Guard elements on either side catch stores outside the array. The elements
+        // live in a byte buffer so that the array can start at any address.
+        std::vector<T> storage(length + 3);
+        uint8_t *bytes = reinterpret_cast<uint8_t *>(&storage[0]) + misalignment;
+        std::memset(bytes, 0x5c, (length + 2) * sizeof(T));
+        T guard;
+        std::memset(&guard, 0x5c, sizeof(T));
+
+        auto entry_point = compiler.getEntryPoint<void (*)(T *, T, int64_t)>();
+        entry_point(reinterpret_cast<T *>(bytes + sizeof(T)), value, length * static_cast<int64_t>(sizeof(T)));
+
+        EXPECT_EQ(0, std::memcmp(&guard, bytes, sizeof(T))) << "Element before the array was overwritten";
+        for (int64_t i = 1; i <= length; i++)
+            EXPECT_EQ(0, std::memcmp(&value, bytes + i * sizeof(T), sizeof(T))) << "Element " << i - 1 << " was not set";
+        EXPECT_EQ(0, std::memcmp(&guard, bytes + (length + 1) * sizeof(T), sizeof(T)))
+            << "Element after the array was overwritten";
+    }
+};
+
+TEST_P(ArraysetTest, ArraysetInt8) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<int8_t>("Int8", "bload", 0x3f);
+}
+
+TEST_P(ArraysetTest, ArraysetInt16) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<int16_t>("Int16", "sload", 0x3f2e);
+}
+
+TEST_P(ArraysetTest, ArraysetInt32) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<int32_t>("Int32", "iload", 0x3f2e1d0c);
+}
+
+TEST_P(ArraysetTest, ArraysetInt64) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<int64_t>("Int64", "lload", 0x3f2e1d0c7b6a5948LL);
+}
+
+TEST_P(ArraysetTest, ArraysetFloat) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<float>("Float", "fload", 1.5f);
+}
+
+TEST_P(ArraysetTest, ArraysetDouble) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<double>("Double", "dload", -2.25);
+}
+
+TEST_P(ArraysetTest, ArraysetMisalignedInt16) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<int16_t>("Int16", "sload", 0x3f2e, 1);
+}
+
+TEST_P(ArraysetTest, ArraysetMisalignedInt32) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<int32_t>("Int32", "iload", 0x3f2e1d0c, 1);
+    checkArrayset<int32_t>("Int32", "iload", 0x3f2e1d0c, 2);
+}
+
+TEST_P(ArraysetTest, ArraysetMisalignedInt64) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<int64_t>("Int64", "lload", 0x3f2e1d0c7b6a5948LL, 3);
+    checkArrayset<int64_t>("Int64", "lload", 0x3f2e1d0c7b6a5948LL, 4);
+}
+
+TEST_P(ArraysetTest, ArraysetMisalignedDouble) {
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    checkArrayset<double>("Double", "dload", -2.25, 5);
+}
+
+static std::vector<int64_t> createArraysetParam() {
+  std::vector<int64_t> v;
+  /* Every length up to a little beyond the longest unrolled sequence */
+  for (int i = 0; i <= 72; i++) {
+    v.push_back(i);
+  }
+  /* A few lengths around the main loop */
+  const int64_t lengths[] = { 127, 128, 129, 255, 256, 257, 1000, 4096 };
+  v.insert(v.end(), lengths, lengths + sizeof(lengths) / sizeof(lengths[0]));
+  return v;
+}
+INSTANTIATE_TEST_CASE_P(ArraysetTest, ArraysetTest, ::testing::ValuesIn(createArraysetParam()));
+
+/**
+ * @brief TestFixture class for arraytranslateAndTest test
+ *
+ * @details Used for arraytranslateAndTest test searching an array for a single byte.
+ * The first parameter is the length of the array.
+ * The second parameter is the offset of the byte searched for, which is not in the
+ * array at all if it equals the length.
+ */
+class ArraytranslateAndTestTest : public TRTest::JitTest, public ::testing::WithParamInterface<std::tuple<int32_t, int32_t>> {};
+
+TEST_P(ArraytranslateAndTestTest, FindByteVariableLen) {
+    SKIP_ON_POWER(MissingImplementation);
+    SKIP_ON_ARM(MissingImplementation);
+    SKIP_ON_AARCH64(MissingImplementation);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    auto length = std::get<0>(GetParam());
+    auto offset = std::get<1>(GetParam());
+    char inputTrees[1024] = {0};
+    std::snprintf(inputTrees, sizeof(inputTrees),
+      "(method return=Int32 args=[Address, Int32]"
+      "  (block"
+      "    (ireturn"
+      "      (arraytranslateAndTest address=0 args=[Address, Int8, Int32]"
+      "        (aload parm=0)"
+      "        (bconst 63)"
+      "        (iload parm=1)))))"
+      );
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    // The byte also follows the array, where it must not be found
+    std::vector<unsigned char> s1(length + 1, 0x5c);
+    s1[offset] = 0x3f;
+    s1[length] = 0x3f;
+
+    auto entry_point = compiler.getEntryPoint<int32_t (*)(unsigned char *, int32_t)>();
+    EXPECT_EQ(offset, entry_point(&s1[0], length));
+}
+
+static std::vector<std::tuple<int32_t, int32_t>> createArraytranslateAndTestParam() {
+  std::vector<std::tuple<int32_t, int32_t>> v;
+  /* Small arrays, with the byte at each end, either side of each vector boundary, or not found */
+  for (int i = 0; i <= 80; i++) {
+    std::set<int> offsets = { 0, 1, 15, 16, 17, 31, 32, 33, 47, 48, 63, 64, i - 2, i - 1, i };
+    for (auto j : offsets) {
+      if (j >= 0 && j <= i)
+        v.push_back(std::make_tuple(i, j));
+    }
+  }
+  /* Variation of the offset of the byte in a 100 byte array */
+  for (int i = 0; i <= 100; i++) {
+    v.push_back(std::make_tuple(100, i));
+  }
+  /* Matches near the end of a large array */
+  for (int i = 4000; i <= 4096; i++) {
+    v.push_back(std::make_tuple(4096, i));
+  }
+  return v;
+}
+INSTANTIATE_TEST_CASE_P(ArraytranslateAndTestTest, ArraytranslateAndTestTest, ::testing::ValuesIn(createArraytranslateAndTestParam()));
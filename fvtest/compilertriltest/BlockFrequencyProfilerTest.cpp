@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentInfo.hpp"
+#include "il/Block.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "infra/Cfg.hpp"
+#include "optimizer/BlockFrequencyProfiler.hpp"
+#include "ras/IlVerifier.hpp"
+
+#include <string>
+#include <vector>
+
+/**
+ * Records the frequency of every block, in tree order, once the optimizer
+ * is done with the method.
+ */
+class BlockFrequencyRecorder : public TR::IlVerifier
+   {
+   public:
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      _frequencies.clear();
+      for (TR::Block *block = sym->getFirstTreeTop()->getNode()->getBlock(); block; block = block->getNextBlock())
+         _frequencies.push_back(block->getFrequency());
+      return 0;
+      }
+
+   std::vector<int32_t> _frequencies;
+   };
+
+/**
+ * Runs the profiler on its own, so the IL it instruments and later applies
+ * its profile to is exactly the IL the test wrote. Tril compiles at warm, so
+ * a method is instrumented until its profile has been entered 100 times.
+ */
+class BlockFrequencyProfilerTest : public TRTest::JitOptTest
+   {
+   public:
+
+   BlockFrequencyProfilerTest() :
+      TRTest::JitOptTest("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+                         "paranoidoptcheck,enableBlockFrequencyProfiling,blockFrequencyProfileThreshold=100")
+      {
+      addOptimization(OMR::blockFrequencyProfiler);
+      }
+
+   static TR_BlockFrequencyProfile *findProfile(const char *name)
+      {
+      std::string signature = std::string("file:line:") + name;
+      return TR::Compiler->persistentMemory()->getPersistentInfo()->getBlockFrequencyProfiles()->find(signature.c_str());
+      }
+
+   /*
+    * int32_t sign(int32_t p)
+    *   if (p < 0) return -1;
+    *   return 1;
+    */
+   static std::string signMethod(const char *name)
+      {
+      return std::string("(method name=\"") + name + "\" return=Int32 args=[Int32]"
+             " (block (ificmplt target=\"negative\" (iload parm=0) (iconst 0)))"
+             " (block (ireturn (iconst 1)))"
+             " (block name=\"negative\" (ireturn (iconst -1))))";
+      }
+   };
+
+TEST_F(BlockFrequencyProfilerTest, CountsBlocksAndTakenBranches)
+   {
+   std::string inputTrees = signMethod("countSign");
+   auto trees = parseString(inputTrees.c_str());
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   TR_BlockFrequencyProfile *profile = findProfile("countSign");
+   ASSERT_NOTNULL(profile);
+   ASSERT_EQ(3, profile->getNumBlocks());
+   ASSERT_EQ(1, profile->getNumBranches());
+
+   auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+   for (int32_t i = 0; i < 40; i++)
+      {
+      EXPECT_EQ(i % 4 == 0 ? -1 : 1, entry_point(i % 4 == 0 ? -i - 1 : i)) << "i = " << i;
+      }
+
+   EXPECT_EQ(40, profile->getBlockCount(0));
+   EXPECT_EQ(30, profile->getBlockCount(1));
+   EXPECT_EQ(10, profile->getBlockCount(2));
+   EXPECT_EQ(10, profile->getTakenCount(0));
+   }
+
+TEST_F(BlockFrequencyProfilerTest, AppliesProfileOnceEnoughEntriesRecorded)
+   {
+   std::string inputTrees = signMethod("hotSign");
+   auto trees = parseString(inputTrees.c_str());
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler instrumented(trees);
+   ASSERT_EQ(0, instrumented.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   // Mostly negative, so the taken path is the hot one
+   auto instrumented_entry = instrumented.getEntryPoint<int32_t (*)(int32_t)>();
+   for (int32_t i = 0; i < 200; i++)
+      EXPECT_EQ(i % 8 == 0 ? 1 : -1, instrumented_entry(i % 8 == 0 ? i : -i - 1)) << "i = " << i;
+
+   Tril::DefaultCompiler recompiled(trees);
+   BlockFrequencyRecorder recorder;
+   ASSERT_EQ(0, recompiled.compileWithVerifier(&recorder)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   ASSERT_EQ(3, recorder._frequencies.size());
+
+   EXPECT_EQ(MAX_BLOCK_COUNT, recorder._frequencies[0]);
+   EXPECT_GT(recorder._frequencies[1], MAX_COLD_BLOCK_COUNT);
+   EXPECT_GT(recorder._frequencies[2], recorder._frequencies[1]);
+   EXPECT_GT(recorder._frequencies[0], recorder._frequencies[2]);
+
+   // The recompiled body is not instrumented, so the profile stops counting
+   auto recompiled_entry = recompiled.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_EQ(1, recompiled_entry(5));
+   EXPECT_EQ(-1, recompiled_entry(-5));
+   EXPECT_EQ(200, findProfile("hotSign")->getEntryCount());
+   }
+
+TEST_F(BlockFrequencyProfilerTest, KeepsInstrumentingBelowThreshold)
+   {
+   std::string inputTrees = signMethod("coolSign");
+   auto trees = parseString(inputTrees.c_str());
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler first(trees);
+   ASSERT_EQ(0, first.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   auto first_entry = first.getEntryPoint<int32_t (*)(int32_t)>();
+   for (int32_t i = 0; i < 50; i++)
+      EXPECT_EQ(1, first_entry(i));
+
+   // Too few entries to trust, so the second body counts into the same profile
+   Tril::DefaultCompiler second(trees);
+   ASSERT_EQ(0, second.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   auto second_entry = second.getEntryPoint<int32_t (*)(int32_t)>();
+   for (int32_t i = 0; i < 50; i++)
+      EXPECT_EQ(-1, second_entry(-i - 1));
+
+   TR_BlockFrequencyProfile *profile = findProfile("coolSign");
+   ASSERT_NOTNULL(profile);
+   EXPECT_EQ(100, profile->getEntryCount());
+   EXPECT_EQ(50, profile->getBlockCount(1));
+   EXPECT_EQ(50, profile->getBlockCount(2));
+   EXPECT_EQ(50, profile->getTakenCount(0));
+   }
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "control/CompiledBodyCache.hpp"
+#include "control/Options.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentInfo.hpp"
+
+/**
+ * Test fixture that turns on the compiled body cache for the duration of
+ * each test case
+ */
+class CompiledBodyCacheTest : public TRTest::JitTest
+   {
+   public:
+   CompiledBodyCacheTest()
+      {
+      TR::Options::getCmdLineOptions()->setOption(TR_EnableCompiledBodyCache);
+      }
+
+   ~CompiledBodyCacheTest()
+      {
+      TR::Options::getCmdLineOptions()->setOption(TR_EnableCompiledBodyCache, false);
+      }
+   };
+
+static const char *addConstantTrees =
+   "(method return=Int32 args=[Int32]  "
+   " (block                            "
+   "  (ireturn                         "
+   "   (iadd                           "
+   "    (iload parm=0)                 "
+   "    (iconst %d)))))                ";
+
+TEST_F(CompiledBodyCacheTest, IdenticalILReusesBody)
+   {
+   char inputTrees[200] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees), addConstantTrees, 1123);
+
+   auto firstTrees = parseString(inputTrees);
+   auto secondTrees = parseString(inputTrees);
+   ASSERT_NOTNULL(firstTrees);
+   ASSERT_NOTNULL(secondTrees);
+
+   Tril::DefaultCompiler first(firstTrees);
+   Tril::DefaultCompiler second(secondTrees);
+   ASSERT_EQ(0, first.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   ASSERT_EQ(0, second.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto firstEntry = first.getEntryPoint<int32_t (*)(int32_t)>();
+   auto secondEntry = second.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_EQ(firstEntry, secondEntry);
+   EXPECT_EQ(1124, secondEntry(1));
+   }
+
+TEST_F(CompiledBodyCacheTest, DifferentConstantsCompileSeparately)
+   {
+   char firstInput[200] = {0};
+   char secondInput[200] = {0};
+   std::snprintf(firstInput, sizeof(firstInput), addConstantTrees, 17);
+   std::snprintf(secondInput, sizeof(secondInput), addConstantTrees, 18);
+
+   auto firstTrees = parseString(firstInput);
+   auto secondTrees = parseString(secondInput);
+   ASSERT_NOTNULL(firstTrees);
+   ASSERT_NOTNULL(secondTrees);
+
+   Tril::DefaultCompiler first(firstTrees);
+   Tril::DefaultCompiler second(secondTrees);
+   ASSERT_EQ(0, first.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << firstInput;
+   ASSERT_EQ(0, second.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << secondInput;
+
+   auto firstEntry = first.getEntryPoint<int32_t (*)(int32_t)>();
+   auto secondEntry = second.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_NE(firstEntry, secondEntry);
+   EXPECT_EQ(18, firstEntry(1));
+   EXPECT_EQ(19, secondEntry(1));
+   }
+
+TEST_F(CompiledBodyCacheTest, DifferentOptionsCompileSeparately)
+   {
+   char inputTrees[200] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees), addConstantTrees, 2047);
+
+   auto firstTrees = parseString(inputTrees);
+   auto secondTrees = parseString(inputTrees);
+   ASSERT_NOTNULL(firstTrees);
+   ASSERT_NOTNULL(secondTrees);
+
+   Tril::DefaultCompiler first(firstTrees);
+   Tril::DefaultCompiler second(secondTrees);
+   ASSERT_EQ(0, first.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   TR::Options::getCmdLineOptions()->setOption(TR_DisableTailRecursion);
+   int32_t rc = second.compile();
+   TR::Options::getCmdLineOptions()->setOption(TR_DisableTailRecursion, false);
+   ASSERT_EQ(0, rc) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto firstEntry = first.getEntryPoint<int32_t (*)(int32_t)>();
+   auto secondEntry = second.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_NE(firstEntry, secondEntry);
+   EXPECT_EQ(2048, firstEntry(1));
+   EXPECT_EQ(2048, secondEntry(1));
+   }
+
+TEST_F(CompiledBodyCacheTest, ReleasingLastReferenceEvictsBody)
+   {
+   char inputTrees[200] = {0};
+   std::snprintf(inputTrees, sizeof(inputTrees), addConstantTrees, 4095);
+
+   auto firstTrees = parseString(inputTrees);
+   auto secondTrees = parseString(inputTrees);
+   auto thirdTrees = parseString(inputTrees);
+   ASSERT_NOTNULL(firstTrees);
+   ASSERT_NOTNULL(secondTrees);
+   ASSERT_NOTNULL(thirdTrees);
+
+   Tril::DefaultCompiler first(firstTrees);
+   Tril::DefaultCompiler second(secondTrees);
+   ASSERT_EQ(0, first.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   ASSERT_EQ(0, second.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto sharedEntry = second.getEntryPoint<int32_t (*)(int32_t)>();
+   ASSERT_EQ(first.getEntryPoint<int32_t (*)(int32_t)>(), sharedEntry);
+
+   // Both compilations hold the body, so only the second release lets the code go
+   TR_CompiledBodyCache *cache
+      = TR::Compiler->persistentMemory()->getPersistentInfo()->getCompiledBodyCacheIfCreated();
+   ASSERT_NOTNULL(cache);
+   uint8_t *start = reinterpret_cast<uint8_t *>(sharedEntry);
+   EXPECT_FALSE(cache->release(start, start + 1));
+   EXPECT_TRUE(cache->release(start, start + 1));
+
+   Tril::DefaultCompiler third(thirdTrees);
+   ASSERT_EQ(0, third.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   auto thirdEntry = third.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_NE(sharedEntry, thirdEntry);
+   EXPECT_EQ(4096, thirdEntry(1));
+   }
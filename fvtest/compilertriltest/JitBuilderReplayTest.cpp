@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "JitTest.hpp"
+#include "compile/CompilationTypes.hpp"
+#include "compile/Method.hpp"
+#include "compile/ResolvedMethod.hpp"
+#include "control/CompileMethod.hpp"
+#include "il/DataTypes.hpp"
+#include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
+#include "ilgen/JitBuilderRecorderBinaryBuffer.hpp"
+#include "ilgen/JitBuilderReplayBinaryBuffer.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "ilgen/MethodBuilderReplay.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+class JitBuilderReplayTest : public TRTest::JitTest {};
+
+template <typename S>
+static S *
+compileMethodBuilder(TR::MethodBuilder *mb)
+   {
+   const char **paramNames = new const char *[mb->getNumParameters()];
+   TR::DataType *paramTypes = new TR::DataType[mb->getNumParameters()];
+   for (int32_t p = 0; p < mb->getNumParameters(); p++)
+      {
+      paramNames[p] = mb->getSymbolName(p);
+      paramTypes[p] = mb->getParameterTypes()[p]->getPrimitiveType();
+      }
+
+   TR::ResolvedMethod resolvedMethod((char *)mb->getDefiningFile(),
+                                     (char *)mb->getDefiningLine(),
+                                     (char *)mb->GetMethodName(),
+                                     mb->getNumParameters(),
+                                     paramNames,
+                                     paramTypes,
+                                     mb->getReturnType()->getPrimitiveType(),
+                                     0,
+                                     static_cast<TR::IlInjector *>(mb));
+   TR::IlGeneratorMethodDetails details(&resolvedMethod);
+   int32_t rc = 0;
+   S *entry = (S *)(reinterpret_cast<void *>(compileMethodFromDetails(NULL, details, warm, rc)));
+   delete[] paramNames;
+   delete[] paramTypes;
+   return entry;
+   }
+
+/**
+ * Adds 3*i for every even i and subtracts every odd i below n
+ */
+class AlternatingSumMethod : public TR::MethodBuilder
+   {
+   public:
+   AlternatingSumMethod(TR::TypeDictionary *types)
+      : TR::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("AlternatingSum");
+      DefineParameter("n", Int32);
+      DefineLocal("sum", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Store("sum", ConstInt32(0));
+
+      TR::IlBuilder *body = NULL;
+      ForLoopUp("i", &body, ConstInt32(0), Load("n"), ConstInt32(1));
+
+      TR::IlBuilder *evenPath = NULL, *oddPath = NULL;
+      body->IfThenElse(&evenPath, &oddPath,
+         body->EqualTo(
+            body->And(body->Load("i"), body->ConstInt32(1)),
+            body->ConstInt32(0)));
+      evenPath->Store("sum",
+         evenPath->Add(evenPath->Load("sum"),
+            evenPath->Mul(evenPath->Load("i"), evenPath->ConstInt32(3))));
+      oddPath->Store("sum",
+         oddPath->Sub(oddPath->Load("sum"), oddPath->Load("i")));
+
+      Return(Load("sum"));
+      return true;
+      }
+   };
+
+static int32_t
+alternatingSum(int32_t n)
+   {
+   int32_t sum = 0;
+   for (int32_t i = 0; i < n; i++)
+      sum += (i % 2 == 0) ? 3 * i : -i;
+   return sum;
+   }
+
+TEST_F(JitBuilderReplayTest, ReplayMatchesLiveBuild)
+   {
+   std::vector<uint8_t> recording;
+   int32_t (*liveEntry)(int32_t) = NULL;
+      {
+      TR::TypeDictionary types;
+      AlternatingSumMethod method(&types);
+      TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+      method.setRecorder(&recorder);
+      liveEntry = compileMethodBuilder<int32_t (int32_t)>(&method);
+      ASSERT_NOTNULL(liveEntry) << "Live compilation failed";
+      recording = recorder.buffer();
+      }
+   ASSERT_FALSE(recording.empty());
+
+   // the live MethodBuilder is gone: everything the replay needs is in the recording
+   TR::JitBuilderReplayBinaryBuffer replay(&recording[0], recording.size());
+   TR::TypeDictionary types;
+   TR::MethodBuilderReplay method(&types, &replay);
+   ASSERT_FALSE(replay.failed());
+
+   TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+   method.setRecorder(&recorder);
+   int32_t (*replayEntry)(int32_t) = compileMethodBuilder<int32_t (int32_t)>(&method);
+   ASSERT_NOTNULL(replayEntry) << "Replay compilation failed";
+   EXPECT_FALSE(replay.failed());
+
+   // the replayed MethodBuilder must call exactly the same services as the live one
+   EXPECT_EQ(recording, recorder.buffer());
+
+   int32_t inputs[] = { 0, 1, 2, 7, 100 };
+   for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++)
+      {
+      EXPECT_EQ(alternatingSum(inputs[i]), liveEntry(inputs[i]));
+      EXPECT_EQ(alternatingSum(inputs[i]), replayEntry(inputs[i]));
+      }
+   }
+
+TEST_F(JitBuilderReplayTest, RecordingCanBeReplayedMoreThanOnce)
+   {
+   std::vector<uint8_t> recording;
+      {
+      TR::TypeDictionary types;
+      AlternatingSumMethod method(&types);
+      TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+      method.setRecorder(&recorder);
+      ASSERT_NOTNULL(compileMethodBuilder<int32_t (int32_t)>(&method));
+      recording = recorder.buffer();
+      }
+
+   TR::JitBuilderReplayBinaryBuffer replay(&recording[0], recording.size());
+   for (int32_t compilation = 0; compilation < 2; compilation++)
+      {
+      TR::TypeDictionary types;
+      TR::MethodBuilderReplay method(&types, &replay);
+      int32_t (*entry)(int32_t) = compileMethodBuilder<int32_t (int32_t)>(&method);
+      ASSERT_NOTNULL(entry) << "Replay compilation " << compilation << " failed";
+      EXPECT_EQ(alternatingSum(10), entry(10));
+      }
+   }
+
+TEST_F(JitBuilderReplayTest, TruncatedRecordingFails)
+   {
+   std::vector<uint8_t> recording;
+      {
+      TR::TypeDictionary types;
+      AlternatingSumMethod method(&types);
+      TR::JitBuilderRecorderBinaryBuffer recorder(&method, NULL);
+      method.setRecorder(&recorder);
+      ASSERT_NOTNULL(compileMethodBuilder<int32_t (int32_t)>(&method));
+      recording = recorder.buffer();
+      }
+   ASSERT_LT(16u, recording.size());
+
+   TR::JitBuilderReplayBinaryBuffer replay(&recording[0], 16);
+   TR::TypeDictionary types;
+   TR::MethodBuilderReplay method(&types, &replay);
+   EXPECT_TRUE(replay.failed());
+   }
@@ -149,6 +149,21 @@ class JitTest : public TestWithPortLib
       {
       shutdownSimpleJit();
       }
+
+   protected:
+
+   /**
+    * Initialize the JIT with a custom option string instead of the default
+    * one, e.g. to enable debug counters for a test.
+    *
+    * @param options The full option string, starting with "-Xjit:".
+    */
+   JitTest(const char *options)
+      {
+      auto initSuccess = initializeSimpleJitWithOptions((char*)options);
+      if (!initSuccess)
+         throw std::runtime_error("Failed to initialize jit");
+      }
   };
 
 /**
@@ -198,6 +213,15 @@ class JitOptTest : public JitTest
       {
       }
 
+   protected:
+
+   JitOptTest(const char *options) :
+      JitTest(options), _optimizations(), _strategy(NULL)
+      {
+      }
+
+   public:
+
    virtual void SetUp()
       {
       JitTest::SetUp();
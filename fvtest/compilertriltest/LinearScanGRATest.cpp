@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentInfo.hpp"
+#include "ras/DebugCounter.hpp"
+
+#include <string>
+#include <string.h>
+
+/**
+ * Runs the global register allocator group with the linear scan allocator in
+ * place of tactical GRA. The methods keep values live in loops and across
+ * control flow so that candidates get global registers. Each test checks
+ * the linear scan static debug counter to make sure it was not tactical GRA
+ * that ran.
+ */
+class LinearScanGRATest : public TRTest::JitOptTest
+   {
+   public:
+
+   LinearScanGRATest() :
+      TRTest::JitOptTest("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+                         "paranoidoptcheck,enableLinearScanGRA,"
+                         "staticDebugCounters={globalRegisterAllocator.linearScan*}")
+      {
+      static const OptimizationStrategy strategy[] =
+         {
+         { OMR::localCSE },
+         { OMR::tacticalGlobalRegisterAllocatorGroup },
+         { OMR::endOpts }
+         };
+      addOptimizations(strategy);
+      }
+
+   static int64_t linearScanRuns()
+      {
+      const char *names[64];
+      int64_t counts[64];
+      TR::DebugCounterGroup *counters = TR::Compiler->persistentMemory()->getPersistentInfo()->getStaticCounters();
+      uint32_t numCounters = counters->snapshot(names, counts, 64);
+      for (uint32_t i = 0; i < numCounters && i < 64; i++)
+         {
+         if (strcmp(names[i], "globalRegisterAllocator.linearScan/performed") == 0)
+            return counts[i];
+         }
+      return 0;
+      }
+   };
+
+TEST_F(LinearScanGRATest, LoopCarriedValues)
+   {
+   auto inputTrees =
+      "(method return=Int32 args=[Int32]                                 "
+      " (block name=\"entry\"                                            "
+      "  (istore temp=\"i\" (iconst 0))                                 "
+      "  (istore temp=\"sum\" (iconst 0)))                               "
+      " (block name=\"check\"                                            "
+      "  (ificmpge target=\"done\" (iload temp=\"i\") (iload parm=0)))  "
+      " (block name=\"body\"                                             "
+      "  (istore temp=\"sum\" (iadd (iload temp=\"sum\") (iload temp=\"i\")))"
+      "  (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1)))      "
+      "  (goto target=\"check\"))                                        "
+      " (block name=\"done\"                                             "
+      "  (ireturn (iload temp=\"sum\"))))                                ";
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees);
+
+   int64_t runsBefore = linearScanRuns();
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   EXPECT_LT(runsBefore, linearScanRuns()) << "Linear scan GRA did not run";
+
+   auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+   EXPECT_EQ(0, entry_point(0));
+   EXPECT_EQ(45, entry_point(10));
+   EXPECT_EQ(4950, entry_point(100));
+   }
+
+/*
+ * More loop-carried values than there are registers, so some intervals
+ * have to give up their register to heavier ones.
+ */
+TEST_F(LinearScanGRATest, MoreLiveValuesThanRegisters)
+   {
+   const int32_t numValues = 20;
+
+   std::string inputTrees = "(method return=Int32 args=[Int32] (block name=\"entry\" (istore temp=\"i\" (iconst 0))";
+   for (int32_t k = 0; k < numValues; k++)
+      inputTrees += " (istore temp=\"a" + std::to_string(k) + "\" (iadd (iload parm=0) (iconst "
+                    + std::to_string(k) + ")))";
+   inputTrees += ") (block name=\"check\" (ificmpge target=\"done\" (iload temp=\"i\") (iload parm=0)))";
+   inputTrees += " (block name=\"body\"";
+   for (int32_t k = 0; k < numValues; k++)
+      {
+      std::string a = "(iload temp=\"a" + std::to_string(k) + "\")";
+      std::string b = "(iload temp=\"a" + std::to_string((k + 1) % numValues) + "\")";
+      inputTrees += " (istore temp=\"a" + std::to_string(k) + "\" (iadd " + a + " (iand " + b + " (iconst 7))))";
+      }
+   inputTrees += " (istore temp=\"i\" (iadd (iload temp=\"i\") (iconst 1))) (goto target=\"check\"))";
+   std::string sum = "(iload temp=\"a0\")";
+   for (int32_t k = 1; k < numValues; k++)
+      sum = "(iadd " + sum + " (iload temp=\"a" + std::to_string(k) + "\"))";
+   inputTrees += " (block name=\"done\" (ireturn " + sum + ")))";
+
+   auto trees = parseString(inputTrees.c_str());
+   ASSERT_NOTNULL(trees);
+
+   int64_t runsBefore = linearScanRuns();
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   EXPECT_LT(runsBefore, linearScanRuns()) << "Linear scan GRA did not run";
+
+   auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+   for (int32_t n = 0; n <= 12; n += 3)
+      {
+      uint32_t a[numValues];
+      for (int32_t k = 0; k < numValues; k++)
+         a[k] = n + k;
+      for (int32_t i = 0; i < n; i++)
+         for (int32_t k = 0; k < numValues; k++)
+            a[k] = a[k] + (a[(k + 1) % numValues] & 7);
+      uint32_t expected = 0;
+      for (int32_t k = 0; k < numValues; k++)
+         expected += a[k];
+      EXPECT_EQ(static_cast<int32_t>(expected), entry_point(n)) << "n = " << n;
+      }
+   }
+
+TEST_F(LinearScanGRATest, ValuesLiveAcrossDiamond)
+   {
+   auto inputTrees =
+      "(method return=Double args=[Int32, Double]                       "
+      " (block name=\"entry\"                                            "
+      "  (istore temp=\"x\" (imul (iload parm=0) (iconst 3)))           "
+      "  (dstore temp=\"d\" (dmul (dload parm=1) (dconst 2.0)))         "
+      "  (ificmplt target=\"negative\" (iload parm=0) (iconst 0)))      "
+      " (block name=\"positive\"                                         "
+      "  (istore temp=\"x\" (iadd (iload temp=\"x\") (iconst 1)))      "
+      "  (goto target=\"join\"))                                         "
+      " (block name=\"negative\"                                         "
+      "  (dstore temp=\"d\" (dneg (dload temp=\"d\"))))                  "
+      " (block name=\"join\"                                             "
+      "  (dreturn (dadd (dload temp=\"d\") (i2d (iload temp=\"x\"))))))";
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees);
+
+   int64_t runsBefore = linearScanRuns();
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   EXPECT_LT(runsBefore, linearScanRuns()) << "Linear scan GRA did not run";
+
+   auto entry_point = compiler.getEntryPoint<double (*)(int32_t, double)>();
+   EXPECT_DOUBLE_EQ(3.0 + 1.0, entry_point(1, 0.0));
+   EXPECT_DOUBLE_EQ(31.0 + 5.0, entry_point(10, 2.5));
+   EXPECT_DOUBLE_EQ(-2.5 * 2.0 * -1.0 - 30.0, entry_point(-10, -2.5));
+   }
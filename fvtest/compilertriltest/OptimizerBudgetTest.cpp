@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentInfo.hpp"
+#include "ras/DebugCounter.hpp"
+
+#include <stdio.h>
+#include <string>
+#include <string.h>
+
+/**
+ * Runs a strategy under a 1KB optimizer memory budget. The first
+ * optimization must be done and its scratch memory alone is more than that,
+ * so the expensive optional ones after it are skipped.
+ */
+class OptimizerBudgetTest : public TRTest::JitOptTest
+   {
+   public:
+
+   OptimizerBudgetTest() :
+      TRTest::JitOptTest("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+                         "paranoidoptcheck,optimizerMemoryBudget=1,"
+                         "staticDebugCounters={optimizer.skippedOverBudget*}")
+      {
+      static const OptimizationStrategy strategy[] =
+         {
+         { OMR::localCSE, OMR::MustBeDone },
+         { OMR::partialRedundancyElimination },
+         { OMR::generalLoopUnroller },
+         { OMR::deadTreesElimination },
+         { OMR::endOpts }
+         };
+      addOptimizations(strategy);
+      }
+
+   static int64_t skippedOverBudget(const char *optName)
+      {
+      char counterName[128];
+      snprintf(counterName, sizeof(counterName), "optimizer.skippedOverBudget/%s", optName);
+
+      const char *names[64];
+      int64_t counts[64];
+      TR::DebugCounterGroup *counters = TR::Compiler->persistentMemory()->getPersistentInfo()->getStaticCounters();
+      uint32_t numCounters = counters->snapshot(names, counts, 64);
+      for (uint32_t i = 0; i < numCounters && i < 64; i++)
+         {
+         if (strcmp(names[i], counterName) == 0)
+            return counts[i];
+         }
+      return 0;
+      }
+   };
+
+/*
+ * x = p; then numBlocks times: x = x * 3 + p, each step in a block of its own.
+ */
+TEST_F(OptimizerBudgetTest, SkipsExpensiveOptimizationsOverBudget)
+   {
+   const int32_t numBlocks = 300;
+
+   std::string inputTrees =
+      "(method return=Int32 args=[Int32]"
+      " (block (istore temp=\"x\" (iload parm=0)))";
+   for (int32_t i = 0; i < numBlocks; i++)
+      {
+      inputTrees += " (block (istore temp=\"x\" (iadd (imul (iload temp=\"x\") (iconst 3)) (iload parm=0))))";
+      }
+   inputTrees += " (block (ireturn (iload temp=\"x\"))))";
+
+   auto trees = parseString(inputTrees.c_str());
+   ASSERT_NOTNULL(trees);
+
+   int64_t preSkippedBefore = skippedOverBudget("partialRedundancyElimination");
+   int64_t unrollerSkippedBefore = skippedOverBudget("generalLoopUnroller");
+
+   Tril::DefaultCompiler compiler(trees);
+   ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   EXPECT_EQ(1, skippedOverBudget("partialRedundancyElimination") - preSkippedBefore);
+   EXPECT_EQ(1, skippedOverBudget("generalLoopUnroller") - unrollerSkippedBefore);
+   EXPECT_EQ(0, skippedOverBudget("deadTreesElimination"));
+
+   auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+   for (int32_t p = -2; p <= 2; p++)
+      {
+      uint32_t x = static_cast<uint32_t>(p);
+      for (int32_t i = 0; i < numBlocks; i++)
+         x = x * 3 + static_cast<uint32_t>(p);
+      EXPECT_EQ(static_cast<int32_t>(x), entry_point(p)) << "p = " << p;
+      }
+   }
@@ -0,0 +1,271 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "control/Options.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentInfo.hpp"
+#include "ras/DebugCounter.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(TR_TARGET_X86)
+
+/**
+ * Compiles each method twice, without and with the x86 peephole pass, and
+ * checks that the only difference in the code is the instruction the
+ * peephole was expected to remove. No optimizations run, so the trees reach
+ * the code generator as written.
+ */
+class PeepholeTest : public TRTest::JitOptTest
+   {
+   public:
+
+   PeepholeTest() :
+      TRTest::JitOptTest("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+                         "paranoidoptcheck,staticDebugCounters={x86/peephole*}")
+      {
+      }
+
+   static int64_t peepholeCount(const char *patternName)
+      {
+      char counterName[128];
+      snprintf(counterName, sizeof(counterName), "x86/peephole/%s", patternName);
+
+      const char *names[64];
+      int64_t counts[64];
+      TR::DebugCounterGroup *counters = TR::Compiler->persistentMemory()->getPersistentInfo()->getStaticCounters();
+      uint32_t numCounters = counters->snapshot(names, counts, 64);
+      for (uint32_t i = 0; i < numCounters && i < 64; i++)
+         {
+         if (strcmp(names[i], counterName) == 0)
+            return counts[i];
+         }
+      return 0;
+      }
+
+   static int32_t compileWithoutPeephole(Tril::DefaultCompiler &compiler)
+      {
+      TR::Options::getCmdLineOptions()->setOption(TR_DisablePeephole);
+      int32_t rc = compiler.compile();
+      TR::Options::getCmdLineOptions()->setOption(TR_DisablePeephole, false);
+      return rc;
+      }
+
+   static bool isREX(uint8_t byte) { return (byte & 0xf0) == 0x40; }
+
+   /**
+    * Length of a ModRM byte together with the SIB byte and displacement
+    * that follow it.
+    */
+   static int32_t modRMLength(const uint8_t *modRM)
+      {
+      uint8_t mod = *modRM >> 6;
+      uint8_t rm = *modRM & 7;
+      if (mod == 3)
+         return 1;
+
+      int32_t length = 1;
+      if (rm == 4)
+         {
+         length++;
+         if (mod == 0 && (modRM[1] & 7) == 5)
+            length += 4;
+         }
+      else if (mod == 0 && rm == 5)
+         {
+         length += 4;
+         }
+
+      if (mod == 1)
+         length += 1;
+      else if (mod == 2)
+         length += 4;
+      return length;
+      }
+
+   /**
+    * Finds the single instruction present in original but not in peepholed.
+    * Both are compared from their entry points up to maxLength bytes.
+    *
+    * @returns the offset of the instruction in original, or -1 if the code
+    *          does not differ
+    */
+   static int32_t findRemovedInstruction(const uint8_t *original, const uint8_t *peepholed, int32_t maxLength)
+      {
+      int32_t offset = 0;
+      while (offset < maxLength && original[offset] == peepholed[offset])
+         offset++;
+      if (offset == maxLength)
+         return -1;
+
+      // The REX prefix of the removed instruction may match the next one's
+      if (offset > 0 && isREX(original[offset - 1]) && !isREX(original[offset]))
+         offset--;
+      return offset;
+      }
+   };
+
+/*
+ * x = p; x = x; return x
+ *
+ * The second store puts back the value just loaded from x.
+ */
+TEST_F(PeepholeTest, RemovesStoreOfValueJustLoaded)
+   {
+   auto inputTrees =
+      "(method return=Int32 args=[Int32]            "
+      " (block                                      "
+      "  (istore temp=\"x\" (iload parm=0))         "
+      "  (istore temp=\"x\" (iload temp=\"x\"))     "
+      "  (ireturn (iload temp=\"x\"))))             ";
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler original(trees);
+   Tril::DefaultCompiler peepholed(trees);
+   ASSERT_EQ(0, compileWithoutPeephole(original)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   int64_t firedBefore = peepholeCount("storeAfterLoad");
+   ASSERT_EQ(0, peepholed.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   EXPECT_EQ(1, peepholeCount("storeAfterLoad") - firedBefore);
+
+   auto originalEntry = original.getEntryPoint<int32_t (*)(int32_t)>();
+   auto peepholedEntry = peepholed.getEntryPoint<int32_t (*)(int32_t)>();
+   const uint8_t *originalCode = reinterpret_cast<const uint8_t *>(originalEntry);
+   const uint8_t *peepholedCode = reinterpret_cast<const uint8_t *>(peepholedEntry);
+
+   // mov dword ptr [x], reg
+   int32_t removed = findRemovedInstruction(originalCode, peepholedCode, 64);
+   ASSERT_LE(0, removed);
+   const uint8_t *store = originalCode + removed;
+   if (isREX(*store))
+      store++;
+   ASSERT_EQ(0x89, store[0]);
+   ASSERT_NE(3, store[1] >> 6) << "Expected a store to memory";
+   int32_t storeLength = static_cast<int32_t>(store - (originalCode + removed)) + 1 + modRMLength(store + 1);
+   EXPECT_EQ(0, memcmp(originalCode + removed + storeLength, peepholedCode + removed, 4));
+
+   EXPECT_EQ(42, originalEntry(42));
+   EXPECT_EQ(42, peepholedEntry(42));
+   EXPECT_EQ(-3, peepholedEntry(-3));
+   }
+
+#if defined(OMR_ENV_DATA64)
+/*
+ * x = p + 1; return x
+ *
+ * The load of x reads back the register just stored to it.
+ */
+TEST_F(PeepholeTest, RemovesLoadOfValueJustStored)
+   {
+   auto inputTrees =
+      "(method return=Int64 args=[Int64]                                "
+      " (block                                                          "
+      "  (lstore temp=\"x\" (ladd (lload parm=0) (lconst 1)))           "
+      "  (lreturn (lload temp=\"x\"))))                                 ";
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler original(trees);
+   Tril::DefaultCompiler peepholed(trees);
+   ASSERT_EQ(0, compileWithoutPeephole(original)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   int64_t firedBefore = peepholeCount("loadAfterStore");
+   ASSERT_EQ(0, peepholed.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   EXPECT_EQ(1, peepholeCount("loadAfterStore") - firedBefore);
+
+   auto originalEntry = original.getEntryPoint<int64_t (*)(int64_t)>();
+   auto peepholedEntry = peepholed.getEntryPoint<int64_t (*)(int64_t)>();
+   const uint8_t *originalCode = reinterpret_cast<const uint8_t *>(originalEntry);
+   const uint8_t *peepholedCode = reinterpret_cast<const uint8_t *>(peepholedEntry);
+
+   // mov reg, qword ptr [x]
+   int32_t removed = findRemovedInstruction(originalCode, peepholedCode, 64);
+   ASSERT_LE(0, removed);
+   const uint8_t *load = originalCode + removed;
+   ASSERT_TRUE(isREX(load[0]) && (load[0] & 8)) << "Expected a 64-bit operation";
+   ASSERT_EQ(0x8b, load[1]);
+   ASSERT_NE(3, load[2] >> 6) << "Expected a load from memory";
+   int32_t loadLength = 2 + modRMLength(load + 2);
+   EXPECT_EQ(0, memcmp(originalCode + removed + loadLength, peepholedCode + removed, 4));
+
+   EXPECT_EQ(1, originalEntry(0));
+   EXPECT_EQ(1, peepholedEntry(0));
+   EXPECT_EQ(0x100000000LL, peepholedEntry(0xffffffffLL));
+   EXPECT_EQ(-41, peepholedEntry(-42));
+   }
+#endif /* OMR_ENV_DATA64 */
+
+/*
+ * if ((a ^ b) == 0) return 7; return 5
+ *
+ * The xor already sets the flags the test of its result would.
+ */
+TEST_F(PeepholeTest, RemovesTestOfLogicalResult)
+   {
+   auto inputTrees =
+      "(method return=Int32 args=[Int32, Int32]                                                     "
+      " (block (ificmpeq target=\"equal\" (ixor (iload parm=0) (iload parm=1)) (iconst 0)))         "
+      " (block (ireturn (iconst 5)))                                                                "
+      " (block name=\"equal\" (ireturn (iconst 7))))                                                ";
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler original(trees);
+   Tril::DefaultCompiler peepholed(trees);
+   ASSERT_EQ(0, compileWithoutPeephole(original)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   int64_t firedBefore = peepholeCount("redundantTest");
+   ASSERT_EQ(0, peepholed.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+   EXPECT_EQ(1, peepholeCount("redundantTest") - firedBefore);
+
+   auto originalEntry = original.getEntryPoint<int32_t (*)(int32_t, int32_t)>();
+   auto peepholedEntry = peepholed.getEntryPoint<int32_t (*)(int32_t, int32_t)>();
+   const uint8_t *originalCode = reinterpret_cast<const uint8_t *>(originalEntry);
+   const uint8_t *peepholedCode = reinterpret_cast<const uint8_t *>(peepholedEntry);
+
+   // test reg, reg
+   int32_t removed = findRemovedInstruction(originalCode, peepholedCode, 64);
+   ASSERT_LE(0, removed);
+   const uint8_t *test = originalCode + removed;
+   uint8_t rex = 0;
+   if (isREX(*test))
+      rex = *test++;
+   ASSERT_EQ(0x85, test[0]);
+   ASSERT_EQ(3, test[1] >> 6) << "Expected a register operand";
+   EXPECT_EQ((test[1] >> 3) & 7, test[1] & 7) << "Expected the register to be tested against itself";
+   EXPECT_EQ((rex >> 2) & 1, rex & 1) << "Expected the register to be tested against itself";
+   int32_t testLength = static_cast<int32_t>(test - (originalCode + removed)) + 2;
+   EXPECT_EQ(0, memcmp(originalCode + removed + testLength, peepholedCode + removed, 2));
+
+   int32_t values[] = { 0, 1, -1, 0x7fffffff, static_cast<int32_t>(0x80000000) };
+   for (auto a : values)
+      {
+      for (auto b : values)
+         {
+         EXPECT_EQ(originalEntry(a, b), peepholedEntry(a, b)) << "a = " << a << ", b = " << b;
+         EXPECT_EQ(a == b ? 7 : 5, peepholedEntry(a, b)) << "a = " << a << ", b = " << b;
+         }
+      }
+   }
+
+#endif /* TR_TARGET_X86 */
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "il/Node.hpp"
+#include "il/ILOps.hpp"
+#include "infra/ILWalk.hpp"
+#include "ras/IlVerifier.hpp"
+
+/**
+ * Fails compilation unless the trees hold a vector store, or, if built not
+ * to expect one, if they do.
+ */
+class VectorStoreIlVerifier : public TR::IlVerifier
+   {
+   public:
+   VectorStoreIlVerifier(bool expectVectorStore) : _expectVectorStore(expectVectorStore) {}
+
+   int32_t verify(TR::ResolvedMethodSymbol *sym)
+      {
+      bool found = false;
+      for (TR::PreorderNodeIterator iter(sym->getFirstTreeTop(), sym->comp()); iter.currentTree(); ++iter)
+         {
+         TR::ILOpCode &op = iter.currentNode()->getOpCode();
+         if (op.isVectorOpCode() && op.getVectorOperation() == TR::vstorei)
+            found = true;
+         }
+      return found == _expectVectorStore ? 0 : 1;
+      }
+
+   private:
+   bool _expectVectorStore;
+   };
+
+class SLPVectorizerTest : public TRTest::JitOptTest
+   {
+   public:
+   SLPVectorizerTest()
+      {
+      addOptimization(OMR::slpVectorization);
+      }
+   };
+
+// Only the x86 code generator reports vector support for now
+#define SKIP_WITHOUT_VECTORS() \
+   SKIP_ON_PPC(MissingImplementation) << "Vector opcodes are not currently supported on POWER"; \
+   SKIP_ON_PPC64(MissingImplementation) << "Vector opcodes are not currently supported on POWER 64"; \
+   SKIP_ON_PPC64LE(MissingImplementation) << "Vector opcodes are not currently supported on POWER 64le"; \
+   SKIP_ON_S390_LINUX(MissingImplementation) << "Vector opcodes are not currently supported on S390 Linux"; \
+   SKIP_ON_S390X_LINUX(MissingImplementation) << "Vector opcodes are not currently supported on S390x Linux"; \
+   SKIP_ON_ARM(MissingImplementation) << "Vector opcodes are not currently supported on ARM"; \
+   SKIP_ON_AARCH64(MissingImplementation) << "Vector opcodes are not currently supported on AArch64"
+
+/*
+ * void method(float *a, float *b, float *c)
+ *   a[0] = b[0] + c[0]; ... a[3] = b[3] + c[3];
+ */
+TEST_F(SLPVectorizerTest, PacksAdjacentFloatAdds)
+   {
+   SKIP_WITHOUT_VECTORS();
+
+   auto inputTrees =
+      "(method return=NoType args=[Address, Address, Address]                                       "
+      " (block                                                                                      "
+      "  (fstorei offset=0 (aload parm=0) (fadd (floadi offset=0 (aload parm=1)) (floadi offset=0 (aload parm=2))))   "
+      "  (fstorei offset=4 (aload parm=0) (fadd (floadi offset=4 (aload parm=1)) (floadi offset=4 (aload parm=2))))   "
+      "  (fstorei offset=8 (aload parm=0) (fadd (floadi offset=8 (aload parm=1)) (floadi offset=8 (aload parm=2))))   "
+      "  (fstorei offset=12 (aload parm=0) (fadd (floadi offset=12 (aload parm=1)) (floadi offset=12 (aload parm=2))))"
+      "  (return)))                                                                                 ";
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler compiler(trees);
+   VectorStoreIlVerifier verifier(true);
+   ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto entry_point = compiler.getEntryPoint<void (*)(float *, float *, float *)>();
+   float a[5] = { 0.0f, 0.0f, 0.0f, 0.0f, -1.0f };
+   float b[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+   float c[4] = { 0.5f, -2.0f, 10.0f, 0.25f };
+   entry_point(a, b, c);
+   for (int i = 0; i < 4; i++)
+      EXPECT_EQ(b[i] + c[i], a[i]) << "element " << i;
+   EXPECT_EQ(-1.0f, a[4]);
+   }
+
+/*
+ * void method(int32_t *a, int32_t *b, int32_t n)
+ *   a[3] = b[3] + n; a[1] = b[1] + n; a[2] = b[2] + n; a[0] = b[0] + n;
+ */
+TEST_F(SLPVectorizerTest, PacksOutOfOrderStoresWithSplat)
+   {
+   SKIP_WITHOUT_VECTORS();
+
+   auto inputTrees =
+      "(method return=NoType args=[Address, Address, Int32]                                  "
+      " (block                                                                               "
+      "  (istorei offset=12 (aload parm=0) (iadd (iloadi offset=12 (aload parm=1)) (iload parm=2)))  "
+      "  (istorei offset=4 (aload parm=0) (iadd (iloadi offset=4 (aload parm=1)) (iload parm=2)))    "
+      "  (istorei offset=8 (aload parm=0) (iadd (iloadi offset=8 (aload parm=1)) (iload parm=2)))    "
+      "  (istorei offset=0 (aload parm=0) (iadd (iloadi offset=0 (aload parm=1)) (iload parm=2)))    "
+      "  (return)))                                                                          ";
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler compiler(trees);
+   VectorStoreIlVerifier verifier(true);
+   ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto entry_point = compiler.getEntryPoint<void (*)(int32_t *, int32_t *, int32_t)>();
+   int32_t a[4] = { 0 };
+   int32_t b[4] = { 1, -2, 300, 0x7fffffff };
+   entry_point(a, b, 5);
+   for (int i = 0; i < 4; i++)
+      EXPECT_EQ(static_cast<int32_t>(static_cast<uint32_t>(b[i]) + 5u), a[i]) << "element " << i;
+   }
+
+/*
+ * void method(int32_t *a)
+ *   a[1] = a[0]; a[2] = a[1]; a[3] = a[2]; a[4] = a[3];
+ *
+ * Each load reads the element stored by the previous tree, so the stores
+ * must stay scalar.
+ */
+TEST_F(SLPVectorizerTest, KeepsDependentStores)
+   {
+   SKIP_WITHOUT_VECTORS();
+
+   auto inputTrees =
+      "(method return=NoType args=[Address]                               "
+      " (block                                                            "
+      "  (istorei offset=4 (aload parm=0) (iloadi offset=0 (aload parm=0)))   "
+      "  (istorei offset=8 (aload parm=0) (iloadi offset=4 (aload parm=0)))   "
+      "  (istorei offset=12 (aload parm=0) (iloadi offset=8 (aload parm=0)))  "
+      "  (istorei offset=16 (aload parm=0) (iloadi offset=12 (aload parm=0))) "
+      "  (return)))                                                       ";
+   auto trees = parseString(inputTrees);
+   ASSERT_NOTNULL(trees);
+
+   Tril::DefaultCompiler compiler(trees);
+   VectorStoreIlVerifier verifier(false);
+   ASSERT_EQ(0, compiler.compileWithVerifier(&verifier)) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+   auto entry_point = compiler.getEntryPoint<void (*)(int32_t *)>();
+   int32_t a[5] = { 7, 1, 2, 3, 4 };
+   entry_point(a);
+   for (int i = 0; i < 5; i++)
+      EXPECT_EQ(7, a[i]) << "element " << i;
+   }
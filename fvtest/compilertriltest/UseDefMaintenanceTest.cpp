@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/PersistentInfo.hpp"
+#include "ras/DebugCounter.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Checks that use/def info survives an optimization that creates and removes
+ * nodes, as long as it reports them to the optimizer. The given optimization
+ * builds use/def info and runs again after dead trees elimination. Use/def
+ * info builds are counted with a static debug counter.
+ */
+class UseDefMaintenanceTestBase : public TRTest::JitOptTest
+   {
+   public:
+
+   UseDefMaintenanceTestBase(OMR::Optimizations useDefConsumer) :
+      TRTest::JitOptTest("-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+                         "paranoidoptcheck,staticDebugCounters={optimizer.useDefInfoBuilt*}")
+      {
+      addOptimization(useDefConsumer);
+      addOptimization(OMR::deadTreesElimination);
+      addOptimization(useDefConsumer);
+      }
+
+   static int64_t useDefInfoBuilds(const char *optName)
+      {
+      char counterName[128];
+      snprintf(counterName, sizeof(counterName), "optimizer.useDefInfoBuilt/%s", optName);
+
+      const char *names[64];
+      int64_t counts[64];
+      TR::DebugCounterGroup *counters = TR::Compiler->persistentMemory()->getPersistentInfo()->getStaticCounters();
+      uint32_t numCounters = counters->snapshot(names, counts, 64);
+      for (uint32_t i = 0; i < numCounters && i < 64; i++)
+         {
+         if (strcmp(names[i], counterName) == 0)
+            return counts[i];
+         }
+      return 0;
+      }
+
+   /*
+    * Dead trees elimination removes the treetop of the iadd and anchors the
+    * commoned imul under a new treetop. It reports both, so the use/def info
+    * built for the first run of the optimization is still valid for the
+    * second one.
+    */
+   void checkDeadTreesKeepsUseDefInfo(const char *optName)
+      {
+      auto inputTrees =
+         "(method return=Int32 args=[Int32]                                         "
+         " (block                                                                   "
+         "  (istore temp=\"x\" (iload parm=0))                                      "
+         "  (treetop (iadd (imul id=\"m\" (iload temp=\"x\") (iconst 3)) (iconst 1)))"
+         "  (ireturn (iadd (@id \"m\") (iconst 2)))))                              ";
+      auto trees = parseString(inputTrees);
+      ASSERT_NOTNULL(trees);
+
+      int64_t buildsBefore = useDefInfoBuilds(optName);
+
+      Tril::DefaultCompiler compiler(trees);
+      ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+      EXPECT_EQ(1, useDefInfoBuilds(optName) - buildsBefore)
+         << "Use/def info was rebuilt after dead trees elimination";
+
+      auto entry_point = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+      EXPECT_EQ(2, entry_point(0));
+      EXPECT_EQ(23, entry_point(7));
+      EXPECT_EQ(-28, entry_point(-10));
+      }
+   };
+
+/*
+ * Dead store elimination asks for use/def info without loads as defs.
+ */
+class UseDefMaintenanceTest : public UseDefMaintenanceTestBase
+   {
+   public:
+
+   UseDefMaintenanceTest() : UseDefMaintenanceTestBase(OMR::globalDeadStoreElimination) {}
+   };
+
+/*
+ * Global value propagation asks for use/def info with loads as defs.
+ */
+class LoadsAsDefsMaintenanceTest : public UseDefMaintenanceTestBase
+   {
+   public:
+
+   LoadsAsDefsMaintenanceTest() : UseDefMaintenanceTestBase(OMR::globalValuePropagation) {}
+   };
+
+TEST_F(UseDefMaintenanceTest, DeadTreesKeepsUseDefInfo)
+   {
+   checkDeadTreesKeepsUseDefInfo("globalDeadStoreElimination");
+   }
+
+TEST_F(LoadsAsDefsMaintenanceTest, DeadTreesKeepsUseDefInfo)
+   {
+   checkDeadTreesKeepsUseDefInfo("globalValuePropagation");
+   }
@@ -672,6 +672,41 @@ TEST_F(VectorTest, VInt8BitSelect) {
     }
 }
 
+TEST_F(VectorTest, VDoubleSqrtOfSum) {
+
+   auto inputTrees = "(method return= NoType args=[Address,Address,Address]           "
+                     "  (block                                                        "
+                     "     (vstoreiVector128Double offset=0                           "
+                     "         (aload parm=0)                                         "
+                     "            (vsqrtVector128Double                               "
+                     "                 (vaddVector128Double                           "
+                     "                      (vloadiVector128Double (aload parm=1))    "
+                     "                      (vloadiVector128Double (aload parm=2))))) "
+                     "     (return)))                                                 ";
+
+    auto trees = parseString(inputTrees);
+
+    ASSERT_NOTNULL(trees);
+    SKIP_ON_RISCV(MissingImplementation);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+
+    auto entry_point = compiler.getEntryPoint<void (*)(double[],double[],double[])>();
+    // This test currently assumes 128bit SIMD
+
+    double output[] =  {0, 0};
+    double inputA[] =  {7, 0.25};
+    double inputB[] =  {9, 6};
+
+    entry_point(output,inputA,inputB);
+
+    for (int i = 0; i < (sizeof(output) / sizeof(*output)); i++) {
+        EXPECT_DOUBLE_EQ(std::sqrt(inputA[i] + inputB[i]), output[i]);
+    }
+}
+
 /* 128/256/512-Bit Float tests*/
 #if !defined(J9ZOS390) && !defined(AIXPPC)
 /* XLC won't accept FNAN/DNAN or 0.0 / 0.0 */
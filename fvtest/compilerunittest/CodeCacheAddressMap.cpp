@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <vector>
+#include "runtime/CodeCacheTypes.hpp"
+
+namespace {
+
+const uintptr_t RepositoryBase = 0x10000000;
+const uintptr_t GranuleSize = (uintptr_t)1 << OMR::CodeCacheAddressMap::GranuleShift;
+
+class CodeCacheAddressMapTest : public ::testing::Test {
+protected:
+    void initialize(uintptr_t size)
+    {
+        _memory.resize(OMR::CodeCacheAddressMap::sizeInBytes(RepositoryBase, RepositoryBase + size));
+        _map.initialize(RepositoryBase, RepositoryBase + size, &_memory[0]);
+    }
+
+    std::vector<uint8_t> _memory;
+    OMR::CodeCacheAddressMap _map;
+};
+
+} // namespace
+
+TEST_F(CodeCacheAddressMapTest, FindsRangesSharingAGranule)
+{
+    initialize(16 * GranuleSize);
+
+    // Two caches that meet in the middle of a granule, as repository carving produces
+    int a = 0, b = 0;
+    uintptr_t split = RepositoryBase + 3 * GranuleSize + GranuleSize / 2;
+    _map.insert(RepositoryBase + 64, split, &a);
+    _map.insert(split, RepositoryBase + 9 * GranuleSize, &b);
+
+    EXPECT_TRUE(_map.isExhaustive());
+    EXPECT_EQ(NULL, _map.lookup(RepositoryBase));
+    EXPECT_EQ(&a, _map.lookup(RepositoryBase + 64));
+    EXPECT_EQ(&a, _map.lookup(split - 1));
+    EXPECT_EQ(&b, _map.lookup(split));
+    EXPECT_EQ(&b, _map.lookup(RepositoryBase + 9 * GranuleSize - 1));
+    EXPECT_EQ(NULL, _map.lookup(RepositoryBase + 9 * GranuleSize));
+    EXPECT_EQ(NULL, _map.lookup(RepositoryBase - 1));
+    EXPECT_EQ(NULL, _map.lookup(RepositoryBase + 16 * GranuleSize));
+}
+
+TEST_F(CodeCacheAddressMapTest, CountsRangesItCannotMap)
+{
+    initialize(4 * GranuleSize);
+
+    int a = 0, b = 0, c = 0, d = 0;
+    uintptr_t granule = RepositoryBase + GranuleSize;
+    _map.insert(granule, granule + 16, &a);
+    _map.insert(granule + 16, granule + 32, &b);
+    EXPECT_TRUE(_map.isExhaustive());
+
+    // A third range in the same granule does not fit
+    _map.insert(granule + 32, granule + 48, &c);
+    EXPECT_FALSE(_map.isExhaustive());
+    EXPECT_EQ(&a, _map.lookup(granule + 8));
+    EXPECT_EQ(&b, _map.lookup(granule + 24));
+    EXPECT_EQ(NULL, _map.lookup(granule + 40));
+
+    // Neither does one outside the mapped span
+    OMR::CodeCacheAddressMap unmapped;
+    EXPECT_TRUE(unmapped.isExhaustive());
+    unmapped.insert(RepositoryBase, RepositoryBase + 16, &d);
+    EXPECT_FALSE(unmapped.isExhaustive());
+    EXPECT_EQ(NULL, unmapped.lookup(RepositoryBase));
+}
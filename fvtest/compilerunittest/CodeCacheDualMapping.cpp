@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+#if defined(LINUX) && (defined(TR_HOST_X86) && defined(TR_HOST_64BIT))
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "CompilerUnitTest.hpp"
+#include "runtime/CodeCacheManager.hpp"
+#include "runtime/CodeCacheMemorySegment.hpp"
+
+namespace {
+
+class CodeCacheDualMappingTest : public TRTest::CompilerUnitTest {
+public:
+    CodeCacheDualMappingTest()
+        : _manager(TR::CodeCacheManager::instance())
+    {}
+
+protected:
+    static const char *mappingPermissions(uint8_t *address)
+    {
+        static char permissions[5];
+        strcpy(permissions, "none");
+
+        FILE *maps = fopen("/proc/self/maps", "r");
+        if (maps == NULL)
+            return permissions;
+
+        char line[512];
+        while (fgets(line, sizeof(line), maps) != NULL) {
+            unsigned long start = 0, end = 0;
+            char mode[5] = "";
+            if (sscanf(line, "%lx-%lx %4s", &start, &end, mode) == 3 && start <= (uintptr_t)address
+                && (uintptr_t)address < end) {
+                strcpy(permissions, mode);
+                break;
+            }
+        }
+        fclose(maps);
+        return permissions;
+    }
+
+    TR::CodeCacheManager *_manager;
+};
+
+TEST_F(CodeCacheDualMappingTest, ViewsAliasTheSameMemory)
+{
+    size_t allocatedSize = 0;
+    intptr_t writableViewOffset = 0;
+    TR::CodeCacheMemorySegment *segment
+        = _manager->allocateDualMappedCodeCacheSegment(4096 + 1, allocatedSize, writableViewOffset);
+
+    // Kernels without memfd_create cannot dual map, and the repository falls back to a single mapping
+    if (segment == NULL)
+        return;
+
+    EXPECT_EQ(2 * 4096u, allocatedSize);
+    EXPECT_EQ(segment->segmentBase() + allocatedSize, segment->segmentTop());
+    ASSERT_NE(0, writableViewOffset);
+
+    // mov eax, 42; ret
+    static const uint8_t code[] = { 0xb8, 0x2a, 0x00, 0x00, 0x00, 0xc3 };
+    uint8_t *writableView = segment->segmentBase() + writableViewOffset;
+    memcpy(writableView + 4096, code, sizeof(code));
+    EXPECT_EQ(0, memcmp(segment->segmentBase() + 4096, code, sizeof(code)));
+
+    int32_t (*function)() = reinterpret_cast<int32_t (*)()>(segment->segmentBase() + 4096);
+    EXPECT_EQ(42, function());
+
+    // Neither view may be both writable and executable
+    EXPECT_STREQ("r-xs", mappingPermissions(segment->segmentBase()));
+    EXPECT_STREQ("rw-s", mappingPermissions(writableView));
+
+    _manager->freeDualMappedCodeCacheSegment(segment, writableViewOffset);
+}
+
+TEST_F(CodeCacheDualMappingTest, SingleMappedRepositoryTranslatesToItself)
+{
+    uint8_t *address = reinterpret_cast<uint8_t *>(_manager->getFirstCodeCache());
+    EXPECT_FALSE(_manager->isDualMapped());
+    EXPECT_EQ(address, _manager->writableAddress(address));
+    EXPECT_EQ(address, _manager->executableAddress(address));
+}
+
+} // namespace
+
+#endif // LINUX && TR_HOST_X86 && TR_HOST_64BIT
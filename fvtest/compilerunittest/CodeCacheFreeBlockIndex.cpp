@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "CompilerUnitTest.hpp"
+#include "Random.hpp"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheManager.hpp"
+#include "runtime/CodeCacheTypes.hpp"
+
+namespace {
+
+// Method sizes are skewed towards small bodies with the occasional large one
+//
+size_t randomBlockSize(TRTest::Random &random)
+{
+    size_t size = 96 + random.next() % 2048;
+    if (random.next() % 16 == 0)
+        size += random.next() % (64 * 1024);
+    return size;
+}
+
+// Reference best fit over all blocks, as the old code cache free list walk did
+//
+OMR::CodeCacheFreeCacheBlock *linearBestFit(std::vector<OMR::CodeCacheFreeCacheBlock *> &freeBlocks, size_t size)
+{
+    OMR::CodeCacheFreeCacheBlock *bestFit = NULL;
+    for (size_t i = 0; i < freeBlocks.size(); i++) {
+        OMR::CodeCacheFreeCacheBlock *block = freeBlocks[i];
+        if (block->_size >= size && (!bestFit || block->_size < bestFit->_size))
+            bestFit = block;
+    }
+    return bestFit;
+}
+
+void removeFrom(std::vector<OMR::CodeCacheFreeCacheBlock *> &freeBlocks, OMR::CodeCacheFreeCacheBlock *block)
+{
+    for (size_t i = 0; i < freeBlocks.size(); i++) {
+        if (freeBlocks[i] == block) {
+            freeBlocks[i] = freeBlocks.back();
+            freeBlocks.pop_back();
+            return;
+        }
+    }
+}
+
+} // namespace
+
+TEST(CodeCacheFreeBlockIndexTest, BinsAreOrderedAndNarrow)
+{
+    uint32_t previousBin = 0;
+    size_t binStart = 16;
+    for (size_t size = 16; size < 1024 * 1024; size++) {
+        uint32_t bin = OMR::CodeCacheFreeBlockIndex::binFor(size);
+        ASSERT_GE(bin, previousBin) << "size " << size;
+        if (bin != previousBin) {
+            previousBin = bin;
+            binStart = size;
+        }
+
+        // Every size in a bin is within 1/NumSubBins of the bin's smallest size
+        ASSERT_LE(size - binStart, binStart / OMR::CodeCacheFreeBlockIndex::NumSubBins) << "size " << size;
+    }
+}
+
+TEST(CodeCacheFreeBlockIndexTest, FindFitAgreesWithLinearBestFit)
+{
+    const size_t numBlocks = 2000;
+    std::vector<OMR::CodeCacheFreeCacheBlock> storage(numBlocks);
+    std::vector<OMR::CodeCacheFreeCacheBlock *> freeBlocks;
+    std::vector<OMR::CodeCacheFreeCacheBlock *> usedBlocks;
+    TRTest::Random random(42);
+
+    OMR::CodeCacheFreeBlockIndex index;
+    index.init();
+    ASSERT_TRUE(index.isEmpty());
+    ASSERT_EQ(0, index.findFit(1));
+
+    for (size_t i = 0; i < numBlocks; i++) {
+        storage[i]._size = randomBlockSize(random);
+        usedBlocks.push_back(&storage[i]);
+    }
+
+    for (int32_t op = 0; op < 20000; op++) {
+        if (!usedBlocks.empty() && (freeBlocks.empty() || random.next() % 2)) {
+            size_t i = random.next() % usedBlocks.size();
+            OMR::CodeCacheFreeCacheBlock *block = usedBlocks[i];
+            usedBlocks[i] = usedBlocks.back();
+            usedBlocks.pop_back();
+            index.insert(block);
+            freeBlocks.push_back(block);
+        } else {
+            size_t size = randomBlockSize(random);
+            OMR::CodeCacheFreeCacheBlock *expected = linearBestFit(freeBlocks, size);
+            OMR::CodeCacheFreeCacheBlock *actual = index.findFit(size);
+            if (!expected) {
+                ASSERT_EQ(0, actual) << "size " << size;
+                continue;
+            }
+
+            // The index may return a block other than the best fit, but only
+            // one from the same bin
+            ASSERT_TRUE(actual != NULL) << "size " << size;
+            ASSERT_GE(actual->_size, size);
+            ASSERT_EQ(OMR::CodeCacheFreeBlockIndex::binFor(expected->_size),
+                OMR::CodeCacheFreeBlockIndex::binFor(actual->_size));
+
+            index.remove(actual);
+            removeFrom(freeBlocks, actual);
+            usedBlocks.push_back(actual);
+        }
+
+        size_t largest = 0;
+        for (size_t i = 0; i < freeBlocks.size(); i++)
+            largest = std::max(largest, freeBlocks[i]->_size);
+        ASSERT_EQ(largest, index.largestBlockSize());
+        ASSERT_EQ(freeBlocks.empty(), index.isEmpty());
+    }
+}
+
+// Runs method unload/reload churn against a fragmented free list, once
+// allocating through the size-binned index and once with the linear best fit
+// walk it replaced. The two policies may pick different blocks, so they are
+// checked separately: every block handed out is big enough, and a request only
+// fails when no free block is.
+//
+TEST(CodeCacheFreeBlockIndexTest, ChurnOnlyFailsWhenNothingFits)
+{
+    const size_t numBlocks = 4000;
+    const int32_t numOps = 40000;
+    std::vector<OMR::CodeCacheFreeCacheBlock> storage(numBlocks);
+
+    for (int32_t useIndex = 0; useIndex < 2; useIndex++) {
+        TRTest::Random random(7);
+        std::vector<OMR::CodeCacheFreeCacheBlock *> freeBlocks;
+        std::vector<OMR::CodeCacheFreeCacheBlock *> usedBlocks;
+        OMR::CodeCacheFreeBlockIndex index;
+        index.init();
+
+        for (size_t i = 0; i < numBlocks; i++) {
+            storage[i]._size = randomBlockSize(random);
+            freeBlocks.push_back(&storage[i]);
+            index.insert(&storage[i]);
+        }
+
+        for (int32_t op = 0; op < numOps; op++) {
+            if (!usedBlocks.empty() && random.next() % 2) {
+                size_t i = random.next() % usedBlocks.size();
+                OMR::CodeCacheFreeCacheBlock *block = usedBlocks[i];
+                usedBlocks[i] = usedBlocks.back();
+                usedBlocks.pop_back();
+                index.insert(block);
+                freeBlocks.push_back(block);
+            } else {
+                size_t size = randomBlockSize(random);
+                size_t largest = 0;
+                for (size_t i = 0; i < freeBlocks.size(); i++)
+                    largest = std::max(largest, freeBlocks[i]->_size);
+
+                OMR::CodeCacheFreeCacheBlock *block
+                    = useIndex ? index.findFit(size) : linearBestFit(freeBlocks, size);
+                if (block == NULL) {
+                    ASSERT_LT(largest, size) << "policy " << useIndex << " op " << op;
+                    continue;
+                }
+
+                ASSERT_GE(block->_size, size) << "policy " << useIndex << " op " << op;
+                index.remove(block);
+                removeFrom(freeBlocks, block);
+                usedBlocks.push_back(block);
+            }
+        }
+    }
+}
+
+class CodeCacheFreeBlocksTest : public TRTest::CompilerUnitTest {};
+
+// Freeing two neighbouring bodies leaves one free block spanning both, which
+// can satisfy a request neither could on its own.
+//
+TEST_F(CodeCacheFreeBlocksTest, AdjacentFreeBlocksCoalesce)
+{
+    TR::CodeCache *codeCache = TR::CodeCacheManager::instance()->getFirstCodeCache();
+    ASSERT_TRUE(codeCache != NULL);
+
+    const size_t bodySize = 4096;
+    uint8_t *coldCode = NULL;
+    uint8_t *first = codeCache->allocateCodeMemory(bodySize, 0, &coldCode, true, false);
+    uint8_t *second = codeCache->allocateCodeMemory(bodySize, 0, &coldCode, true, false);
+    uint8_t *guard = codeCache->allocateCodeMemory(bodySize, 0, &coldCode, true, false);
+    ASSERT_TRUE(first != NULL && second != NULL && guard != NULL);
+    ASSERT_LT(first, second);
+    ASSERT_LT(second, guard);
+
+    ASSERT_TRUE(codeCache->addFreeBlock2(first, second));
+    ASSERT_TRUE(codeCache->addFreeBlock2(second, guard));
+
+    // Blocks freed earlier may have been merged in too, so look for the one covering both bodies
+    OMR::CodeCacheFreeCacheBlock *merged = NULL;
+    for (OMR::CodeCacheFreeCacheBlock *block = codeCache->freeBlockList(); block; block = block->_next) {
+        uint8_t *blockStart = (uint8_t *)block;
+        if (blockStart <= first && blockStart + block->_size >= guard)
+            merged = block;
+        else
+            EXPECT_FALSE(blockStart + block->_size > first && blockStart < guard) << "range split across blocks";
+    }
+    ASSERT_TRUE(merged != NULL);
+
+    // Both bodies' worth of space comes back from the free list rather than the code cache heap
+    uint8_t *reused = codeCache->allocateCodeMemory(guard - first, 0, &coldCode, false, false);
+    ASSERT_TRUE(reused != NULL);
+    EXPECT_LT(reused, guard);
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if defined(LINUX)
+
+#include <stdint.h>
+#include <string.h>
+#include "CompilerUnitTest.hpp"
+#include "runtime/CodeCacheConfig.hpp"
+#include "runtime/CodeCacheManager.hpp"
+#include "runtime/CodeCacheMemorySegment.hpp"
+
+namespace {
+
+const size_t HugePageSize = 2 * 1024 * 1024;
+
+class CodeCacheHugePagesTest : public TRTest::CompilerUnitTest {
+public:
+    CodeCacheHugePagesTest()
+        : _manager(TR::CodeCacheManager::instance())
+        , _savedLargeCodePageSize(_manager->codeCacheConfig().largeCodePageSize())
+    {}
+
+    ~CodeCacheHugePagesTest() { _manager->codeCacheConfig()._largeCodePageSize = _savedLargeCodePageSize; }
+
+protected:
+    TR::CodeCacheManager *_manager;
+    size_t _savedLargeCodePageSize;
+};
+
+TEST_F(CodeCacheHugePagesTest, NotConfigured)
+{
+    _manager->codeCacheConfig()._largeCodePageSize = 0;
+
+    size_t allocatedSize = 0;
+    TR::CodeCacheManager::HugePageBacking backing = TR::CodeCacheManager::TransparentHugePages;
+    EXPECT_TRUE(_manager->allocateHugePageCodeCacheSegment(HugePageSize, allocatedSize, backing) == NULL);
+    EXPECT_EQ(TR::CodeCacheManager::NoHugePages, backing);
+}
+
+TEST_F(CodeCacheHugePagesTest, SegmentIsAlignedAndRounded)
+{
+    _manager->codeCacheConfig()._largeCodePageSize = HugePageSize;
+
+    size_t allocatedSize = 0;
+    TR::CodeCacheManager::HugePageBacking backing = TR::CodeCacheManager::NoHugePages;
+    TR::CodeCacheMemorySegment *segment
+        = _manager->allocateHugePageCodeCacheSegment(HugePageSize + 4096, allocatedSize, backing);
+
+    // Kernels built without huge page support have neither hugetlbfs pages nor MADV_HUGEPAGE
+    if (segment == NULL) {
+        EXPECT_EQ(TR::CodeCacheManager::NoHugePages, backing);
+        return;
+    }
+
+    EXPECT_NE(TR::CodeCacheManager::NoHugePages, backing);
+    EXPECT_EQ(2 * HugePageSize, allocatedSize);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(segment->segmentBase()) % HugePageSize);
+    EXPECT_EQ(segment->segmentBase() + allocatedSize,
+        segment->segmentTop() + sizeof(TR::CodeCacheMemorySegment));
+    EXPECT_EQ(reinterpret_cast<uint8_t *>(segment), segment->segmentTop());
+
+    memset(segment->segmentBase(), 0xcc, segment->segmentTop() - segment->segmentBase());
+    _manager->freeCodeCacheSegment(segment);
+}
+
+TEST_F(CodeCacheHugePagesTest, RepositoryWithoutHugePagesReportsNoCoverage)
+{
+    EXPECT_EQ(TR::CodeCacheManager::NoHugePages, _manager->repositoryHugePageBacking());
+    EXPECT_EQ(0u, _manager->repositoryHugePageBytes());
+    EXPECT_STREQ("none", TR::CodeCacheManager::hugePageBackingString(TR::CodeCacheManager::NoHugePages));
+}
+
+} // namespace
+
+#endif // LINUX
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <stdint.h>
+#include <vector>
+#include "CompilerUnitTest.hpp"
+#include "runtime/CodeCache.hpp"
+#include "runtime/CodeCacheLayout.hpp"
+#include "runtime/CodeCacheManager.hpp"
+
+namespace {
+
+TR_OpaqueMethodBlock *const A = reinterpret_cast<TR_OpaqueMethodBlock *>(0x1000);
+TR_OpaqueMethodBlock *const B = reinterpret_cast<TR_OpaqueMethodBlock *>(0x2000);
+TR_OpaqueMethodBlock *const C = reinterpret_cast<TR_OpaqueMethodBlock *>(0x3000);
+TR_OpaqueMethodBlock *const D = reinterpret_cast<TR_OpaqueMethodBlock *>(0x4000);
+
+class CodeCacheLayoutTest : public TRTest::CompilerUnitTest {
+public:
+    CodeCacheLayoutTest()
+        : _layout(TR::CodeCacheLayout::create(TR::RawAllocator(), 4096))
+    {}
+
+    ~CodeCacheLayoutTest() { _layout->destroy(); }
+
+    // Gives method a body of size bytes at a distinct fake address
+    void code(TR_OpaqueMethodBlock *method, size_t size)
+    {
+        _layout->recordCode(method, _codeBuffer + reinterpret_cast<uintptr_t>(method), size);
+    }
+
+protected:
+    TR::CodeCacheLayout *_layout;
+    uint8_t _codeBuffer[0x10000];
+};
+
+std::vector<TR_OpaqueMethodBlock *> methods(TR_OpaqueMethodBlock *m0, TR_OpaqueMethodBlock *m1 = NULL,
+    TR_OpaqueMethodBlock *m2 = NULL, TR_OpaqueMethodBlock *m3 = NULL)
+{
+    TR_OpaqueMethodBlock *all[] = { m0, m1, m2, m3 };
+    std::vector<TR_OpaqueMethodBlock *> result;
+    for (int i = 0; i < 4 && all[i]; i++)
+        result.push_back(all[i]);
+    return result;
+}
+
+TEST_F(CodeCacheLayoutTest, CalleesFollowTheirHeaviestCaller)
+{
+    code(A, 100);
+    code(B, 100);
+    code(C, 100);
+    code(D, 100);
+    _layout->recordInvocations(A, 1000);
+    _layout->recordInvocations(D, 500);
+    _layout->recordCall(A, NULL, C, 800);
+    _layout->recordCall(D, NULL, C, 100);
+    _layout->recordCall(C, NULL, B, 600);
+
+    _layout->computeLayout(1);
+
+    // A, C and B form one cluster of weight 2500, denser than D alone
+    EXPECT_EQ(methods(A, C, B, D), _layout->hotMethods());
+}
+
+TEST_F(CodeCacheLayoutTest, ClustersRespectTheSizeLimit)
+{
+    code(A, 3000);
+    code(B, 2500);
+    code(C, 1000);
+    _layout->recordInvocations(A, 1000);
+    _layout->recordCall(A, NULL, B, 900);
+    _layout->recordCall(A, NULL, C, 800);
+
+    _layout->computeLayout(1);
+
+    // B does not fit with A, so C is placed after A instead; B stays on its own
+    EXPECT_EQ(methods(A, C, B), _layout->hotMethods());
+}
+
+TEST_F(CodeCacheLayoutTest, DenserClustersComeFirst)
+{
+    code(A, 4000);
+    code(B, 100);
+    _layout->recordInvocations(A, 1000);
+    _layout->recordInvocations(B, 500);
+
+    _layout->computeLayout(1);
+
+    EXPECT_EQ(methods(B, A), _layout->hotMethods());
+}
+
+TEST_F(CodeCacheLayoutTest, ColdMethodsAreNotPlaced)
+{
+    _layout->recordInvocations(A, 1000);
+    _layout->recordInvocations(B, 10);
+    _layout->recordCall(A, NULL, B, 5);
+
+    _layout->computeLayout(100);
+
+    EXPECT_TRUE(_layout->isHot(A));
+    EXPECT_FALSE(_layout->isHot(B));
+    EXPECT_FALSE(_layout->isHot(C));
+    EXPECT_EQ(methods(A), _layout->hotMethods());
+
+    _layout->recordInvocations(B, 200);
+    _layout->computeLayout(100);
+
+    EXPECT_TRUE(_layout->isHot(B));
+}
+
+TEST_F(CodeCacheLayoutTest, CallSitesInReplacedOrFreedCodeAreForgotten)
+{
+    code(A, 100);
+    code(C, 100);
+    uint8_t *callInA = _codeBuffer + reinterpret_cast<uintptr_t>(A) + 10;
+    uint8_t *callInC = _codeBuffer + reinterpret_cast<uintptr_t>(C) + 20;
+    _layout->recordCall(A, callInA, B, 1);
+    _layout->recordCall(C, callInC, B, 1);
+
+    std::vector<void *> expected;
+    expected.push_back(callInA);
+    expected.push_back(callInC);
+    EXPECT_EQ(expected, _layout->callSitesTo(B));
+
+    // A is recompiled elsewhere, and the body of C is freed
+    _layout->recordCode(A, _codeBuffer, 100);
+    _layout->codeFreed(callInC - 20, callInC + 80);
+
+    EXPECT_TRUE(_layout->callSitesTo(B).empty());
+}
+
+TEST_F(CodeCacheLayoutTest, HotCodeCacheIsSeparateAndContiguous)
+{
+    TR::CodeCacheManager *manager = TR::CodeCacheManager::instance();
+    int32_t numReserved = 0;
+    TR::CodeCache *hotCache = manager->reserveCodeCache(false, 0, 0, &numReserved, TR::CodeCacheKind::HOT_CODE_CC);
+    ASSERT_TRUE(hotCache != NULL);
+    EXPECT_EQ(TR::CodeCacheKind::HOT_CODE_CC, hotCache->_kind);
+    EXPECT_STREQ("HOT_CODE_CC", hotCache->getCodeCacheKindString());
+
+    uint8_t *coldCode = NULL;
+    uint8_t *first = hotCache->allocateCodeMemory(64, 0, &coldCode, false, false);
+    uint8_t *second = hotCache->allocateCodeMemory(64, 0, &coldCode, false, false);
+    manager->unreserveCodeCache(hotCache);
+
+    ASSERT_TRUE(first != NULL);
+    EXPECT_EQ(first + 64, second);
+
+    TR::CodeCache *defaultCache
+        = manager->reserveCodeCache(false, 0, 0, &numReserved, TR::CodeCacheKind::DEFAULT_CC);
+    ASSERT_TRUE(defaultCache != NULL);
+    EXPECT_NE(hotCache, defaultCache);
+    EXPECT_EQ(TR::CodeCacheKind::DEFAULT_CC, defaultCache->_kind);
+    manager->unreserveCodeCache(defaultCache);
+}
+
+} // namespace
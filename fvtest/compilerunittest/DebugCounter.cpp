@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "CompilerUnitTest.hpp"
+#include "control/Options.hpp"
+#include "il/Node_inlines.hpp"
+#include "ras/DebugCounter.hpp"
+
+namespace {
+
+class DebugCounterTest : public TRTest::CompilerUnitTest {
+public:
+    DebugCounterTest()
+        : _group(new (TR::FrontEnd::instance()->persistentMemory())
+                  TR::DebugCounterGroup(TR::FrontEnd::instance()->persistentMemory()))
+    {}
+
+    // Simulates compiled code bumping the slot it was given
+    //
+    void bump(intptr_t address, uint64_t delta) { *(uint64_t *)address += delta; }
+
+    std::string csv()
+    {
+        size_t length = _group->formatCSV(NULL, 0);
+        std::string text(length + 1, '\0');
+        EXPECT_EQ(length, _group->formatCSV(&text[0], text.size()));
+        text.resize(length);
+        return text;
+    }
+
+protected:
+    TR::DebugCounterGroup *_group;
+};
+
+TEST_F(DebugCounterTest, ShardedSlotsAreCacheLineIsolated)
+{
+    _options.setDebugCounterShards(4);
+
+    TR::DebugCounter *first = _group->getCounter(&_comp, "first");
+    TR::DebugCounter *second = _group->getCounter(&_comp, "second");
+    TR::DebugCounterAggregation *aggregation = _group->createAggregation(&_comp, "aggregation");
+
+    intptr_t addresses[] = { first->getBumpCountAddress(&_comp), second->getBumpCountAddress(&_comp),
+        aggregation->getBumpCountAddress(&_comp) };
+
+    EXPECT_NE(first->getBumpCountAddress(), addresses[0]);
+    EXPECT_NE(second->getBumpCountAddress(), addresses[1]);
+
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(0, addresses[i] % TR::DebugCounterGroup::SLOT_SIZE);
+        for (int j = i + 1; j < 3; j++) {
+            intptr_t distance = addresses[i] > addresses[j] ? addresses[i] - addresses[j] : addresses[j] - addresses[i];
+            EXPECT_GE(distance, TR::DebugCounterGroup::SLOT_SIZE);
+        }
+    }
+}
+
+TEST_F(DebugCounterTest, AccumulateFoldsShardsAndAggregations)
+{
+    _options.setDebugCounterShards(8);
+
+    TR::DebugCounter *counter = _group->getCounter(&_comp, "counter");
+    TR::DebugCounter *aggregated = _group->getCounter(&_comp, "aggregated");
+    TR::DebugCounterAggregation *aggregation = _group->createAggregation(&_comp, "site");
+    aggregation->aggregate(aggregated, 3);
+
+    bump(counter->getBumpCountAddress(&_comp), 5);
+    bump(counter->getBumpCountAddress(), 2);
+    bump(aggregation->getBumpCountAddress(&_comp), 2);
+    _group->accumulate();
+
+    EXPECT_EQ(7, counter->getCount());
+    EXPECT_EQ(6, aggregated->getCount());
+
+    _group->resetAll();
+    _group->accumulate();
+    EXPECT_EQ(0, counter->getCount());
+    EXPECT_EQ(0, aggregated->getCount());
+
+    bump(counter->getBumpCountAddress(&_comp), 1);
+    bump(aggregation->getBumpCountAddress(&_comp), 1);
+    _group->accumulate();
+    EXPECT_EQ(1, counter->getCount());
+    EXPECT_EQ(3, aggregated->getCount());
+}
+
+TEST_F(DebugCounterTest, ConcurrentIncrementsUseOneShardPerThread)
+{
+    const int32_t numShards = 16;
+    const int numThreads = 8;
+    const int incrementsPerThread = 100000;
+    _options.setDebugCounterShards(numShards);
+
+    TR::DebugCounter *counter = _group->getCounter(&_comp, "concurrent");
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; i++) {
+        threads.push_back(std::thread([counter]() {
+            for (int j = 0; j < incrementsPerThread; j++)
+                counter->increment(1);
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); i++)
+        threads[i].join();
+
+    _group->accumulate();
+    EXPECT_EQ(numThreads * incrementsPerThread, counter->getCount());
+
+    // Every thread keeps to one shard, so the increments are in whole
+    // multiples of a thread's share, spread over more than one shard
+    int32_t shardsUsed = 0;
+    uint8_t *shards = (uint8_t *)counter->getBumpCountAddress(&_comp);
+    for (int32_t i = 0; i < numShards; i++) {
+        uint64_t count = *(uint64_t *)(shards + i * TR::DebugCounterGroup::SLOT_SIZE);
+        EXPECT_EQ(0, count % incrementsPerThread);
+        if (count != 0)
+            shardsUsed++;
+    }
+    EXPECT_GT(shardsUsed, 1);
+}
+
+TEST_F(DebugCounterTest, ShardIndexSeparatesStacks)
+{
+    // Addresses within one stack region share a shard, as a hot loop would
+    EXPECT_EQ(TR::DebugCounterBase::shardIndex(0x7f0000010000, 16),
+        TR::DebugCounterBase::shardIndex(0x7f0000010ff8, 16));
+
+    // Stacks of different threads are spread over the shards
+    bool seen[16] = {};
+    for (uintptr_t stack = 0; stack < 64; stack++) {
+        int32_t shard = TR::DebugCounterBase::shardIndex(0x7f0000000000 + stack * 0x801000, 16);
+        ASSERT_GE(shard, 0);
+        ASSERT_LT(shard, 16);
+        seen[shard] = true;
+    }
+    for (int32_t i = 0; i < 16; i++)
+        EXPECT_TRUE(seen[i]) << "shard " << i;
+
+    EXPECT_EQ(0, TR::DebugCounterBase::shardIndex(0x7f0000010000, 1));
+}
+
+TEST_F(DebugCounterTest, ShardedBumpPicksShardFromFrameAddress)
+{
+    _options.setDebugCounterShards(16);
+    TR::DebugCounter *counter = _group->getCounter(&_comp, "frame");
+
+    bool is64Bit = _comp.target().is64Bit();
+    TR::Node *delta = is64Bit ? TR::Node::lconst(1) : TR::Node::iconst(1);
+    TR::Node *bump = counter->createBumpCounterNode(&_comp, delta);
+    ASSERT_EQ(is64Bit ? TR::lstorei : TR::istorei, bump->getOpCodeValue());
+
+    TR::Node *address = bump->getFirstChild();
+    ASSERT_EQ(is64Bit ? TR::aladd : TR::aiadd, address->getOpCodeValue());
+    EXPECT_EQ(counter->getBumpCountAddress(&_comp), (intptr_t)address->getFirstChild()->getAddress());
+    EXPECT_EQ(address, bump->getSecondChild()->getFirstChild()->getFirstChild());
+
+    TR::Node *frame = address->getSecondChild();
+    while (frame->getNumChildren() > 0)
+        frame = frame->getFirstChild();
+    EXPECT_EQ(TR::loadaddr, frame->getOpCodeValue());
+    EXPECT_EQ(_comp.getDebugCounterFrameTemp(), frame->getSymbolReference());
+}
+
+TEST_F(DebugCounterTest, SnapshotAndCSVAreSortedByName)
+{
+    TR::DebugCounter *zebra = _group->getCounter(&_comp, "zebra");
+    TR::DebugCounter *apple = _group->getCounter(&_comp, "apple");
+    _group->getCounter(&_comp, "with,comma \"quoted\"");
+
+    bump(zebra->getBumpCountAddress(&_comp), 4);
+    bump(apple->getBumpCountAddress(&_comp), 9);
+
+    const char *names[2];
+    int64_t counts[2];
+    ASSERT_EQ(3, _group->snapshot(names, counts, 2));
+    EXPECT_STREQ("apple", names[0]);
+    EXPECT_EQ(9, counts[0]);
+    EXPECT_STREQ("with,comma \"quoted\"", names[1]);
+    EXPECT_EQ(0, counts[1]);
+
+    EXPECT_EQ("name,count\napple,9\n\"with,comma \"\"quoted\"\"\",0\nzebra,4\n", csv());
+
+    char truncated[8];
+    EXPECT_EQ(csv().size(), _group->formatCSV(truncated, sizeof(truncated)));
+    EXPECT_STREQ("name,co", truncated);
+}
+
+TEST_F(DebugCounterTest, CAPIReportsDynamicCounters)
+{
+    TR::DebugCounter *counter
+        = _comp.getPersistentInfo()->getDynamicCounters()->getCounter(&_comp, "compunittest.capi");
+    bump(counter->getBumpCountAddress(&_comp), 11);
+
+    const char *names[64];
+    int64_t counts[64];
+    uint32_t numCounters = snapshotJitDebugCounters(names, counts, 64);
+    ASSERT_GE(numCounters, 1);
+
+    bool found = false;
+    for (uint32_t i = 0; i < numCounters && i < 64; i++) {
+        if (strcmp(names[i], "compunittest.capi") == 0) {
+            EXPECT_EQ(11, counts[i]);
+            found = true;
+        }
+    }
+    EXPECT_TRUE(found);
+
+    char buffer[1024];
+    formatJitDebugCounters(buffer, sizeof(buffer));
+    EXPECT_NE((char *)NULL, strstr(buffer, "compunittest.capi,11\n"));
+
+    resetJitDebugCounters();
+    EXPECT_EQ(0, counter->getCount());
+}
+
+} // namespace
@@ -0,0 +1,225 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include "CompilerUnitTest.hpp"
+#include "infra/BitVector.hpp"
+
+class HybridBitVectorTest : public TRTest::CompilerUnitTest {
+protected:
+    // Check the hybrid vector holds exactly the elements of the reference
+    //
+    void expectSame(TR_HybridBitVector &hybrid, TR_BitVector &reference)
+    {
+        ASSERT_EQ(reference.elementCount(), hybrid.elementCount());
+        TR_BitVectorIterator bvi(reference);
+        for (TR_HybridBitVectorCursor cursor(hybrid); cursor.Valid(); cursor.SetToNextOne()) {
+            ASSERT_TRUE(bvi.hasMoreElements());
+            ASSERT_EQ(bvi.getNextElement(), (int32_t)cursor);
+        }
+        ASSERT_FALSE(bvi.hasMoreElements());
+    }
+
+    // A small deterministic generator so failures reproduce
+    //
+    uint32_t next()
+    {
+        _seed = _seed * 1103515245 + 12345;
+        return (_seed >> 8) & 0xffffff;
+    }
+
+    uint32_t _seed;
+};
+
+TEST_F(HybridBitVectorTest, SetAndResetAcrossRepresentations)
+{
+    TR_HybridBitVector bv(region());
+    ASSERT_TRUE(bv.isEmpty());
+
+    // Fill one block far past the sparse limit until it becomes full, then
+    // drain it again
+    //
+    for (int32_t i = 0; i < TR_HybridBitVector::BlockBits; i++) {
+        bv.set(5 * TR_HybridBitVector::BlockBits + i);
+        ASSERT_EQ(i + 1, bv.elementCount());
+    }
+    ASSERT_TRUE(bv.get(5 * TR_HybridBitVector::BlockBits));
+    ASSERT_FALSE(bv.get(6 * TR_HybridBitVector::BlockBits));
+
+    for (int32_t i = TR_HybridBitVector::BlockBits - 1; i >= 0; i--) {
+        bv.reset(5 * TR_HybridBitVector::BlockBits + i);
+        ASSERT_EQ(i, bv.elementCount());
+        ASSERT_FALSE(bv.get(5 * TR_HybridBitVector::BlockBits + i));
+    }
+    ASSERT_TRUE(bv.isEmpty());
+}
+
+TEST_F(HybridBitVectorTest, RangesMatchDenseBitVector)
+{
+    TR_HybridBitVector bv(region());
+    TR_BitVector reference(region());
+
+    bv.setAll(3000);
+    reference.setAll(3000);
+    expectSame(bv, reference);
+
+    bv.resetAll(17, 2100);
+    reference.resetAll(17, 2100);
+    expectSame(bv, reference);
+
+    bv.setAll(1000, 5000);
+    reference.setAll(1000, 5000);
+    expectSame(bv, reference);
+
+    bv.resetAll(5000);
+    reference.resetAll(0, 4999);
+    expectSame(bv, reference);
+}
+
+TEST_F(HybridBitVectorTest, SetOperationsMatchDenseBitVector)
+{
+    _seed = 42;
+    for (int32_t round = 0; round < 50; round++) {
+        TR_HybridBitVector a(region()), b(region());
+        TR_BitVector ra(region()), rb(region());
+
+        // Mix of sparse, dense and full blocks over a large index space
+        //
+        int32_t range = (round % 5 + 1) * 4000;
+        int32_t density = round % 7 + 1;
+        for (int32_t i = 0; i < range / density; i++) {
+            int32_t n = next() % range;
+            a.set(n);
+            ra.set(n);
+            n = next() % range;
+            b.set(n);
+            rb.set(n);
+        }
+        if (round % 3 == 0) {
+            a.setAll(1024, 4095);
+            ra.setAll(1024, 4095);
+        }
+
+        ASSERT_EQ(ra.intersects(rb), a.intersects(b));
+
+        TR_HybridBitVector c(region());
+        TR_BitVector rc(region());
+
+        c = a;
+        rc = ra;
+        ASSERT_TRUE(c == a);
+        c |= b;
+        rc |= rb;
+        expectSame(c, rc);
+
+        c = a;
+        rc = ra;
+        c &= b;
+        rc &= rb;
+        expectSame(c, rc);
+
+        c = a;
+        rc = ra;
+        c -= b;
+        rc -= rb;
+        expectSame(c, rc);
+        ASSERT_FALSE(c.intersects(b));
+
+        // Mixed operations against dense vectors
+        //
+        c = a;
+        rc = ra;
+        c -= rb;
+        rc -= rb;
+        expectSame(c, rc);
+
+        c |= rb;
+        rc |= rb;
+        expectSame(c, rc);
+
+        TR_BitVector dense(region());
+        dense = rb;
+        dense &= a;
+        rb &= ra;
+        ASSERT_TRUE(dense == rb);
+    }
+}
+
+TEST_F(HybridBitVectorTest, EqualityIsRepresentationIndependent)
+{
+    TR_HybridBitVector a(region()), b(region());
+
+    a.setAll(0, 2047);
+    for (int32_t i = 2047; i >= 0; i--)
+        b.set(i);
+    ASSERT_TRUE(a == b);
+
+    a.reset(100);
+    ASSERT_TRUE(a != b);
+    b.reset(100);
+    ASSERT_TRUE(a == b);
+}
+
+TEST_F(HybridBitVectorTest, SparseSetsStaySmall)
+{
+    // A handful of elements scattered over a million indices should cost a
+    // few blocks, not a million bits
+    //
+    TR_HybridBitVector bv(region());
+    for (int32_t i = 0; i < 16; i++)
+        bv.set(i * 65536 + 7);
+    ASSERT_EQ(16, bv.elementCount());
+    ASSERT_LT(bv.memoryUsed(), (size_t)(1000000 / 8 / 10));
+
+    // Storage released by one block is reused by the next
+    //
+    size_t used = bv.memoryUsed();
+    for (int32_t round = 0; round < 100; round++) {
+        bv.empty();
+        for (int32_t i = 0; i < 16; i++)
+            bv.set(i * 65536 + round);
+    }
+    ASSERT_EQ(used, bv.memoryUsed());
+}
+
+TEST_F(HybridBitVectorTest, BitContainerIteratesHybridVectors)
+{
+    TR_HybridBitVector bv(region());
+    bv.set(3);
+    bv.set(70000);
+
+    TR_BitContainer container(&bv);
+    ASSERT_FALSE(container.isSingleValue());
+    ASSERT_TRUE(container.hasMoreThanOneElement());
+    ASSERT_TRUE(container.get(70000));
+
+    TR_BitContainerIterator bci(container);
+    ASSERT_EQ(3, bci.getFirstElement());
+    ASSERT_TRUE(bci.hasMoreElements());
+    ASSERT_EQ(70000, bci.getNextElement());
+    ASSERT_FALSE(bci.hasMoreElements());
+
+    TR_BitVector dense(region());
+    dense = container;
+    ASSERT_EQ(2, dense.elementCount());
+    ASSERT_TRUE(dense.get(3) && dense.get(70000));
+}
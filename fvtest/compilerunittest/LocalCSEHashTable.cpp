@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <map>
+#include "CompilerUnitTest.hpp"
+#include "Random.hpp"
+#include "env/StackMemoryRegion.hpp"
+#include "optimizer/LocalCSE.hpp"
+
+namespace {
+
+typedef OMR::LocalCSE::HashTable HashTable;
+
+// Stand-in nodes; the table only stores and compares the pointers
+//
+TR::Node *fakeNode(uintptr_t i) { return reinterpret_cast<TR::Node *>((i + 1) * sizeof(void *)); }
+
+// The std::multimap the hash table replaced, used as the reference
+//
+typedef TR::typed_allocator<std::pair<const int32_t, TR::Node *>, TR::Region &> MultimapAllocator;
+typedef std::multimap<int32_t, TR::Node *, std::less<int32_t>, MultimapAllocator> Multimap;
+
+} // namespace
+
+class LocalCSEHashTableTest : public TRTest::CompilerUnitTest {};
+
+TEST_F(LocalCSEHashTableTest, KeepsInsertionOrderPerKey)
+{
+    HashTable table(region(), 107);
+
+    // 128 buckets, so keys 1 and 129 may share one; their entries must not mix
+    //
+    table.insert(1, fakeNode(10));
+    table.insert(129, fakeNode(20));
+    table.insert(1, fakeNode(11));
+    table.insert(129, fakeNode(21));
+    table.insert(1, fakeNode(12));
+
+    int32_t i = 0;
+    for (HashTable::Entry *entry = table.first(1); entry; entry = table.next(entry))
+        EXPECT_EQ(fakeNode(10 + i++), entry->_node);
+    EXPECT_EQ(3, i);
+
+    i = 0;
+    for (HashTable::Entry *entry = table.first(129); entry; entry = table.next(entry))
+        EXPECT_EQ(fakeNode(20 + i++), entry->_node);
+    EXPECT_EQ(2, i);
+
+    EXPECT_TRUE(table.first(2) == NULL);
+}
+
+TEST_F(LocalCSEHashTableTest, EraseSkipsEntriesAndEraseKeyReturnsLatestLiveNode)
+{
+    HashTable table(region(), 107);
+    table.insert(5, fakeNode(1));
+    table.insert(5, fakeNode(2));
+    table.insert(5, fakeNode(3));
+    table.insert(6, fakeNode(4));
+
+    table.erase(table.next(table.first(5)));
+    HashTable::Entry *entry = table.first(5);
+    ASSERT_TRUE(entry != NULL);
+    EXPECT_EQ(fakeNode(1), entry->_node);
+    entry = table.next(entry);
+    ASSERT_TRUE(entry != NULL);
+    EXPECT_EQ(fakeNode(3), entry->_node);
+    EXPECT_TRUE(table.next(entry) == NULL);
+
+    table.erase(entry);
+    EXPECT_EQ(fakeNode(1), table.eraseKey(5));
+    EXPECT_TRUE(table.first(5) == NULL);
+    EXPECT_TRUE(table.eraseKey(5) == NULL);
+
+    // Erasing a key leaves the other keys alone, and its storage is reused
+    //
+    ASSERT_TRUE(table.first(6) != NULL);
+    table.insert(5, fakeNode(7));
+    EXPECT_EQ(fakeNode(7), table.first(5)->_node);
+}
+
+TEST_F(LocalCSEHashTableTest, ClearEmptiesEveryKeyAndTableIsReusable)
+{
+    HashTable table(region(), 4096);
+    for (int32_t key = 0; key < 1000; key += 7)
+        table.insert(key, fakeNode(key));
+
+    table.clear();
+    for (int32_t key = 0; key < 1000; key++)
+        EXPECT_TRUE(table.first(key) == NULL) << "key " << key;
+
+    table.insert(14, fakeNode(1));
+    table.insert(14, fakeNode(2));
+    EXPECT_EQ(fakeNode(2), table.eraseKey(14));
+}
+
+// LocalCSE clears its tables for every block and reuses them for the next
+// one. This runs the same random sequence of inserts, lookups and kills
+// against a table reused across blocks and against a fresh std::multimap per
+// block, the structure the tables replaced, and checks that they always agree.
+//
+TEST_F(LocalCSEHashTableTest, ReusedTableAgreesWithMultimapPerBlock)
+{
+    const int32_t numBlocks = 500;
+    const int32_t opsPerBlock = 48;
+    const int32_t numKeys = 4096;
+
+    HashTable table(region(), numKeys);
+    TRTest::Random random(11);
+
+    for (int32_t block = 0; block < numBlocks; block++) {
+        TR::StackMemoryRegion stackRegion(_trMemory);
+        Multimap multimap(std::less<int32_t>(), stackRegion);
+        table.clear();
+
+        for (int32_t op = 0; op < opsPerBlock; op++) {
+            int32_t key = random.next() % numKeys;
+            uint32_t kind = random.next() % 8;
+            if (kind < 4) {
+                table.insert(key, fakeNode(op));
+                multimap.insert(std::make_pair(key, fakeNode(op)));
+            } else if (kind < 7) {
+                auto range = multimap.equal_range(key);
+                HashTable::Entry *entry = table.first(key);
+                for (auto it = range.first; it != range.second; ++it, entry = table.next(entry)) {
+                    ASSERT_TRUE(entry != NULL) << "block " << block << " key " << key;
+                    ASSERT_EQ(it->second, entry->_node) << "block " << block << " key " << key;
+                }
+                ASSERT_TRUE(entry == NULL) << "block " << block << " key " << key;
+            } else {
+                auto range = multimap.equal_range(key);
+                TR::Node *latest = NULL;
+                for (auto it = range.first; it != range.second; ++it)
+                    latest = it->second;
+                ASSERT_EQ(latest, table.eraseKey(key)) << "block " << block << " key " << key;
+                multimap.erase(key);
+            }
+        }
+    }
+}
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if defined(LINUX)
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+#include "runtime/PerfJitDump.hpp"
+
+namespace {
+
+struct Record {
+    uint32_t _id;
+    std::vector<uint8_t> _body; /**< everything after the record header */
+};
+
+template<typename T> T read(const uint8_t *p)
+{
+    T value;
+    memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+class PerfJitDumpTest : public ::testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        strcpy(_directory, "/tmp/perfjitdumptestXXXXXX");
+        ASSERT_TRUE(mkdtemp(_directory) != NULL);
+        _jitDump = TR::PerfJitDump::create(TR::RawAllocator(), _directory);
+        ASSERT_TRUE(_jitDump != NULL);
+        _fileName = _jitDump->fileName();
+    }
+
+    virtual void TearDown()
+    {
+        if (_jitDump)
+            _jitDump->destroy();
+        unlink(_fileName.c_str());
+        rmdir(_directory);
+    }
+
+    // Reads the records written so far, checking the file header and record framing
+    std::vector<Record> readRecords()
+    {
+        std::vector<Record> records;
+        std::vector<uint8_t> contents;
+        FILE *file = fopen(_fileName.c_str(), "rb");
+        EXPECT_TRUE(file != NULL);
+        if (!file)
+            return records;
+        int c;
+        while ((c = fgetc(file)) != EOF)
+            contents.push_back(static_cast<uint8_t>(c));
+        fclose(file);
+
+        EXPECT_LE(40u, contents.size());
+        if (contents.size() < 40)
+            return records;
+        EXPECT_EQ(0x4A695444u, read<uint32_t>(&contents[0]));
+        EXPECT_EQ(1u, read<uint32_t>(&contents[4]));
+        EXPECT_EQ(40u, read<uint32_t>(&contents[8]));
+        EXPECT_EQ(static_cast<uint32_t>(getpid()), read<uint32_t>(&contents[20]));
+
+        size_t offset = read<uint32_t>(&contents[8]);
+        while (offset + 16 <= contents.size()) {
+            Record record;
+            record._id = read<uint32_t>(&contents[offset]);
+            uint32_t totalSize = read<uint32_t>(&contents[offset + 4]);
+            EXPECT_EQ(0u, totalSize % 8);
+            EXPECT_LE(offset + totalSize, contents.size());
+            if (totalSize < 16 || offset + totalSize > contents.size())
+                break;
+            record._body.assign(contents.begin() + offset + 16, contents.begin() + offset + totalSize);
+            records.push_back(record);
+            offset += totalSize;
+        }
+        EXPECT_EQ(contents.size(), offset);
+        return records;
+    }
+
+    char _directory[64];
+    std::string _fileName;
+    TR::PerfJitDump *_jitDump;
+};
+
+} // namespace
+
+TEST_F(PerfJitDumpTest, WritesDebugInfoBeforeLoad)
+{
+    uint8_t code[] = { 0x55, 0x48, 0x89, 0xe5, 0x5d, 0xc3 };
+    TR::PerfJitDump::LineEntry lines[] = { { &code[0], 0 }, { &code[4], 7 } };
+    _jitDump->codeLoad("method", code, sizeof(code), "method.src", lines, 2);
+    _jitDump->flush();
+
+    std::vector<Record> records = readRecords();
+    ASSERT_EQ(2u, records.size());
+
+    const Record &debugInfo = records[0];
+    EXPECT_EQ(2u, debugInfo._id);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(code), read<uint64_t>(&debugInfo._body[0]));
+    EXPECT_EQ(2u, read<uint64_t>(&debugInfo._body[8]));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&code[4]), read<uint64_t>(&debugInfo._body[16 + 16 + 11]));
+    EXPECT_EQ(7, read<int32_t>(&debugInfo._body[16 + 16 + 11 + 8]));
+    EXPECT_STREQ("method.src", reinterpret_cast<const char *>(&debugInfo._body[16 + 16]));
+
+    const Record &load = records[1];
+    EXPECT_EQ(0u, load._id);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(code), read<uint64_t>(&load._body[16]));
+    EXPECT_EQ(sizeof(code), read<uint64_t>(&load._body[24]));
+    EXPECT_STREQ("method", reinterpret_cast<const char *>(&load._body[40]));
+    EXPECT_EQ(0, memcmp(code, &load._body[40 + strlen("method") + 1], sizeof(code)));
+}
+
+TEST_F(PerfJitDumpTest, MovesOnlyLoadedCode)
+{
+    uint8_t code[64] = { 0 };
+    _jitDump->codeLoad("first", &code[0], 16);
+    _jitDump->codeLoad("second", &code[16], 16);
+    _jitDump->codeMove(&code[16], &code[32]);
+
+    // freed code can no longer be moved
+    _jitDump->codeUnload(&code[0], &code[16]);
+    _jitDump->codeMove(&code[0], &code[48]);
+    _jitDump->flush();
+
+    std::vector<Record> records = readRecords();
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(0u, records[0]._id);
+    EXPECT_EQ(0u, records[1]._id);
+
+    const Record &move = records[2];
+    EXPECT_EQ(1u, move._id);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&code[16]), read<uint64_t>(&move._body[16]));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&code[32]), read<uint64_t>(&move._body[24]));
+    EXPECT_EQ(16u, read<uint64_t>(&move._body[32]));
+    // code_index of the second load
+    EXPECT_EQ(read<uint64_t>(&records[1]._body[32]), read<uint64_t>(&move._body[40]));
+}
+
+TEST_F(PerfJitDumpTest, EndsWithCloseRecord)
+{
+    uint8_t code[8] = { 0 };
+    _jitDump->codeLoad("method", code, sizeof(code));
+    _jitDump->destroy();
+    _jitDump = NULL;
+
+    std::vector<Record> records = readRecords();
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(0u, records[0]._id);
+    EXPECT_EQ(3u, records[1]._id);
+}
+
+#endif // defined(LINUX)
@@ -26,6 +26,8 @@
 #include "optimizer/abstractinterpreter/AbsValue.hpp"
 #include "optimizer/abstractinterpreter/AbsOpArray.hpp"
 #include "optimizer/abstractinterpreter/AbsOpStack.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummary.hpp"
+#include "optimizer/abstractinterpreter/InliningMethodSummaryCache.hpp"
 
 
 class AbsVPValueTest : public TRTest::AbsInterpreterTest {};
@@ -428,3 +430,75 @@ TEST_F(AbsOpArrayTest, testMergeOperation) {
     ASSERT_EQ(INT_MAX, v3->getHigh());
     ASSERT_TRUE(v3->isTop());
 }
+
+
+class InliningMethodSummaryCacheTest : public TRTest::AbsInterpreterTest {
+public:
+    InliningMethodSummaryCacheTest() :
+        AbsInterpreterTest(),
+        _callee("compunittest", "0", "callee", 0, NULL, NULL, TR::NoType, &_calleeBody, NULL) {}
+
+    TR::ResolvedMethod* callee() { return &_callee; }
+
+    TR::InliningMethodSummary* createSummary() {
+        TR::InliningMethodSummary* summary = new (region()) TR::InliningMethodSummary(region());
+        summary->addPotentialOptimizationByArgument(new (region()) TR::PotentialOptimizationVPPredicate(
+            TR::VPIntRange::create(vp(), 0, 10), 4, TR::PotentialOptimizationPredicate::BranchFolding, vp()), 0);
+        summary->addPotentialOptimizationByArgument(new (region()) TR::PotentialOptimizationVPPredicate(
+            TR::VPNonNullObject::create(vp()), 9, TR::PotentialOptimizationPredicate::NullCheckFolding, vp()), 1);
+        return summary;
+    }
+
+private:
+    static int32_t _calleeBody;
+    TR::ResolvedMethod _callee;
+};
+
+int32_t InliningMethodSummaryCacheTest::_calleeBody = 0;
+
+TEST_F(InliningMethodSummaryCacheTest, testFindRebuildsSummary) {
+    TR::InliningMethodSummaryCache cache;
+    ASSERT_TRUE(cache.insert(callee(), createSummary(), false));
+    ASSERT_EQ(1, cache.getNumEntries());
+
+    bool hasCallSites = true;
+    TR::InliningMethodSummary* summary = cache.find(&_comp, callee(), vp(), region(), hasCallSites);
+    ASSERT_TRUE(summary != NULL);
+    ASSERT_FALSE(hasCallSites);
+    ASSERT_EQ(2, summary->getNumArguments());
+    ASSERT_EQ(4, summary->getPotentialOptimizationByArgument(0, 0)->getBytecodeIndex());
+    ASSERT_EQ(TR::PotentialOptimizationPredicate::NullCheckFolding, summary->getPotentialOptimizationByArgument(1, 0)->getKind());
+
+    TR::AbsVPValue* inRange = new (region()) TR::AbsVPValue(vp(), TR::VPIntConst::create(vp(), 5), TR::Int32);
+    TR::AbsVPValue* outOfRange = new (region()) TR::AbsVPValue(vp(), TR::VPIntConst::create(vp(), 50), TR::Int32);
+    TR::AbsVPValue* nonNull = new (region()) TR::AbsVPValue(vp(), TR::VPNonNullObject::create(vp()), TR::Address);
+    ASSERT_EQ(1, summary->testArgument(inRange, 0));
+    ASSERT_EQ(0, summary->testArgument(outOfRange, 0));
+    ASSERT_EQ(1, summary->testArgument(nonNull, 1));
+}
+
+TEST_F(InliningMethodSummaryCacheTest, testInsertRejectsUnpersistableConstraint) {
+    TR::InliningMethodSummaryCache cache;
+    TR::InliningMethodSummary* summary = createSummary();
+    summary->addPotentialOptimizationByArgument(new (region()) TR::PotentialOptimizationVPPredicate(
+        TR::VPLongConst::create(vp(), 7), 12, TR::PotentialOptimizationPredicate::BranchFolding, vp()), 2);
+
+    ASSERT_FALSE(cache.insert(callee(), summary, false));
+    ASSERT_EQ(0, cache.getNumEntries());
+
+    bool hasCallSites = false;
+    ASSERT_EQ(NULL, cache.find(&_comp, callee(), vp(), region(), hasCallSites));
+}
+
+TEST_F(InliningMethodSummaryCacheTest, testInvalidateMethod) {
+    TR::InliningMethodSummaryCache cache;
+    ASSERT_TRUE(cache.insert(callee(), createSummary(), true));
+
+    bool hasCallSites = false;
+    ASSERT_TRUE(cache.find(&_comp, callee(), vp(), region(), hasCallSites) != NULL);
+    ASSERT_TRUE(hasCallSites);
+
+    cache.invalidateMethod(callee()->getPersistentIdentifier());
+    ASSERT_EQ(0, cache.getNumEntries());
+    ASSERT_EQ(NULL, cache.find(&_comp, callee(), vp(), region(), hasCallSites));
+}
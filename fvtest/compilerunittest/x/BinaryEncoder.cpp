@@ -49,6 +49,46 @@ TEST_P(XDirectEncodingTest, encode)
     ASSERT_EQ(std::get<2>(GetParam()), encodeInstruction(instr));
 }
 
+class XOpCodeLengthTest : public TRTest::BinaryEncoderTest<> {};
+
+/**
+ * One entry per instruction in X86Ops.ins. TR::InstOpCode::NumOpCodes can't
+ * bound the walk over every mnemonic because it follows the aliases at the end
+ * of the enum, not the last instruction.
+ */
+static const uint8_t opCodeTableEntries[] = {
+#define INSTRUCTION(name, mnemonic, binary, ...) 0
+#include "codegen/X86Ops.ins"
+#undef INSTRUCTION
+};
+
+TEST_F(XOpCodeLengthTest, lengthMatchesEncoding)
+{
+    static const OMR::X86::Encoding legacyEncodings[] = { OMR::X86::Default, OMR::X86::Legacy };
+    static const OMR::X86::Encoding vexEncodings[] = { OMR::X86::VEX_L128, OMR::X86::VEX_L256, OMR::X86::EVEX_L128,
+        OMR::X86::EVEX_L256, OMR::X86::EVEX_L512 };
+
+    for (int32_t m = 0; m < (int32_t)(sizeof(opCodeTableEntries) / sizeof(opCodeTableEntries[0])); m++) {
+        TR::InstOpCode op(static_cast<TR::InstOpCode::Mnemonic>(m));
+        for (uint8_t rex = 0; rex < 16; rex++) {
+            for (size_t i = 0; i < sizeof(legacyEncodings) / sizeof(legacyEncodings[0]); i++) {
+                uint8_t *cursor = op.binary(getAlignedBuf(), legacyEncodings[i], rex);
+                ASSERT_EQ(cursor - getAlignedBuf(), op.length(legacyEncodings[i], rex))
+                    << "mnemonic " << m << " encoding " << legacyEncodings[i] << " rex " << (int)rex;
+            }
+
+            if (!op.info().supportsAVX())
+                continue;
+
+            for (size_t i = 0; i < sizeof(vexEncodings) / sizeof(vexEncodings[0]); i++) {
+                uint8_t *cursor = op.binary(getAlignedBuf(), vexEncodings[i], rex);
+                ASSERT_EQ(cursor - getAlignedBuf(), op.length(vexEncodings[i], rex))
+                    << "mnemonic " << m << " encoding " << vexEncodings[i] << " rex " << (int)rex;
+            }
+        }
+    }
+}
+
 class XLabelEncodingTest
     : public TRTest::BinaryEncoderTest<>
     , public ::testing::WithParamInterface<std::tuple<OP::Mnemonic, size_t, TRTest::BinaryInstruction> > {};
@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../CodeGenTest.hpp"
+#include "codegen/OMRX86Instruction.hpp"
+#include "codegen/Peephole.hpp"
+
+class XPeepholeTest : public TRTest::CodeGenTest {
+public:
+    XPeepholeTest()
+    {
+        _comp.getOptions()->setOptLevel(warm);
+
+        // The first instruction of a method is never a candidate, so keep the
+        // instructions under test away from it
+        _entry = generateRegRegInstruction(TR::InstOpCode::ADD8RegReg, fakeNode, reg(TR::RealRegister::edi),
+            reg(TR::RealRegister::esi), cg());
+    }
+
+    TR::RealRegister *reg(TR::RealRegister::RegNum regNum) { return cg()->machine()->getRealRegister(regNum); }
+
+    void performPeephole()
+    {
+        TR::Peephole peephole(cg()->comp());
+        peephole.perform();
+    }
+
+protected:
+    TR::Instruction *_entry;
+};
+
+TEST_F(XPeepholeTest, removesSelfMove)
+{
+    generateRegRegInstruction(TR::InstOpCode::MOV8RegReg, fakeNode, reg(TR::RealRegister::eax),
+        reg(TR::RealRegister::eax), cg());
+
+    performPeephole();
+
+    ASSERT_EQ(_entry, cg()->getFirstInstruction());
+    ASSERT_FALSE(_entry->getNext());
+}
+
+TEST_F(XPeepholeTest, removesCopyBack)
+{
+    TR::Instruction *copy = generateRegRegInstruction(TR::InstOpCode::MOV8RegReg, fakeNode,
+        reg(TR::RealRegister::eax), reg(TR::RealRegister::ebx), cg());
+    generateRegRegInstruction(TR::InstOpCode::MOV8RegReg, fakeNode, reg(TR::RealRegister::ebx),
+        reg(TR::RealRegister::eax), cg());
+
+    performPeephole();
+
+    ASSERT_EQ(copy, _entry->getNext());
+    ASSERT_FALSE(copy->getNext());
+}
+
+TEST_F(XPeepholeTest, removesLoadAfterStore)
+{
+    TR::Instruction *store = generateMemRegInstruction(TR::InstOpCode::S8MemReg, fakeNode,
+        generateX86MemoryReference(reg(TR::RealRegister::ebx), 16, cg()), reg(TR::RealRegister::eax), cg());
+    generateRegMemInstruction(TR::InstOpCode::L8RegMem, fakeNode, reg(TR::RealRegister::eax),
+        generateX86MemoryReference(reg(TR::RealRegister::ebx), 16, cg()), cg());
+
+    performPeephole();
+
+    ASSERT_EQ(store, _entry->getNext());
+    ASSERT_FALSE(store->getNext());
+}
+
+TEST_F(XPeepholeTest, keepsLoadFromOtherLocation)
+{
+    TR::Instruction *store = generateMemRegInstruction(TR::InstOpCode::S8MemReg, fakeNode,
+        generateX86MemoryReference(reg(TR::RealRegister::ebx), 16, cg()), reg(TR::RealRegister::eax), cg());
+    TR::Instruction *load = generateRegMemInstruction(TR::InstOpCode::L8RegMem, fakeNode, reg(TR::RealRegister::eax),
+        generateX86MemoryReference(reg(TR::RealRegister::ebx), 24, cg()), cg());
+
+    performPeephole();
+
+    ASSERT_EQ(store, _entry->getNext());
+    ASSERT_EQ(load, store->getNext());
+}
+
+TEST_F(XPeepholeTest, reducesCompareWithZeroToTest)
+{
+    generateRegImmInstruction(TR::InstOpCode::CMP8RegImms, fakeNode, reg(TR::RealRegister::ecx), 0, cg());
+
+    performPeephole();
+
+    TR::Instruction *test = _entry->getNext();
+    ASSERT_TRUE(test);
+    ASSERT_EQ(TR::InstOpCode::TEST8RegReg, test->getOpCodeValue());
+    ASSERT_EQ(reg(TR::RealRegister::ecx), test->getTargetRegister());
+    ASSERT_EQ(reg(TR::RealRegister::ecx), test->getSourceRegister());
+    ASSERT_FALSE(test->getNext());
+}
+
+TEST_F(XPeepholeTest, keepsCompareWithRelocatedImmediate)
+{
+    TR::Instruction *compare = generateRegImmInstruction(TR::InstOpCode::CMP8RegImm4, fakeNode,
+        reg(TR::RealRegister::ecx), 0, cg(), TR_ClassAddress);
+
+    performPeephole();
+
+    ASSERT_EQ(compare, _entry->getNext());
+    ASSERT_FALSE(compare->getNext());
+}
+
+TEST_F(XPeepholeTest, removesTestOfLogicalResult)
+{
+    TR::Instruction *andInstr = generateRegRegInstruction(TR::InstOpCode::AND8RegReg, fakeNode,
+        reg(TR::RealRegister::eax), reg(TR::RealRegister::ebx), cg());
+    generateRegRegInstruction(TR::InstOpCode::TEST8RegReg, fakeNode, reg(TR::RealRegister::eax),
+        reg(TR::RealRegister::eax), cg());
+
+    performPeephole();
+
+    ASSERT_EQ(andInstr, _entry->getNext());
+    ASSERT_FALSE(andInstr->getNext());
+}
+
+TEST_F(XPeepholeTest, foldsLEAIntoMove)
+{
+    generateRegMemInstruction(TR::InstOpCode::LEA8RegMem, fakeNode, reg(TR::RealRegister::eax),
+        generateX86MemoryReference(reg(TR::RealRegister::ebx), 0, cg()), cg());
+
+    performPeephole();
+
+    TR::Instruction *move = _entry->getNext();
+    ASSERT_TRUE(move);
+    ASSERT_EQ(TR::InstOpCode::MOV8RegReg, move->getOpCodeValue());
+    ASSERT_EQ(reg(TR::RealRegister::eax), move->getTargetRegister());
+    ASSERT_EQ(reg(TR::RealRegister::ebx), move->getSourceRegister());
+    ASSERT_FALSE(move->getNext());
+}
+
+TEST_F(XPeepholeTest, usesZeroIdiomWhenFlagsAreDead)
+{
+    generateRegImmInstruction(TR::InstOpCode::MOV4RegImm4, fakeNode, reg(TR::RealRegister::eax), 0, cg());
+    TR::Instruction *add = generateRegRegInstruction(TR::InstOpCode::ADD8RegReg, fakeNode,
+        reg(TR::RealRegister::ebx), reg(TR::RealRegister::ecx), cg());
+
+    performPeephole();
+
+    TR::Instruction *zero = _entry->getNext();
+    ASSERT_TRUE(zero);
+    ASSERT_EQ(TR::InstOpCode::XOR4RegReg, zero->getOpCodeValue());
+    ASSERT_EQ(reg(TR::RealRegister::eax), zero->getTargetRegister());
+    ASSERT_EQ(add, zero->getNext());
+}
+
+TEST_F(XPeepholeTest, keepsMoveOfRelocatedImmediate)
+{
+    TR::Instruction *move = generateRegImmInstruction(TR::InstOpCode::MOV4RegImm4, fakeNode,
+        reg(TR::RealRegister::eax), 0, cg(), TR_ClassAddress);
+    TR::Instruction *add = generateRegRegInstruction(TR::InstOpCode::ADD8RegReg, fakeNode,
+        reg(TR::RealRegister::ebx), reg(TR::RealRegister::ecx), cg());
+
+    performPeephole();
+
+    ASSERT_EQ(move, _entry->getNext());
+    ASSERT_EQ(add, move->getNext());
+}
+
+TEST_F(XPeepholeTest, keepsMoveOfZeroWhenFlagsAreLive)
+{
+    TR::Instruction *move = generateRegImmInstruction(TR::InstOpCode::MOV4RegImm4, fakeNode,
+        reg(TR::RealRegister::eax), 0, cg());
+    TR::Instruction *set
+        = generateRegInstruction(TR::InstOpCode::SETE1Reg, fakeNode, reg(TR::RealRegister::ecx), cg());
+
+    performPeephole();
+
+    ASSERT_EQ(move, _entry->getNext());
+    ASSERT_EQ(set, move->getNext());
+}
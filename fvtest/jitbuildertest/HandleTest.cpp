@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <cstddef>
+
+struct HandlePoint
+   {
+   int32_t x;
+   int32_t y;
+   };
+
+union HandleUnion
+   {
+   int32_t i;
+   float f;
+   };
+
+DEFINE_TYPES(HandleTypes)
+   {
+   DefineStruct("HandlePoint");
+   DefineField("HandlePoint", "x", Int32, offsetof(HandlePoint, x));
+   DefineField("HandlePoint", "y", Int32, offsetof(HandlePoint, y));
+   CloseStruct("HandlePoint");
+
+   DefineUnion("HandleUnion");
+   UnionField("HandleUnion", "i", Int32);
+   UnionField("HandleUnion", "f", Float);
+   CloseUnion("HandleUnion");
+   }
+
+typedef int32_t (*SumPointsFunction)(HandlePoint *, int32_t);
+
+/*
+ * `SumPoints` adds up the x and y fields of an array of points, accessing every
+ * local variable, parameter, and field through handles looked up in the constructor.
+ */
+class SumPoints : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+   SumPoints(OMR::JitBuilder::TypeDictionary *types)
+      : OMR::JitBuilder::MethodBuilder(types)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+
+      DefineName("SumPoints");
+      _pPoint = types->PointerTo("HandlePoint");
+      DefineParameter("points", _pPoint);
+      DefineParameter("count", Int32);
+      DefineLocal("sum", Int32);
+      DefineReturnType(Int32);
+
+      _points = LookupLocal("points");
+      _count = LookupLocal("count");
+      _sum = LookupLocal("sum");
+      _x = types->LookupField("HandlePoint", "x");
+      _y = types->LookupField("HandlePoint", "y");
+      }
+
+   virtual bool buildIL()
+      {
+      Store(_sum, ConstInt32(0));
+
+      OMR::JitBuilder::IlBuilder *body = NULL;
+      ForLoopUp((char *)"i", &body, ConstInt32(0), Load(_count), ConstInt32(1));
+      OMR::JitBuilder::IlValue *point = body->IndexAt(_pPoint, body->Load(_points), body->Load("i"));
+      OMR::JitBuilder::IlValue *pointSum = body->Add(body->LoadIndirect(_x, point), body->LoadIndirect(_y, point));
+      body->Store(_sum, body->Add(body->Load(_sum), pointSum));
+
+      Return(Load(_sum));
+
+      return true;
+      }
+
+   private:
+   OMR::JitBuilder::IlType *_pPoint;
+   OMR::JitBuilder::LocalVariable *_points;
+   OMR::JitBuilder::LocalVariable *_count;
+   OMR::JitBuilder::LocalVariable *_sum;
+   OMR::JitBuilder::Field *_x;
+   OMR::JitBuilder::Field *_y;
+   };
+
+typedef int32_t (*StoreUnionFunction)(HandleUnion *, int32_t);
+
+DEFINE_BUILDER( StoreUnion,
+                Int32,
+                PARAM("u", PointerTo(LookupUnion("HandleUnion"))),
+                PARAM("v", Int32) )
+   {
+   OMR::JitBuilder::Field *i = typeDictionary()->LookupField("HandleUnion", "i");
+   StoreIndirect(i, Load(LookupLocal("u")), Load(LookupLocal("v")));
+   Return(LoadIndirect(i, Load(LookupLocal("u"))));
+
+   return true;
+   }
+
+class HandleTest : public JitBuilderTest {};
+
+TEST_F(HandleTest, LookupReturnsSameHandle)
+   {
+   HandleTypes types;
+   SumPoints builder(&types);
+
+   OMR::JitBuilder::LocalVariable *sum = builder.LookupLocal("sum");
+   EXPECT_EQ(sum, builder.LookupLocal("sum"));
+   EXPECT_STREQ("sum", sum->getName());
+   EXPECT_EQ(types.Int32, sum->getType());
+
+   OMR::JitBuilder::Field *y = types.LookupField("HandlePoint", "y");
+   EXPECT_EQ(y, types.LookupField("HandlePoint", "y"));
+   EXPECT_STREQ("y", y->getName());
+   EXPECT_EQ(types.Int32, y->getType());
+   EXPECT_EQ(offsetof(HandlePoint, y), y->getOffset());
+   EXPECT_EQ(types.OffsetOf("HandlePoint", "y"), y->getOffset());
+
+   OMR::JitBuilder::Field *f = types.LookupField("HandleUnion", "f");
+   EXPECT_EQ(types.Float, f->getType());
+   EXPECT_EQ(0, f->getOffset());
+   }
+
+TEST_F(HandleTest, LoadAndStoreThroughHandles)
+   {
+   SumPointsFunction sumPoints;
+   ASSERT_COMPILE(HandleTypes, SumPoints, sumPoints);
+
+   HandlePoint points[] = { {1, 2}, {3, 4}, {-5, 60} };
+   EXPECT_EQ(0, sumPoints(points, 0));
+   EXPECT_EQ(3, sumPoints(points, 1));
+   EXPECT_EQ(65, sumPoints(points, 3));
+   }
+
+TEST_F(HandleTest, UnionFieldHandle)
+   {
+   StoreUnionFunction storeUnion;
+   ASSERT_COMPILE(HandleTypes, StoreUnion, storeUnion);
+
+   HandleUnion u;
+   u.i = 0;
+   EXPECT_EQ(42, storeUnion(&u, 42));
+   EXPECT_EQ(42, u.i);
+   }
+
+TEST_F(HandleTest, HandlesSurviveRecompilation)
+   {
+   HandleTypes types;
+   SumPoints builder(&types);
+   HandlePoint points[] = { {7, 8}, {9, 10} };
+
+   for (int32_t c = 0; c < 2; c++)
+      {
+      void *entry = NULL;
+      ASSERT_EQ(0, compileMethodBuilder(&builder, &entry)) << "Failed to compile method " << builder.GetMethodName();
+      EXPECT_EQ(34, ((SumPointsFunction)entry)(points, 2)) << "compilation " << c;
+      }
+   }
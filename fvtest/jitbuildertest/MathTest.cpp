@@ -0,0 +1,422 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <math.h>
+#include <string.h>
+
+
+DEFINE_BUILDER(TestInt32Abs,
+               Int32,
+               PARAM("param", Int32))
+   {
+   Return(Abs(Load("param")));
+   return true;
+   }
+
+DEFINE_BUILDER(TestDoubleSqrt,
+               Double,
+               PARAM("param", Double))
+   {
+   Return(Sqrt(Load("param")));
+   return true;
+   }
+
+DEFINE_BUILDER(TestInt64Min,
+               Int64,
+               PARAM("left", Int64),
+               PARAM("right", Int64))
+   {
+   Return(Min(Load("left"), Load("right")));
+   return true;
+   }
+
+DEFINE_BUILDER(TestFloatMin,
+               Float,
+               PARAM("left", Float),
+               PARAM("right", Float))
+   {
+   Return(Min(Load("left"), Load("right")));
+   return true;
+   }
+
+DEFINE_BUILDER(TestDoubleMax,
+               Double,
+               PARAM("left", Double),
+               PARAM("right", Double))
+   {
+   Return(Max(Load("left"), Load("right")));
+   return true;
+   }
+
+DEFINE_BUILDER(TestInt16Max,
+               Int16,
+               PARAM("left", Int16),
+               PARAM("right", Int16))
+   {
+   Return(Max(Load("left"), Load("right")));
+   return true;
+   }
+
+DEFINE_BUILDER(TestFloatVectorMax,
+               NoType,
+               PARAM("result", PointerTo(Float)),
+               PARAM("left", PointerTo(Float)),
+               PARAM("right", PointerTo(Float)))
+   {
+   OMR::JitBuilder::IlValue *left = VectorLoadAt(PointerTo(Float), Load("left"));
+   OMR::JitBuilder::IlValue *right = VectorLoadAt(PointerTo(Float), Load("right"));
+   VectorStoreAt(Load("result"), Max(left, right));
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(TestDoubleVectorMin,
+               NoType,
+               PARAM("result", PointerTo(Double)),
+               PARAM("left", PointerTo(Double)),
+               PARAM("right", PointerTo(Double)))
+   {
+   OMR::JitBuilder::IlValue *left = VectorLoadAt(PointerTo(Double), Load("left"));
+   OMR::JitBuilder::IlValue *right = VectorLoadAt(PointerTo(Double), Load("right"));
+   VectorStoreAt(Load("result"), Min(left, right));
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(TestInt32VectorAbsMin,
+               NoType,
+               PARAM("result", PointerTo(Int32)),
+               PARAM("values", PointerTo(Int32)),
+               PARAM("limit", Int32))
+   {
+   OMR::JitBuilder::IlValue *values = VectorLoadAt(PointerTo(Int32), Load("values"));
+   VectorStoreAt(Load("result"), Min(Abs(values), Load("limit")));
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(TestDoubleVectorSqrt,
+               NoType,
+               PARAM("result", PointerTo(Double)),
+               PARAM("values", PointerTo(Double)))
+   {
+   VectorStoreAt(Load("result"), Sqrt(VectorLoadAt(PointerTo(Double), Load("values"))));
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(TestInt32VectorSplat,
+               NoType,
+               PARAM("result", PointerTo(Int32)),
+               PARAM("value", Int32))
+   {
+   VectorStoreAt(Load("result"), VectorSplat(Load("value")));
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(TestInt32VectorElements,
+               Int32,
+               PARAM("values", PointerTo(Int32)),
+               PARAM("index", Int32),
+               PARAM("element", Int32))
+   {
+   OMR::JitBuilder::IlValue *values = VectorLoadAt(PointerTo(Int32), Load("values"));
+   OMR::JitBuilder::IlValue *updated = VectorSetElement(values, Load("index"), Load("element"));
+   VectorStoreAt(Load("values"), updated);
+   Return(VectorGetElement(updated, ConstInt32(3)));
+   return true;
+   }
+
+DEFINE_BUILDER(TestInt32VectorReduceAdd,
+               Int32,
+               PARAM("values", PointerTo(Int32)))
+   {
+   Return(VectorReduceAdd(VectorLoadAt(PointerTo(Int32), Load("values"))));
+   return true;
+   }
+
+DEFINE_BUILDER(TestInt16VectorReduceMin,
+               Int16,
+               PARAM("values", PointerTo(Int16)))
+   {
+   Return(VectorReduceMin(VectorLoadAt(PointerTo(Int16), Load("values"))));
+   return true;
+   }
+
+DEFINE_BUILDER(TestDoubleVectorReduceMax,
+               Double,
+               PARAM("values", PointerTo(Double)))
+   {
+   Return(VectorReduceMax(VectorLoadAt(PointerTo(Double), Load("values"))));
+   return true;
+   }
+
+DEFINE_BUILDER(TestCopyMemory,
+               NoType,
+               PARAM("dest", PointerTo(Int8)),
+               PARAM("source", PointerTo(Int8)),
+               PARAM("numBytes", Int32))
+   {
+   CopyMemory(Load("dest"), Load("source"), Load("numBytes"));
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(TestSetMemory,
+               NoType,
+               PARAM("dest", PointerTo(Int8)),
+               PARAM("value", Int8),
+               PARAM("numBytes", Int64))
+   {
+   SetMemory(Load("dest"), Load("value"), Load("numBytes"));
+   Return();
+   return true;
+   }
+
+class MathTest : public JitBuilderTest {};
+
+typedef int32_t (*Int32UnaryFunction)(int32_t);
+TEST_F(MathTest, Int32Abs)
+   {
+   Int32UnaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestInt32Abs, testFunction);
+   ASSERT_EQ(testFunction(0), 0);
+   ASSERT_EQ(testFunction(5), 5);
+   ASSERT_EQ(testFunction(-5), 5);
+   ASSERT_EQ(testFunction(INT32_MAX), INT32_MAX);
+   ASSERT_EQ(testFunction(-INT32_MAX), INT32_MAX);
+   }
+
+typedef double (*DoubleUnaryFunction)(double);
+TEST_F(MathTest, DoubleSqrt)
+   {
+   DoubleUnaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestDoubleSqrt, testFunction);
+   ASSERT_EQ(testFunction(0.0), 0.0);
+   ASSERT_EQ(testFunction(4.0), 2.0);
+   ASSERT_EQ(testFunction(2.0), sqrt(2.0));
+   ASSERT_TRUE(isnan(testFunction(-1.0)));
+   }
+
+typedef int64_t (*Int64BinaryFunction)(int64_t, int64_t);
+TEST_F(MathTest, Int64Min)
+   {
+   Int64BinaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestInt64Min, testFunction);
+   ASSERT_EQ(testFunction(1, 2), 1);
+   ASSERT_EQ(testFunction(2, 1), 1);
+   ASSERT_EQ(testFunction(-1, 1), -1);
+   ASSERT_EQ(testFunction(INT64_MIN, INT64_MAX), INT64_MIN);
+   }
+
+typedef int16_t (*Int16BinaryFunction)(int16_t, int16_t);
+TEST_F(MathTest, Int16Max)
+   {
+   Int16BinaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestInt16Max, testFunction);
+   ASSERT_EQ(testFunction(1, 2), 2);
+   ASSERT_EQ(testFunction(2, 1), 2);
+   ASSERT_EQ(testFunction(-1, 1), 1);
+   ASSERT_EQ(testFunction(INT16_MIN, INT16_MAX), INT16_MAX);
+   }
+
+typedef float (*FloatBinaryFunction)(float, float);
+TEST_F(MathTest, FloatMinIgnoresNaN)
+   {
+   FloatBinaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestFloatMin, testFunction);
+   ASSERT_EQ(testFunction(1.0f, 2.0f), 1.0f);
+   ASSERT_EQ(testFunction(2.0f, -1.0f), -1.0f);
+   ASSERT_EQ(testFunction(NAN, 1.0f), 1.0f);
+   ASSERT_EQ(testFunction(1.0f, NAN), 1.0f);
+   ASSERT_TRUE(isnan(testFunction(NAN, NAN)));
+   }
+
+typedef double (*DoubleBinaryFunction)(double, double);
+TEST_F(MathTest, DoubleMaxIgnoresNaN)
+   {
+   DoubleBinaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestDoubleMax, testFunction);
+   ASSERT_EQ(testFunction(1.0, 2.0), 2.0);
+   ASSERT_EQ(testFunction(2.0, -1.0), 2.0);
+   ASSERT_EQ(testFunction(NAN, 1.0), 1.0);
+   ASSERT_EQ(testFunction(1.0, NAN), 1.0);
+   ASSERT_TRUE(isnan(testFunction(NAN, NAN)));
+   }
+
+typedef void (*FloatVectorBinaryFunction)(float *, float *, float *);
+TEST_F(MathTest, FloatVectorMax)
+   {
+   FloatVectorBinaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestFloatVectorMax, testFunction);
+   float left[4] = { 1.0f, -2.0f, 3.5f, 0.0f };
+   float right[4] = { 0.5f, -1.0f, 4.0f, 0.0f };
+   float result[4];
+   testFunction(result, left, right);
+   ASSERT_EQ(result[0], 1.0f);
+   ASSERT_EQ(result[1], -1.0f);
+   ASSERT_EQ(result[2], 4.0f);
+   ASSERT_EQ(result[3], 0.0f);
+   }
+
+TEST_F(MathTest, FloatVectorMaxIgnoresNaN)
+   {
+   FloatVectorBinaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestFloatVectorMax, testFunction);
+   float left[4] = { NAN, 1.0f, NAN, -3.0f };
+   float right[4] = { 1.0f, NAN, NAN, -4.0f };
+   float result[4];
+   testFunction(result, left, right);
+   ASSERT_EQ(result[0], 1.0f);
+   ASSERT_EQ(result[1], 1.0f);
+   ASSERT_TRUE(isnan(result[2]));
+   ASSERT_EQ(result[3], -3.0f);
+   }
+
+typedef void (*DoubleVectorBinaryFunction)(double *, double *, double *);
+TEST_F(MathTest, DoubleVectorMinIgnoresNaN)
+   {
+   DoubleVectorBinaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestDoubleVectorMin, testFunction);
+   double left[2] = { NAN, 2.0 };
+   double right[2] = { -1.0, NAN };
+   double result[2];
+   testFunction(result, left, right);
+   ASSERT_EQ(result[0], -1.0);
+   ASSERT_EQ(result[1], 2.0);
+
+   double moreLeft[2] = { 1.5, NAN };
+   double moreRight[2] = { 0.5, NAN };
+   testFunction(result, moreLeft, moreRight);
+   ASSERT_EQ(result[0], 0.5);
+   ASSERT_TRUE(isnan(result[1]));
+   }
+
+typedef void (*Int32VectorAbsMinFunction)(int32_t *, int32_t *, int32_t);
+TEST_F(MathTest, Int32VectorAbsMin)
+   {
+   Int32VectorAbsMinFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestInt32VectorAbsMin, testFunction);
+   int32_t values[4] = { -3, 7, -12, 10 };
+   int32_t result[4];
+   testFunction(result, values, 10);
+   ASSERT_EQ(result[0], 3);
+   ASSERT_EQ(result[1], 7);
+   ASSERT_EQ(result[2], 10);
+   ASSERT_EQ(result[3], 10);
+   }
+
+typedef void (*DoubleVectorUnaryFunction)(double *, double *);
+TEST_F(MathTest, DoubleVectorSqrt)
+   {
+   DoubleVectorUnaryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestDoubleVectorSqrt, testFunction);
+   double values[2] = { 9.0, 2.25 };
+   double result[2];
+   testFunction(result, values);
+   ASSERT_EQ(result[0], 3.0);
+   ASSERT_EQ(result[1], 1.5);
+   }
+
+typedef void (*Int32VectorSplatFunction)(int32_t *, int32_t);
+TEST_F(MathTest, Int32VectorSplat)
+   {
+   Int32VectorSplatFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestInt32VectorSplat, testFunction);
+   int32_t result[4] = { 0, 0, 0, 0 };
+   testFunction(result, -42);
+   for (int i = 0; i < 4; i++)
+      ASSERT_EQ(result[i], -42);
+   }
+
+typedef int32_t (*Int32VectorElementsFunction)(int32_t *, int32_t, int32_t);
+TEST_F(MathTest, Int32VectorElements)
+   {
+   Int32VectorElementsFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestInt32VectorElements, testFunction);
+   int32_t values[4] = { 1, 2, 3, 4 };
+   ASSERT_EQ(testFunction(values, 1, 20), 4);
+   ASSERT_EQ(values[0], 1);
+   ASSERT_EQ(values[1], 20);
+   ASSERT_EQ(values[2], 3);
+   ASSERT_EQ(values[3], 4);
+   ASSERT_EQ(testFunction(values, 3, 40), 40);
+   ASSERT_EQ(values[3], 40);
+   }
+
+typedef int32_t (*Int32VectorReduceFunction)(int32_t *);
+TEST_F(MathTest, Int32VectorReduceAdd)
+   {
+   Int32VectorReduceFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestInt32VectorReduceAdd, testFunction);
+   int32_t values[4] = { 1, -2, 30, 400 };
+   ASSERT_EQ(testFunction(values), 429);
+   }
+
+typedef int16_t (*Int16VectorReduceFunction)(int16_t *);
+TEST_F(MathTest, Int16VectorReduceMin)
+   {
+   Int16VectorReduceFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestInt16VectorReduceMin, testFunction);
+   int16_t values[8] = { 5, 3, 9, -7, 12, 0, -6, 8 };
+   ASSERT_EQ(testFunction(values), -7);
+   }
+
+typedef double (*DoubleVectorReduceFunction)(double *);
+TEST_F(MathTest, DoubleVectorReduceMax)
+   {
+   DoubleVectorReduceFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestDoubleVectorReduceMax, testFunction);
+   double values[2] = { -1.5, 2.5 };
+   ASSERT_EQ(testFunction(values), 2.5);
+   }
+
+typedef void (*CopyMemoryFunction)(int8_t *, int8_t *, int32_t);
+TEST_F(MathTest, CopyMemory)
+   {
+   CopyMemoryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestCopyMemory, testFunction);
+   int8_t buffer[64];
+   for (int i = 0; i < 64; i++)
+      buffer[i] = (int8_t)i;
+   testFunction(buffer + 8, buffer, 37);
+   for (int i = 0; i < 37; i++)
+      ASSERT_EQ(buffer[8 + i], i) << "overlapping copy at byte " << i;
+   ASSERT_EQ(buffer[45], 45);
+   }
+
+typedef void (*SetMemoryFunction)(int8_t *, int8_t, int64_t);
+TEST_F(MathTest, SetMemory)
+   {
+   SetMemoryFunction testFunction;
+   ASSERT_COMPILE(OMR::JitBuilder::TypeDictionary, TestSetMemory, testFunction);
+   int8_t buffer[64];
+   memset(buffer, 0, sizeof(buffer));
+   testFunction(buffer + 3, (int8_t)0x5a, 50);
+   ASSERT_EQ(buffer[2], 0);
+   for (int i = 3; i < 53; i++)
+      ASSERT_EQ(buffer[i], 0x5a) << "byte " << i;
+   ASSERT_EQ(buffer[53], 0);
+   }
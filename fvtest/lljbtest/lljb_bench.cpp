@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Times the kernels in vector_kernels.cpp compiled two ways: by clang -O2
+ * (linked into this executable) and by LLJB from the IR clang -O2 produced
+ * for the same source. Usage: lljb_bench <vector_kernels.ll> [iterations]
+ */
+
+#include "lljb/Module.hpp"
+#include "lljb/Compiler.hpp"
+#include "JitBuilder.hpp"
+#include "vector_kernels.hpp"
+
+#include "llvm/IR/Module.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/Support/SourceMgr.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+
+const int32_t N = 4096;
+
+struct Buffers
+   {
+   float x[N], y[N], fout[N];
+   int32_t a[N], b[N], iout[N];
+
+   void reset()
+      {
+      for (int32_t i = 0; i < N; i++)
+         {
+         x[i] = (float) (i % 101) * 0.25f;
+         y[i] = (float) (N - i);
+         a[i] = i % 17 - 8;
+         b[i] = 3 - i % 5;
+         fout[i] = 0.0f;
+         iout[i] = 0;
+         }
+      }
+   };
+
+/*
+ * Each kernel gets a runner that calls either the native or the LLJB compiled
+ * entry point on the shared buffers and returns a value to compare.
+ */
+typedef int64_t (*KernelRunner)(void * entry, Buffers &buffers);
+
+int64_t runSaxpy(void * entry, Buffers &bufs)
+   {
+   ((void (*)(int32_t, float, const float *, float *)) entry)(N, 1.5f, bufs.x, bufs.y);
+   return (int64_t) bufs.y[N - 1];
+   }
+
+int64_t runDot(void * entry, Buffers &bufs)
+   {
+   return ((int32_t (*)(int32_t, const int32_t *, const int32_t *)) entry)(N, bufs.a, bufs.b);
+   }
+
+int64_t runSum(void * entry, Buffers &bufs)
+   {
+   return ((int32_t (*)(int32_t, const int32_t *)) entry)(N, bufs.a);
+   }
+
+int64_t runMaximum(void * entry, Buffers &bufs)
+   {
+   return ((int32_t (*)(int32_t, const int32_t *)) entry)(N, bufs.b);
+   }
+
+int64_t runClamp(void * entry, Buffers &bufs)
+   {
+   ((void (*)(int32_t, int32_t *, const int32_t *, int32_t, int32_t)) entry)(N, bufs.iout, bufs.a, -3, 5);
+   return bufs.iout[N / 2];
+   }
+
+int64_t runMagnitude(void * entry, Buffers &bufs)
+   {
+   ((void (*)(int32_t, float *, const float *, const float *)) entry)(N, bufs.fout, bufs.x, bufs.y);
+   return (int64_t) bufs.fout[N / 3];
+   }
+
+int64_t runDistance(void * entry, Buffers &bufs)
+   {
+   ((void (*)(int32_t, float *, const float *, float)) entry)(N, bufs.fout, bufs.x, 12.5f);
+   return (int64_t) bufs.fout[7];
+   }
+
+int64_t runCopy(void * entry, Buffers &bufs)
+   {
+   ((void (*)(int32_t, int32_t *, const int32_t *)) entry)(N, bufs.iout, bufs.a);
+   return bufs.iout[N - 1];
+   }
+
+int64_t runClear(void * entry, Buffers &bufs)
+   {
+   ((void (*)(int32_t, int32_t *)) entry)(N, bufs.iout);
+   return bufs.iout[N - 1];
+   }
+
+struct Kernel
+   {
+   const char * name;
+   void * native;
+   KernelRunner run;
+   };
+
+Kernel kernels[] =
+   {
+   { "saxpy", (void *) &saxpy, runSaxpy },
+   { "dot", (void *) &dot, runDot },
+   { "sum", (void *) &sum, runSum },
+   { "maximum", (void *) &maximum, runMaximum },
+   { "clamp", (void *) &clamp, runClamp },
+   { "magnitude", (void *) &magnitude, runMagnitude },
+   { "distance", (void *) &distance, runDistance },
+   { "copy", (void *) &copy, runCopy },
+   { "clear", (void *) &clear, runClear },
+   };
+
+/* returns the average time of one call in nanoseconds */
+double timeKernel(Kernel &kernel, void * entry, Buffers &bufs, int32_t iterations, int64_t &result)
+   {
+   bufs.reset();
+   result = kernel.run(entry, bufs); // warm up, and the result compared between the two compilers
+   auto start = std::chrono::steady_clock::now();
+   for (int32_t i = 0; i < iterations; i++)
+      kernel.run(entry, bufs);
+   auto end = std::chrono::steady_clock::now();
+   return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+   }
+
+} // anonymous namespace
+
+int main(int argc, char * argv[])
+   {
+   if (argc != 2 && argc != 3)
+      {
+      std::cerr << "Usage: " << argv[0] << " <vector_kernels.ll> [iterations]" << std::endl;
+      exit(EXIT_FAILURE);
+      }
+   int32_t iterations = argc == 3 ? atoi(argv[2]) : 10000;
+
+   if (!initializeJit())
+      {
+      std::cerr << "Failed to initialize JIT" << std::endl;
+      exit(EXIT_FAILURE);
+      }
+
+   llvm::LLVMContext context;
+   llvm::SMDiagnostic SMDiags;
+   lljb::Module module(argv[1], SMDiags, context);
+   lljb::Compiler compiler(&module);
+   compiler.compile();
+
+   static Buffers bufs;
+   int32_t mismatches = 0;
+   std::cout << std::left << std::setw(12) << "kernel"
+             << std::right << std::setw(16) << "clang -O2 (ns)"
+             << std::setw(16) << "lljb (ns)"
+             << std::setw(10) << "ratio" << std::endl;
+   for (Kernel &kernel : kernels)
+      {
+      llvm::Function * function = module.getLLVMModule()->getFunction(kernel.name);
+      if (!function)
+         {
+         std::cerr << "kernel " << kernel.name << " not found in " << argv[1] << std::endl;
+         exit(EXIT_FAILURE);
+         }
+      void * jitted = compiler.getFunctionAddress(function);
+
+      int64_t nativeResult, jittedResult;
+      double nativeTime = timeKernel(kernel, kernel.native, bufs, iterations, nativeResult);
+      double jittedTime = timeKernel(kernel, jitted, bufs, iterations, jittedResult);
+      std::cout << std::left << std::setw(12) << kernel.name
+                << std::right << std::fixed << std::setprecision(1)
+                << std::setw(16) << nativeTime
+                << std::setw(16) << jittedTime
+                << std::setw(10) << std::setprecision(2) << jittedTime / nativeTime;
+      if (nativeResult != jittedResult)
+         {
+         std::cout << "  MISMATCH (" << nativeResult << " vs " << jittedResult << ")";
+         mismatches++;
+         }
+      std::cout << std::endl;
+      }
+
+   shutdownJit();
+
+   return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+   }
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "vector_kernels.hpp"
+
+#include <cmath>
+
+VECTOR_KERNEL void saxpy(int32_t n, float a, const float * __restrict x, float * __restrict y)
+   {
+   for (int32_t i = 0; i < n; i++)
+      y[i] = a * x[i] + y[i];
+   }
+
+VECTOR_KERNEL int32_t dot(int32_t n, const int32_t * __restrict a, const int32_t * __restrict b)
+   {
+   int32_t result = 0;
+   for (int32_t i = 0; i < n; i++)
+      result += a[i] * b[i];
+   return result;
+   }
+
+VECTOR_KERNEL int32_t sum(int32_t n, const int32_t * a)
+   {
+   int32_t result = 0;
+   for (int32_t i = 0; i < n; i++)
+      result += a[i];
+   return result;
+   }
+
+VECTOR_KERNEL int32_t maximum(int32_t n, const int32_t * a)
+   {
+   int32_t result = INT32_MIN;
+   for (int32_t i = 0; i < n; i++)
+      result = a[i] > result ? a[i] : result;
+   return result;
+   }
+
+VECTOR_KERNEL void clamp(int32_t n, int32_t * __restrict dst, const int32_t * __restrict src, int32_t lo, int32_t hi)
+   {
+   for (int32_t i = 0; i < n; i++)
+      {
+      int32_t value = src[i] < lo ? lo : src[i];
+      dst[i] = value > hi ? hi : value;
+      }
+   }
+
+VECTOR_KERNEL void magnitude(int32_t n, float * __restrict dst, const float * __restrict x, const float * __restrict y)
+   {
+   for (int32_t i = 0; i < n; i++)
+      dst[i] = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+   }
+
+VECTOR_KERNEL void distance(int32_t n, float * __restrict dst, const float * __restrict x, float c)
+   {
+   for (int32_t i = 0; i < n; i++)
+      dst[i] = std::fabs(x[i] - c);
+   }
+
+VECTOR_KERNEL void copy(int32_t n, int32_t * __restrict dst, const int32_t * __restrict src)
+   {
+   for (int32_t i = 0; i < n; i++) // becomes llvm.memcpy
+      dst[i] = src[i];
+   }
+
+VECTOR_KERNEL void clear(int32_t n, int32_t * dst)
+   {
+   for (int32_t i = 0; i < n; i++) // becomes llvm.memset
+      dst[i] = 0;
+   }
+
+#if !defined(LLJB_NATIVE_KERNELS)
+/*
+ * Checks every kernel against a scalar loop and returns the number of
+ * mismatches. The reference loops are kept scalar so they do not go through
+ * the same vector lowering as the kernels they check.
+ */
+int main()
+   {
+   const int32_t n = 1003; // not a multiple of any vector length, so the remainder loops run too
+   float x[n], y[n], fout[n];
+   int32_t a[n], b[n], iout[n];
+   int32_t errors = 0;
+
+   #pragma clang loop vectorize(disable) interleave(disable)
+   for (int32_t i = 0; i < n; i++)
+      {
+      x[i] = (float) i * 0.5f;
+      y[i] = (float) (n - i);
+      a[i] = i % 17 - 8;
+      b[i] = 3 - i % 5;
+      }
+
+   saxpy(n, 2.0f, x, y);
+   #pragma clang loop vectorize(disable) interleave(disable)
+   for (int32_t i = 0; i < n; i++)
+      if (y[i] != (float) n) errors++;
+
+   int32_t expectedDot = 0, expectedSum = 0, expectedMax = INT32_MIN;
+   #pragma clang loop vectorize(disable) interleave(disable)
+   for (int32_t i = 0; i < n; i++)
+      {
+      expectedDot += a[i] * b[i];
+      expectedSum += a[i];
+      if (a[i] * b[i] > expectedMax) expectedMax = a[i] * b[i];
+      iout[i] = a[i] * b[i];
+      }
+   if (dot(n, a, b) != expectedDot) errors++;
+   if (sum(n, a) != expectedSum) errors++;
+   if (maximum(n, iout) != expectedMax) errors++;
+
+   clamp(n, iout, a, -3, 5);
+   #pragma clang loop vectorize(disable) interleave(disable)
+   for (int32_t i = 0; i < n; i++)
+      if (iout[i] != (a[i] < -3 ? -3 : (a[i] > 5 ? 5 : a[i]))) errors++;
+
+   magnitude(n, fout, x, x);
+   #pragma clang loop vectorize(disable) interleave(disable)
+   for (int32_t i = 0; i < n; i++)
+      if (fout[i] != std::sqrt(2.0f * x[i] * x[i])) errors++;
+
+   distance(n, fout, x, 100.0f);
+   #pragma clang loop vectorize(disable) interleave(disable)
+   for (int32_t i = 0; i < n; i++)
+      if (fout[i] != std::fabs(x[i] - 100.0f)) errors++;
+
+   copy(n, iout, b);
+   #pragma clang loop vectorize(disable) interleave(disable)
+   for (int32_t i = 0; i < n; i++)
+      if (iout[i] != b[i]) errors++;
+
+   clear(n - 1, iout);
+   #pragma clang loop vectorize(disable) interleave(disable)
+   for (int32_t i = 0; i < n - 1; i++)
+      if (iout[i] != 0) errors++;
+   if (iout[n - 1] != b[n - 1]) errors++;
+
+   return errors;
+   }
+#endif /* !defined(LLJB_NATIVE_KERNELS) */
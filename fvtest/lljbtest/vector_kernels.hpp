@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef LLJB_VECTOR_KERNELS_HPP
+#define LLJB_VECTOR_KERNELS_HPP
+
+#include <cstdint>
+
+/*
+ * Numeric kernels that clang -O2 auto-vectorizes for baseline x86-64. They are
+ * compiled both to LLVM IR for LLJB and natively, so lljb_bench can compare
+ * the two. noinline keeps the calls from main intact at -O2.
+ */
+#define VECTOR_KERNEL extern "C" __attribute__((noinline))
+
+VECTOR_KERNEL void saxpy(int32_t n, float a, const float * __restrict x, float * __restrict y);
+VECTOR_KERNEL int32_t dot(int32_t n, const int32_t * __restrict a, const int32_t * __restrict b);
+VECTOR_KERNEL int32_t sum(int32_t n, const int32_t * a);
+VECTOR_KERNEL int32_t maximum(int32_t n, const int32_t * a);
+VECTOR_KERNEL void clamp(int32_t n, int32_t * __restrict dst, const int32_t * __restrict src, int32_t lo, int32_t hi);
+VECTOR_KERNEL void magnitude(int32_t n, float * __restrict dst, const float * __restrict x, const float * __restrict y);
+VECTOR_KERNEL void distance(int32_t n, float * __restrict dst, const float * __restrict x, float c);
+VECTOR_KERNEL void copy(int32_t n, int32_t * __restrict dst, const int32_t * __restrict src);
+VECTOR_KERNEL void clear(int32_t n, int32_t * dst);
+
+#endif /* LLJB_VECTOR_KERNELS_HPP */
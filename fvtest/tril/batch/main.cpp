@@ -0,0 +1,502 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * trilbatch compiles a library of methods ahead of deployment. It takes
+ * directories (searched recursively) and files of two kinds:
+ *
+ *   - .tril files, every method of which is compiled
+ *   - .jbil files, binary JitBuilder recordings written by a
+ *     TR::JitBuilderRecorderBinaryFile, which are replayed through a
+ *     TR::MethodBuilderReplay and compiled
+ *
+ * The methods are compiled in parallel by a pool of threads, each of which
+ * runs one compilation, with its own TR::Compilation, at a time. With
+ * --output, relocatable ELF generation is enabled and the compiled bodies,
+ * together with the relocations they need, are written to a relocatable
+ * object by TR::ELFRelocatableGenerator when the JIT shuts down.
+ *
+ * Every method is reported with its compile time or the reason it failed, as
+ * text on standard output and, with --report, as JSON. Trees that Tril's IL
+ * generator cannot handle are rejected before compilation, so one bad method
+ * does not take down the batch.
+ */
+
+#include "default_compiler.hpp"
+#include "ilgen.hpp"
+#include "control/SimpleJit.hpp"
+#include "ilgen/JitBuilderReplayBinaryBuffer.hpp"
+#include "ilgen/MethodBuilderReplay.hpp"
+#include "ilgen/TypeDictionary.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+    int32_t threads;
+    const char *output;
+    const char *report;
+    const char *jitOptions;
+    std::vector<const char *> paths;
+
+    Options()
+        : threads(0)
+        , output(NULL)
+        , report(NULL)
+        , jitOptions(NULL)
+    {}
+};
+
+// One method to compile: a method of a parsed Tril file or a recording
+//
+struct Job {
+    std::string file;
+    std::string method;
+    const ASTNode *trees;
+    std::vector<uint8_t> recording;
+
+    // results, written only by the thread that compiles the job
+    int32_t rc;
+    const char *error;
+    double compileTimeMs;
+    void *entry;
+};
+
+bool endsWith(const std::string &text, const char *suffix)
+{
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+bool readFile(const std::string &fileName, std::string &contents)
+{
+    FILE *file = fopen(fileName.c_str(), "rb");
+    if (file == NULL)
+        return false;
+
+    char buffer[4096];
+    size_t length;
+    while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        contents.append(buffer, length);
+    fclose(file);
+    return true;
+}
+
+// Collects the .tril and .jbil files below path, sorted by name so the order
+// of the report does not depend on the file system
+//
+void findInputs(const std::string &path, std::vector<std::string> &inputs)
+{
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0 || !S_ISDIR(info.st_mode)) {
+        inputs.push_back(path);
+        return;
+    }
+
+    DIR *dir = opendir(path.c_str());
+    if (dir == NULL)
+        return;
+
+    std::vector<std::string> entries;
+    for (struct dirent *entry = readdir(dir); entry != NULL; entry = readdir(dir)) {
+        if (entry->d_name[0] != '.')
+            entries.push_back(entry->d_name);
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end());
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        std::string child = path + "/" + entries[i];
+        if (stat(child.c_str(), &info) == 0 && S_ISDIR(info.st_mode))
+            findInputs(child, inputs);
+        else if (endsWith(child, ".tril") || endsWith(child, ".jbil"))
+            inputs.push_back(child);
+    }
+}
+
+bool hasValueOfType(const ASTNode *tree, const char *argName, ASTValue::ASTType type)
+{
+    const ASTNodeArg *arg = tree->getArgByName(argName);
+    return arg == NULL || (arg->getValue() != NULL && arg->getValue()->getType() == type);
+}
+
+// Tril's IL generator asserts on values of the wrong kind and does not check
+// names, so check a tree the way ILGen will walk it: each node before its
+// children, blocks and trees in order. Returns why the tree cannot be
+// compiled, or NULL.
+//
+const char *checkTree(const ASTNode *tree, int32_t numArgs, const std::set<std::string> &blocks,
+    std::set<std::string> &temps)
+{
+    const char *name = tree->getName();
+    if (strcmp(name, "@id") == 0 || strcmp(name, "@common") == 0) {
+        const ASTNodeArg *id = strcmp(name, "@id") == 0 ? tree->getPositionalArg(0) : tree->getArgByName("id");
+        if (id == NULL || id->getValue() == NULL || id->getValue()->getType() != ASTValue::String)
+            return "node reference without an id";
+        return NULL;
+    }
+
+    // The name lookup also fills Tril's opcode cache, which is not thread
+    // safe, before the compilation threads start
+    TR::ILOpCodes opcodeValue = Tril::OpCodeTable::getOpCodeFromName(name);
+    if (opcodeValue == TR::BadILOp)
+        return "unknown opcode";
+    Tril::OpCodeTable opcode(opcodeValue);
+
+    if (!hasValueOfType(tree, "parm", ASTValue::Integer) || !hasValueOfType(tree, "offset", ASTValue::Integer)
+        || !hasValueOfType(tree, "value", ASTValue::Integer) || !hasValueOfType(tree, "address", ASTValue::Integer))
+        return "parm, offset, value or address is not an integer (unresolved placeholder?)";
+
+    if (!hasValueOfType(tree, "temp", ASTValue::String) || !hasValueOfType(tree, "target", ASTValue::String)
+        || !hasValueOfType(tree, "id", ASTValue::String) || !hasValueOfType(tree, "linkage", ASTValue::String))
+        return "temp, target, id or linkage is not a string";
+
+    if (opcode.isLoadConst()) {
+        const ASTNodeArg *value = tree->getPositionalArg(0);
+        ASTValue::ASTType type = opcode.isIntegerOrAddress() ? ASTValue::Integer : ASTValue::FloatingPoint;
+        if (value == NULL || value->getValue() == NULL || value->getValue()->getType() != type)
+            return "constant of the wrong kind";
+    }
+
+    const ASTNodeArg *parm = tree->getArgByName("parm");
+    if (parm && (parm->getValue()->getInteger() < 0 || parm->getValue()->getInteger() >= numArgs))
+        return "parameter out of range";
+
+    const ASTNodeArg *temp = tree->getArgByName("temp");
+    if (temp && opcode.isStoreDirect())
+        temps.insert(temp->getValue()->getString());
+    else if (temp && opcode.isLoadDirect() && temps.count(temp->getValue()->getString()) == 0)
+        return "load of a temp that is not stored first";
+
+    const ASTNodeArg *target = tree->getArgByName("target");
+    if (target && opcode.isBranch() && blocks.count(target->getValue()->getString()) == 0)
+        return "branch to an unknown block";
+
+    if (opcode.isCall()) {
+        if (tree->getArgByName("address") == NULL)
+            return "call without an address";
+        for (const ASTValue *type = tree->getArgByName("args") ? tree->getArgByName("args")->getValue() : NULL; type;
+             type = type->next) {
+            if (type->getType() != ASTValue::String)
+                return "call argument type is not a string";
+        }
+        Tril::parseArgTypes(tree);
+    }
+
+    for (const ASTNode *child = tree->getChildren(); child != NULL; child = child->next) {
+        const char *error = checkTree(child, numArgs, blocks, temps);
+        if (error)
+            return error;
+    }
+    return NULL;
+}
+
+// Returns why a method cannot be compiled, or NULL. Unknown type names are
+// reported by Tril with a std::runtime_error.
+//
+const char *checkMethod(const ASTNode *method)
+{
+    if (strcmp(method->getName(), "method") != 0)
+        return "not a method";
+    if (!hasValueOfType(method, "return", ASTValue::String) || method->getArgByName("return") == NULL
+        || !hasValueOfType(method, "name", ASTValue::String))
+        return "method without a return type";
+    for (const ASTValue *type = method->getArgByName("args") ? method->getArgByName("args")->getValue() : NULL; type;
+         type = type->next) {
+        if (type->getType() != ASTValue::String)
+            return "method argument type is not a string";
+    }
+
+    int32_t numArgs = static_cast<int32_t>(Tril::parseArgTypes(method).size());
+    Tril::getTRDataTypes(method->getArgByName("return")->getValue()->getString());
+
+    std::set<std::string> blocks;
+    for (const ASTNode *block = method->getChildren(); block != NULL; block = block->next) {
+        if (strcmp(block->getName(), "block") != 0)
+            return "method contains something other than blocks";
+        if (!hasValueOfType(block, "name", ASTValue::String))
+            return "block name is not a string";
+        if (block->getArgByName("name"))
+            blocks.insert(block->getArgByName("name")->getValue()->getString());
+    }
+
+    std::set<std::string> temps;
+    for (const ASTNode *block = method->getChildren(); block != NULL; block = block->next) {
+        for (const ASTNode *tree = block->getChildren(); tree != NULL; tree = tree->next) {
+            const char *error = checkTree(tree, numArgs, blocks, temps);
+            if (error)
+                return error;
+        }
+    }
+    return NULL;
+}
+
+// Turns every input into jobs. The Tril parser is not reentrant, so this runs
+// before any compilation thread starts.
+//
+void createJobs(const std::vector<std::string> &inputs, std::vector<Job> &jobs)
+{
+    for (size_t i = 0; i < inputs.size(); i++) {
+        Job job;
+        job.file = inputs[i];
+        job.trees = NULL;
+        job.rc = 0;
+        job.error = NULL;
+        job.compileTimeMs = 0;
+        job.entry = NULL;
+
+        std::string contents;
+        if (!readFile(inputs[i], contents)) {
+            job.error = "could not read file";
+        } else if (endsWith(inputs[i], ".jbil")) {
+            job.recording.assign(contents.begin(), contents.end());
+            if (job.recording.empty())
+                job.error = "empty recording";
+        } else {
+            const ASTNode *trees = parseString(contents.c_str());
+            if (trees == NULL)
+                job.error = "parse error";
+
+            int32_t index = 0;
+            for (const ASTNode *method = trees; method != NULL; method = method->next, index++) {
+                const ASTNodeArg *name = method->getArgByName("name");
+                bool hasName = name && name->getValue() && name->getValue()->getType() == ASTValue::String;
+                job.method = hasName ? name->getValue()->getString() : "method" + std::to_string(index);
+                job.trees = method;
+                try {
+                    job.error = checkMethod(method);
+                } catch (const std::runtime_error &) {
+                    job.error = "unknown type name";
+                }
+                jobs.push_back(job);
+            }
+            if (trees != NULL)
+                continue;
+        }
+        jobs.push_back(job);
+    }
+}
+
+void compileJob(Job &job)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (job.trees != NULL) {
+        Tril::DefaultCompiler compiler(job.trees);
+        job.rc = compiler.compile();
+        job.entry = reinterpret_cast<void *>(compiler.getEntryPoint<void (*)()>());
+    } else {
+        TR::JitBuilderReplayBinaryBuffer replay(&job.recording[0], job.recording.size());
+        TR::TypeDictionary types;
+        TR::MethodBuilderReplay method(&types, &replay);
+        if (replay.failed()) {
+            job.error = "unreadable recording";
+            return;
+        }
+        job.method = method.GetMethodName();
+        job.rc = method.Compile(&job.entry);
+        if (job.rc == 0 && replay.failed())
+            job.error = "incomplete recording";
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    job.compileTimeMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    if (job.error == NULL && (job.rc != 0 || job.entry == NULL))
+        job.error = "compilation failed";
+}
+
+// Compiles the jobs on numThreads threads, each taking the next job that is
+// not yet compiled until none is left
+//
+void compileJobs(std::vector<Job> &jobs, int32_t numThreads)
+{
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> threads;
+    for (int32_t t = 0; t < numThreads; t++) {
+        threads.push_back(std::thread([&jobs, &next]() {
+            for (size_t i = next++; i < jobs.size(); i = next++) {
+                if (jobs[i].error == NULL)
+                    compileJob(jobs[i]);
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++)
+        threads[t].join();
+}
+
+std::string jsonString(const std::string &text)
+{
+    std::string out = "\"";
+    for (size_t i = 0; i < text.size(); i++) {
+        char c = text[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((unsigned char)c < 0x20) {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", c);
+            out += escape;
+        } else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+bool writeReport(const char *fileName, const Options &options, int32_t numThreads, const std::vector<Job> &jobs,
+    double wallTimeMs)
+{
+    FILE *out = fopen(fileName, "w");
+    if (out == NULL)
+        return false;
+
+    fprintf(out, "{\n  \"schema\": 1,\n  \"threads\": %d,\n  \"wallTimeMs\": %.3f,\n", numThreads, wallTimeMs);
+    fprintf(out, "  \"object\": %s,\n", options.output ? jsonString(options.output).c_str() : "null");
+    fprintf(out, "  \"methods\": [");
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const Job &job = jobs[i];
+        fprintf(out, "%s{ \"file\": %s, \"method\": %s, \"compileTimeMs\": %.3f", i ? ",\n    " : "\n    ",
+            jsonString(job.file).c_str(), jsonString(job.method).c_str(), job.compileTimeMs);
+        if (job.error)
+            fprintf(out, ", \"rc\": %d, \"error\": %s", job.rc, jsonString(job.error).c_str());
+        fprintf(out, " }");
+    }
+    fprintf(out, "\n  ]\n}\n");
+    fclose(out);
+    return true;
+}
+
+bool parseOptions(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (strncmp(arg, "--threads=", 10) == 0) {
+            options.threads = atoi(arg + 10);
+            if (options.threads <= 0)
+                return false;
+        } else if (strncmp(arg, "--output=", 9) == 0) {
+            options.output = arg + 9;
+        } else if (strncmp(arg, "--report=", 9) == 0) {
+            options.report = arg + 9;
+        } else if (strncmp(arg, "--jit-options=", 14) == 0) {
+            options.jitOptions = arg + 14;
+        } else if (arg[0] == '-') {
+            return false;
+        } else {
+            options.paths.push_back(arg);
+        }
+    }
+    return !options.paths.empty();
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        fprintf(stderr,
+            "usage: %s [--threads=N] [--output=file.o] [--report=file.json] [--jit-options=opt,...] dir|file...\n"
+            "  compiles every method of the .tril and .jbil files found in the given directories\n",
+            argv[0]);
+        return 1;
+    }
+
+    std::string jitOptions = "-Xjit:acceptHugeMethods";
+    if (options.output) {
+        remove(options.output);
+        jitOptions += std::string(",enableRelocatableELFGeneration,objectFile=") + options.output;
+    }
+    if (options.jitOptions)
+        jitOptions += std::string(",") + options.jitOptions;
+    if (!initializeSimpleJitWithOptions(const_cast<char *>(jitOptions.c_str()))) {
+        fprintf(stderr, "FAIL: could not initialize JIT\n");
+        return 2;
+    }
+
+    std::vector<std::string> inputs;
+    for (size_t p = 0; p < options.paths.size(); p++)
+        findInputs(options.paths[p], inputs);
+
+    std::vector<Job> jobs;
+    createJobs(inputs, jobs);
+
+    int32_t numThreads = options.threads;
+    if (numThreads == 0)
+        numThreads = std::max(1, (int32_t)std::thread::hardware_concurrency());
+    numThreads = std::max(1, std::min(numThreads, (int32_t)jobs.size()));
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    compileJobs(jobs, numThreads);
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    double wallTimeMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    int failures = 0;
+    double totalCompileTimeMs = 0;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const Job &job = jobs[i];
+        std::string name = job.method.empty() ? job.file : job.file + ":" + job.method;
+        totalCompileTimeMs += job.compileTimeMs;
+        if (job.error && job.rc != 0) {
+            failures++;
+            printf("FAIL %10.3f ms  %s  %s, rc=%d\n", job.compileTimeMs, name.c_str(), job.error, job.rc);
+        } else if (job.error) {
+            failures++;
+            printf("FAIL %10.3f ms  %s  %s\n", job.compileTimeMs, name.c_str(), job.error);
+        } else {
+            printf("OK   %10.3f ms  %s\n", job.compileTimeMs, name.c_str());
+        }
+    }
+    printf("%d of %d methods compiled on %d threads in %.3f ms (%.3f ms of compile time)\n",
+        (int)jobs.size() - failures, (int)jobs.size(), numThreads, wallTimeMs, totalCompileTimeMs);
+
+    if (options.report && !writeReport(options.report, options, numThreads, jobs, wallTimeMs)) {
+        fprintf(stderr, "could not open %s\n", options.report);
+        failures++;
+    }
+
+    // the object file is written as the code cache is torn down
+    shutdownSimpleJit();
+
+    if (options.output) {
+        struct stat info;
+        if (stat(options.output, &info) != 0) {
+            fprintf(stderr, "%s was not written\n", options.output);
+            failures++;
+        } else {
+            printf("wrote %s\n", options.output);
+        }
+    }
+    return failures ? 3 : 0;
+}
@@ -0,0 +1,401 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * trilbench compiles every method of each .tril file it is given a number of
+ * times, then runs the last compiled body under a timing loop, and writes the
+ * distributions as JSON for regression tracking.
+ *
+ * Compile time is wall-clock time around each compilation. Scratch memory is
+ * what the TR::RegionProfiler instances around the ilgen, optimizer and
+ * codegen phases record, read back through the static debug counters; perf
+ * profiles of each compile can additionally be taken with
+ * TR_Options=compileTimeProfiler (see TR::CompileTimeProfiler).
+ *
+ * Benchmark methods follow one convention, see corpus/loops.tril:
+ *
+ *     (method name="..." return="Int32|Int64|Double" args=["Address", "Int32"] ...)
+ *
+ * The first argument points to 2*n Int32 elements, the first n of which are
+ * read-only input and the last n scratch output; the second is n.
+ */
+
+#include "default_compiler.hpp"
+#include "control/SimpleJit.hpp"
+#include "env/FrontEnd.hpp"
+#include "env/PersistentInfo.hpp"
+#include "ras/DebugCounter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+extern "C" int32_t benchMix(int32_t acc, int32_t v) { return acc * 31 + v; }
+
+// Functions Tril code can call, spelled @name in the source
+//
+struct Helper {
+    const char *name;
+    void *address;
+} helpers[] = {
+    { "benchMix", reinterpret_cast<void *>(&benchMix) },
+};
+
+// The scratch-memory counters the region profilers bump for each phase
+//
+const char *memoryCounterPrefixes[] = {
+    "kbytesAllocated.details/comp/",
+    "segmentAllocation.details/comp/",
+};
+
+struct Options {
+    int32_t compiles;
+    int32_t samples;
+    int32_t iterations;
+    int32_t size;
+    const char *output;
+    std::vector<const char *> files;
+
+    Options()
+        : compiles(20)
+        , samples(15)
+        , iterations(50)
+        , size(4096)
+        , output(NULL)
+    {}
+};
+
+struct Summary {
+    size_t count;
+    double min;
+    double max;
+    double mean;
+    double median;
+    double p90;
+    double stddev;
+};
+
+Summary summarize(std::vector<double> values)
+{
+    Summary s = {};
+    s.count = values.size();
+    if (values.empty())
+        return s;
+
+    std::sort(values.begin(), values.end());
+    s.min = values.front();
+    s.max = values.back();
+
+    double sum = 0;
+    for (size_t i = 0; i < values.size(); i++)
+        sum += values[i];
+    s.mean = sum / values.size();
+
+    size_t mid = values.size() / 2;
+    s.median = values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2;
+    s.p90 = values[std::min(values.size() - 1, (size_t)std::ceil(0.9 * values.size()) - 1)];
+
+    double squares = 0;
+    for (size_t i = 0; i < values.size(); i++)
+        squares += (values[i] - s.mean) * (values[i] - s.mean);
+    s.stddev = values.size() > 1 ? std::sqrt(squares / (values.size() - 1)) : 0;
+    return s;
+}
+
+std::string jsonString(const std::string &text)
+{
+    std::string out = "\"";
+    for (size_t i = 0; i < text.size(); i++) {
+        char c = text[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((unsigned char)c < 0x20) {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", c);
+            out += escape;
+        } else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+std::string jsonSummary(const Summary &s)
+{
+    char text[256];
+    snprintf(text, sizeof(text),
+        "{ \"count\": %zu, \"min\": %.3f, \"median\": %.3f, \"mean\": %.3f, \"p90\": %.3f, \"max\": %.3f, "
+        "\"stddev\": %.3f }",
+        s.count, s.min, s.median, s.mean, s.p90, s.max, s.stddev);
+    return text;
+}
+
+std::map<std::string, int64_t> memoryCounters()
+{
+    TR::DebugCounterGroup *counters = TR::FrontEnd::instance()->getPersistentInfo()->getStaticCounters();
+    uint32_t numCounters = counters->snapshot(NULL, NULL, 0);
+    std::vector<const char *> names(numCounters + 16);
+    std::vector<int64_t> counts(numCounters + 16);
+    numCounters = std::min(counters->snapshot(&names[0], &counts[0], (uint32_t)names.size()), (uint32_t)names.size());
+
+    std::map<std::string, int64_t> result;
+    for (uint32_t i = 0; i < numCounters; i++) {
+        for (size_t p = 0; p < sizeof(memoryCounterPrefixes) / sizeof(memoryCounterPrefixes[0]); p++) {
+            if (strncmp(names[i], memoryCounterPrefixes[p], strlen(memoryCounterPrefixes[p])) == 0)
+                result[names[i]] = counts[i];
+        }
+    }
+    return result;
+}
+
+bool readSource(const char *fileName, std::string &source)
+{
+    FILE *file = fopen(fileName, "r");
+    if (file == NULL)
+        return false;
+
+    char buffer[4096];
+    size_t length;
+    while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        source.append(buffer, length);
+    fclose(file);
+
+    for (size_t h = 0; h < sizeof(helpers) / sizeof(helpers[0]); h++) {
+        std::string token = std::string("@") + helpers[h].name;
+        char address[32];
+        snprintf(address, sizeof(address), "0x%jX", (uintmax_t)(uintptr_t)helpers[h].address);
+        for (size_t at = source.find(token); at != std::string::npos; at = source.find(token, at))
+            source.replace(at, token.size(), address);
+    }
+    return true;
+}
+
+std::string formatResult(int32_t value) { return std::to_string(value); }
+
+std::string formatResult(int64_t value) { return std::to_string((long long)value); }
+
+std::string formatResult(double value)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "%.17g", value);
+    return text;
+}
+
+// Runs the kernel in samples of options.iterations calls after one warm-up
+// call, which also provides the checksum. Returns whether every call agreed.
+//
+template <typename T>
+bool timeKernel(const Options &options, void *entry, std::vector<int32_t> &data, std::vector<double> &callTimes,
+    std::string &checksum)
+{
+    T (*kernel)(int32_t *, int32_t) = reinterpret_cast<T (*)(int32_t *, int32_t)>(entry);
+    T expected = kernel(&data[0], options.size);
+    checksum = formatResult(expected);
+
+    bool deterministic = true;
+    for (int32_t s = 0; s < options.samples; s++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < options.iterations; i++)
+            deterministic &= kernel(&data[0], options.size) == expected;
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        callTimes.push_back(std::chrono::duration<double, std::nano>(end - start).count() / options.iterations);
+    }
+    return deterministic;
+}
+
+// Compiles and times one method, returning its JSON object
+//
+std::string runBenchmark(const Options &options, const char *fileName, const ASTNode *method, int32_t index)
+{
+    Tril::MethodInfo info(method);
+    std::string name = info.getName().empty() ? "method" + std::to_string(index) : info.getName();
+    std::string json = "{ \"file\": " + jsonString(fileName) + ", \"method\": " + jsonString(name);
+
+    const std::vector<TR::DataTypes> &args = info.getArgTypes();
+    TR::DataTypes returnType = info.getReturnType();
+    if (args.size() != 2 || args[0] != TR::Address || args[1] != TR::Int32
+        || (returnType != TR::Int32 && returnType != TR::Int64 && returnType != TR::Double)) {
+        fprintf(stderr, "%s: %s does not follow the benchmark calling convention\n", fileName, name.c_str());
+        return json + ", \"error\": \"unsupported signature\" }";
+    }
+
+    // Compile
+    //
+    std::vector<double> compileTimes;
+    std::map<std::string, std::vector<double> > memory;
+    void *entry = NULL;
+    for (int32_t c = 0; c < options.compiles; c++) {
+        std::map<std::string, int64_t> before = memoryCounters();
+
+        Tril::DefaultCompiler compiler(method);
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int32_t rc = compiler.compile();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        if (rc != 0) {
+            fprintf(stderr, "%s: %s failed to compile, rc=%d\n", fileName, name.c_str(), rc);
+            return json + ", \"error\": \"compilation failed\" }";
+        }
+
+        compileTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        entry = reinterpret_cast<void *>(compiler.getEntryPoint<int32_t (*)(int32_t *, int32_t)>());
+
+        std::map<std::string, int64_t> after = memoryCounters();
+        for (std::map<std::string, int64_t>::iterator it = after.begin(); it != after.end(); ++it)
+            memory[it->first].push_back((double)(it->second - before[it->first]));
+    }
+
+    // Execute
+    //
+    std::vector<int32_t> data(2 * (size_t)options.size);
+    uint32_t seed = 12345;
+    for (int32_t i = 0; i < options.size; i++) {
+        seed = seed * 1103515245 + 12345;
+        data[i] = (int32_t)(seed >> 8) & 0xffff;
+    }
+
+    std::vector<double> callTimes;
+    std::string checksum;
+    bool deterministic;
+    if (returnType == TR::Int32)
+        deterministic = timeKernel<int32_t>(options, entry, data, callTimes, checksum);
+    else if (returnType == TR::Int64)
+        deterministic = timeKernel<int64_t>(options, entry, data, callTimes, checksum);
+    else
+        deterministic = timeKernel<double>(options, entry, data, callTimes, checksum);
+
+    json += ", \"checksum\": " + jsonString(checksum);
+    json += ", \"deterministic\": ";
+    json += deterministic ? "true" : "false";
+    json += ",\n      \"compileTimeUs\": " + jsonSummary(summarize(compileTimes));
+    json += ",\n      \"executionNsPerCall\": " + jsonSummary(summarize(callTimes));
+    json += ",\n      \"scratchKB\": {";
+    for (std::map<std::string, std::vector<double> >::iterator it = memory.begin(); it != memory.end(); ++it) {
+        json += it == memory.begin() ? "\n        " : ",\n        ";
+        json += jsonString(it->first) + ": " + jsonSummary(summarize(it->second));
+    }
+    json += memory.empty() ? "}" : "\n      }";
+    return json + " }";
+}
+
+bool parseNumber(const char *arg, const char *option, int32_t &value)
+{
+    size_t length = strlen(option);
+    if (strncmp(arg, option, length) != 0)
+        return false;
+    value = atoi(arg + length);
+    return true;
+}
+
+bool parseOptions(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (parseNumber(arg, "--compiles=", options.compiles) || parseNumber(arg, "--samples=", options.samples)
+            || parseNumber(arg, "--iterations=", options.iterations) || parseNumber(arg, "--size=", options.size)) {
+            continue;
+        } else if (strncmp(arg, "--output=", 9) == 0) {
+            options.output = arg + 9;
+        } else if (arg[0] == '-') {
+            return false;
+        } else {
+            options.files.push_back(arg);
+        }
+    }
+
+    bool sizeIsPowerOfTwo = options.size >= 4 && (options.size & (options.size - 1)) == 0;
+    return !options.files.empty() && options.compiles > 0 && options.samples > 0 && options.iterations > 0
+        && sizeIsPowerOfTwo;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        fprintf(stderr,
+            "usage: %s [--compiles=N] [--samples=N] [--iterations=N] [--size=N] [--output=file.json] file.tril...\n"
+            "  --size must be a power of two, at least 4\n",
+            argv[0]);
+        return 1;
+    }
+
+    // Region profiling feeds the scratch memory numbers
+    //
+    if (!initializeSimpleJitWithOptions((char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,"
+                                                 "profileMemoryRegions,staticDebugCounters={*.details/comp/*}")) {
+        fprintf(stderr, "FAIL: could not initialize JIT\n");
+        return 2;
+    }
+
+    std::string json = "{\n  \"schema\": 1,\n";
+    char config[256];
+    snprintf(config, sizeof(config),
+        "  \"config\": { \"compiles\": %d, \"samples\": %d, \"iterations\": %d, \"size\": %d },\n", options.compiles,
+        options.samples, options.iterations, options.size);
+    json += config;
+    json += "  \"benchmarks\": [";
+
+    int failures = 0;
+    int32_t benchmarks = 0;
+    for (size_t f = 0; f < options.files.size(); f++) {
+        std::string source;
+        ASTNode *trees = readSource(options.files[f], source) ? parseString(source.c_str()) : NULL;
+        if (trees == NULL) {
+            fprintf(stderr, "%s: could not read or parse\n", options.files[f]);
+            failures++;
+            continue;
+        }
+
+        int32_t index = 0;
+        for (const ASTNode *method = trees; method != NULL; method = method->next, index++) {
+            std::string result = runBenchmark(options, options.files[f], method, index);
+            if (result.find("\"error\"") != std::string::npos)
+                failures++;
+            json += benchmarks++ ? ",\n    " : "\n    ";
+            json += result;
+        }
+    }
+    json += "\n  ]\n}\n";
+
+    FILE *out = options.output ? fopen(options.output, "w") : stdout;
+    if (out == NULL) {
+        fprintf(stderr, "could not open %s\n", options.output);
+        failures++;
+    } else {
+        fputs(json.c_str(), out);
+        if (out != stdout)
+            fclose(out);
+    }
+
+    shutdownSimpleJit();
+    return failures ? 3 : 0;
+}
@@ -56,3 +56,32 @@ TEST_F(CompileTest, NoCodeGen) {
 
     EXPECT_TRUE(verifier.hasRun());
 }
+
+TEST_F(CompileTest, LookupSwitch) {
+    auto trees = parseString(
+        "(method return=\"Int32\" args=[\"Int32\"]"
+        "  (block name=\"entry\""
+        "    (lookup (iload parm=0)"
+        "      (case target=\"other\")"
+        "      (case value=-5 target=\"minusFive\")"
+        "      (case value=1 target=\"one\")"
+        "      (case value=7 target=\"seven\")))"
+        "  (block name=\"minusFive\" (ireturn (iconst 50)))"
+        "  (block name=\"one\" (ireturn (iconst 10)))"
+        "  (block name=\"seven\" (ireturn (iconst 70)))"
+        "  (block name=\"other\" (ireturn (iconst 0))))");
+
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed";
+
+    auto entry = compiler.getEntryPoint<int32_t (*)(int32_t)>();
+    ASSERT_NOTNULL(entry) << "Entry point of compiled body cannot be null";
+    EXPECT_EQ(50, entry(-5));
+    EXPECT_EQ(10, entry(1));
+    EXPECT_EQ(70, entry(7));
+    EXPECT_EQ(0, entry(2));
+    EXPECT_EQ(0, entry(-1));
+}
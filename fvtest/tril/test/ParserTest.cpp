@@ -428,3 +428,21 @@ TEST(ParserTest, SingleNodeWithTwoNamedArgs) {
     ASSERT_EQ(2.71828, arg->getValue()->getFloatingPoint());
     ASSERT_EQ(reinterpret_cast<ASTNodeArg*>(NULL), arg->next);
 }
+
+class TruncatedInput : public ::testing::TestWithParam<const char *> {};
+
+TEST_P(TruncatedInput, ReturnsNull) {
+    ASSERT_EQ(reinterpret_cast<ASTNode*>(NULL), parseString(GetParam()));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    ParserTest,
+    TruncatedInput,
+    ::testing::Values(
+        "(nodeName",
+        "(nodeName arg",
+        "(nodeName arg=",
+        "(nodeName args=[1, 2",
+        "(nodeName (childNode)",
+        "(method garbage"
+));
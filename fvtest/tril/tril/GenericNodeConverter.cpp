@@ -168,6 +168,13 @@ TR::Node *GenericNodeConverter::impl(const ASTNode *tree, IlGenState *state)
         TraceIL("  is branch to target block %d (%s, entry = %p", targetId, targetName, targetEntry);
         node = TR::Node::create(opcode.getOpCodeValue(), childCount);
         node->setBranchDestination(targetEntry);
+
+        // Switch cases carry the selector value they match; the default case has none
+        if (opcode.getOpCodeValue() == TR::Case && tree->getArgByName("value")) {
+            const auto caseValue = tree->getArgByName("value")->getValue()->get<int32_t>();
+            TraceIL("  with case value %d", caseValue);
+            node->setCaseConstant(caseValue);
+        }
     } else {
         TraceIL("  unrecognized opcode; using default creation mechanism\n", "");
         node = TR::Node::create(opcode.getOpCodeValue(), childCount);
@@ -91,10 +91,11 @@ bool Tril::TRLangBuilder::cfgFor(const ASTNode * const tree, IlGenState *state)
 {
     auto isFallthroughNeeded = true;
 
-    // visit the children first
+    // visit the children first, all of them, since every case of a switch adds an edge
     const ASTNode *t = tree->getChildren();
     while (t) {
-        isFallthroughNeeded = isFallthroughNeeded && cfgFor(t, state);
+        const bool childNeedsFallthrough = cfgFor(t, state);
+        isFallthroughNeeded = isFallthroughNeeded && childNeedsFallthrough;
         t = t->next;
     }
 
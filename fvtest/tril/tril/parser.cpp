@@ -353,6 +353,8 @@ class TokenIter {
         Token peek() {
             auto temp = it;
             ++temp;
+            if (temp == end)
+                throw ParserFailure("Token stream ended unexpectedly");
             return *temp;
         }
         Token& operator * () { return *it; }
@@ -445,7 +447,7 @@ ASTValue* buildNodeValue(Token token) {
  */
 ASTValue* parseValueList(TokenIter &tokenIt) {
     ASTValue* currentValue = NULL;
-    while (tokenIt->getType() != Token::RPAREN_SQ) {
+    while (!tokenIt.isEnd() && tokenIt->getType() != Token::RPAREN_SQ) {
         if (currentValue == NULL && tokenIt->getType() != Token::COMMA) {
             currentValue = buildNodeValue(*tokenIt);
         } else if (currentValue && tokenIt->getType() != Token::COMMA) {
@@ -453,6 +455,9 @@ ASTValue* parseValueList(TokenIter &tokenIt) {
         }
         ++tokenIt; // consume the node value
     }
+    if (tokenIt.isEnd()) {
+        throw ParserFailure("Token stream ended unexpectedly in value list");
+    }
     return currentValue;
 }
 
@@ -469,13 +474,15 @@ ASTNodeArg* parseArgList(TokenIter &tokenIt) {
     ASTNodeArg* currentArg = NULL;
     ASTNodeArg* argList = NULL;
 
-    while (tokenIt->getType() != Token::LPAREN && tokenIt->getType() != Token::RPAREN) {
+    while (!tokenIt.isEnd() && tokenIt->getType() != Token::LPAREN && tokenIt->getType() != Token::RPAREN) {
         if (tokenIt->getType() == Token::ID && tokenIt.peek().getType() == Token::EQUALS) {
             char * node_args_name = new char[tokenIt->getValue().size() + 1];
             strcpy(node_args_name, tokenIt->getValue().c_str());
             ++tokenIt; // consume ID
             ++tokenIt; // consume EQUALS
-            if (tokenIt->getType() == Token::LPAREN_SQ) {
+            if (tokenIt.isEnd()) {
+                throw ParserFailure("Token stream ended unexpectedly after EQUALS");
+            } else if (tokenIt->getType() == Token::LPAREN_SQ) {
                 ++tokenIt; // consume LPAREN_SQ
                 currentArg = createNodeArg(node_args_name, parseValueList(tokenIt), NULL);
             } else {
@@ -525,7 +532,9 @@ ASTNode* buildAST(TokenIter &tokenIt) {
             argList = parseArgList(tokenIt);
         }
         childrenList = buildAST(tokenIt);
-        if (tokenIt.isEnd() || tokenIt->getType() != Token::RPAREN) {
+        if (tokenIt.isEnd()) {
+            throw ParserFailure("Missing RPAREN at the end of the token stream");
+        } else if (tokenIt->getType() != Token::RPAREN) {
             throw ParserFailure("Missing RPAREN, while current value is " + tokenIt->getValue());
         }
         ++tokenIt; // consume to be the end or RPAREN
@@ -551,9 +560,7 @@ ASTNode* parseFile(FILE *in) {
         fgets(temp, 100, in);
         result += temp;
     }
-    std::vector<Token> scanToken = scan(result);
-    TokenIter token = TokenIter(scanToken.begin(), scanToken.end());
-    return buildAST(token);
+    return parseString(result.c_str());
 }
 
 /* @brief Parse the string to build AST
@@ -562,8 +569,15 @@ ASTNode* parseFile(FILE *in) {
  * @return The root of the AST
  */
 ASTNode* parseString(const char* in) {
-    std::string in_str(in);
-    std::vector<Token> tokenLine = scan(in_str);
-    TokenIter token = TokenIter(tokenLine.begin(), tokenLine.end());
-    return buildAST(token);
+    try {
+        std::string in_str(in);
+        std::vector<Token> tokenLine = scan(in_str);
+        TokenIter token = TokenIter(tokenLine.begin(), tokenLine.end());
+        return buildAST(token);
+    } catch (const LexerFailure &failure) {
+        std::cerr << "Tril lexer error: " << failure.what() << std::endl;
+    } catch (const ParserFailure &failure) {
+        std::cerr << "Tril parser error: " << failure.what() << std::endl;
+    }
+    return NULL;
 }
@@ -66,7 +66,9 @@ int32_t Tril::SimpleCompiler::compileWithVerifier(TR::IlVerifier* verifier) {
     }
     // construct a `TR::ResolvedMethod` instance from the IL generator and use
     // to compile the method
-    TR::ResolvedMethod resolvedMethod("file", "line", "name",
+    // a named method keeps its name, so it can be told apart in logs and object files
+    const char *name = methodInfo.getName().empty() ? "name" : methodInfo.getName().c_str();
+    TR::ResolvedMethod resolvedMethod("file", "line", name,
                                       static_cast<int32_t>(argIlTypes.size()),
                                       argNames.size() != 0 ? &argNames[0] : NULL,
                                       argIlTypes.size() != 0 ? &argIlTypes[0] : NULL,
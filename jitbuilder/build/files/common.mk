@@ -115,10 +115,12 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/ras/ILValidationUtils.cpp \
     $(JIT_OMR_DIRTY_DIR)/ras/ILValidator.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/AsyncCheckInsertion.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/AllocationEscapeAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/BackwardBitVectorAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/BackwardIntersectionBitVectorAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/BackwardUnionBitVectorAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/BitVectorAnalysis.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/BlockFrequencyProfiler.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/CatchBlockRemover.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRCFGSimplifier.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/CompactLocals.cpp \
@@ -175,8 +177,11 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRRegisterCandidate.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/ReorderIndexExpr.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/SinkStores.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/SLPVectorizer.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/StripMiner.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/VPConstraint.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/InliningMethodSummary.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/abstractinterpreter/InliningMethodSummaryCache.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/VPHandlers.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/VPHandlersCommon.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRValuePropagation.cpp \
@@ -235,6 +240,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/runtime/Runtime.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/Trampoline.cpp \
     $(JIT_OMR_DIRTY_DIR)/control/CompileMethod.cpp \
+    $(JIT_OMR_DIRTY_DIR)/control/CompiledBodyCache.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/OMRIO.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/OMRKnownObjectTable.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/Globals.cpp \
@@ -247,7 +253,10 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderRecorderBinaryBuffer.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderRecorderBinaryFile.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderRecorderTextFile.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderReplay.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRJitBuilderReplayBinaryBuffer.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRMethodBuilder.cpp \
+    $(JIT_OMR_DIRTY_DIR)/ilgen/OMRMethodBuilderReplay.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRThunkBuilder.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRTypeDictionary.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRVirtualMachineOperandArray.cpp \
@@ -255,12 +264,14 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRVirtualMachineRegister.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRVirtualMachineRegisterInStruct.cpp \
     $(JIT_OMR_DIRTY_DIR)/ilgen/OMRVirtualMachineState.cpp \
+    $(JIT_OMR_DIRTY_DIR)/runtime/CodeCacheLayout.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/CodeCacheTypes.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCache.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheManager.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheMemorySegment.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRCodeCacheConfig.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/OMRRSSReport.cpp \
+    $(JIT_OMR_DIRTY_DIR)/runtime/PerfJitDump.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/OMRCompilerEnv.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/PersistentAllocator.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRSmallOptimizer.cpp \
@@ -269,9 +280,11 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
 CPP_GENERATED_SOURCE_DIR=$(JIT_PRODUCT_DIR)/client/cpp
 CPP_GENERATED_API_SOURCES+=\
     $(CPP_GENERATED_SOURCE_DIR)/BytecodeBuilder.cpp \
+    $(CPP_GENERATED_SOURCE_DIR)/Field.cpp \
     $(CPP_GENERATED_SOURCE_DIR)/IlBuilder.cpp \
     $(CPP_GENERATED_SOURCE_DIR)/IlType.cpp \
     $(CPP_GENERATED_SOURCE_DIR)/IlValue.cpp \
+    $(CPP_GENERATED_SOURCE_DIR)/LocalVariable.cpp \
     $(CPP_GENERATED_SOURCE_DIR)/MethodBuilder.cpp \
     $(CPP_GENERATED_SOURCE_DIR)/ThunkBuilder.cpp \
     $(CPP_GENERATED_SOURCE_DIR)/TypeDictionary.cpp \
@@ -285,9 +298,11 @@ CPP_GENERATED_API_SOURCES+=\
 CPP_GENERATED_HEADER_DIR=$(JIT_PRODUCT_DIR)/release/cpp/include
 CPP_GENERATED_API_HEADERS+=\
     $(CPP_GENERATED_HEADER_DIR)/BytecodeBuilder.hpp \
+    $(CPP_GENERATED_HEADER_DIR)/Field.hpp \
     $(CPP_GENERATED_HEADER_DIR)/IlBuilder.hpp \
     $(CPP_GENERATED_HEADER_DIR)/IlType.hpp \
     $(CPP_GENERATED_HEADER_DIR)/IlValue.hpp \
+    $(CPP_GENERATED_HEADER_DIR)/LocalVariable.hpp \
     $(CPP_GENERATED_HEADER_DIR)/MethodBuilder.hpp \
     $(CPP_GENERATED_HEADER_DIR)/ThunkBuilder.hpp \
     $(CPP_GENERATED_HEADER_DIR)/TypeDictionary.hpp \
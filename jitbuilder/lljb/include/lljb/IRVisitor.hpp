@@ -93,6 +93,31 @@ struct IRVisitor : public llvm::InstVisitor<IRVisitor>
    void visitPHINode(llvm::PHINode &I);
    void visitSelectInst(llvm::SelectInst &I);
 
+   /**
+    * Vector lane instructions map onto the JitBuilder vector services.
+    * Shuffles that broadcast one lane become VectorSplat, any other shuffle
+    * is done one lane at a time through local arrays.
+    */
+   void visitExtractElementInst(llvm::ExtractElementInst &I);
+   void visitInsertElementInst(llvm::InsertElementInst &I);
+   void visitShuffleVectorInst(llvm::ShuffleVectorInst &I);
+
+   /**
+    * visitMemTransferInst handles the following intrinsics:
+    * llvm.memcpy
+    * llvm.memmove
+    */
+   void visitMemTransferInst(llvm::MemTransferInst &I);
+   void visitMemSetInst(llvm::MemSetInst &I);
+   void visitDbgInfoIntrinsic(llvm::DbgInfoIntrinsic &I);
+
+   /**
+    * visitIntrinsicInst handles the math intrinsics (sqrt, fabs, minnum,
+    * maxnum, fmuladd and the integer min/max/abs intrinsics), the vector
+    * reduction intrinsics, and drops the lifetime and assume hints
+    */
+   void visitIntrinsicInst(llvm::IntrinsicInst &I);
+
 
    /************************************************************************
     * Unimplemented visitors
@@ -106,9 +131,6 @@ struct IRVisitor : public llvm::InstVisitor<IRVisitor>
    //void visitAtomicRMWInst(llvm::AtomicRMWInst &I);
    //void visitFenceInst(llvm::FenceInst   &I);
    //void visitVAArgInst(llvm::VAArgInst   &I);
-   //void visitExtractElementInst(llvm::ExtractElementInst &I);
-   //void visitInsertElementInst(llvm::InsertElementInst &I);
-   //void visitShuffleVectorInst(llvm::ShuffleVectorInst &I);
    //void visitExtractValueInst(llvm::ExtractValueInst &I);
    //void visitInsertValueInst(llvm::InsertValueInst &I);
    //void visitLandingPadInst(llvm::LandingPadInst &I);
@@ -119,16 +141,12 @@ struct IRVisitor : public llvm::InstVisitor<IRVisitor>
    //void visitDbgValueInst(llvm::DbgValueInst &I);
    //void visitDbgVariableIntrinsic(llvm::DbgVariableIntrinsic &I);
    //void visitDbgLabelInst(llvm::DbgLabelInst &I);
-   //void visitDbgInfoIntrinsic(llvm::DbgInfoIntrinsic &I);
-   //void visitMemSetInst(llvm::MemSetInst &I);
    //void visitMemCpyInst(llvm::MemCpyInst &I);
    //void visitMemMoveInst(llvm::MemMoveInst &I);
-   //void visitMemTransferInst(llvm::MemTransferInst &I);
    //void visitMemIntrinsic(llvm::MemIntrinsic &I);
    //void visitVAStartInst(llvm::VAStartInst &I);
    //void visitVAEndInst(llvm::VAEndInst &I);
    //void visitVACopyInst(llvm::VACopyInst &I);
-   //void visitIntrinsicInst(llvm::IntrinsicInst &I);
    //void visitInvokeInst(llvm::InvokeInst &I);
    //void visitSwitchInst(llvm::SwitchInst &I);
    //void visitIndirectBrInst(llvm::IndirectBrInst &I);
@@ -153,6 +171,20 @@ private:
    TR::IlValue * createConstFPIlValue(llvm::Value * value);
    TR::IlValue * createConstExprIlValue(llvm::Value * value);
    TR::IlValue * createConstantDataArrayVal(llvm::Value * value);
+   TR::IlValue * createConstVectorIlValue(llvm::Value * value);
+   TR::IlValue * createLaneIndex(llvm::Value * index);
+   TR::IlValue * spillVector(llvm::Value * vector);
+   TR::IlValue * createMinMaxFromSelect(llvm::SelectInst &I);
+   TR::IlValue * loadLocal(char * name, llvm::Type * type);
+   void storeLocal(char * name, llvm::Type * type, TR::IlValue * value);
+
+   /**
+    * @brief Store the values that flow along the edge into successor into the
+    * locals of the successor's phi nodes. All incoming values are evaluated
+    * before the first store so phi nodes that feed each other see the values
+    * from the previous iteration.
+    */
+   void storePhiValues(llvm::BasicBlock * predecessor, llvm::BasicBlock * successor);
    TR::IlValue * loadParameter(llvm::Value * value);
    TR::IlValue * loadGlobal(llvm::Value * value);
    TR::IlValue * getIlValue(llvm::Value * value);
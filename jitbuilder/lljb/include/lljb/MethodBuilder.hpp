@@ -65,6 +65,17 @@ public:
 
    static TR::IlType * getIlType(TR::TypeDictionary * td,llvm::Type * type);
 
+   /**
+    * @brief Map a 128-bit llvm vector type to the OMR vector type with the
+    * same lane type
+    */
+   static TR::IlType * getVectorIlType(TR::TypeDictionary * td, llvm::Type * type);
+
+   /**
+    * @brief Get the number of lanes in an llvm vector type
+    */
+   static unsigned getVectorLength(llvm::Type * type);
+
    virtual bool buildIL() override;
    TR::IlValue * getIlValue(llvm::Value * value);
    char * getParamNameFromIndex(unsigned index);
@@ -89,6 +100,7 @@ public:
 private:
 
    void assignBuildersToBasicBlocks();
+   void allocatePhiLocals();
    void defineParameters();
 
    /**
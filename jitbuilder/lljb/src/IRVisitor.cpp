@@ -25,11 +25,22 @@
 #include "ilgen/TypeDictionary.hpp"
 #include "ilgen/BytecodeBuilder.hpp"
 
+#include "llvm/Config/llvm-config.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/IntrinsicInst.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <cassert>
+#include <utility>
 #include <vector>
 
+// the vector reduction intrinsics lost their "experimental" prefix in LLVM 12
+#if LLVM_VERSION_MAJOR < 12
+#define LLJB_VECTOR_REDUCE(op) experimental_vector_reduce_##op
+#else
+#define LLJB_VECTOR_REDUCE(op) vector_reduce_##op
+#endif
+
 namespace lljb
 {
 
@@ -120,13 +131,22 @@ IRVisitor::visitLoadInst(llvm::LoadInst &I)
    TR::IlValue * loadedVal = nullptr;
    if (_methodBuilder->isIndirectLoadOrStore(source))
       {
-      loadedVal = _builder->LoadAt(
-                              _td->PointerTo(_methodBuilder->getIlType(_td,I.getType())),
-                              getIlValue(source));
+      if (I.getType()->isVectorTy())
+         {
+         loadedVal = _builder->VectorLoadAt(
+                                 _td->PointerTo(_methodBuilder->getIlType(_td,I.getType()->getScalarType())),
+                                 getIlValue(source));
+         }
+      else
+         {
+         loadedVal = _builder->LoadAt(
+                                 _td->PointerTo(_methodBuilder->getIlType(_td,I.getType())),
+                                 getIlValue(source));
+         }
       }
    else
       {
-      loadedVal = _builder->Load(_methodBuilder->getLocalNameFromValue(source));
+      loadedVal = loadLocal(_methodBuilder->getLocalNameFromValue(source), I.getType());
       }
    _methodBuilder->mapIRtoIlValue(&I, loadedVal);
    }
@@ -138,13 +158,22 @@ IRVisitor::visitStoreInst(llvm::StoreInst &I)
    llvm::Value * value = I.getOperand(0);
    if (_methodBuilder->isIndirectLoadOrStore(dest))
       {
-      _builder->StoreAt(
-               getIlValue(dest),
-               getIlValue(value));
+      if (value->getType()->isVectorTy())
+         {
+         _builder->VectorStoreAt(
+                  getIlValue(dest),
+                  getIlValue(value));
+         }
+      else
+         {
+         _builder->StoreAt(
+                  getIlValue(dest),
+                  getIlValue(value));
+         }
       }
    else
       {
-      _builder->Store(_methodBuilder->getLocalNameFromValue(dest), getIlValue(value));
+      storeLocal(_methodBuilder->getLocalNameFromValue(dest), value->getType(), getIlValue(value));
       }
    }
 
@@ -208,6 +237,11 @@ IRVisitor::visitBinaryOperator(llvm::BinaryOperator &I)
 void
 IRVisitor::visitCmpInst(llvm::CmpInst &I)
    {
+   // vector compares produce lane masks, which JitBuilder has no type for; the
+   // only use clang's vectorizer makes of them is in min/max selects, which
+   // visitSelectInst matches against the compare directly
+   if (I.getType()->isVectorTy()) return;
+
    TR::IlValue * lhs = getIlValue(I.getOperand(0));
    TR::IlValue * rhs = getIlValue(I.getOperand(1));
 
@@ -271,9 +305,10 @@ IRVisitor::visitBranchInst(llvm::BranchInst &I)
    {
    if (I.isUnconditional())
       {
-      llvm::Value * dest = I.getSuccessor(0);
+      llvm::BasicBlock * dest = I.getSuccessor(0);
       TR::BytecodeBuilder * destBuilder = _methodBuilder->getByteCodeBuilder(dest);
       assert(destBuilder && "failed to find builder for target basic block in unconditional branch");
+      storePhiValues(I.getParent(), dest);
       _builder->Goto(destBuilder);
       }
    else
@@ -282,6 +317,11 @@ IRVisitor::visitBranchInst(llvm::BranchInst &I)
       TR::BytecodeBuilder * ifTrue = _methodBuilder->getByteCodeBuilder(I.getSuccessor(0));
       TR::BytecodeBuilder * ifFalse = _methodBuilder->getByteCodeBuilder(I.getSuccessor(1));
       assert(ifTrue && ifFalse && condition && "Failed to find destination blocks for conditional branch");
+      // a phi local is only read by its own block, so storing the values for
+      // both edges before the branch is safe
+      storePhiValues(I.getParent(), I.getSuccessor(0));
+      if (I.getSuccessor(1) != I.getSuccessor(0))
+         storePhiValues(I.getParent(), I.getSuccessor(1));
       _builder->IfCmpNotEqualZero(&ifTrue, condition);
       _builder->Goto(&ifFalse);
       }
@@ -383,6 +423,14 @@ IRVisitor::visitGetElementPtrInst(llvm::GetElementPtrInst &I)
 void
 IRVisitor::visitPHINode(llvm::PHINode &I)
    {
+   if (!I.getType()->isIntegerTy(1))
+      {
+      // MethodBuilder::allocatePhiLocals gave this phi node a local, and every
+      // predecessor stores its incoming value into it before branching here
+      TR::IlValue * ilValue = loadLocal(_methodBuilder->getLocalNameFromValue(&I), I.getType());
+      _methodBuilder->mapIRtoIlValue(&I, ilValue);
+      return;
+      }
 
    // This initial implementation of PHINode visitor is capable of handling a
    // limited set of phi node variants, such as the phi nodes in the following
@@ -489,6 +537,12 @@ IRVisitor::visitPHINode(llvm::PHINode &I)
 void
 IRVisitor::visitSelectInst(llvm::SelectInst &I)
    {
+   if (I.getType()->isVectorTy())
+      {
+      _methodBuilder->mapIRtoIlValue(&I, createMinMaxFromSelect(I));
+      return;
+      }
+
    TR::IlValue * condition = getIlValue(I.getCondition());
    TR::IlValue * ifTrue = getIlValue(I.getTrueValue());
    TR::IlValue * ifFalse = getIlValue(I.getFalseValue());
@@ -496,6 +550,189 @@ IRVisitor::visitSelectInst(llvm::SelectInst &I)
    _methodBuilder->mapIRtoIlValue(&I, result);
    }
 
+void
+IRVisitor::visitExtractElementInst(llvm::ExtractElementInst &I)
+   {
+   TR::IlValue * result = _builder->VectorGetElement(
+                                       getIlValue(I.getVectorOperand()),
+                                       createLaneIndex(I.getIndexOperand()));
+   _methodBuilder->mapIRtoIlValue(&I, result);
+   }
+
+void
+IRVisitor::visitInsertElementInst(llvm::InsertElementInst &I)
+   {
+   TR::IlValue * result = _builder->VectorSetElement(
+                                       getIlValue(I.getOperand(0)),
+                                       createLaneIndex(I.getOperand(2)),
+                                       getIlValue(I.getOperand(1)));
+   _methodBuilder->mapIRtoIlValue(&I, result);
+   }
+
+void
+IRVisitor::visitShuffleVectorInst(llvm::ShuffleVectorInst &I)
+   {
+   TR::IlValue * result = nullptr;
+   int numLanes = MethodBuilder::getVectorLength(I.getType());
+   int numSourceLanes = MethodBuilder::getVectorLength(I.getOperand(0)->getType());
+
+   // clang broadcasts a scalar by inserting it into lane k of an undefined
+   // vector and then shuffling with a mask that selects lane k everywhere
+   int splatLane = -1;
+   bool isSplat = true;
+   for (int i = 0; i < numLanes; i++)
+      {
+      int maskValue = I.getMaskValue(i);
+      if (maskValue < 0) continue; // undefined lane
+      if (splatLane < 0) splatLane = maskValue;
+      else if (maskValue != splatLane) isSplat = false;
+      }
+
+   if (isSplat && splatLane >= 0)
+      {
+      llvm::Value * source = I.getOperand(splatLane < numSourceLanes ? 0 : 1);
+      int sourceLane = splatLane % numSourceLanes;
+      llvm::InsertElementInst * insert = llvm::dyn_cast<llvm::InsertElementInst>(source);
+      llvm::ConstantInt * insertIndex = insert ? llvm::dyn_cast<llvm::ConstantInt>(insert->getOperand(2)) : nullptr;
+      TR::IlValue * element = nullptr;
+      if (insertIndex && insertIndex->getZExtValue() == (uint64_t)sourceLane)
+         element = getIlValue(insert->getOperand(1));
+      else
+         element = _builder->VectorGetElement(getIlValue(source), _builder->ConstInt32(sourceLane));
+      result = _builder->VectorSplat(element);
+      }
+   else
+      {
+      // general shuffle: copy the selected lanes one at a time. Undefined
+      // lanes are left as whatever the result array holds.
+      TR::IlType * pLane = _td->PointerTo(_methodBuilder->getIlType(_td, I.getType()->getScalarType()));
+      TR::IlValue * sources[2] = { nullptr, nullptr };
+      TR::IlValue * resultLanes = _builder->CreateLocalArray(numLanes, _methodBuilder->getIlType(_td, I.getType()->getScalarType()));
+      for (int i = 0; i < numLanes; i++)
+         {
+         int maskValue = I.getMaskValue(i);
+         if (maskValue < 0) continue;
+         unsigned operand = maskValue < numSourceLanes ? 0 : 1;
+         if (!sources[operand])
+            sources[operand] = spillVector(I.getOperand(operand));
+         TR::IlValue * lane = _builder->LoadAt(pLane,
+                                 _builder->IndexAt(pLane,
+                                    sources[operand],
+                                    _builder->ConstInt32(maskValue % numSourceLanes)));
+         _builder->StoreAt(
+                     _builder->IndexAt(pLane, resultLanes, _builder->ConstInt32(i)),
+                     lane);
+         }
+      result = _builder->VectorLoadAt(pLane, resultLanes);
+      }
+   _methodBuilder->mapIRtoIlValue(&I, result);
+   }
+
+void
+IRVisitor::visitMemTransferInst(llvm::MemTransferInst &I)
+   {
+   // CopyMemory has memmove semantics, so it serves llvm.memcpy as well
+   _builder->CopyMemory(
+               getIlValue(I.getRawDest()),
+               getIlValue(I.getRawSource()),
+               getIlValue(I.getLength()));
+   }
+
+void
+IRVisitor::visitMemSetInst(llvm::MemSetInst &I)
+   {
+   _builder->SetMemory(
+               getIlValue(I.getRawDest()),
+               getIlValue(I.getValue()),
+               getIlValue(I.getLength()));
+   }
+
+void
+IRVisitor::visitDbgInfoIntrinsic(llvm::DbgInfoIntrinsic &I)
+   {
+   // debug info has no JitBuilder equivalent
+   }
+
+void
+IRVisitor::visitIntrinsicInst(llvm::IntrinsicInst &I)
+   {
+   TR::IlValue * result = nullptr;
+   switch (I.getIntrinsicID())
+      {
+      case llvm::Intrinsic::lifetime_start:
+      case llvm::Intrinsic::lifetime_end:
+      case llvm::Intrinsic::assume:
+#if LLVM_VERSION_MAJOR >= 12
+      case llvm::Intrinsic::experimental_noalias_scope_decl:
+#endif
+         return; // optimizer hints only
+
+      case llvm::Intrinsic::sqrt:
+         result = _builder->Sqrt(getIlValue(I.getArgOperand(0)));
+         break;
+      case llvm::Intrinsic::fabs:
+#if LLVM_VERSION_MAJOR >= 12
+      case llvm::Intrinsic::abs:
+#endif
+         result = _builder->Abs(getIlValue(I.getArgOperand(0)));
+         break;
+      // Floating point Min and Max, scalar or vector, return the non-NaN
+      // operand when exactly one operand is NaN, as minnum and maxnum require
+      case llvm::Intrinsic::minnum:
+#if LLVM_VERSION_MAJOR >= 12
+      case llvm::Intrinsic::smin:
+#endif
+         result = _builder->Min(getIlValue(I.getArgOperand(0)), getIlValue(I.getArgOperand(1)));
+         break;
+      case llvm::Intrinsic::maxnum:
+#if LLVM_VERSION_MAJOR >= 12
+      case llvm::Intrinsic::smax:
+#endif
+         result = _builder->Max(getIlValue(I.getArgOperand(0)), getIlValue(I.getArgOperand(1)));
+         break;
+#if LLVM_VERSION_MAJOR >= 12
+      case llvm::Intrinsic::umin:
+      case llvm::Intrinsic::umax:
+         {
+         // there are no unsigned min/max services, so select on an unsigned compare
+         assert(!I.getType()->isVectorTy() && "Unsigned vector min/max is not supported");
+         TR::IlValue * lhs = getIlValue(I.getArgOperand(0));
+         TR::IlValue * rhs = getIlValue(I.getArgOperand(1));
+         TR::IlValue * lhsIsLess = _builder->UnsignedLessThan(lhs, rhs);
+         if (I.getIntrinsicID() == llvm::Intrinsic::umin)
+            result = _builder->Select(lhsIsLess, lhs, rhs);
+         else
+            result = _builder->Select(lhsIsLess, rhs, lhs);
+         }
+         break;
+#endif
+      case llvm::Intrinsic::fmuladd:
+         // fmuladd leaves fusing up to the code generator, so a separate
+         // multiply and add is a valid implementation (unlike llvm.fma)
+         result = _builder->Add(
+                     _builder->Mul(getIlValue(I.getArgOperand(0)), getIlValue(I.getArgOperand(1))),
+                     getIlValue(I.getArgOperand(2)));
+         break;
+
+      case llvm::Intrinsic::LLJB_VECTOR_REDUCE(add):
+         result = _builder->VectorReduceAdd(getIlValue(I.getArgOperand(0)));
+         break;
+      case llvm::Intrinsic::LLJB_VECTOR_REDUCE(smin):
+      case llvm::Intrinsic::LLJB_VECTOR_REDUCE(fmin):
+         result = _builder->VectorReduceMin(getIlValue(I.getArgOperand(0)));
+         break;
+      case llvm::Intrinsic::LLJB_VECTOR_REDUCE(smax):
+      case llvm::Intrinsic::LLJB_VECTOR_REDUCE(fmax):
+         result = _builder->VectorReduceMax(getIlValue(I.getArgOperand(0)));
+         break;
+
+      default:
+         visitInstruction(I);
+         break;
+      }
+   _methodBuilder->mapIRtoIlValue(&I, result);
+   }
+
 TR::IlValue *
 IRVisitor::createConstIntIlValue(llvm::Value * value)
    {
@@ -565,11 +802,145 @@ IRVisitor::createConstantDataArrayVal(llvm::Value * value)
    return ilValue;
    }
 
+TR::IlValue *
+IRVisitor::createConstVectorIlValue(llvm::Value * value)
+   {
+   TR::IlValue * ilValue = nullptr;
+   llvm::Constant * constVector = llvm::dyn_cast<llvm::Constant>(value);
+   llvm::Type * laneType = value->getType()->getScalarType();
+   llvm::Constant * splatValue = constVector->getSplatValue();
+   if (splatValue)
+      {
+      ilValue = _builder->VectorSplat(getIlValue(splatValue));
+      }
+   else
+      {
+      // build the vector in a local array, one constant lane at a time
+      unsigned numLanes = MethodBuilder::getVectorLength(value->getType());
+      TR::IlType * pLane = _td->PointerTo(_methodBuilder->getIlType(_td, laneType));
+      TR::IlValue * lanes = _builder->CreateLocalArray(numLanes, _methodBuilder->getIlType(_td, laneType));
+      for (unsigned i = 0; i < numLanes; i++)
+         {
+         llvm::Constant * element = constVector->getAggregateElement(i);
+         if (llvm::isa<llvm::UndefValue>(element)) continue;
+         _builder->StoreAt(
+                     _builder->IndexAt(pLane, lanes, _builder->ConstInt32(i)),
+                     getIlValue(element));
+         }
+      ilValue = _builder->VectorLoadAt(pLane, lanes);
+      }
+   return ilValue;
+   }
+
+TR::IlValue *
+IRVisitor::createLaneIndex(llvm::Value * index)
+   {
+   // JitBuilder lane indices are Int32, LLVM uses any integer type
+   llvm::ConstantInt * constIndex = llvm::dyn_cast<llvm::ConstantInt>(index);
+   if (constIndex)
+      return _builder->ConstInt32(constIndex->getZExtValue());
+   TR::IlValue * ilIndex = getIlValue(index);
+   if (!index->getType()->isIntegerTy(32))
+      ilIndex = _builder->ConvertTo(_td->Int32, ilIndex);
+   return ilIndex;
+   }
+
+TR::IlValue *
+IRVisitor::spillVector(llvm::Value * vector)
+   {
+   TR::IlValue * lanes = _builder->CreateLocalArray(
+                                    MethodBuilder::getVectorLength(vector->getType()),
+                                    _methodBuilder->getIlType(_td, vector->getType()->getScalarType()));
+   _builder->VectorStoreAt(lanes, getIlValue(vector));
+   return lanes;
+   }
+
+TR::IlValue *
+IRVisitor::createMinMaxFromSelect(llvm::SelectInst &I)
+   {
+   // clang vectorizes a > b ? a : b into a lane mask compare feeding a select.
+   // Without a mask type, the only vector selects supported are min and max.
+   llvm::CmpInst * compare = llvm::dyn_cast<llvm::CmpInst>(I.getCondition());
+   assert(compare && "Vector select must be controlled by a compare");
+   llvm::Value * lhs = compare->getOperand(0);
+   llvm::Value * rhs = compare->getOperand(1);
+
+   bool selectsGreater = false;
+   switch (compare->getPredicate())
+      {
+      case llvm::CmpInst::Predicate::ICMP_SGT:
+      case llvm::CmpInst::Predicate::ICMP_SGE:
+      case llvm::CmpInst::Predicate::FCMP_OGT:
+      case llvm::CmpInst::Predicate::FCMP_OGE:
+         selectsGreater = true;
+         break;
+      case llvm::CmpInst::Predicate::ICMP_SLT:
+      case llvm::CmpInst::Predicate::ICMP_SLE:
+      case llvm::CmpInst::Predicate::FCMP_OLT:
+      case llvm::CmpInst::Predicate::FCMP_OLE:
+         selectsGreater = false;
+         break;
+      default:
+         llvm::outs() << "Instruction being visited: " << I << "\n";
+         assert(0 && "Unsupported vector select predicate");
+         break;
+      }
+
+   if (I.getTrueValue() == rhs && I.getFalseValue() == lhs)
+      selectsGreater = !selectsGreater;
+   else
+      assert(I.getTrueValue() == lhs && I.getFalseValue() == rhs && "Vector select is not a min or max");
+
+   if (selectsGreater)
+      return _builder->Max(getIlValue(lhs), getIlValue(rhs));
+   return _builder->Min(getIlValue(lhs), getIlValue(rhs));
+   }
+
+TR::IlValue *
+IRVisitor::loadLocal(char * name, llvm::Type * type)
+   {
+   if (type->isVectorTy())
+      return _builder->VectorLoad(name);
+   return _builder->Load(name);
+   }
+
+void
+IRVisitor::storeLocal(char * name, llvm::Type * type, TR::IlValue * value)
+   {
+   if (type->isVectorTy())
+      _builder->VectorStore(name, value);
+   else
+      _builder->Store(name, value);
+   }
+
+void
+IRVisitor::storePhiValues(llvm::BasicBlock * predecessor, llvm::BasicBlock * successor)
+   {
+   std::vector<std::pair<llvm::PHINode *, TR::IlValue *> > incoming;
+   for (llvm::PHINode &phi : successor->phis())
+      {
+      if (phi.getType()->isIntegerTy(1)) continue; // see visitPHINode
+      incoming.push_back(std::make_pair(&phi, getIlValue(phi.getIncomingValueForBlock(predecessor))));
+      }
+   for (auto &entry : incoming)
+      {
+      storeLocal(_methodBuilder->getLocalNameFromValue(entry.first), entry.first->getType(), entry.second);
+      }
+   }
+
 TR::IlValue *
 IRVisitor::getIlValue(llvm::Value * value)
    {
    TR::IlValue * ilValue = _methodBuilder->getIlValue(value);
    if (ilValue) return ilValue;
+
+   // undefined values (and poison, which derives from undef) may take any
+   // value, so materialize them as zero
+   if (llvm::isa<llvm::UndefValue>(value))
+      return getIlValue(llvm::Constant::getNullValue(value->getType()));
+   if (value->getType()->isVectorTy() && llvm::isa<llvm::Constant>(value))
+      return createConstVectorIlValue(value);
+
    switch (value->getValueID())
       {
       /* Constants */
@@ -596,9 +967,10 @@ IRVisitor::getIlValue(llvm::Value * value)
       case llvm::Value::ValueTy::ConstantDataArrayVal:
          ilValue = createConstantDataArrayVal(value);
          break;
-      case llvm::Value::ValueTy::ConstantAggregateZeroVal:
-      case llvm::Value::ValueTy::ConstantDataVectorVal:
       case llvm::Value::ValueTy::ConstantPointerNullVal:
+         ilValue = _builder->NullAddress();
+         break;
+      case llvm::Value::ValueTy::ConstantAggregateZeroVal:
       case llvm::Value::ValueTy::ConstantTokenNoneVal:
          assert(0 && "Unsupported constant data value type");
          break;
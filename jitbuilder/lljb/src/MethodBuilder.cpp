@@ -61,6 +61,7 @@ MethodBuilder::buildIL()
    State * state = new State();
    setVMState(state);
    assignBuildersToBasicBlocks();
+   allocatePhiLocals();
 
    TR::BytecodeBuilder * firstBuilder = _BBToBuilderMap[&(_function.getEntryBlock())];
    assert (firstBuilder && "first builder not found!");
@@ -81,6 +82,8 @@ TR::IlType *
 MethodBuilder::getIlType(TR::TypeDictionary * td, llvm::Type * type)
    {
    TR::IlType * ilType = nullptr;
+   if (type->isVectorTy()) // SIMD "packed" format, or other vector types
+      return getVectorIlType(td, type);
    switch (type->getTypeID())
       {
       case llvm::Type::TypeID::IntegerTyID: // arbitrary bitwidth integers
@@ -116,7 +119,6 @@ MethodBuilder::getIlType(TR::TypeDictionary * td, llvm::Type * type)
       case llvm::Type::TypeID::X86_MMXTyID: // 64-bit MMX vectors -- X86
       case llvm::Type::TypeID::TokenTyID: // Tokens
       case llvm::Type::TypeID::FunctionTyID: // Functions
-      case llvm::Type::TypeID::VectorTyID: // SIMD "packed" format, or other vector types
       case llvm::Type::TypeID::MetadataTyID: // Metadata type
       default:
          llvm::outs() << "invalid type: " << *type << "\n";
@@ -126,6 +128,34 @@ MethodBuilder::getIlType(TR::TypeDictionary * td, llvm::Type * type)
    return ilType;
    }
 
+TR::IlType *
+MethodBuilder::getVectorIlType(TR::TypeDictionary * td, llvm::Type * type)
+   {
+   // OMR vector IL is 128 bits wide, which is also the width clang picks for
+   // auto-vectorized loops when targeting baseline x86-64 (SSE2)
+   TR::IlType * ilType = nullptr;
+   llvm::Type * laneType = type->getScalarType();
+   if (getVectorLength(type) * laneType->getScalarSizeInBits() != 128)
+      {
+      llvm::outs() << "invalid vector type: " << *type << "\n";
+      assert(0 && "Only 128-bit vector types are supported");
+      }
+   if (laneType->isIntegerTy(8)) ilType = td->VectorInt8;
+   else if (laneType->isIntegerTy(16)) ilType = td->VectorInt16;
+   else if (laneType->isIntegerTy(32)) ilType = td->VectorInt32;
+   else if (laneType->isIntegerTy(64)) ilType = td->VectorInt64;
+   else if (laneType->isFloatTy()) ilType = td->VectorFloat;
+   else if (laneType->isDoubleTy()) ilType = td->VectorDouble;
+   else assert(0 && "Unsupported vector lane type");
+   return ilType;
+   }
+
+unsigned
+MethodBuilder::getVectorLength(llvm::Type * type)
+   {
+   return type->getPrimitiveSizeInBits() / type->getScalarSizeInBits();
+   }
+
 void
 MethodBuilder::assignBuildersToBasicBlocks()
    {
@@ -139,6 +169,23 @@ MethodBuilder::assignBuildersToBasicBlocks()
       }
    }
 
+void
+MethodBuilder::allocatePhiLocals()
+   {
+   // Every phi node gets a local that the predecessors store their incoming
+   // value into before branching. The locals have to exist before any block is
+   // visited because a loop latch can be visited ahead of the loop header.
+   // Phi nodes of i1 type are still handled by IRVisitor::visitPHINode.
+   for (llvm::BasicBlock &BB : _function)
+      {
+      for (llvm::PHINode &phi : BB.phis())
+         {
+         if (!phi.getType()->isIntegerTy(1))
+            allocateLocal(&phi, getIlType(typeDictionary(), phi.getType()));
+         }
+      }
+   }
+
 void
 MethodBuilder::defineParameters()
    {